@@ -0,0 +1,800 @@
+#!/usr/bin/bash
+
+###########################################################
+# Name: anotateASFV.sh
+#   - annotates a genome uses genes from a known sequence
+# Input:
+#  -gene genes.fasta: [Required]
+#    o fasta file with genes to annotate with.
+#      - should be full gene (start codon to end codon)
+#      - for non-coding regions ignore the error messages
+#  -ref genome.fasta: [Required]
+#    o genome to annotate
+#  -prefix out:
+#    o prefix to add to output file names 
+#  -reads reads.fastq:
+#    o reads to map to -ref; the consensus from the
+#      mapped reads is annotated instead of -ref
+# Ouput:
+#  - prefix-scores.tsv:
+#    o tsv file with the scores for each genes possible
+#      mappings
+#  - prefix-highScores.tsv:
+#    o tsv file with the selected best score(s) for each
+#      gene
+#  - prefix-ntSequences.fa
+#    o fasta file with nucleotide sequence (coordinates
+#      are from prefix-highScores)
+#  - prefix-aaSequences.fa
+#    o fasta file with the amino acid sequences for each
+#      sequence in prefix-ntSequences.fa
+#  - prefix-featureTable.tsv:
+#    o Genbank feature table. Positions that you need to
+#      select an alignment for are labled with
+#      WARNING_ERROR
+#  - prefix-featureErrors.aln:
+#    o list annotations that need to be double checked
+#      * dupications (make final decision)
+#      * incomplete reading frames (missing start/stop)
+###########################################################
+
+
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+# anotateASFV.sh SOF: Start Of File
+#  - annotates a genome
+#  o sec01:
+#    - variable declerations
+#  o sec02:
+#    - get and check user input
+#  o sec03:
+#    - Annotation
+#  o sec04:
+#    - Remove temporary files, translate sequences and
+#      detect if reading frames are complete
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec01:
+#  - Variable declerations
+#  o sec01 sub01:
+#    - general variables
+#  o sec01 sub02:
+#    - help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec01 Sub01:
+#   - general variables
+#**********************************************************
+
+genesStr="$1";  # fasta data base of genes to use
+             # Each sequence is on one line
+refStr="$2"; # Fasta file with genome to annotate
+prefixStr="$3"; # Prefix to call everything by
+fastBl=1;    # use demux
+traceStr=""; # file to save trace events to
+percScoreStr="0.90"; # min percent score for a mapping
+kmerLenStr="7";      # demux kmer length (-fast)
+kmerPercStr="0.60";  # demux min percent kmers (-fast)
+seedStr="0";         # memwaterScan seed kmer length (-slow)
+
+readsStr="";     # reads to build a consensus (-ref) from
+threadsStr="1";  # threads mapRead uses (-reads)
+readTypeStr="";  # -fq or -fa (type of -reads file)
+
+cacheStr="";     # directory to cache gene mappings in
+hashCmdStr="";   # sha256sum or cksum for cache keys
+setKeyStr="";    # hash of settings, genome, and programs
+keyStr="";       # cache key for the current gene
+mapProgStr="";   # demux or memwaterScan (for cache key)
+cacheHitSI=0;    # number of genes found in the cache
+
+prevRefStr="";    # older version of the genome (-ref)
+prevScoresStr=""; # scores.tsv from older genome
+geneIdStr="";     # id of the current gene
+reuseBl=0;        # 1: reusing mappings for current gene
+shiftHitSI=0;     # genes with mappings from -prev-scores
+
+iCnt=1;       # Counter for my loop
+numGenesI=0;  # number of genes in genesStr
+scriptDirStr="$(dirname "$0")";
+
+#**********************************************************
+# Sec01 Sub02:
+#   - help message
+#**********************************************************
+
+helpStr="bash $(basename "$0") -gene genes.fa -ref genome.fa -prefix <good_name>
+ Use:
+  - Annotates an ASFV genome
+  - This should be used as a guide, not a solution. Make
+    sure you check all output. There will be some mistakes.
+ Input:
+  -gene genes.fasta: [Required]
+    o Fasta file with genes to annotate with. Each gene
+      should start with atg and end with a stop codon.
+      - For non-coding regions ignore the error messages
+      - use >non-coding<id> for non-coding regions
+      - remove duplicate entries
+  -ref genome.fasta: [Required]
+    o Genome to annotate
+  -prefix $prefixStr:
+    o Prefix to add to output file names 
+  -reads reads.fastq: [Optional; not used]
+    o map reads to -ref with mapRead and annotate the
+      consensus (prefix-con.fa) instead of -ref
+    o the mapped reads are saved to prefix-reads.sam
+    o -ref should be a close (same genotype) genome
+  -threads $threadsStr:
+    o number of threads mapRead uses (-reads only)
+  -fast yes:
+    o use the gene coordinate detection in demux to speed
+      the gene search up
+    o disable with -slow
+  -trace trace.json: [Optional; not used]
+    o save the time spent in each step to trace.json
+      (open with chrome://tracing or ui.perfetto.dev)
+    o -slow only traces extractGenes
+  -perc-score $percScoreStr:
+    o minimum percent score to keep a mapping
+  -kmer-len $kmerLenStr:
+    o kmer length demux uses to find genes (-fast only)
+  -kmer-perc $kmerPercStr:
+    o minimum percent of kmers demux needs to align a
+      window (-fast only)
+  -seed $seedStr:
+    o kmer length memwaterScan seeds alignments with
+      (-slow only); only aligns genes to the genome
+      windows that have chains of exact kmer matches
+    o 0 does a full waterman alignment, 13 is a good
+      starting point (much faster, but may miss very
+      divergent mappings)
+  -cache directory: [Optional; not used]
+    o save the mappings for each gene to directory and
+      reuse them in later runs
+    o a gene is only reused if its sequence, the genome,
+      the settings (-fast/-slow, -perc-score, -kmer-len,
+      -kmer-perc, -seed), and the mapping programs are
+      the same
+    o delete the directory to clear the cache
+  -prev-ref old-genome.fasta: [Optional; not used]
+    o older version of -ref (before polishing); use with
+      -prev-scores to only remap genes in changed regions
+    o only genes that had a mapping in a changed region
+      or had no mappings are remapped; the other mappings
+      are shifted to the -ref coordinates
+    o both genomes should have one sequence
+  -prev-scores old-scores.tsv: [Optional; not used]
+    o prefix-scores.tsv from annotating -prev-ref with the
+      same -gene file and settings
+ Ouput:
+  - prefix-con.fa and prefix-reads.sam (-reads only)
+    o consensus that was annotated and the mapped reads
+  - prefix-seq.fa
+    o Fasta file with the acid sequences. All sequences
+      start with a stop codon (so are reversed).
+      - Header: >sequenceName-start-end-forward/reverse
+      - forward = 1; reverse = 0
+  - prefix-aa.fa
+    o Fasta file with the translated amino acid sequences
+      for each annotation (ignore non-gene annotations).
+  - prefix-feat.tbl:
+    o Genbank feature table. Positions that you need to
+      select an alignment for are labled with ALT-FIX
+  - prefix-scores.tsv:
+    o tsv file with the selected alignments and possible
+      alternative alignments.
+  - prefix-map.aln:
+    o File with the individual alignments for each feature
+  - prefix-error.tsv:
+    o tsv file with all the features that need to be fixed
+ Requires:
+  - several programs with bioTools, which should be
+    included in the repository
+  - standard unix programs. You already have these unless
+    your using windows. In which case use the linux shell.
+"; # Help message
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec02:
+#   - get and check user input
+#   o sec02 sub01:
+#     - get user input
+#   o sec02 sub02:
+#     - check user input
+#   o sec02 sub03:
+#     - build consensus from reads (-reads)
+#   o sec02 sub04:
+#     - set up the mapping cache
+#   o sec02 sub05:
+#     - find changed regions for -prev-ref
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#*********************************************************
+# Sec02 Sub01:
+#   - get user input
+#*********************************************************
+
+while [ $# -gt 0 ];
+do   # Loop: get input
+   if [ "$1" = "-ref" ]; then
+      shift;
+      refStr="$1";
+   elif [ "$1" = "-gene" ]; then
+      shift;
+      genesStr="$1";
+   elif [ "$1" = "-prefix" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-out" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-o" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-fast" ]; then
+      fastBl=1;
+   elif [ "$1" = "-slow" ]; then
+      fastBl=0;
+   elif [ "$1" = "-trace" ]; then
+      shift;
+      traceStr="$1";
+   elif [ "$1" = "-perc-score" ]; then
+      shift;
+      percScoreStr="$1";
+   elif [ "$1" = "-kmer-len" ]; then
+      shift;
+      kmerLenStr="$1";
+   elif [ "$1" = "-kmer-perc" ]; then
+      shift;
+      kmerPercStr="$1";
+   elif [ "$1" = "-seed" ]; then
+      shift;
+      seedStr="$1";
+   elif [ "$1" = "-cache" ]; then
+      shift;
+      cacheStr="$1";
+   elif [ "$1" = "-prev-ref" ]; then
+      shift;
+      prevRefStr="$1";
+   elif [ "$1" = "-prev-scores" ]; then
+      shift;
+      prevScoresStr="$1";
+   elif [ "$1" = "-reads" ]; then
+      shift;
+      readsStr="$1";
+   elif [ "$1" = "-threads" ]; then
+      shift;
+      threadsStr="$1";
+
+   elif [ "$1" = "-h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "-help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+
+   else
+      printf "%s is not recongnized" "$1"; exit;
+   fi;
+
+   shift;
+done # Loop: get input
+
+#*********************************************************
+# Sec02 Sub02:
+#   - check user input
+#*********************************************************
+
+if [ "$prefixStr" = "" ]; then prefixStr="ASFV"; fi;
+
+if [ ! -f "$refStr" ]; then
+   printf\
+      "could not open genome to annotate (%s).\n"\
+      "$refStr";
+   exit;
+fi # If an invalid genome was input
+
+if [ ! -f "$genesStr" ]; then
+  {
+     printf "could not fasta file with genes to annotate";
+     printf " with (%s)\n" "$refStr";
+  }
+
+  exit;
+fi # If an invalid deta base was input
+
+if [ "$traceStr" != "" ] && [ -f "$traceStr" ]; then
+   rm "$traceStr"; # programs append to the trace file
+fi;
+
+#*********************************************************
+# Sec02 Sub03:
+#   - build consensus from reads (-reads)
+#*********************************************************
+
+if [ "$readsStr" != "" ];
+then # If: annotating a consensus from reads
+   if [ ! -f "$readsStr" ]; then
+      printf "could not open -reads %s\n" "$readsStr";
+      exit;
+   fi;
+
+   if head -n 1 "$readsStr" | grep -q "^>"; then
+      readTypeStr="-fa";
+   else
+      readTypeStr="-fq";
+   fi;
+
+   "$scriptDirStr/mapRead" \
+      -ref "$refStr" \
+      "$readTypeStr" "$readsStr" \
+      -threads "$threadsStr" \
+      -sam "$prefixStr-reads.sam" \
+      -con "$prefixStr-con.fa" ||
+      exit;
+
+   refStr="$prefixStr-con.fa";
+fi; # If: annotating a consensus from reads
+
+#*********************************************************
+# Sec02 Sub04:
+#   - set up the mapping cache
+#*********************************************************
+
+if [ "$cacheStr" != "" ];
+then # If: caching gene mappings
+   if [ ! -d "$cacheStr" ]; then
+      mkdir -p "$cacheStr" || exit;
+   fi;
+
+   if command -v sha256sum > /dev/null 2>&1; then
+      hashCmdStr="sha256sum";
+   else
+      hashCmdStr="cksum"; # posix, but only a 32 bit crc
+   fi;
+
+   # settings key; the mapping programs are included, so
+   # a rebuild (or edit to mapGene.sh) will not reuse
+   # older mappings
+   if [ "$fastBl" -ge 1 ]; then
+      setKeyStr="fast $percScoreStr $kmerLenStr $kmerPercStr";
+      mapProgStr="$scriptDirStr/demux";
+   else
+      setKeyStr="slow $percScoreStr $seedStr";
+      mapProgStr="$scriptDirStr/memwaterScan";
+   fi;
+
+   setKeyStr="$(       {
+         printf "%s\n" "$setKeyStr";
+         "$hashCmdStr" < "$refStr";
+         "$hashCmdStr" < "$mapProgStr";
+         "$hashCmdStr" < "$scriptDirStr/mapGene.sh";
+      } |
+        "$hashCmdStr" |
+        awk '{if($2 == "-") print $1; else print $1 "_" $2;}' \
+   )";
+fi; # If: caching gene mappings
+
+#*********************************************************
+# Sec02 Sub05:
+#   - find changed regions for -prev-ref
+#*********************************************************
+
+if [ "$prevRefStr" != "" ] || [ "$prevScoresStr" != "" ];
+then # If: only remapping genes in changed regions
+   if [ ! -f "$prevRefStr" ]; then
+      printf "could not open -prev-ref %s\n" "$prevRefStr";
+      exit;
+   fi;
+
+   if [ ! -f "$prevScoresStr" ]; then
+      printf "could not open -prev-scores %s\n" \
+         "$prevScoresStr";
+      exit;
+   fi;
+
+   # one base per line, so diff gives the changed bases
+   grep -v "^>" "$prevRefStr" |
+     tr -d "\r\n" |
+     tr "[:lower:]" "[:upper:]" |
+     fold -w 1 \
+     > "$prefixStr-tmpPrevRef.txt";
+
+   grep -v "^>" "$refStr" |
+     tr -d "\r\n" |
+     tr "[:lower:]" "[:upper:]" |
+     fold -w 1 \
+     > "$prefixStr-tmpRef.txt";
+
+   # diff returns 1 for differences, so no error check
+   diff "$prefixStr-tmpPrevRef.txt" "$prefixStr-tmpRef.txt" |
+     grep "^[0-9]" \
+     > "$prefixStr-tmpDiff.txt";
+
+   rm "$prefixStr-tmpPrevRef.txt" "$prefixStr-tmpRef.txt";
+
+   # shift mappings to new coordinates and find the
+   # genes with mappings in changed regions
+   awk \
+       -v remapFileStr="$prefixStr-tmpRemap.txt" \
+       '
+          BEGIN{
+             FS = "\t";
+             OFS = "\t";
+             numHunkSI = 0;
+             printf "" > remapFileStr; # make empty file
+          };
+
+          FNR == NR{ # diff hunk (old[,end]{a,c,d}new[,end])
+             typeStr = $0;
+             sub(/^[0-9,]*/, "", typeStr);
+             typeStr = substr(typeStr, 1, 1);
+
+             split($0, posAryStr, /[acd]/);
+             if(split(posAryStr[1], oldArySI, ",") < 2)
+                oldArySI[2] = oldArySI[1];
+             if(split(posAryStr[2], newArySI, ",") < 2)
+                newArySI[2] = newArySI[1];
+
+             ++numHunkSI;
+             startArySI[numHunkSI] = oldArySI[1];
+             endArySI[numHunkSI] = oldArySI[2];
+             shiftArySI[numHunkSI] = 1 + newArySI[2];
+             shiftArySI[numHunkSI] -= newArySI[1];
+
+             # insertions are between two bases
+             if(typeStr == "a")
+                endArySI[numHunkSI] = oldArySI[1] + 1;
+             else if(typeStr == "d")
+                shiftArySI[numHunkSI] = 0;
+
+             if(typeStr != "a")
+                shiftArySI[numHunkSI] -= 1 + oldArySI[2] - oldArySI[1];
+
+             next;
+          }; # diff hunk
+
+          FNR == 1{next;}; # scores.tsv header
+
+          { # MAIN: shift or mark each old mapping
+             shiftSI = 0;
+
+             for(siHunk = 1; siHunk <= numHunkSI; ++siHunk)
+             { # Loop: apply changes before mapping
+                if(endArySI[siHunk] < $5 - 1)
+                   shiftSI += shiftArySI[siHunk];
+                else if(startArySI[siHunk] <= $6 + 1)
+                   remapAryBl[$1] = 1; # mapping changed
+                else
+                   break; # hunks are sorted
+             } # Loop: apply changes before mapping
+
+             $5 += shiftSI;
+             $6 += shiftSI;
+             print $0;
+          }; # MAIN: shift or mark each old mapping
+
+          END{
+             for(geneStr in remapAryBl)
+                print geneStr > remapFileStr;
+          };
+       ' \
+       "$prefixStr-tmpDiff.txt" \
+       "$prevScoresStr" \
+     > "$prefixStr-tmpPrevScores.tsv";
+
+   # genes with the same id can not be told apart in
+   # -prev-scores, so always remap them (same header
+   # clean up as sec03 sub01)
+   awk \
+       '
+          /^>/{
+             sub(/>gene /, ">", $0);
+             sub(/>CDS /, ">", $0);
+             sub(/\/gene=/, "", $0);
+             gsub(/"/, "", $0);
+             gsub(/[ \t]/, "_", $0);
+             sub(/^>/, "", $0);
+             ++idCntArySI[$0];
+          };
+
+          END{
+             for(idStr in idCntArySI)
+                if(idCntArySI[idStr] > 1)
+                   print idStr;
+          };
+       ' "$genesStr" \
+     >> "$prefixStr-tmpRemap.txt";
+
+   printf "%s changed regions between %s and %s\n" \
+      "$(wc -l < "$prefixStr-tmpDiff.txt")" \
+      "$prevRefStr" \
+      "$refStr";
+
+   rm "$prefixStr-tmpDiff.txt";
+fi; # If: only remapping genes in changed regions
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec03:
+#  - annotation
+#  o sec03 sub01:
+#    - find number genes + start loop + extract each gene
+#  o sec03 sub02:
+#    - get mappings for the gene
+#  o sec03 sub03:
+#    - get high scoring mapping(s) + merge scores + clean
+#  o sec03 sub04:
+#    - extract genes from genome, tanslate, and build
+#      feature table
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec03 Sub01:
+#  - find number genes + start loop + extract each gene
+#**********************************************************
+
+numGenesI="$(grep -c '>' "$genesStr")";
+iCnt=0;
+while [ "$iCnt" -lt "$numGenesI" ];
+do # Loop: git hits and extract genes in reference
+   iCnt="$((iCnt + 1))";
+
+   # extract the sequence
+   awk \
+       -v targSI="$iCnt" \
+       '
+          BEGIN{seqOneSI = 0; headBl = 1;};
+
+          { # MAIN
+             if($1 ~ /^>/)
+                ++seqOnSI;
+
+             if(seqOnSI == targSI)
+             { # If: On the correct sequence
+                if(headBl == 1)
+                { # If: on the header
+                   headBl = 0;
+                   sub(/>gene /, ">", $0);
+                   sub(/>CDS /, ">", $0);
+                   sub(/\/gene=/, "", $0);
+                   gsub(/"/, "", $0);
+                   gsub(/[ \t]/, "_", $0);
+                   print $0;
+                } # If: on the header
+
+                else
+                  print $0;
+             } # If: On the correct sequence
+
+             else if(seqOneSI > targSI)
+                exit; # past the correct sequence
+          } # MAIN
+       ' "$genesStr" \
+     > "$prefixStr-tmpQryForward.fa";
+
+   printf "on gene %s\n" \
+       "$(head -n 1 "$prefixStr-tmpQryForward.fa")";
+
+   #*******************************************************
+   # Sec03 Sub02:
+   #  - get mappings for the gene
+   #*******************************************************
+
+   if [ -f "$prefixStr-scores.tsv" ]; then
+      tmpPrefixStr="$prefixStr-delete-tmp";
+   else
+      tmpPrefixStr="$prefixStr";
+   fi;
+
+   if [ "$cacheStr" != "" ]; then
+      keyStr="$( \
+         {
+            printf "%s\n" "$setKeyStr";
+            cat "$prefixStr-tmpQryForward.fa";
+         } |
+           "$hashCmdStr" |
+           awk '{if($2 == "-") print $1; else print $1 "_" $2;}' \
+      )";
+   fi;
+
+   reuseBl=0;
+
+   if [ -f "$prefixStr-tmpHigh.tsv" ]; then
+      rm "$prefixStr-tmpHigh.tsv";
+   fi;
+
+   if [ "$cacheStr" != "" ] &&
+      [ -f "$cacheStr/$keyStr-scores.tsv" ];
+   then # If: have mappings for this gene in the cache
+      cacheHitSI="$((cacheHitSI + 1))";
+      reuseBl=1;
+      cp \
+         "$cacheStr/$keyStr-scores.tsv" \
+         "$prefixStr-tmpReuse.tsv";
+
+   elif [ "$prevScoresStr" != "" ];
+   then # Else If: may have shifted -prev-scores mappings
+      geneIdStr="$( \
+         awk '{sub(/^>/, ""); print $1; exit;}' \
+            "$prefixStr-tmpQryForward.fa" \
+      )";
+
+      if ! grep -q -x -F "$geneIdStr" \
+           "$prefixStr-tmpRemap.txt";
+      then # If: no mappings in changed regions
+         awk \
+            -v geneStr="$geneIdStr" \
+            'BEGIN{FS = "\t";}; $1 == geneStr{print $0;};' \
+            "$prefixStr-tmpPrevScores.tsv" \
+           > "$prefixStr-tmpReuse.tsv";
+
+         if [ -s "$prefixStr-tmpReuse.tsv" ]; then
+            shiftHitSI="$((shiftHitSI + 1))";
+            reuseBl=1;
+         else
+            rm "$prefixStr-tmpReuse.tsv";
+         fi; # else had no mappings, so remap
+      fi; # If: no mappings in changed regions
+   fi; # check if can reuse mappings
+
+   if [ "$reuseBl" -ge 1 ];
+   then # If: reusing mappings for this gene
+      { # same header as mapGene.sh
+         printf "gene_id\tgene_direction\tscore\tmax_score";
+         printf "\tref_start\tref_end";
+         printf "\tqry_start\tqry_end\tqry_len\taln_len\n";
+         cat "$prefixStr-tmpReuse.tsv";
+      } > "$tmpPrefixStr-scores.tsv";
+
+      rm "$prefixStr-tmpReuse.tsv";
+
+   elif [ "$fastBl" -ge 1 ];
+   then # Else If: using faster demux
+      sh "$scriptDirStr/mapGene.sh" \
+         -ref "$refStr" \
+         -gene "$prefixStr-tmpQryForward.fa" \
+         -fast \
+         -perc-score "$percScoreStr" \
+         -kmer-len "$kmerLenStr" \
+         -kmer-perc "$kmerPercStr" \
+         ${traceStr:+-trace} ${traceStr:+"$traceStr"} \
+         -high "$prefixStr-tmpHigh.tsv" \
+         -prefix "$tmpPrefixStr";
+   
+   else
+   # Else: using slower waterman
+      # memwaterScan maps both directions, so there is no
+      # need for a reverse complement gene file
+      sh "$scriptDirStr/mapGene.sh" \
+         -ref "$refStr" \
+         -gene "$prefixStr-tmpQryForward.fa" \
+         -slow \
+         -perc-score "$percScoreStr" \
+         -seed "$seedStr" \
+         -high "$prefixStr-tmpHigh.tsv" \
+         -prefix "$tmpPrefixStr";
+   # Else: using slower waterman
+   fi;
+
+   if [ "$cacheStr" != "" ] && [ "$reuseBl" -lt 1 ];
+   then # If: saving the mappings to the cache
+      # temporary file + mv, so a stopped run does not
+      # leave a partial entry in the cache
+      tail -n+2 "$tmpPrefixStr-scores.tsv" \
+        > "$cacheStr/$keyStr-scores.tsv.tmp" &&
+        mv \
+           "$cacheStr/$keyStr-scores.tsv.tmp" \
+           "$cacheStr/$keyStr-scores.tsv";
+   fi; # If: saving the mappings to the cache
+
+   #******************************************************
+   # Sec03 Sub03:
+   #  - get high scoring mapping(s) + merge scores + clean
+   #******************************************************
+
+   if [ ! -f "$prefixStr-highScores.tsv" ]; then
+      head -n 1 "$tmpPrefixStr-scores.tsv" \
+        > "$prefixStr-highScores.tsv";
+   fi;
+
+   numLinesSI="$( \
+      wc -l "$tmpPrefixStr-scores.tsv" | cut -d " " -f 1 \
+   )";
+   if [ "$numLinesSI" -gt 1 ];
+   then # If: had matches
+      # get the highscoring entries
+      if [ -f "$prefixStr-tmpHigh.tsv" ];
+      then # If: mapper found the high scoring entries
+         cat "$prefixStr-tmpHigh.tsv" \
+           >> "$prefixStr-highScores.tsv";
+
+      else
+      # Else: reused mappings (-cache or -prev-scores)
+         tail -n+2 "$tmpPrefixStr-scores.tsv" |
+           sort -r -n -k 3 |
+           awk '
+                 BEGIN{getline; print $0; highScoreSI=$3; };
+                 {if($3 == highScoreSI) print $0; else exit;}
+               ' >> "$prefixStr-highScores.tsv";
+      # Else: reused mappings (-cache or -prev-scores)
+      fi;
+
+      if [ "$tmpPrefixStr" = "$prefixStr" ]; then
+         tmpPrefixStr="";
+      else
+         tail -n+2 "$tmpPrefixStr-scores.tsv" \
+           >> "$prefixStr-scores.tsv";
+         rm "$tmpPrefixStr-scores.tsv";
+      fi;
+   else
+      if [ "$tmpPrefixStr" = "$prefixStr" ]; then
+         tmpPrefixStr="";
+      else
+         rm "$tmpPrefixStr-scores.tsv";
+      fi;
+   fi; # If: had matches
+
+   if [ -f "$prefixStr-tmpQryForward.fa" ]; then
+      rm "$prefixStr-tmpQryForward.fa";
+   fi;
+
+   if [ -f "$prefixStr-tmpHigh.tsv" ]; then
+      rm "$prefixStr-tmpHigh.tsv";
+   fi;
+done # Loop: git hits and extract genes in reference
+
+if [ "$prevScoresStr" != "" ]; then
+   rm "$prefixStr-tmpPrevScores.tsv" "$prefixStr-tmpRemap.txt";
+
+   printf "%s of %s genes were shifted from -prev-scores %s\n" \
+      "$shiftHitSI" \
+      "$numGenesI" \
+      "$prevScoresStr";
+fi;
+
+#*********************************************************
+# Sec03 Sub04:
+#  - extract genes from genome, tanslate, & build feature
+#    table
+#*********************************************************
+
+# check if we found any genes
+numLinesSI="$( \
+   wc -l "$prefixStr-highScores.tsv" | cut -d " " -f 1 \
+)";
+
+if [ "$numLinesSI" -le 1 ]; then
+   printf "no genes were found for -ref %s\n" "$refStr";
+
+   if [ -f "$traceStr" ]; then
+      printf "\n]\n" >> "$traceStr"; # close event array
+   fi;
+
+   exit;
+fi;
+
+# extract genes, translate, and build feature table
+"$scriptDirStr/extractGenes" \
+    -ref "$refStr" \
+    -hits "$prefixStr-highScores.tsv" \
+    -out "$prefixStr-ntSequences.fa" \
+    -aa "$prefixStr-aaSequences.fa" \
+    -feat "$prefixStr-featureTable.tsv" \
+    -feat-err "$prefixStr-featureErrors.tsv" \
+    ${traceStr:+-trace} ${traceStr:+"$traceStr"};
+
+if [ "$traceStr" != "" ]; then
+   printf "\n]\n" >> "$traceStr"; # close event array
+fi;
+
+if [ "$cacheStr" != "" ]; then
+   printf "%s of %s genes were from -cache %s\n" \
+      "$cacheHitSI" \
+      "$numGenesI" \
+      "$cacheStr";
+fi;
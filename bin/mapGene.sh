@@ -0,0 +1,225 @@
+#!/usr/bin/sh
+
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+# mapGene.sh:
+#   - maps a gene to a reference sequence or a consensus
+#   o sec01:
+#     - variable declarations
+#   o sec02:
+#     - get and check user input
+#   o sec03:
+#     - print header if no older file
+#   o sec04:
+#     - map gene to reference and filter hits
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec01:
+#   - variable declarations
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+refStr="";
+geneStr="";
+dirStr="forward";
+prefixStr="out";
+fastBl=1;
+traceStr="";
+highStr="";          # file to add highest scoring mapping(s) to
+percScoreStr="0.90"; # min percent score to keep a mapping
+kmerLenStr="7";      # demux kmer length (-fast)
+kmerPercStr="0.60";  # demux min percent kmers (-fast)
+seedStr="0";         # memwaterScan seed kmer length (-slow)
+scriptDirStr="$(dirname "$0")";
+
+helpStr="$(basename "$0") -ref reference.fa -gene gene.fa
+   - uses memwaterScan (or demux) to get alternative
+     mappings, then filters out the duplicate mappings
+Input:
+   -ref reference.fa: fasta file with the reference or
+      consensus sequence to get mappings for
+   -gene gene.fa: fasta file with gene to map to the
+      reference or consensus
+   -rev: in output scoring file, use reverse instead
+      of forwards (not used, both directions are always
+      mapped and the direction comes from the mapper)
+   -prefix $prefixStr: prefix to call the output file
+   -fast yes: use the faster kmer scaning method to hunt
+      for genes (disable with -slow)
+   -trace trace.json: [Optional; not used]
+      add demux's chrome/perfetto trace events (timings)
+      to trace.json (-fast only)
+   -perc-score $percScoreStr: minimum percent score to
+      keep a mapping
+   -kmer-len $kmerLenStr: kmer length demux uses to find
+      genes (-fast only)
+   -kmer-perc $kmerPercStr: minimum percent of kmers demux
+      needs to align a window (-fast only)
+   -seed $seedStr: memwaterScan seed kmer length; only
+      aligns to windows with kmer seeds (-slow only; 0 is
+      a full waterman, 13 is a good start)
+   -high high.tsv: [Optional; not used]
+      append the highest scoring mapping(s) to high.tsv
+      (no header is printed)
+Output:
+   - prefix-scores.tsv: has filtered mappings for the
+     gene to the reference
+   - high.tsv: has the highest scoring mapping(s) if
+     -high was used
+"
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec02:
+#   - get and check user input
+#   o sec02 sub01:
+#     - get user input
+#   o sec02 sub02:
+#     - check user input
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#*********************************************************
+# Sec02 Sub01:
+#   - get user input
+#*********************************************************
+
+while [ $# -gt 0 ];
+do   # Loop: get user input
+   if [ "$1" = "-ref" ]; then
+      shift;
+      refStr="$1";
+   elif [ "$1" = "-gene" ]; then
+      shift;
+      geneStr="$1";
+
+   elif [ "$1" = "-prefix" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-out" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-o" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-p" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-fast" ]; then
+      fastBl=1;
+   elif [ "$1" = "-slow" ]; then
+      fastBl=0;
+   elif [ "$1" = "-trace" ]; then
+      shift;
+      traceStr="$1";
+   elif [ "$1" = "-perc-score" ]; then
+      shift;
+      percScoreStr="$1";
+   elif [ "$1" = "-kmer-len" ]; then
+      shift;
+      kmerLenStr="$1";
+   elif [ "$1" = "-kmer-perc" ]; then
+      shift;
+      kmerPercStr="$1";
+   elif [ "$1" = "-seed" ]; then
+      shift;
+      seedStr="$1";
+   elif [ "$1" = "-high" ]; then
+      shift;
+      highStr="$1";
+
+   elif [ "$1" = "-r" ]; then
+      dirStr="reverse";
+   elif [ "$1" = "-rev" ]; then
+      dirStr="reverse";
+   elif [ "$1" = "-reverse" ]; then
+      dirStr="reverse";
+
+   elif [ "$1" = "-f" ]; then
+      dirStr="forward";
+   elif [ "$1" = "-for" ]; then
+      dirStr="forward";
+   elif [ "$1" = "-forward" ]; then
+      dirStr="forward";
+
+   elif [ "$1" = "-h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "-help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+
+   else
+      printf "%s is not recognized\n" "$1"; exit;
+   fi;
+
+   shift; # move to the next argument
+done # Loop: get user input
+
+#*********************************************************
+# Sec02 Sub02:
+#   - check user input
+#*********************************************************
+
+if [ ! -f "$geneStr" ]; then
+   printf "could not open -gene %s\n" "$geneStr"; exit;
+fi;
+
+if [ ! -f "$refStr" ]; then
+   printf "could not open -ref %s\n" "$refStr"; exit;
+fi;
+
+if [ "$prefixStr" = "" ]; then
+   prefixStr="out";
+fi;
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec03:
+#   - print header if no older file
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+if [ ! -f "$prefixStr-scores.tsv" ]; then
+   { # print header to file
+      printf "gene_id\tgene_direction\tscore\tmax_score";
+      printf "\tref_start\tref_end";
+      printf "\tqry_start\tqry_end\tqry_len\taln_len\n";
+   } > "$prefixStr-scores.tsv"; # print header to file
+fi;
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec04:
+#   - map gene to reference and filter hits
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+# the mappers filter the mappings (removes overlaps) and
+# print scores.tsv rows (-score-tbl), so no sort or awk is
+# needed here
+
+if [ "$fastBl" -lt 1 ];
+then # If: using slower waterman
+   # memwaterScan aligns the forward and reverse complement
+   # gene (reverse complement is done in memory), so only
+   # one call is needed for both directions
+   "$scriptDirStr/memwaterScan" \
+       -perc-score "$percScoreStr" \
+       -seed "$seedStr" \
+       -score-tbl \
+       ${highStr:+-high-tbl} ${highStr:+"$highStr"} \
+       -ref "$refStr" \
+       -qry "$geneStr" \
+     >> "$prefixStr-scores.tsv";
+else
+# Else: using faster kmer scan
+   "$scriptDirStr/demux" \
+       -perc-score "$percScoreStr" \
+       -gene "$geneStr" \
+       -kmer-len "$kmerLenStr" \
+       -kmer-perc "$kmerPercStr" \
+       -score-tbl \
+       ${highStr:+-high-tbl} ${highStr:+"$highStr"} \
+       ${traceStr:+-trace} ${traceStr:+"$traceStr"} \
+       "$refStr" \
+     >> "$prefixStr-scores.tsv";
+# Else: using faster kmer scan
+fi;
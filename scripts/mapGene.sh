@@ -23,24 +23,48 @@ geneStr="";
 dirStr="forward";
 prefixStr="out";
 fastBl=1;
+traceStr="";
+highStr="";          # file to add highest scoring mapping(s) to
+percScoreStr="0.90"; # min percent score to keep a mapping
+kmerLenStr="7";      # demux kmer length (-fast)
+kmerPercStr="0.60";  # demux min percent kmers (-fast)
+seedStr="0";         # memwaterScan seed kmer length (-slow)
 scriptDirStr="$(dirname "$0")";
 
 helpStr="$(basename "$0") -ref reference.fa -gene gene.fa
-   - uses memwaterScan to get alternative mappings, then
-     filters out the duplicate mappings
+   - uses memwaterScan (or demux) to get alternative
+     mappings, then filters out the duplicate mappings
 Input:
    -ref reference.fa: fasta file with the reference or
       consensus sequence to get mappings for
    -gene gene.fa: fasta file with gene to map to the
       reference or consensus
    -rev: in output scoring file, use reverse instead
-      of forwards
+      of forwards (not used, both directions are always
+      mapped and the direction comes from the mapper)
    -prefix $prefixStr: prefix to call the output file
    -fast yes: use the faster kmer scaning method to hunt
       for genes (disable with -slow)
+   -trace trace.json: [Optional; not used]
+      add demux's chrome/perfetto trace events (timings)
+      to trace.json (-fast only)
+   -perc-score $percScoreStr: minimum percent score to
+      keep a mapping
+   -kmer-len $kmerLenStr: kmer length demux uses to find
+      genes (-fast only)
+   -kmer-perc $kmerPercStr: minimum percent of kmers demux
+      needs to align a window (-fast only)
+   -seed $seedStr: memwaterScan seed kmer length; only
+      aligns to windows with kmer seeds (-slow only; 0 is
+      a full waterman, 13 is a good start)
+   -high high.tsv: [Optional; not used]
+      append the highest scoring mapping(s) to high.tsv
+      (no header is printed)
 Output:
    - prefix-scores.tsv: has filtered mappings for the
      gene to the reference
+   - high.tsv: has the highest scoring mapping(s) if
+     -high was used
 "
 
 #>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -82,6 +106,24 @@ do   # Loop: get user input
       fastBl=1;
    elif [ "$1" = "-slow" ]; then
       fastBl=0;
+   elif [ "$1" = "-trace" ]; then
+      shift;
+      traceStr="$1";
+   elif [ "$1" = "-perc-score" ]; then
+      shift;
+      percScoreStr="$1";
+   elif [ "$1" = "-kmer-len" ]; then
+      shift;
+      kmerLenStr="$1";
+   elif [ "$1" = "-kmer-perc" ]; then
+      shift;
+      kmerPercStr="$1";
+   elif [ "$1" = "-seed" ]; then
+      shift;
+      seedStr="$1";
+   elif [ "$1" = "-high" ]; then
+      shift;
+      highStr="$1";
 
    elif [ "$1" = "-r" ]; then
       dirStr="reverse";
@@ -150,147 +192,34 @@ fi;
 #   - map gene to reference and filter hits
 #<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
+# the mappers filter the mappings (removes overlaps) and
+# print scores.tsv rows (-score-tbl), so no sort or awk is
+# needed here
+
 if [ "$fastBl" -lt 1 ];
 then # If: using slower waterman
+   # memwaterScan aligns the forward and reverse complement
+   # gene (reverse complement is done in memory), so only
+   # one call is needed for both directions
    "$scriptDirStr/memwaterScan" \
-       -min-score 90 \
+       -perc-score "$percScoreStr" \
+       -seed "$seedStr" \
+       -score-tbl \
+       ${highStr:+-high-tbl} ${highStr:+"$highStr"} \
        -ref "$refStr" \
-       -qry "$geneStr" |
-     tail -n+2 |
-     sort -n -k 3 -k 7 |
-     sort -r -n -k 6 |
-     awk \
-        -v dirStr="$dirStr" \
-        'BEGIN{
-           # get the first mapping
-           getline;
-           nameStr=$1;
-           scoreSI=$3;
-           maxScoreSI=$5;
-           maxLenSI=$11;
-           refStartSI=$6;
-           refEndSI=$7;
-           qryStartSI=$9;
-           qryEndSI=$10;
-         };
-         { # MAIN
-            # check if the other frame is in this frame
-            if($6 >= refStartSI && $6 <= refEndSI)
-               next;
-     
-            # this mapping does not overlap, print it out
-            if(scoreSI > 0)
-            { # If: something was found
-               printf "%s\t%s", nameStr, dirStr;
-               printf "\t%i\t%i", scoreSI, maxScoreSI;
-               printf "\t%i\t%i", refStartSI, refEndSI;
-               printf "\t%i\t%i", qryStartSI, qryEndSI; 
-               printf "\t%i", maxLenSI;
-               printf "\t%i\n", 1 + refEndSI - refStartSI;
-            } # If: something was found
-     
-            # Get the new mapping
-            nameStr=$1;
-            scoreSI=$3;
-            maxScoreSI=$5;
-            maxLenSI=$11;
-            refStartSI=$6;
-            refEndSI=$7;
-            qryStartSI=$9;
-            qryEndSI=$10;
-         }; # MAIN
-     
-         END{
-            if(scoreSI > 0)
-            { # If: something was found
-               printf "%s\t%s", nameStr, dirStr;
-               printf "\t%i\t%i", scoreSI, maxScoreSI;
-               printf "\t%i\t%i", refStartSI, refEndSI;
-               printf "\t%i\t%i", qryStartSI, qryEndSI; 
-               printf "\t%i", maxLenSI;
-               printf "\t%i\n", 1 + refEndSI - refStartSI;
-            } # If: something was found
-         };' \
+       -qry "$geneStr" \
      >> "$prefixStr-scores.tsv";
 else
 # Else: using faster kmer scan
    "$scriptDirStr/demux" \
-       -perc-score 0.90 \
+       -perc-score "$percScoreStr" \
        -gene "$geneStr" \
-       -kmer-len 7 \
-       -kmer-perc 0.60 \
-       "$refStr" |
-     awk \
-        'BEGIN{
-           getline; # get past header
-           getline; # get the first mapping
-
-           nameStr = $2;
-           dirStr = $3;
-           scoreSI = $4;
-           maxScoreSI = $5;
-           lenSI = $6;
-           maxLenSI = $7;
-           refStartSI = $8;
-           refEndSI = $9;
-           qryStartSI = "NA"; # demux does not give this
-           qryEndSI = "NA";   # demux does not give this
-
-           if(dirStr == "R")
-              dirStr = "reverse";
-           else
-              dirStr = "forward";
-
-           if(scoreSI < 0)
-              scoreSI *= -1;
-         };
-
-         { # MAIN
-            # check if the other frame is in this frame
-            if($6 >= refStartSI && $6 <= refEndSI)
-               next;
-     
-            # this mapping does not overlap, print it out
-            if(scoreSI > 0)
-            { # If: something was found
-               printf "%s\t%s", nameStr, dirStr;
-               printf "\t%i\t%i", scoreSI, maxScoreSI;
-               printf "\t%i\t%i", refStartSI, refEndSI;
-               printf "\t%s\t%s", qryStartSI, qryEndSI; 
-               printf "\t%i\t%i\n", maxLenSI, lenSI;
-            } # If: something was found
-     
-            nameStr  =$2;
-            dirStr = $3;
-            scoreSI = $4;
-            maxScoreSI = $5;
-            lenSI = $6;
-            maxLenSI = $7;
-            refStartSI = $8;
-            refEndSI = $9;
-            qryStartSI = "NA"; # demux does not give this
-            qryEndSI = "NA";   # demux does not give this
-
-            dirStr = $3;
-            if(dirStr == "R")
-               dirStr = "reverse";
-            else
-               dirStr = "forward";
-
-            if(scoreSI < 0)
-               scoreSI *= -1;
-         }; # MAIN
-     
-         END{
-            if(scoreSI > 0)
-            { # If: something was found
-               printf "%s\t%s", nameStr, dirStr;
-               printf "\t%i\t%i", scoreSI, maxScoreSI;
-               printf "\t%i\t%i", refStartSI, refEndSI;
-               printf "\t%s\t%s", qryStartSI, qryEndSI; 
-               printf "\t%i\t%i\n", maxLenSI, lenSI;
-            } # If: something was found
-         };' \
+       -kmer-len "$kmerLenStr" \
+       -kmer-perc "$kmerPercStr" \
+       -score-tbl \
+       ${highStr:+-high-tbl} ${highStr:+"$highStr"} \
+       ${traceStr:+-trace} ${traceStr:+"$traceStr"} \
+       "$refStr" \
      >> "$prefixStr-scores.tsv";
 # Else: using faster kmer scan
 fi;
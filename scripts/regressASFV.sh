@@ -0,0 +1,378 @@
+#!/usr/bin/bash
+
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+# regressASFV.sh SOF: Start Of File
+#   - runs annotateASFV.sh on the demo genome, checks the
+#     output against the expected demo output, and records
+#     the run time and memory usage to a history file
+#   o sec01:
+#     - variable declarations
+#   o sec02:
+#     - get and check user input
+#   o sec03:
+#     - run each mode, compare output, and check times
+#   o sec04:
+#     - report and exit
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec01:
+#   - variable declarations
+#   o sec01 sub01:
+#     - general variables
+#   o sec01 sub02:
+#     - help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec01 Sub01:
+#   - general variables
+#**********************************************************
+
+scriptDirStr="$(dirname "$0")";
+binStr="$scriptDirStr/../bin";  # annotateASFV.sh + programs
+demoStr="$scriptDirStr/../demo"; # inputs + expected output
+historyStr="regress-history.tsv"; # run time history
+prefixStr="regress-tmp";  # prefix for the test output
+modeStr="fast slow";      # modes to test
+maxSlowStr="1.5";         # fail if time > best * this
+keepBl=0;                 # 1: keep the test output
+
+# files annotateASFV.sh makes (suffix after prefix-)
+outAryStr="scores.tsv highScores.tsv ntSequences.fa aaSequences.fa featureTable.tsv featureErrors.tsv";
+
+errSI=0;          # number of failed checks
+reportStr="";     # summary printed at end
+commitStr="NA";   # git commit tested
+timeCmdBl=0;      # 1: have GNU time for memory usage
+
+#**********************************************************
+# Sec01 Sub02:
+#   - help message
+#**********************************************************
+
+helpStr="bash $(basename "$0") [-fast] [-slow] [-history $historyStr]
+  - runs annotateASFV.sh on the demo genome, byte compares
+    the output to the expected demo output, and saves the
+    run time and peak memory to a history file
+Input:
+  -bin path: [$binStr]
+    o directory with annotateASFV.sh and its programs
+      (make puts these in bin)
+  -demo path: [$demoStr]
+    o directory with OP605386.fa,
+      OP605386-features-rmDup.fa, and the expected output
+      (fastTestCase-* for -fast, testCase-* for -slow)
+  -history file.tsv: [$historyStr]
+    o tsv file to append the run times to; is also used
+      to find the best (fastest) past run time
+  -max-slow $maxSlowStr:
+    o fail if a run takes longer then this times the best
+      passing run time in -history
+    o use 0 to not check times
+  -fast:
+    o only test the -fast (demux) mode
+  -slow:
+    o only test the -slow (memwaterScan) mode
+    o default is to test both modes
+  -prefix $prefixStr:
+    o prefix to call the test output
+  -keep:
+    o keep the test output (deleted by default)
+Output:
+  - Prints:
+    o pass or fail for each mode to stdout
+  - File:
+    o a row for each mode to -history
+      date, commit, mode, seconds, peak_kb, status
+    o peak_kb is NA if GNU time (/usr/bin/time) is not
+      installed
+  - Returns:
+    o 0 if all modes matched and were not to slow
+    o 1 if output drifted, an expected output file was
+      missing, or a mode was to slow
+";
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec02:
+#   - get and check user input
+#   o sec02 sub01:
+#     - get user input
+#   o sec02 sub02:
+#     - check user input
+#   o sec02 sub03:
+#     - find timing programs and commit
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec02 Sub01:
+#   - get user input
+#**********************************************************
+
+while [ $# -gt 0 ];
+do   # Loop: get user input
+   if [ "$1" = "-bin" ]; then
+      shift;
+      binStr="$1";
+   elif [ "$1" = "-demo" ]; then
+      shift;
+      demoStr="$1";
+   elif [ "$1" = "-history" ]; then
+      shift;
+      historyStr="$1";
+   elif [ "$1" = "-max-slow" ]; then
+      shift;
+      maxSlowStr="$1";
+   elif [ "$1" = "-prefix" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-fast" ]; then
+      modeStr="fast";
+   elif [ "$1" = "-slow" ]; then
+      modeStr="slow";
+   elif [ "$1" = "-keep" ]; then
+      keepBl=1;
+
+   elif [ "$1" = "-h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "-help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+
+   else
+      printf "%s is not recognized\n" "$1"; exit 1;
+   fi;
+
+   shift; # move to the next argument
+done # Loop: get user input
+
+#**********************************************************
+# Sec02 Sub02:
+#   - check user input
+#**********************************************************
+
+if [ ! -f "$binStr/annotateASFV.sh" ]; then
+   printf "no annotateASFV.sh in -bin %s (run make)\n" \
+      "$binStr";
+   exit 1;
+fi;
+
+if [ ! -f "$demoStr/OP605386.fa" ]; then
+   printf "no OP605386.fa in -demo %s\n" "$demoStr";
+   exit 1;
+fi;
+
+if [ ! -f "$historyStr" ]; then
+   printf "date\tcommit\tmode\tseconds\tpeak_kb\tstatus\n" \
+     > "$historyStr";
+fi;
+
+#**********************************************************
+# Sec02 Sub03:
+#   - find timing programs and commit
+#**********************************************************
+
+if /usr/bin/time -f "%e" true > /dev/null 2>&1; then
+   timeCmdBl=1; # GNU time; gives peak memory (%M)
+fi;
+
+if command -v git > /dev/null 2>&1; then
+   commitStr="$( \
+      git -C "$scriptDirStr" rev-parse --short HEAD \
+        2> /dev/null \
+   )";
+
+   if [ "$commitStr" = "" ]; then
+      commitStr="NA";
+   fi;
+fi;
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec03:
+#   - run each mode, compare output, and check times
+#   o sec03 sub01:
+#     - run annotateASFV.sh and time it
+#   o sec03 sub02:
+#     - byte compare output to expected output
+#   o sec03 sub03:
+#     - check run time against the best past run time
+#   o sec03 sub04:
+#     - record the run and clean up
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+for runStr in $modeStr;
+do # Loop: test each mode
+   #*******************************************************
+   # Sec03 Sub01:
+   #   - run annotateASFV.sh and time it
+   #*******************************************************
+
+   if [ "$runStr" = "fast" ]; then
+      expectStr="$demoStr/fastTestCase";
+   else
+      expectStr="$demoStr/testCase";
+   fi;
+
+   for fileStr in $outAryStr; do
+      if [ -f "$prefixStr-$fileStr" ]; then
+         rm "$prefixStr-$fileStr";
+      fi; # else no old output to remove
+   done;
+
+   peakStr="NA";
+
+   if [ "$timeCmdBl" -ge 1 ];
+   then # If: GNU time can get peak memory
+      /usr/bin/time \
+          -f "%e\t%M" \
+          -o "$prefixStr-time.tsv" \
+          bash "$binStr/annotateASFV.sh" \
+             -gene "$demoStr/OP605386-features-rmDup.fa" \
+             -ref "$demoStr/OP605386.fa" \
+             -prefix "$prefixStr" \
+             "-$runStr" \
+        > /dev/null;
+
+      secStr="$(tail -n 1 "$prefixStr-time.tsv" | cut -f 1)";
+      peakStr="$(tail -n 1 "$prefixStr-time.tsv" | cut -f 2)";
+      rm "$prefixStr-time.tsv";
+
+   else
+   # Else: only have date for timing
+      startStr="$(date +%s.%N)";
+
+      bash "$binStr/annotateASFV.sh" \
+         -gene "$demoStr/OP605386-features-rmDup.fa" \
+         -ref "$demoStr/OP605386.fa" \
+         -prefix "$prefixStr" \
+         "-$runStr" \
+        > /dev/null;
+
+      endStr="$(date +%s.%N)";
+
+      # date without %N (non-GNU) prints a N, so this
+      # falls back to whole seconds
+      secStr="$( \
+         printf "%s\t%s\n" "${startStr%.N}" "${endStr%.N}" |
+           awk '{printf "%.2f", $2 - $1;}' \
+      )";
+   # Else: only have date for timing
+   fi;
+
+   #*******************************************************
+   # Sec03 Sub02:
+   #   - byte compare output to expected output
+   #*******************************************************
+
+   statusStr="pass";
+
+   for fileStr in $outAryStr;
+   do # Loop: compare output files
+      if [ ! -f "$expectStr-$fileStr" ];
+      then # If: no expected output to compare to
+         printf "%s: no expected output %s\n" \
+            "$runStr" \
+            "$expectStr-$fileStr";
+         statusStr="fail";
+
+      elif ! cmp -s \
+            "$expectStr-$fileStr" \
+            "$prefixStr-$fileStr";
+      then # Else If: output drifted
+         printf "%s: %s differs from %s\n" \
+            "$runStr" \
+            "$prefixStr-$fileStr" \
+            "$expectStr-$fileStr";
+         statusStr="drift";
+      fi; # Else If: output drifted
+   done; # Loop: compare output files
+
+   #*******************************************************
+   # Sec03 Sub03:
+   #   - check run time against the best past run time
+   #*******************************************************
+
+   bestStr="$( \
+      awk \
+         -v modeStr="$runStr" \
+         '
+            BEGIN{bestF = -1;};
+
+            { # MAIN
+               if($3 != modeStr || $6 != "pass")
+                  next;
+               if(bestF < 0 || $4 < bestF)
+                  bestF = $4;
+            }; # MAIN
+
+            END{if(bestF >= 0) print bestF;};
+         ' "$historyStr" \
+   )";
+
+   if [ "$bestStr" != "" ] && [ "$statusStr" = "pass" ];
+   then # If: have a past run to compare to
+      slowBl="$( \
+         awk \
+            -v secF="$secStr" \
+            -v bestF="$bestStr" \
+            -v maxF="$maxSlowStr" \
+            'BEGIN{print (maxF > 0 && secF > bestF * maxF);}'\
+      )";
+
+      if [ "$slowBl" -ge 1 ]; then
+         printf "%s: took %s seconds; best is %s (x%s)\n" \
+            "$runStr" \
+            "$secStr" \
+            "$bestStr" \
+            "$maxSlowStr";
+         statusStr="slow";
+      fi;
+   fi; # If: have a past run to compare to
+
+   #*******************************************************
+   # Sec03 Sub04:
+   #   - record the run and clean up
+   #*******************************************************
+
+   printf "%s\t%s\t%s\t%s\t%s\t%s\n" \
+      "$(date +%Y-%m-%dT%H:%M:%S)" \
+      "$commitStr" \
+      "$runStr" \
+      "$secStr" \
+      "$peakStr" \
+      "$statusStr" \
+     >> "$historyStr";
+
+   reportStr="$reportStr$runStr\t$statusStr\t$secStr s\t$peakStr kb\n";
+
+   if [ "$statusStr" != "pass" ]; then
+      errSI="$((errSI + 1))";
+   fi;
+
+   if [ "$keepBl" -lt 1 ]; then
+      for fileStr in $outAryStr; do
+         if [ -f "$prefixStr-$fileStr" ]; then
+            rm "$prefixStr-$fileStr";
+         fi;
+      done;
+   fi; # If: removing the test output
+done # Loop: test each mode
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec04:
+#   - report and exit
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+printf "mode\tstatus\ttime\tpeak_memory\n";
+printf "%b" "$reportStr";
+
+if [ "$errSI" -gt 0 ]; then
+   exit 1;
+fi;
+
+exit 0;
@@ -0,0 +1,386 @@
+#!/usr/bin/bash
+
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+# regressMapRead.sh SOF: Start Of File
+#   - simulates reads from part of the demo genome, builds
+#     a consensus with mapRead -con, and checks the
+#     consensus against the reference
+#   o sec01:
+#     - variable declarations
+#   o sec02:
+#     - get and check user input
+#   o sec03:
+#     - make the reference and simulate reads
+#   o sec04:
+#     - run mapRead for each read set and check consensus
+#   o sec05:
+#     - report and exit
+#~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec01:
+#   - variable declarations
+#   o sec01 sub01:
+#     - general variables
+#   o sec01 sub02:
+#     - help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec01 Sub01:
+#   - general variables
+#**********************************************************
+
+scriptDirStr="$(dirname "$0")";
+binStr="$scriptDirStr/../bin";  # has mapRead
+demoStr="$scriptDirStr/../demo"; # has OP605386.fa
+prefixStr="regress-mapRead";  # prefix for the test output
+keepBl=0;                 # 1: keep the test output
+
+refStartSI=10001;  # first genome base in the reference
+refLenSI=60000;    # length of the reference
+readLenSI=150;     # length of each read
+numReadsSI=8000;   # reads per set (20x depth)
+minCallF="0.9";    # fail if < this fraction is called
+
+# read sets: name:percent_snps
+setAryStr="perfect:0 snp:1";
+
+errSI=0;          # number of failed checks
+reportStr="";     # summary printed at end
+
+#**********************************************************
+# Sec01 Sub02:
+#   - help message
+#**********************************************************
+
+helpStr="bash $(basename "$0") [-keep]
+  - simulates error free and low (1%) snp reads from
+    part of the demo genome, builds a consensus with
+    mapRead -con (and -panel), and checks the consensus
+    matches the reference
+Input:
+  -bin path: [$binStr]
+    o directory with mapRead (make puts it in bin)
+  -demo path: [$demoStr]
+    o directory with OP605386.fa
+  -prefix $prefixStr:
+    o prefix to call the test output
+  -keep:
+    o keep the test output (deleted by default)
+Output:
+  - Prints:
+    o pass or fail for each read set to stdout
+  - Returns:
+    o 0 if all consensuses matched the reference
+    o 1 if a consensus was not built, had a base that
+      differs from the reference, or called under
+      $minCallF of the reference
+";
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec02:
+#   - get and check user input
+#   o sec02 sub01:
+#     - get user input
+#   o sec02 sub02:
+#     - check user input
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec02 Sub01:
+#   - get user input
+#**********************************************************
+
+while [ $# -gt 0 ];
+do   # Loop: get user input
+   if [ "$1" = "-bin" ]; then
+      shift;
+      binStr="$1";
+   elif [ "$1" = "-demo" ]; then
+      shift;
+      demoStr="$1";
+   elif [ "$1" = "-prefix" ]; then
+      shift;
+      prefixStr="$1";
+   elif [ "$1" = "-keep" ]; then
+      keepBl=1;
+
+   elif [ "$1" = "-h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--h" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "-help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+   elif [ "$1" = "--help" ]; then
+      printf "%s\n" "$helpStr"; exit;
+
+   else
+      printf "%s is not recognized\n" "$1"; exit 1;
+   fi;
+
+   shift; # move to the next argument
+done # Loop: get user input
+
+#**********************************************************
+# Sec02 Sub02:
+#   - check user input
+#**********************************************************
+
+if [ ! -f "$binStr/mapRead" ]; then
+   printf "no mapRead in -bin %s (run make)\n" "$binStr";
+   exit 1;
+fi;
+
+if [ ! -f "$demoStr/OP605386.fa" ]; then
+   printf "no OP605386.fa in -demo %s\n" "$demoStr";
+   exit 1;
+fi;
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec03:
+#   - make the reference and simulate reads
+#   o sec03 sub01:
+#     - make the reference
+#   o sec03 sub02:
+#     - simulate reads
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#**********************************************************
+# Sec03 Sub01:
+#   - make the reference
+#**********************************************************
+
+awk \
+   -v startSI="$refStartSI" \
+   -v lenSI="$refLenSI" \
+   '
+      { # MAIN
+         if($0 ~ /^>/)
+            next;
+         seqStr = seqStr $0;
+      }; # MAIN
+
+      END{
+         printf ">ref\n%s\n", substr(seqStr, startSI, lenSI);
+      };
+   ' "$demoStr/OP605386.fa" \
+  > "$prefixStr-ref.fa";
+
+#**********************************************************
+# Sec03 Sub02:
+#   - simulate reads
+#**********************************************************
+
+for setStr in $setAryStr;
+do # Loop: simulate each read set
+   awk \
+      -v numSI="$numReadsSI" \
+      -v lenSI="$readLenSI" \
+      -v percF="${setStr#*:}" \
+      '
+         BEGIN{
+            srand(1024);
+            compStr["A"] = "T";
+            compStr["C"] = "G";
+            compStr["G"] = "C";
+            compStr["T"] = "A";
+            ntStr = "ACGT";
+         };
+
+         { # MAIN
+            if($0 ~ /^>/)
+               next;
+            refStr = refStr $0;
+         }; # MAIN
+
+         END{
+            refLenSI = length(refStr);
+
+            for(siRead = 0; siRead < numSI; ++siRead)
+            { # Loop: make reads
+               posSI = int(rand() * (refLenSI - lenSI + 1));
+               readStr = "";
+
+               for(siNt = 1; siNt <= lenSI; ++siNt)
+               { # Loop: copy bases
+                  baseStr = substr(refStr, posSI + siNt, 1);
+
+                  if(rand() * 100 < percF)
+                  { # If: adding a snp
+                     do
+                        snpSI = int(rand() * 4) + 1;
+                     while(substr(ntStr, snpSI, 1) == baseStr);
+
+                     baseStr = substr(ntStr, snpSI, 1);
+                  }; # If: adding a snp
+
+                  readStr = readStr baseStr;
+               }; # Loop: copy bases
+
+               if(rand() < 0.5)
+               { # If: reverse complement read
+                  revStr = "";
+
+                  for(siNt = lenSI; siNt > 0; --siNt)
+                     revStr = revStr compStr[substr(readStr, siNt, 1)];
+
+                  readStr = revStr;
+               }; # If: reverse complement read
+
+               printf ">read-%i\n%s\n", siRead, readStr;
+            }; # Loop: make reads
+         };
+      ' "$prefixStr-ref.fa" \
+     > "$prefixStr-${setStr%:*}.fa";
+done # Loop: simulate each read set
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec04:
+#   - run mapRead for each read set and check consensus
+#   o sec04 sub01:
+#     - run mapRead
+#   o sec04 sub02:
+#     - check the consensus against the reference
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+runAryStr="";
+
+for setStr in $setAryStr; do
+   runAryStr="$runAryStr ${setStr%:*}";
+done;
+
+runAryStr="$runAryStr perfect-panel"; # panel mode
+
+for runStr in $runAryStr;
+do # Loop: check each read set
+   #*******************************************************
+   # Sec04 Sub01:
+   #   - run mapRead
+   #*******************************************************
+
+   statusStr="pass";
+   conStr="$prefixStr-$runStr-con.fa";
+
+   if [ -f "$conStr" ]; then
+      rm "$conStr";
+   fi; # else no old consensus to remove
+
+   if [ "$runStr" = "perfect-panel" ]; then
+      "$binStr/mapRead" \
+         -panel \
+         -ref "$prefixStr-ref.fa" \
+         -fa "$prefixStr-perfect.fa" \
+         -con "$conStr" \
+        > /dev/null 2>&1;
+   else
+      "$binStr/mapRead" \
+         -ref "$prefixStr-ref.fa" \
+         -fa "$prefixStr-$runStr.fa" \
+         -con "$conStr" \
+        > /dev/null 2>&1;
+   fi;
+
+   #*******************************************************
+   # Sec04 Sub02:
+   #   - check the consensus against the reference
+   #*******************************************************
+
+   if [ ! -s "$conStr" ]; then
+      printf "%s: no consensus was built\n" "$runStr";
+      statusStr="no_consensus";
+   else
+   # Else: compare consensus to reference
+      checkStr="$( \
+         awk \
+            -v minF="$minCallF" \
+            '
+               { # MAIN
+                  if(FNR == NR)
+                  { # If: reference
+                     if($0 !~ /^>/)
+                        refStr = refStr $0;
+                     next;
+                  }; # If: reference
+
+                  if($0 ~ /^>/)
+                  { # If: consensus header
+                     startSI = $0;
+                     sub(/.* start=/, "", startSI);
+                     sub(/ .*/, "", startSI);
+                     posSI = startSI + 0;
+                     next;
+                  }; # If: consensus header
+
+                  for(siNt = 1; siNt <= length($0); ++siNt)
+                  { # Loop: compare bases
+                     baseStr = substr($0, siNt, 1);
+
+                     if(baseStr != "N")
+                     { # If: called base
+                        ++callSI;
+                        if(baseStr != substr(refStr, posSI, 1))
+                           ++diffSI;
+                     }; # If: called base
+
+                     ++posSI;
+                  }; # Loop: compare bases
+               }; # MAIN
+
+               END{
+                  callF = callSI / length(refStr);
+                  printf "%i\t%.3f", diffSI, callF;
+
+                  if(diffSI > 0 || callF < minF)
+                     printf "\tfail";
+                  else
+                     printf "\tpass";
+               };
+            ' "$prefixStr-ref.fa" "$conStr" \
+      )";
+
+      if [ "$(printf "%s" "$checkStr" | cut -f 3)" != "pass" ];
+      then # If: consensus differs from reference
+         printf "%s: %s differing bases; %s called\n" \
+            "$runStr" \
+            "$(printf "%s" "$checkStr" | cut -f 1)" \
+            "$(printf "%s" "$checkStr" | cut -f 2)";
+         statusStr="mismatch";
+      fi; # If: consensus differs from reference
+   # Else: compare consensus to reference
+   fi;
+
+   reportStr="$reportStr$runStr\t$statusStr\n";
+
+   if [ "$statusStr" != "pass" ]; then
+      errSI="$((errSI + 1))";
+   fi;
+
+   if [ "$keepBl" -lt 1 ] && [ -f "$conStr" ]; then
+      rm "$conStr";
+   fi;
+done # Loop: check each read set
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec05:
+#   - report and exit
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+if [ "$keepBl" -lt 1 ]; then
+   rm "$prefixStr-ref.fa";
+
+   for setStr in $setAryStr; do
+      rm "$prefixStr-${setStr%:*}.fa";
+   done;
+fi; # If: removing the test input
+
+printf "reads\tstatus\n";
+printf "%b" "$reportStr";
+
+if [ "$errSI" -gt 0 ]; then
+   exit 1;
+fi;
+
+exit 0;
@@ -0,0 +1,2369 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of File
+'   - times the alignment and search kernels on a fasta
+'     file or on synthetic sequences
+'   o header:
+'     - included libraries and defaults
+'   o fun01: pversion_bench
+'     - prints bench's version numbers
+'   o fun02: phelp_bench
+'     - prints out bench's help message
+'   o fun03: input_bench
+'     - gets user input
+'   o fun04: wallTime_bench
+'     - gets the wall clock time in seconds
+'   o fun05: peakRSS_bench
+'     - gets the peak resident set size (memory usage)
+'   o fun06: synSeq_bench
+'     - makes a random (synthetic) sequence
+'   o fun07: mutSeq_bench
+'     - copies part of a sequence and adds mutations
+'   o fun08: pHead_bench
+'     - prints the header for the tsv output
+'   o fun09: pResult_bench
+'     - prints the result for one kernel
+'   o fun10: aln_bench
+'     - times one of the alignment kernels
+'   o fun11: kmerFind_bench
+'     - times the kmerFind gene search
+'   o fun12: gzSeqST_bench
+'     - times reading a fasta (or fasta.gz) file
+'   o main:
+'     - benchmark the kernels
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Header:
+|  - Includes
+\--------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #define _POSIX_C_SOURCE 199309L /*for clock_gettime*/
+   #include <stdlib.h>
+   #include <time.h>
+   #include <sys/resource.h>
+#endif
+
+#include <stdio.h>
+
+#include "../genLib/ulCp.h"
+#include "../genLib/base10str.h"
+#include "../genLib/inflate.h"
+#include "../genBio/seqST.h"
+#include "../genBio/gzSeqST.h"
+#include "../genBio/samEntry.h"
+#include "../genAln/alnSet.h"
+#include "../genAln/dirMatrix.h"
+#include "../genAln/memwater.h"
+#include "../genAln/memwaterScan.h"
+#include "../genAln/water.h"
+#include "../genAln/needle.h"
+#include "../genAln/hirschberg.h"
+#include "../genAln/kmerFind.h"
+#include "../genLib/memTag.h"
+
+/*only .h files*/
+#include "../bioTools.h" /*version number*/
+#include "../genLib/endLine.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden Libraries:
+!   - .c  #include "../genLib/numToStr.h"
+!   - .c  #include "../genLib/charCp.h"
+!   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genLib/shellSort.h"
+!   - .c  #include "../genLib/outBuf.h"
+!   - .c  #include "../genLib/checkSum.h"
+!   - .c  #include "../genLib/endin.h"
+!   - .c  #include "../genLib/genMath.h"
+!   - .c  #include "../genAln/indexToCoord.h"
+!   - .h  #include "../genBio/ntTo5Bit.h"
+!   - .h  #include "../genBio/kmerBit.h"
+!   - .h  #include "../genAln/alnDefs.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*kernels; used as flags*/
+#define def_memwater_bench 1
+#define def_memwaterScan_bench 2
+#define def_water_bench 4
+#define def_needle_bench 8
+#define def_hirschberg_bench 16
+#define def_kmerFind_bench 32
+#define def_gzSeqST_bench 64
+#define def_all_bench 127
+
+#define def_memErr_bench 1
+#define def_fileErr_bench 2
+
+/*defaults*/
+#define def_refLen_bench 100000 /*synthetic reference*/
+#define def_qryLen_bench 1000   /*synthetic query*/
+#define def_numQry_bench 4      /*queries to align*/
+#define def_win_bench 10000     /*ref bases for water ...*/
+#define def_rep_bench 1         /*times to run kernel*/
+#define def_seed_bench 1        /*random number seed*/
+#define def_mutate_bench 50     /*1 in 50 bases mutated*/
+
+/*kmerFind settings (same as mapGene.sh)*/
+#define def_lenKmer_bench 7
+#define def_kmerPerc_bench 0.60f
+#define def_percScore_bench 0.90f
+
+/*--------------------------------------------------------\
+| Fun01: pversion_bench
+|  - prints bench's version numbers
+| Input:
+|  - outFILE:
+|    o pointer to FILE to print to
+| Output:
+|  - Prints:
+|    o version number to outFILE
+\--------------------------------------------------------*/
+void
+pversion_bench(
+   void *outFILE
+){
+   fprintf(
+      (FILE *) outFILE,
+      "bench from bioTools version: %i-%02i-%02i%s",
+      def_year_bioTools,
+      def_month_bioTools,
+      def_day_bioTools,
+      str_endLine
+   );
+} /*pversion_bench*/
+
+/*--------------------------------------------------------\
+| Fun02: phelp_bench
+|  - prints out bench's help message
+| Input:
+|  - outFILE:
+|    o pointer to FILE to print to
+| Output:
+|  - Prints:
+|    o help message to outFILE
+\--------------------------------------------------------*/
+void
+phelp_bench(
+   void *outFILE
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun02 TOC:
+   '   o fun02 sec01:
+   '     - usage line
+   '   o fun02 sec02:
+   '     - input
+   '   o fun02 sec03:
+   '     - output
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec01:
+   ^   - usage line
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "bench [-ref ref.fa -qry genes.fa] [-kernel name]%s",
+      str_endLine
+   );
+
+   fprintf(
+     (FILE *) outFILE,
+     "  - times the alignment and search kernels%s",
+     str_endLine
+   );
+
+   fprintf(
+     (FILE *) outFILE,
+     "  - uses synthetic sequences if no -ref is input%s",
+     str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec02:
+   ^   - input
+   ^   o fun02 sec02 sub01:
+   ^     - input files
+   ^   o fun02 sec02 sub02:
+   ^     - synthetic sequences
+   ^   o fun02 sec02 sub03:
+   ^     - kernels and run settings
+   ^   o fun02 sec02 sub04:
+   ^     - output
+   ^   o fun02 sec02 sub05:
+   ^     - help message and version number
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "Input:%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub01:
+   *   - input files
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -ref ref.fa: [Optional; synthetic]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o fasta (or fasta.gz) file with reference%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o only the first sequence is aligned to, but%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     gzSeqST reads the whole file%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -qry genes.fa: [Optional; synthetic]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o fasta (or fasta.gz) file with queries (genes)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o if no -qry, queries are mutated pieces of the%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     reference (every other one reverse complement)%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub02:
+   *   - synthetic sequences
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -ref-len %i: [Optional; %i]%s",
+      def_refLen_bench,
+      def_refLen_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o length of synthetic reference (no -ref)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -qry-len %i: [Optional; %i]%s",
+      def_qryLen_bench,
+      def_qryLen_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o length of synthetic queries (no -qry)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -seed %i: [Optional; %i]%s",
+      def_seed_bench,
+      def_seed_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o seed for making synthetic sequences%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub03:
+   *   - kernels and run settings
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -kernel all: [Optional; all]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o kernel to time; use more than once for more%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o memwater, memwaterScan, water, needle,%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     hirschberg, kmerFind, gzSeqST, or all%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o gzSeqST needs -ref%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -num-qry %i: [Optional; %i]%s",
+      def_numQry_bench,
+      def_numQry_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o number of queries to use%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -win %i: [Optional; %i]%s",
+      def_win_bench,
+      def_win_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o reference bases water, needle, and%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     hirschberg align to (they are not linear%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     memory); use 0 for the whole reference%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -rep %i: [Optional; %i]%s",
+      def_rep_bench,
+      def_rep_bench,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o number of times to run each kernel%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub04:
+   *   - output
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -json: [Optional; No]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o print one json object per kernel (per line)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     instead of a tsv%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -no-head: [Optional; No]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o do not print the tsv header (for appending)%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub05:
+   *   - help message and version number
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -h: print this help message and exit%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -v: print version number and exit%s",
+      str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec03:
+   ^   - output
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "Output:%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints one line per kernel to stdout%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o kernel, input, unit (cells or bases), ref_len,%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      qry_len, reps, count, seconds, per_sec,%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      gcups (NA for bases), peak_rss_kb, and check%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o check is the summed score (alignments), hits%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      (kmerFind), or sequences (gzSeqST); it%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      should not change between commits%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o peak_rss_kb is for the whole run, so run one%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      kernel at a time to get each kernels memory%s",
+      str_endLine
+   );
+} /*phelp_bench*/
+
+/*--------------------------------------------------------\
+| Fun03: input_bench
+|   - gets user input
+| Input:
+|   - numArgsSI:
+|     o number arguments user input
+|   - argAryStr:
+|     o c-string array with user input
+|   - refStrPtr:
+|     o c-string pointer to update with reference path
+|   - qryStrPtr:
+|     o c-string pointer to update with query path
+|   - kernelSCPtr:
+|     o signed char pointer to update with the kernels
+|       (def_memwater_bench | ...) to time
+|   - setArySL:
+|     o signed long array to update with the numeric
+|       settings
+|       * index 0: synthetic reference length
+|       * index 1: synthetic query length
+|       * index 2: number of queries
+|       * index 3: reference window (water, needle, ...)
+|       * index 4: number of repeats
+|       * index 5: seed for synthetic sequences
+|   - jsonBlPtr:
+|     o signed char pointer set to 1 for json output
+|   - headBlPtr:
+|     o signed char pointer set to 0 for no tsv header
+| Output:
+|   - Modifies:
+|     o all input variables to have user input
+|   - Prints:
+|     o if had error; error message to stderr
+|   - Returns:
+|     o 0 for no errors
+|     o 1 if printed help message
+|     o 2 if had error
+\--------------------------------------------------------*/
+signed char
+input_bench(
+   int numArgsSI,           /*number arguments input*/
+   char *argAryStr[],       /*arguments user input*/
+   signed char **refStrPtr, /*gets reference file*/
+   signed char **qryStrPtr, /*gets query file*/
+   signed char *kernelSCPtr,/*gets kernels to time*/
+   signed long *setArySL,   /*gets numeric settings*/
+   signed char *jsonBlPtr,  /*1: json output*/
+   signed char *headBlPtr   /*1: print tsv header*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun03 TOC:
+   '   - gets user input
+   '   o fun03 sec01:
+   '     - variable declartions
+   '   o fun03 sec02:
+   '     - get input
+   '   o fun03 sec03:
+   '     - return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec01:
+   ^   - variable declartions
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed int siArg = 1;
+   signed char errSC = 0;
+   signed char setSC = -1; /*numeric setting on*/
+   signed char kernelBl = 0; /*1: user input -kernel*/
+   signed char *tmpStr = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec02:
+   ^   - get input
+   ^   o fun03 sec02 sub01:
+   ^     - file input + start loop
+   ^   o fun03 sec02 sub02:
+   ^     - kernels
+   ^   o fun03 sec02 sub03:
+   ^     - numeric settings
+   ^   o fun03 sec02 sub04:
+   ^     - output settings
+   ^   o fun03 sec02 sub05:
+   ^     - help message and version number requests
+   ^   o fun03 sec02 sub06:
+   ^     - invalid input
+   ^   o fun03 sec02 sub07:
+   ^     - convert numeric settings + next argument
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun03 Sec02 Sub01:
+   *   - file input + start loop
+   \*****************************************************/
+
+   while(siArg < numArgsSI)
+   { /*Loop: get user input*/
+      setSC = -1;
+
+      if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*If: reference file input*/
+         ++siArg;
+         *refStrPtr = (signed char *) argAryStr[siArg];
+      }  /*If: reference file input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-qry",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: query file input*/
+         ++siArg;
+         *qryStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: query file input*/
+
+      /**************************************************\
+      * Fun03 Sec02 Sub02:
+      *   - kernels
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-kernel",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: kernel to time*/
+         ++siArg;
+         tmpStr = (signed char *) argAryStr[siArg];
+
+         if(! kernelBl)
+            *kernelSCPtr = 0; /*user is picking kernels*/
+         kernelBl = 1;
+
+         if(! tmpStr)
+            goto noKernel_fun03_sec03;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "all", tmpStr)
+         ) *kernelSCPtr |= def_all_bench;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "memwater",tmpStr)
+         ) *kernelSCPtr |= def_memwater_bench;
+
+         else if(
+            ! eqlNull_ulCp(
+               (signed char *) "memwaterScan",
+               tmpStr
+            )
+         ) *kernelSCPtr |= def_memwaterScan_bench;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "water", tmpStr)
+         ) *kernelSCPtr |= def_water_bench;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "needle", tmpStr)
+         ) *kernelSCPtr |= def_needle_bench;
+
+         else if(
+            ! eqlNull_ulCp(
+               (signed char *) "hirschberg",
+               tmpStr
+            )
+         ) *kernelSCPtr |= def_hirschberg_bench;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "kmerFind",tmpStr)
+         ) *kernelSCPtr |= def_kmerFind_bench;
+
+         else if(
+            ! eqlNull_ulCp((signed char *) "gzSeqST", tmpStr)
+         ) *kernelSCPtr |= def_gzSeqST_bench;
+
+         else
+            goto noKernel_fun03_sec03;
+      }  /*Else If: kernel to time*/
+
+      /**************************************************\
+      * Fun03 Sec02 Sub03:
+      *   - numeric settings
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref-len",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 0;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-qry-len",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 1;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-num-qry",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 2;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-win",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 3;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-rep",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 4;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-seed",
+            (signed char *) argAryStr[siArg]
+         )
+      ) setSC = 5;
+
+      /**************************************************\
+      * Fun03 Sec02 Sub04:
+      *   - output settings
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-json",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *jsonBlPtr = 1;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-tsv",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *jsonBlPtr = 0;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-no-head",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *headBlPtr = 0;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-head",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *headBlPtr = 1;
+
+      /**************************************************\
+      * Fun03 Sec02 Sub05:
+      *   - help message and version number requests
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      /**************************************************\
+      * Fun03 Sec02 Sub06:
+      *   - invalid input
+      \**************************************************/
+
+      else
+      { /*Else: invalid input*/
+         fprintf(
+            stderr,
+            "%s is not recognized%s",
+            argAryStr[siArg],
+            str_endLine
+         );
+
+         goto err_fun03_sec03;
+      } /*Else: invalid input*/
+
+      /**************************************************\
+      * Fun03 Sec02 Sub07:
+      *   - convert numeric settings + next argument
+      \**************************************************/
+
+      if(setSC >= 0)
+      { /*If: have a numeric setting*/
+         ++siArg;
+
+         if(siArg >= numArgsSI)
+            goto nonNumeric_fun03_sec03;
+
+         tmpStr = (signed char *) argAryStr[siArg];
+         tmpStr += strToSL_base10str(tmpStr, &setArySL[setSC]);
+
+         if(*tmpStr != '\0' || setArySL[setSC] < 0)
+            goto nonNumeric_fun03_sec03;
+      } /*If: have a numeric setting*/
+
+      ++siArg;
+   } /*Loop: get user input*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec03:
+   ^   - return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errSC = 0;
+   goto ret_fun03_sec03;
+
+   phelp_fun03_sec03:;
+      phelp_bench(stdout);
+      errSC = 1;
+      goto ret_fun03_sec03;
+
+   pversion_fun03_sec03:;
+      pversion_bench(stdout);
+      errSC = 1;
+      goto ret_fun03_sec03;
+
+   noKernel_fun03_sec03:;
+      fprintf(
+         stderr,
+         "-kernel %s is not a kernel I can time%s",
+         tmpStr,
+         str_endLine
+      );
+      goto err_fun03_sec03;
+
+   nonNumeric_fun03_sec03:;
+      fprintf(
+         stderr,
+         "%s needs a positive number%s",
+         argAryStr[siArg - 1],
+         str_endLine
+      );
+      goto err_fun03_sec03;
+
+   err_fun03_sec03:;
+      errSC = 2;
+      goto ret_fun03_sec03;
+
+   ret_fun03_sec03:;
+      return errSC;
+} /*input_bench*/
+
+/*--------------------------------------------------------\
+| Fun04: wallTime_bench
+|   - gets the wall clock time in seconds
+| Input:
+| Output:
+|   - Returns:
+|     o seconds from an arbitrary (fixed) start point
+\--------------------------------------------------------*/
+double
+wallTime_bench(
+   void
+){
+   #ifdef PLAN9
+      return (double) nsec() / 1000000000.0;
+   #else
+      struct timespec timeST;
+      clock_gettime(CLOCK_MONOTONIC, &timeST);
+
+      return
+           (double) timeST.tv_sec
+         + (double) timeST.tv_nsec / 1000000000.0;
+   #endif
+} /*wallTime_bench*/
+
+/*--------------------------------------------------------\
+| Fun05: peakRSS_bench
+|   - gets the peak resident set size (memory usage)
+| Input:
+| Output:
+|   - Returns:
+|     o peak resident set size in kilobytes (bytes on
+|       OSX)
+|     o -1 if could not get the resident set size
+\--------------------------------------------------------*/
+signed long
+peakRSS_bench(
+   void
+){
+   #ifdef PLAN9
+      return -1;
+   #else
+      struct rusage useST;
+
+      if( getrusage(RUSAGE_SELF, &useST) )
+         return -1;
+
+      return (signed long) useST.ru_maxrss;
+   #endif
+} /*peakRSS_bench*/
+
+/*--------------------------------------------------------\
+| Fun06: synSeq_bench
+|   - makes a random (synthetic) sequence
+| Input:
+|   - seqSTPtr:
+|     o seqST struct pointer to store sequence in
+|   - idStr:
+|     o c-string with id to give the sequence
+|   - lenSL:
+|     o length of sequence to make
+|   - seedULPtr:
+|     o unsigned long pointer with seed for the random
+|       number generator (updated)
+| Output:
+|   - Modifies:
+|     o seqStr, idStr, seqLenSL, idLenSL, offsetSL, and
+|       endAlnSL in seqSTPtr
+|     o seedULPtr to have the next seed
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_bench for memory errors
+\--------------------------------------------------------*/
+signed char
+synSeq_bench(
+   struct seqST *seqSTPtr,  /*gets sequence*/
+   signed char *idStr,      /*id for sequence*/
+   signed long lenSL,       /*length of sequence*/
+   unsigned long *seedULPtr /*random number seed*/
+){
+   signed long siNt = 0;
+   signed char *tmpStr = 0;
+
+   if(seqSTPtr->seqSizeSL <= lenSL)
+   { /*If: need more memory*/
+      tmpStr = realloc(seqSTPtr->seqStr, lenSL + 1);
+      if(! tmpStr)
+         return def_memErr_bench;
+      seqSTPtr->seqStr = tmpStr;
+      resize_memTag(
+         def_seqST_memTag,
+         seqSTPtr->seqSizeSL,
+         lenSL + 1
+      );
+      seqSTPtr->seqSizeSL = lenSL + 1;
+   } /*If: need more memory*/
+
+   if(seqSTPtr->idSizeSL <= lenStr_ulCp(idStr, 0, 0))
+   { /*If: need more memory for the id*/
+      tmpStr =
+         realloc(
+            seqSTPtr->idStr,
+            lenStr_ulCp(idStr, 0, 0) + 1
+         );
+      if(! tmpStr)
+         return def_memErr_bench;
+      seqSTPtr->idStr = tmpStr;
+      resize_memTag(
+         def_seqST_memTag,
+         seqSTPtr->idSizeSL,
+         lenStr_ulCp(idStr, 0, 0) + 1
+      );
+      seqSTPtr->idSizeSL = lenStr_ulCp(idStr, 0, 0) + 1;
+   } /*If: need more memory for the id*/
+
+   seqSTPtr->idLenSL = cpStr_ulCp(seqSTPtr->idStr, idStr);
+
+   for(siNt = 0; siNt < lenSL; ++siNt)
+   { /*Loop: make sequence*/
+      /*linear congruential generator (C standard rand
+      `  example), upper bits are the most random
+      */
+      *seedULPtr = *seedULPtr * 1103515245UL + 12345UL;
+      *seedULPtr &= 0xffffffffUL;
+      seqSTPtr->seqStr[siNt] = "ACGT"[(*seedULPtr >> 16) & 3];
+   } /*Loop: make sequence*/
+
+   seqSTPtr->seqStr[lenSL] = '\0';
+   seqSTPtr->seqLenSL = lenSL;
+   seqSTPtr->offsetSL = 0;
+   seqSTPtr->endAlnSL = lenSL - 1;
+
+   return 0;
+} /*synSeq_bench*/
+
+/*--------------------------------------------------------\
+| Fun07: mutSeq_bench
+|   - copies part of a sequence and adds mutations
+| Input:
+|   - outSTPtr:
+|     o seqST struct pointer to store the copy in
+|   - idStr:
+|     o c-string with id to give the copy
+|   - refSTPtr:
+|     o seqST struct pointer with sequence to copy
+|   - lenSL:
+|     o number of bases to copy (must be <= reference)
+|   - seedULPtr:
+|     o unsigned long pointer with seed for the random
+|       number generator (updated)
+| Output:
+|   - Modifies:
+|     o outSTPtr to have a random part of refSTPtr with
+|       1 in def_mutate_bench bases mutated
+|     o seedULPtr to have the next seed
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_bench for memory errors
+\--------------------------------------------------------*/
+signed char
+mutSeq_bench(
+   struct seqST *outSTPtr,  /*gets copy*/
+   signed char *idStr,      /*id for copy*/
+   struct seqST *refSTPtr,  /*sequence to copy*/
+   signed long lenSL,       /*bases to copy*/
+   unsigned long *seedULPtr /*random number seed*/
+){
+   signed long siNt = 0;
+   signed long startSL = 0;
+
+   /*use synSeq_bench to get memory and the id; the random
+   `  bases are only used for the mutations
+   */
+   if( synSeq_bench(outSTPtr, idStr, lenSL, seedULPtr) )
+      return def_memErr_bench;
+
+   *seedULPtr = *seedULPtr * 1103515245UL + 12345UL;
+   *seedULPtr &= 0xffffffffUL;
+   startSL =
+        (signed long) (*seedULPtr >> 8)
+      % (refSTPtr->seqLenSL - lenSL + 1);
+
+   for(siNt = 0; siNt < lenSL; ++siNt)
+   { /*Loop: copy and mutate sequence*/
+      *seedULPtr = *seedULPtr * 1103515245UL + 12345UL;
+      *seedULPtr &= 0xffffffffUL;
+
+      if( ((*seedULPtr >> 8) % def_mutate_bench) )
+         outSTPtr->seqStr[siNt] =
+            refSTPtr->seqStr[startSL + siNt];
+      /*else keep the random base (mutation)*/
+   } /*Loop: copy and mutate sequence*/
+
+   return 0;
+} /*mutSeq_bench*/
+
+/*--------------------------------------------------------\
+| Fun08: pHead_bench
+|   - prints the header for the tsv output
+| Input:
+|   - outFILE:
+|     o FILE pointer to print header to
+| Output:
+|   - Prints:
+|     o tsv header to outFILE
+\--------------------------------------------------------*/
+void
+pHead_bench(
+   void *outFILE
+){
+   fprintf(
+      (FILE *) outFILE,
+      "kernel\tinput\tunit\tref_len\tqry_len\treps\tcount"
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "\tseconds\tper_sec\tgcups\tpeak_rss_kb\tcheck%s",
+      str_endLine
+   );
+} /*pHead_bench*/
+
+/*--------------------------------------------------------\
+| Fun09: pResult_bench
+|   - prints the result for one kernel
+| Input:
+|   - outFILE:
+|     o FILE pointer to print result to
+|   - jsonBl:
+|     o 1: print result as a json object
+|     o 0: print result as a tsv line
+|   - kernelStr:
+|     o c-string with name of kernel
+|   - inStr:
+|     o c-string with input file name (or "synthetic")
+|   - cellBl:
+|     o 1: countDbl is dynamic programing cells (gcups)
+|     o 0: countDbl is bases (no gcups)
+|   - refLenSL:
+|     o reference bases used by the kernel
+|   - qryLenSL:
+|     o query bases used by the kernel (all queries)
+|   - repSL:
+|     o number of times kernel was run
+|   - countDbl:
+|     o number of cells or bases processed (all repeats)
+|   - secDbl:
+|     o wall time in seconds (all repeats)
+|   - checkSL:
+|     o summed score, hits, or sequences (should be the
+|       same between commits)
+| Output:
+|   - Prints:
+|     o result to outFILE
+\--------------------------------------------------------*/
+void
+pResult_bench(
+   void *outFILE,
+   signed char jsonBl,
+   signed char *kernelStr,
+   signed char *inStr,
+   signed char cellBl,
+   signed long refLenSL,
+   signed long qryLenSL,
+   signed long repSL,
+   double countDbl,
+   double secDbl,
+   signed long checkSL
+){
+   double perSecDbl = 0;
+
+   if(secDbl > 0)
+      perSecDbl = countDbl / secDbl;
+
+   if(jsonBl)
+   { /*If: printing json*/
+      fprintf(
+         (FILE *) outFILE,
+         "{\"kernel\": \"%s\", \"input\": \"%s\",",
+         kernelStr,
+         inStr
+      );
+
+      fprintf(
+         (FILE *) outFILE,
+         " \"unit\": \"%s\", \"ref_len\": %li,",
+         cellBl ? "cells" : "bases",
+         refLenSL
+      );
+
+      fprintf(
+         (FILE *) outFILE,
+         " \"qry_len\": %li, \"reps\": %li, \"count\": %.0f,",
+         qryLenSL,
+         repSL,
+         countDbl
+      );
+
+      fprintf(
+         (FILE *) outFILE,
+         " \"seconds\": %.6f, \"per_sec\": %.0f,",
+         secDbl,
+         perSecDbl
+      );
+
+      if(cellBl)
+         fprintf(
+            (FILE *) outFILE,
+            " \"gcups\": %.6f,",
+            perSecDbl / 1000000000.0
+         );
+      else
+         fprintf((FILE *) outFILE, " \"gcups\": null,");
+
+      fprintf(
+         (FILE *) outFILE,
+         " \"peak_rss_kb\": %li, \"check\": %li}%s",
+         peakRSS_bench(),
+         checkSL,
+         str_endLine
+      );
+   } /*If: printing json*/
+
+   else
+   { /*Else: printing tsv*/
+      fprintf(
+         (FILE *) outFILE,
+         "%s\t%s\t%s\t%li\t%li\t%li\t%.0f\t%.6f\t%.0f",
+         kernelStr,
+         inStr,
+         cellBl ? "cells" : "bases",
+         refLenSL,
+         qryLenSL,
+         repSL,
+         countDbl,
+         secDbl,
+         perSecDbl
+      );
+
+      if(cellBl)
+         fprintf(
+            (FILE *) outFILE,
+            "\t%.6f",
+            perSecDbl / 1000000000.0
+         );
+      else
+         fprintf((FILE *) outFILE, "\tNA");
+
+      fprintf(
+         (FILE *) outFILE,
+         "\t%li\t%li%s",
+         peakRSS_bench(),
+         checkSL,
+         str_endLine
+      );
+   } /*Else: printing tsv*/
+} /*pResult_bench*/
+
+/*--------------------------------------------------------\
+| Fun10: aln_bench
+|   - times one of the alignment kernels
+| Input:
+|   - kernelSC:
+|     o kernel to time; def_memwater_bench,
+|       def_memwaterScan_bench, def_water_bench,
+|       def_needle_bench, or def_hirschberg_bench
+|   - qryAryST:
+|     o seqST struct array with queries to align
+|       (converted with seqToIndex_alnSet)
+|   - numQrySI:
+|     o number of queries in qryAryST
+|   - refSTPtr:
+|     o seqST struct pointer with reference to align to
+|       (converted with seqToIndex_alnSet)
+|   - winSL:
+|     o number of reference bases to use for water,
+|       needle, and hirschberg (0 for all)
+|   - repSL:
+|     o number of times to align each query
+|   - alnSetPtr:
+|     o alnSet struct pointer with alignment settings
+|   - cellsDblPtr:
+|     o double pointer to get number of cells scored
+|   - refLenSLPtr:
+|     o signed long pointer to get reference bases used
+|   - secDblPtr:
+|     o double pointer to get seconds the kernel took
+| Output:
+|   - Modifies:
+|     o cellsDblPtr, refLenSLPtr, and secDblPtr
+|   - Returns:
+|     o summed score of all alignments
+|     o def_memErr_hirschberg (very negative) for memory
+|       errors
+\--------------------------------------------------------*/
+signed long
+aln_bench(
+   signed char kernelSC,     /*kernel to time*/
+   struct seqST *qryAryST,   /*queries*/
+   signed int numQrySI,      /*number of queries*/
+   struct seqST *refSTPtr,   /*reference*/
+   signed long winSL,        /*ref bases (not linear)*/
+   signed long repSL,        /*times to align*/
+   struct alnSet *alnSetPtr, /*alignment settings*/
+   double *cellsDblPtr,      /*gets cells scored*/
+   signed long *refLenSLPtr, /*gets ref bases used*/
+   double *secDblPtr         /*gets time taken*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun10 TOC:
+   '   - times one of the alignment kernels
+   '   o fun10 sec01:
+   '     - variable declarations
+   '   o fun10 sec02:
+   '     - set up structures and count cells
+   '   o fun10 sec03:
+   '     - time the kernel
+   '   o fun10 sec04:
+   '     - clean up and return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long scoreSL = 0;
+   signed long totalSL = 0;
+   signed long repOnSL = 0;
+   signed int siQry = 0;
+   double startDbl = 0;
+
+   signed long oldEndSL = refSTPtr->endAlnSL;
+
+   /*memwater coordinates (not used)*/
+   signed long refStartSL = 0;
+   signed long refEndSL = 0;
+   signed long qryStartSL = 0;
+   signed long qryEndSL = 0;
+
+   struct dirMatrix matrixStackST;
+   struct samEntry samStackST;
+   struct aln_memwaterScan scanStackST;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec02:
+   ^   - set up structures and count cells
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   init_dirMatrix(&matrixStackST);
+   init_samEntry(&samStackST);
+   init_aln_memwaterScan(&scanStackST);
+
+   if(kernelSC == def_hirschberg_bench)
+   { /*If: hirschberg, need a samEntry*/
+      if( setup_samEntry(&samStackST) )
+         goto memErr_fun10_sec04;
+   } /*If: hirschberg, need a samEntry*/
+
+   if(
+         kernelSC
+      & (def_water_bench|def_needle_bench|def_hirschberg_bench)
+   ){ /*If: kernel is not linear memory*/
+      if(winSL > 0 && winSL < refSTPtr->seqLenSL)
+         refSTPtr->endAlnSL = winSL - 1;
+   }  /*If: kernel is not linear memory*/
+
+   *refLenSLPtr =
+      refSTPtr->endAlnSL - refSTPtr->offsetSL + 1;
+
+   *cellsDblPtr = 0;
+
+   for(siQry = 0; siQry < numQrySI; ++siQry)
+      *cellsDblPtr +=
+           (double) *refLenSLPtr
+         * (double)
+           (   qryAryST[siQry].endAlnSL
+             - qryAryST[siQry].offsetSL
+             + 1
+           );
+
+   *cellsDblPtr *= (double) repSL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec03:
+   ^   - time the kernel
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   startDbl = wallTime_bench();
+
+   for(repOnSL = 0; repOnSL < repSL; ++repOnSL)
+   { /*Loop: repeat the kernel*/
+      for(siQry = 0; siQry < numQrySI; ++siQry)
+      { /*Loop: align each query*/
+         switch(kernelSC)
+         { /*Switch: find kernel to run*/
+            case def_memwater_bench:
+               scoreSL =
+                  memwater(
+                     &qryAryST[siQry],
+                     refSTPtr,
+                     &refStartSL,
+                     &refEndSL,
+                     &qryStartSL,
+                     &qryEndSL,
+                     alnSetPtr
+                  );
+
+               if(scoreSL < 0)
+                  goto memErr_fun10_sec04;
+               break;
+
+            case def_memwaterScan_bench:
+               scoreSL =
+                  memwaterScan(
+                     &qryAryST[siQry],
+                     refSTPtr,
+                     &scanStackST,
+                     alnSetPtr
+                  );
+
+               if(scoreSL < 0)
+                  goto memErr_fun10_sec04;
+               break;
+
+            case def_water_bench:
+               scoreSL =
+                  water(
+                     &qryAryST[siQry],
+                     refSTPtr,
+                     &matrixStackST,
+                     alnSetPtr
+                  );
+
+               if(matrixStackST.errSC)
+                  goto memErr_fun10_sec04;
+               break;
+
+            case def_needle_bench:
+               scoreSL =
+                  needle(
+                     &qryAryST[siQry],
+                     refSTPtr,
+                     &matrixStackST,
+                     alnSetPtr
+                  );
+
+               if(matrixStackST.errSC)
+                  goto memErr_fun10_sec04;
+               break;
+
+            case def_hirschberg_bench:
+               /*hirschberg takes the reference first*/
+               scoreSL =
+                  aln_hirschberg(
+                     refSTPtr,
+                     &qryAryST[siQry],
+                     &samStackST,
+                     alnSetPtr
+                  );
+
+               if(scoreSL == def_memErr_hirschberg)
+                  goto memErr_fun10_sec04;
+               break;
+         } /*Switch: find kernel to run*/
+
+         totalSL += scoreSL;
+      } /*Loop: align each query*/
+   } /*Loop: repeat the kernel*/
+
+   *secDblPtr = wallTime_bench() - startDbl;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec04:
+   ^   - clean up and return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   goto ret_fun10_sec04;
+
+   memErr_fun10_sec04:;
+      totalSL = def_memErr_hirschberg;
+      goto ret_fun10_sec04;
+
+   ret_fun10_sec04:;
+      refSTPtr->endAlnSL = oldEndSL;
+      freeStack_dirMatrix(&matrixStackST);
+      freeStack_samEntry(&samStackST);
+      freeStack_aln_memwaterScan(&scanStackST);
+      return totalSL;
+} /*aln_bench*/
+
+/*--------------------------------------------------------\
+| Fun11: kmerFind_bench
+|   - times the kmerFind gene search (what demux -gene
+|     and the annotateASFV.sh -fast mode use)
+| Input:
+|   - qryAryST:
+|     o seqST struct array with queries (genes) to find
+|       (not converted with seqToIndex_alnSet)
+|   - numQrySI:
+|     o number of queries in qryAryST
+|   - refSTPtr:
+|     o seqST struct pointer with reference to search
+|       (not converted with seqToIndex_alnSet)
+|   - repSL:
+|     o number of times to search for each gene
+|   - alnSetPtr:
+|     o alnSet struct pointer with alignment settings
+|   - basesDblPtr:
+|     o double pointer to get number of reference bases
+|       scanned (reference length * genes * repeats)
+|   - secDblPtr:
+|     o double pointer to get seconds the kernel took
+| Output:
+|   - Modifies:
+|     o basesDblPtr and secDblPtr
+|   - Returns:
+|     o number of hits found
+|     o -1 for memory errors
+\--------------------------------------------------------*/
+signed long
+kmerFind_bench(
+   struct seqST *qryAryST,   /*genes*/
+   signed int numQrySI,      /*number of genes*/
+   struct seqST *refSTPtr,   /*reference*/
+   signed long repSL,        /*times to search*/
+   struct alnSet *alnSetPtr, /*alignment settings*/
+   double *basesDblPtr,      /*gets bases scanned*/
+   double *secDblPtr         /*gets time taken*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun11 TOC:
+   '   - times the kmerFind gene search
+   '   o fun11 sec01:
+   '     - variable declarations
+   '   o fun11 sec02:
+   '     - build the gene kmer tables
+   '   o fun11 sec03:
+   '     - time the search
+   '   o fun11 sec04:
+   '     - clean up and return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long totalSL = 0;
+   signed long repOnSL = 0;
+   signed int siQry = 0;
+   signed int hitsSI = 0;
+   unsigned int longestUI = 0;
+   double startDbl = 0;
+
+   struct tblST_kmerFind tblStackST;
+   struct refST_kmerFind *geneHeapAryST = 0;
+
+   signed char *dirHeapArySC = 0;
+   signed short *primHeapArySS = 0;
+   signed int *scoreHeapArySI = 0;
+   signed int *startHeapArySI = 0;
+   signed int *endHeapArySI = 0;
+   signed short *primStartHeapArySS = 0;
+   signed short *primEndHeapArySS = 0;
+   signed int sizeSI = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec02:
+   ^   - build the gene kmer tables
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   init_tblST_kmerFind(&tblStackST);
+
+   if( setup_tblST_kmerFind(&tblStackST, def_lenKmer_bench) )
+      goto memErr_fun11_sec04;
+
+   geneHeapAryST =
+      malloc(numQrySI * sizeof(struct refST_kmerFind));
+   if(! geneHeapAryST)
+      goto memErr_fun11_sec04;
+
+   for(siQry = 0; siQry < numQrySI; ++siQry)
+      init_refST_kmerFind(&geneHeapAryST[siQry]);
+
+   for(siQry = 0; siQry < numQrySI; ++siQry)
+   { /*Loop: add genes to kmer tables*/
+      if(
+         setup_refST_kmerFind(
+            &geneHeapAryST[siQry],
+            def_lenKmer_bench
+         )
+      ) goto memErr_fun11_sec04;
+
+      longestUI =
+         addSeqToRefST_kmerFind(
+            &tblStackST,
+            &geneHeapAryST[siQry],
+            &qryAryST[siQry],
+            def_kmerPerc_bench,
+            longestUI,
+            alnSetPtr
+         );
+
+      if(! longestUI)
+         goto memErr_fun11_sec04;
+   } /*Loop: add genes to kmer tables*/
+
+   if(
+      prep_tblST_kmerFind(
+         &tblStackST,
+         def_extraNtInWin_kmerFind,
+         def_percShift_kmerFind,
+         longestUI
+      )
+   ) goto memErr_fun11_sec04;
+
+   *basesDblPtr =
+        (double) refSTPtr->seqLenSL
+      * (double) numQrySI
+      * (double) repSL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec03:
+   ^   - time the search
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   startDbl = wallTime_bench();
+
+   for(repOnSL = 0; repOnSL < repSL; ++repOnSL)
+   { /*Loop: repeat the kernel*/
+      for(siQry = 0; siQry < numQrySI; ++siQry)
+      { /*Loop: find each gene (as demux -gene does)*/
+         if(
+            setChange_tblST_kmerFind(
+               &tblStackST,
+               def_extraNtInWin_kmerFind,
+               def_percShift_kmerFind,
+               geneHeapAryST[siQry].forSeqST->seqLenSL
+            )
+         ) goto memErr_fun11_sec04;
+
+         hitsSI =
+            fxAllFindPrims_kmerFind(
+               &tblStackST,
+               &geneHeapAryST[siQry],
+               1,
+               refSTPtr,
+               def_percScore_bench,
+               &dirHeapArySC,
+               &primHeapArySS,
+               &scoreHeapArySI,
+               &startHeapArySI,
+               &endHeapArySI,
+               &primStartHeapArySS,
+               &primEndHeapArySS,
+               &sizeSI,
+               alnSetPtr
+            );
+
+         if(hitsSI < 0)
+            goto memErr_fun11_sec04;
+
+         totalSL += hitsSI;
+      } /*Loop: find each gene (as demux -gene does)*/
+   } /*Loop: repeat the kernel*/
+
+   *secDblPtr = wallTime_bench() - startDbl;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec04:
+   ^   - clean up and return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   goto ret_fun11_sec04;
+
+   memErr_fun11_sec04:;
+      totalSL = -1;
+      goto ret_fun11_sec04;
+
+   ret_fun11_sec04:;
+      freeStack_tblST_kmerFind(&tblStackST);
+
+      if(geneHeapAryST)
+         freeHeapAry_refST_kmerFind(geneHeapAryST, numQrySI);
+      geneHeapAryST = 0;
+
+      if(dirHeapArySC)
+         free(dirHeapArySC);
+      dirHeapArySC = 0;
+
+      if(primHeapArySS)
+         free(primHeapArySS);
+      primHeapArySS = 0;
+
+      if(scoreHeapArySI)
+         free(scoreHeapArySI);
+      scoreHeapArySI = 0;
+
+      if(startHeapArySI)
+         free(startHeapArySI);
+      startHeapArySI = 0;
+
+      if(endHeapArySI)
+         free(endHeapArySI);
+      endHeapArySI = 0;
+
+      if(primStartHeapArySS)
+         free(primStartHeapArySS);
+      primStartHeapArySS = 0;
+
+      if(primEndHeapArySS)
+         free(primEndHeapArySS);
+      primEndHeapArySS = 0;
+
+      return totalSL;
+} /*kmerFind_bench*/
+
+/*--------------------------------------------------------\
+| Fun12: gzSeqST_bench
+|   - times reading a fasta (or fasta.gz) file
+| Input:
+|   - fileStr:
+|     o c-string with path to file to read
+|   - repSL:
+|     o number of times to read the file
+|   - basesDblPtr:
+|     o double pointer to get number of bases read
+|   - secDblPtr:
+|     o double pointer to get seconds the kernel took
+| Output:
+|   - Modifies:
+|     o basesDblPtr and secDblPtr
+|   - Returns:
+|     o number of sequences read
+|     o -1 for memory errors
+|     o -2 for file errors
+\--------------------------------------------------------*/
+signed long
+gzSeqST_bench(
+   signed char *fileStr,  /*file to read*/
+   signed long repSL,     /*times to read file*/
+   double *basesDblPtr,   /*gets bases read*/
+   double *secDblPtr      /*gets time taken*/
+){
+   signed long numSeqSL = 0;
+   signed long repOnSL = 0;
+   signed char errSC = 0;
+   signed char typeSC = 0;
+   double startDbl = 0;
+
+   struct file_inflate fileStackST;
+   struct seqST seqStackST;
+   FILE *inFILE = 0;
+
+   init_file_inflate(&fileStackST);
+   init_seqST(&seqStackST);
+   *basesDblPtr = 0;
+
+   startDbl = wallTime_bench();
+
+   for(repOnSL = 0; repOnSL < repSL; ++repOnSL)
+   { /*Loop: read the file repSL times*/
+      inFILE = fopen((char *) fileStr, "rb");
+
+      if(! inFILE)
+         goto fileErr_fun12;
+
+      errSC =
+         get_gzSeqST(
+            &fileStackST,
+            &typeSC,
+            &seqStackST,
+            inFILE
+         );
+      inFILE = 0; /*fileStackST closes the file*/
+
+      while(! errSC)
+      { /*Loop: read all sequences*/
+         ++numSeqSL;
+         *basesDblPtr += (double) seqStackST.seqLenSL;
+
+         errSC =
+            get_gzSeqST(&fileStackST, &typeSC, &seqStackST, 0);
+      } /*Loop: read all sequences*/
+
+      if(errSC != def_EOF_seqST)
+      { /*If: had an error*/
+         if(errSC & def_memErr_seqST)
+            goto memErr_fun12;
+         goto fileErr_fun12;
+      } /*If: had an error*/
+
+      freeStack_file_inflate(&fileStackST); /*close file*/
+   } /*Loop: read the file repSL times*/
+
+   *secDblPtr = wallTime_bench() - startDbl;
+   goto ret_fun12;
+
+   memErr_fun12:;
+      numSeqSL = -1;
+      goto ret_fun12;
+
+   fileErr_fun12:;
+      numSeqSL = -2;
+      goto ret_fun12;
+
+   ret_fun12:;
+      freeStack_file_inflate(&fileStackST);
+      freeStack_seqST(&seqStackST);
+      return numSeqSL;
+} /*gzSeqST_bench*/
+
+/*--------------------------------------------------------\
+| Main:
+|   - benchmark the kernels
+| Input:
+|   - numArgsSI:
+|     o number of arguments user input
+|   - argAryStr:
+|     o c-string array with user input
+| Output:
+|   - Prints:
+|     o timings to stdout
+|   - Returns:
+|     o 0 for no errors
+|     o 1 for errors
+\--------------------------------------------------------*/
+int main(
+   int numArgsSI,
+   char *argAryStr[]
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Main TOC:
+   '   o main sec01:
+   '     - variable declarations
+   '   o main sec02:
+   '     - initialize, get input, and read sequences
+   '   o main sec03:
+   '     - time the kernels
+   '   o main sec04:
+   '     - clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *refFileStr = 0;
+   signed char *qryFileStr = 0;
+   signed char *refInStr = (signed char *) "synthetic";
+   signed char *qryInStr = (signed char *) "synthetic";
+   signed char kernelSC = def_all_bench;
+   signed char jsonBl = 0;
+   signed char headBl = 1;
+   signed char errSC = 0;
+   signed char typeSC = 0;
+
+   signed long setArySL[6];
+   unsigned long seedUL = 0;
+   signed int numQrySI = 0;
+   signed int siQry = 0;
+   signed long qryLenSL = 0;   /*all query bases*/
+   signed long refLenSL = 0;   /*ref bases kernel used*/
+   signed long checkSL = 0;
+   double countDbl = 0;
+   double secDbl = 0;
+   signed char idStr[64];
+   signed char siKernel = 0;
+
+   /*kernel names; in order run (index is flag bit)*/
+   signed char *kernelAryStr[] =
+   {
+      (signed char *) "memwater",
+      (signed char *) "memwaterScan",
+      (signed char *) "water",
+      (signed char *) "needle",
+      (signed char *) "hirschberg"
+   };
+
+   struct seqST refStackST;
+   struct seqST *qryHeapAryST = 0;
+   struct file_inflate fileStackST;
+   struct alnSet alnStackST;
+   FILE *inFILE = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec02:
+   ^   - initialize, get input, and read sequences
+   ^   o main sec02 sub01:
+   ^     - initialize and get input
+   ^   o main sec02 sub02:
+   ^     - get reference
+   ^   o main sec02 sub03:
+   ^     - get queries
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Main Sec02 Sub01:
+   *   - initialize and get input
+   \*****************************************************/
+
+   init_seqST(&refStackST);
+   init_file_inflate(&fileStackST);
+   init_alnSet(&alnStackST);
+
+   setArySL[0] = def_refLen_bench;
+   setArySL[1] = def_qryLen_bench;
+   setArySL[2] = def_numQry_bench;
+   setArySL[3] = def_win_bench;
+   setArySL[4] = def_rep_bench;
+   setArySL[5] = def_seed_bench;
+
+   errSC =
+      input_bench(
+         numArgsSI,
+         argAryStr,
+         &refFileStr,
+         &qryFileStr,
+         &kernelSC,
+         setArySL,
+         &jsonBl,
+         &headBl
+      );
+
+   if(errSC)
+   { /*If: help message, version, or error*/
+      --errSC; /*help message/version goes to 0*/
+      goto ret_main_sec04;
+   } /*If: help message, version, or error*/
+
+   seedUL = (unsigned long) setArySL[5];
+
+   if(setArySL[2] < 1)
+      setArySL[2] = 1;
+   if(setArySL[4] < 1)
+      setArySL[4] = 1;
+
+   /*****************************************************\
+   * Main Sec02 Sub02:
+   *   - get reference
+   \*****************************************************/
+
+   if(refFileStr)
+   { /*If: user input a reference*/
+      inFILE = fopen((char *) refFileStr, "rb");
+      if(! inFILE)
+         goto refErr_main_sec04;
+
+      errSC =
+         get_gzSeqST(&fileStackST, &typeSC,&refStackST,inFILE);
+      inFILE = 0;
+      freeStack_file_inflate(&fileStackST); /*closes file*/
+
+      if(errSC && errSC != def_EOF_seqST)
+      { /*If: had an error*/
+         if(errSC & def_memErr_seqST)
+            goto memErr_main_sec04;
+         goto refErr_main_sec04;
+      } /*If: had an error*/
+
+      if(refStackST.seqLenSL < 1)
+         goto refErr_main_sec04;
+
+      refStackST.offsetSL = 0;
+      refStackST.endAlnSL = refStackST.seqLenSL - 1;
+      refInStr = refFileStr;
+   } /*If: user input a reference*/
+
+   else if(
+      synSeq_bench(
+         &refStackST,
+         (signed char *) "synthetic_ref",
+         setArySL[0],
+         &seedUL
+      )
+   ) goto memErr_main_sec04;
+
+   /*****************************************************\
+   * Main Sec02 Sub03:
+   *   - get queries
+   \*****************************************************/
+
+   qryHeapAryST = malloc(setArySL[2] * sizeof(struct seqST));
+   if(! qryHeapAryST)
+      goto memErr_main_sec04;
+
+   for(siQry = 0; siQry < setArySL[2]; ++siQry)
+      init_seqST(&qryHeapAryST[siQry]);
+
+   if(qryFileStr)
+   { /*If: user input queries*/
+      inFILE = fopen((char *) qryFileStr, "rb");
+      if(! inFILE)
+         goto qryErr_main_sec04;
+
+      errSC = 0;
+
+      while(numQrySI < setArySL[2])
+      { /*Loop: read in queries*/
+         errSC =
+            get_gzSeqST(
+               &fileStackST,
+               &typeSC,
+               &qryHeapAryST[numQrySI],
+               inFILE
+            );
+         inFILE = 0;
+
+         if(errSC)
+            break;
+
+         qryHeapAryST[numQrySI].offsetSL = 0;
+         qryHeapAryST[numQrySI].endAlnSL =
+            qryHeapAryST[numQrySI].seqLenSL - 1;
+         qryLenSL += qryHeapAryST[numQrySI].seqLenSL;
+         ++numQrySI;
+      } /*Loop: read in queries*/
+
+      freeStack_file_inflate(&fileStackST);
+
+      if(errSC && errSC != def_EOF_seqST)
+      { /*If: had an error*/
+         if(errSC & def_memErr_seqST)
+            goto memErr_main_sec04;
+         goto qryErr_main_sec04;
+      } /*If: had an error*/
+
+      if(numQrySI < 1)
+         goto qryErr_main_sec04;
+
+      qryInStr = qryFileStr;
+   } /*If: user input queries*/
+
+   else
+   { /*Else: make synthetic queries*/
+      if(setArySL[1] > refStackST.seqLenSL)
+         setArySL[1] = refStackST.seqLenSL;
+
+      for(
+         numQrySI = 0;
+         numQrySI < setArySL[2];
+         ++numQrySI
+      ){ /*Loop: make synthetic queries*/
+         idStr[0] = '\0';
+         cpStr_ulCp(idStr, (signed char *) "synthetic_qry");
+
+         if(
+            mutSeq_bench(
+               &qryHeapAryST[numQrySI],
+               idStr,
+               &refStackST,
+               setArySL[1],
+               &seedUL
+            )
+         ) goto memErr_main_sec04;
+
+         if(numQrySI & 1)
+            revCmpStr_seqST(
+               qryHeapAryST[numQrySI].seqStr,
+               0,
+               qryHeapAryST[numQrySI].seqLenSL
+            ); /*so both directions are tested*/
+
+         qryLenSL += qryHeapAryST[numQrySI].seqLenSL;
+      } /*Loop: make synthetic queries*/
+   } /*Else: make synthetic queries*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec03:
+   ^   - time the kernels
+   ^   o main sec03 sub01:
+   ^     - print header
+   ^   o main sec03 sub02:
+   ^     - gzSeqST (file reading)
+   ^   o main sec03 sub03:
+   ^     - kmerFind (needs non-index sequences)
+   ^   o main sec03 sub04:
+   ^     - alignment kernels
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Main Sec03 Sub01:
+   *   - print header
+   \*****************************************************/
+
+   if(headBl && ! jsonBl)
+      pHead_bench(stdout);
+
+   /*****************************************************\
+   * Main Sec03 Sub02:
+   *   - gzSeqST (file reading)
+   \*****************************************************/
+
+   if(kernelSC & def_gzSeqST_bench)
+   { /*If: timing file reading*/
+      if(! refFileStr)
+         fprintf(
+            stderr,
+            "skipping gzSeqST, it needs -ref%s",
+            str_endLine
+         );
+
+      else
+      { /*Else: have a file to read*/
+         checkSL =
+            gzSeqST_bench(
+               refFileStr,
+               setArySL[4],
+               &countDbl,
+               &secDbl
+            );
+
+         if(checkSL == -1)
+            goto memErr_main_sec04;
+         else if(checkSL < 0)
+            goto refErr_main_sec04;
+
+         pResult_bench(
+            stdout,
+            jsonBl,
+            (signed char *) "gzSeqST",
+            refInStr,
+            0,
+            (signed long) (countDbl / setArySL[4]),
+            0,
+            setArySL[4],
+            countDbl,
+            secDbl,
+            checkSL
+         );
+      } /*Else: have a file to read*/
+   } /*If: timing file reading*/
+
+   /*****************************************************\
+   * Main Sec03 Sub03:
+   *   - kmerFind (needs non-index sequences)
+   \*****************************************************/
+
+   if(kernelSC & def_kmerFind_bench)
+   { /*If: timing kmerFind*/
+      checkSL =
+         kmerFind_bench(
+            qryHeapAryST,
+            numQrySI,
+            &refStackST,
+            setArySL[4],
+            &alnStackST,
+            &countDbl,
+            &secDbl
+         );
+
+      if(checkSL < 0)
+         goto memErr_main_sec04;
+
+      pResult_bench(
+         stdout,
+         jsonBl,
+         (signed char *) "kmerFind",
+         qryInStr,
+         0,
+         refStackST.seqLenSL,
+         qryLenSL,
+         setArySL[4],
+         countDbl,
+         secDbl,
+         checkSL
+      );
+   } /*If: timing kmerFind*/
+
+   /*****************************************************\
+   * Main Sec03 Sub04:
+   *   - alignment kernels
+   \*****************************************************/
+
+   seqToIndex_alnSet(refStackST.seqStr);
+
+   for(siQry = 0; siQry < numQrySI; ++siQry)
+      seqToIndex_alnSet(qryHeapAryST[siQry].seqStr);
+
+   for(siKernel = 0; siKernel < 5; ++siKernel)
+   { /*Loop: time the alignment kernels*/
+      if(! (kernelSC & (1 << siKernel)) )
+         continue;
+
+      /*kmerFind and the aligners can change the aligned
+      `  region, so reset to full length for each kernel
+      */
+      refStackST.offsetSL = 0;
+      refStackST.endAlnSL = refStackST.seqLenSL - 1;
+
+      for(siQry = 0; siQry < numQrySI; ++siQry)
+      { /*Loop: reset query aligned regions*/
+         qryHeapAryST[siQry].offsetSL = 0;
+         qryHeapAryST[siQry].endAlnSL =
+            qryHeapAryST[siQry].seqLenSL - 1;
+      } /*Loop: reset query aligned regions*/
+
+      checkSL =
+         aln_bench(
+            (signed char) (1 << siKernel),
+            qryHeapAryST,
+            numQrySI,
+            &refStackST,
+            setArySL[3],
+            setArySL[4],
+            &alnStackST,
+            &countDbl,
+            &refLenSL,
+            &secDbl
+         );
+
+      if(checkSL == def_memErr_hirschberg)
+         goto memErr_main_sec04;
+
+      pResult_bench(
+         stdout,
+         jsonBl,
+         kernelAryStr[(signed int) siKernel],
+         qryInStr,
+         1,
+         refLenSL,
+         qryLenSL,
+         setArySL[4],
+         countDbl,
+         secDbl,
+         checkSL
+      );
+   } /*Loop: time the alignment kernels*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec04:
+   ^   - clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errSC = 0;
+   goto ret_main_sec04;
+
+   memErr_main_sec04:;
+      fprintf(stderr, "memory error%s", str_endLine);
+      errSC = 1;
+      goto ret_main_sec04;
+
+   refErr_main_sec04:;
+      fprintf(
+         stderr,
+         "could not read -ref %s%s",
+         refFileStr,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   qryErr_main_sec04:;
+      fprintf(
+         stderr,
+         "could not read -qry %s%s",
+         qryFileStr,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   ret_main_sec04:;
+      if(inFILE)
+         fclose(inFILE);
+      inFILE = 0;
+
+      freeStack_file_inflate(&fileStackST);
+      freeStack_seqST(&refStackST);
+      freeStack_alnSet(&alnStackST);
+
+      if(qryHeapAryST)
+      { /*If: have queries to free*/
+         for(siQry = 0; siQry < setArySL[2]; ++siQry)
+            freeStack_seqST(&qryHeapAryST[siQry]);
+         free(qryHeapAryST);
+      } /*If: have queries to free*/
+      qryHeapAryST = 0;
+
+      return errSC;
+} /*main*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -32,11 +32,15 @@
 #include "../genLib/ulCp.h"
 #include "../genLib/base10str.h"
 #include "../genLib/inflate.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
+#include "../genLib/trace.h"
 #include "../genBio/seqST.h"
 #include "../genBio/gzSeqST.h"
 #include "../genAln/alnSet.h"
 #include "../genAln/kmerFind.h"
 #include "../genAln/demux.h"
+#include "../genAln/hitTbl.h"
 
 
 /*.h files only*/
@@ -52,6 +56,8 @@
 !   - .c  #include "../genAln/indexToCoord.h"
 !   - .c  #include "../genLib/shellSort.h"
 !   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genLib/numToStr.h"
+!   - .c  #include "../genLib/ptrAry.h"
 !   - .c  #include "memwater.h"
 !   - .h  #include "../genLib/genMath.h"
 !   - .h  #include "alnDefs.h"
@@ -262,6 +268,104 @@ phelp_mainDemux(
       str_endLine
    );
 
+   fprintf(
+      (FILE *) outFILE,
+      "  -stats file.tsv: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o print kmerFind counters to file.tsv; one%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      row per gene (-gene) or one row (all)%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o windows scanned, windows passing kmer check,%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      alignments, alignment cells, hits under%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      -perc-score, overlapping hits dropped, and%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      hits kept%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -trace trace.json: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o add chrome/perfetto trace events (timings) to%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      trace.json; appends if trace.json exists%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o marks reading, each gene (-gene), each%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      memwater alignment, and hit filtering%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -score-tbl: [No]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o print filtered scores.tsv rows (no header)%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      instead of gene coordinates (-gene only)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -high-tbl high.tsv: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o append the highest scoring scores.tsv%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      row(s) to high.tsv (turns on -score-tbl)%s",
+      str_endLine
+   );
+
    /*****************************************************\
    * Fun02 Sec02 Sub03:
    *   - min percent score
@@ -571,6 +675,15 @@ phelp_mainDemux(
 |   - prefixStrPtr:
 |     o c-string pointer to get the prefix for the output
 |       file
+|   - statsStrPtr:
+|     o c-string pointer to get the -stats file name
+|   - traceStrPtr:
+|     o c-string pointer to get the -trace file name
+|   - scoreTblBlPtr:
+|     o signed char pointer to get if printing score
+|       table rows (1) or gene coordinates (0)
+|   - highStrPtr:
+|     o c-string pointer to get the -high-tbl file name
 |   - splitSIPtr:
 |     o signed int pointer to get maximum splits to do
 |   - minDistSIPtr:
@@ -611,6 +724,10 @@ input_mainDemux(
    signed char **primTsvStrPtr, /*tsv file with primers*/
    signed char **geneFaStrPtr,  /*fa file with genes*/
    signed char **prefixStrPtr,  /*output file name*/
+   signed char **statsStrPtr,   /*kmerFind counters file*/
+   signed char **traceStrPtr,   /*trace events file*/
+   signed char *scoreTblBlPtr,  /*1: print score table*/
+   signed char **highStrPtr,    /*highest score rows file*/
    signed int *splitSIPtr,      /*max splits to do*/
    signed int *minDistSIPtr,    /*minimum distance*/
    signed int *maxDistSIPtr,    /*minimum distance*/
@@ -720,6 +837,44 @@ input_mainDemux(
          *prefixStrPtr = (signed char *) argAryStr[siArg];
       }  /*Else If: get fasta file with barcodes*/
 
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-stats",
+            (signed char *) argAryStr[siArg]
+         )
+      ){  /*Else If: printing kmerFind counters*/
+         ++siArg;
+         *statsStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: printing kmerFind counters*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-trace",
+            (signed char *) argAryStr[siArg]
+         )
+      ){  /*Else If: printing trace events*/
+         ++siArg;
+         *traceStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: printing trace events*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-score-tbl",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *scoreTblBlPtr = 1;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-high-tbl",
+            (signed char *) argAryStr[siArg]
+         )
+      ){  /*Else If: printing highest scoring rows*/
+         ++siArg;
+         *highStrPtr = (signed char *) argAryStr[siArg];
+         *scoreTblBlPtr = 1;
+      }  /*Else If: printing highest scoring rows*/
+
       /**************************************************\
       * Fun03 Sec02 Sub02:
       *   - get percent mininmum score
@@ -1316,6 +1471,10 @@ main(
    signed char *barcodesFileStr = 0;
    signed char *primTsvStr = 0;
    signed char *geneFaStr = 0;
+   signed char *statsFileStr = 0;
+   signed char *traceFileStr = 0;
+   signed char scoreTblBl = 0; /*1: print scores.tsv rows*/
+   signed char *highFileStr = 0;
 
    signed int fqFileSI = 0;
    signed int splitSI = def_maxSplits_mainDemux;
@@ -1359,10 +1518,23 @@ main(
 
    signed int siGene = 0;
    signed char headBl = 1;
+   struct hitTbl hitStackST; /*hits for -score-tbl*/
+   signed long hitStartSL = 0; /*first hit of a gene*/
+
+   struct stats_kmerFind *statsHeapAryST = 0;
+   signed int statsLenSI = 0; /*number of counters*/
 
    signed char **outFileHeapStrAry = 0;
    FILE *logFILE = 0;
    FILE *outFILE = 0;
+   FILE *statsFILE = 0;
+   FILE *highFILE = 0;
+
+   struct outBuf outStackST; /*buffers outFILE prints*/
+   struct outBuf logStackST; /*buffers logFILE prints*/
+   struct outBuf statsStackST; /*buffers statsFILE prints*/
+   struct outBuf highStackST;  /*buffers highFILE prints*/
+   struct trace traceStackST;  /*-trace file and settings*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec02:
@@ -1386,6 +1558,12 @@ main(
    init_tblST_kmerFind(&tblStackST);
    init_alnSet(&alnStackST);
    init_seqST(&seqStackST);
+   init_outBuf(&outStackST);
+   init_outBuf(&logStackST);
+   init_outBuf(&statsStackST);
+   init_outBuf(&highStackST);
+   init_trace(&traceStackST);
+   init_hitTbl(&hitStackST);
 
    /*****************************************************\
    * Main Sec02 Sub02:
@@ -1400,6 +1578,10 @@ main(
          &primTsvStr,
          &geneFaStr,
          &prefixStr,
+         &statsFileStr,
+         &traceFileStr,
+         &scoreTblBl,
+         &highFileStr,
          &splitSI,
          &minDistSI,
          &maxDistSI,
@@ -1429,6 +1611,40 @@ main(
       goto memErr_main_sec04;
    } /*If: memory error*/
 
+   if(traceFileStr)
+   { /*If: user wanted trace events*/
+      errSC =
+         setup_trace(
+            &traceStackST,
+            traceFileStr,
+            1,
+            (signed char *) "demux"
+         );
+
+      if(errSC == def_memErr_trace)
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "memory error setting up -trace%s",
+            str_endLine
+         );
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+
+      else if(errSC)
+      { /*Else If: file error*/
+         fprintf(
+            stderr,
+            "could not open -trace %s%s",
+            traceFileStr,
+            str_endLine
+         );
+         goto fileErr_main_sec04;
+      } /*Else If: file error*/
+
+      tblStackST.traceSTPtr = &traceStackST;
+   } /*If: user wanted trace events*/
+
    /*****************************************************\
    * Main Sec02 Sub04:
    *   - open files
@@ -1445,6 +1661,12 @@ main(
    +   - read in the barcodes/primers
    \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 
+   begin_trace(
+      tblStackST.traceSTPtr,
+      (signed char *) "read references",
+      (signed char *) "parse"
+   );
+
    if(barcodesFileStr)
    { /*If: barcode demuxing; read barcodes*/
       barHeapAryST =
@@ -1563,6 +1785,12 @@ main(
       } /*If: had an error*/
    } /*Else: primer demuxing*/
 
+   end_trace(
+      tblStackST.traceSTPtr,
+      (signed char *) "read references",
+      (signed char *) "parse"
+   );
+
    /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
    + Main Sec02 Sub04 Cat02:
    +   - open the output files for barcode demux
@@ -1639,8 +1867,20 @@ main(
    \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
 
    else
+   { /*Else: using stdout for output*/
       outFILE = stdout; /*use stdout for primer output*/
 
+      if(setup_outBuf(&outStackST, 0, outFILE))
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "memory error setting up output buffer%s",
+            str_endLine
+         );
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+   } /*Else: using stdout for output*/
+
    /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
    + Main Sec02 Sub04 Cat04:
    +   - open the log file (either mode)
@@ -1674,14 +1914,80 @@ main(
          goto fileErr_main_sec04;
       } /*If: could not open the file*/
 
-      fprintf(logFILE, "id\tlen\tnum_barcodes\tstatus");
-      fprintf(
-         logFILE,
-           "\tid_1\tstart_1\tend_1\tscore_1\t*"
+      if(setup_outBuf(&logStackST, 0, logFILE))
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "memory error setting up log buffer%s",
+            str_endLine
+         );
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+
+      addStr_outBuf(
+         &logStackST,
+         (signed char *) "id\tlen\tnum_barcodes\tstatus"
+      );
+      addStr_outBuf(
+         &logStackST,
+         (signed char *) "\tid_1\tstart_1\tend_1\tscore_1\t*"
       );
-      fprintf(logFILE, "%s", str_endLine);
+      addStr_outBuf(&logStackST, str_endLine);
    } /*If: using the log file (gene mode does not)*/
 
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Main Sec02 Sub04 Cat05:
+   +   - open the kmerFind counters (-stats) file
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   if(statsFileStr)
+   { /*If: user wanted kmerFind counters*/
+      if(geneFaStr)
+         statsLenSI = barLenSI; /*one set per gene*/
+      else
+         statsLenSI = 1; /*one set for all barcodes*/
+
+      statsHeapAryST =
+         malloc(statsLenSI * sizeof(struct stats_kmerFind));
+      if(! statsHeapAryST)
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "memory error setting up -stats%s",
+            str_endLine
+         );
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+
+      for(siGene = 0; siGene < statsLenSI; ++siGene)
+         blank_stats_kmerFind(&statsHeapAryST[siGene]);
+
+      /*gene mode changes this for each gene*/
+      tblStackST.statsSTPtr = statsHeapAryST;
+
+      statsFILE = fopen((char *) statsFileStr, "w");
+      if(! statsFILE)
+      { /*If: could not open the file*/
+         fprintf(
+            stderr,
+            "could not open -stats %s for output%s",
+            statsFileStr,
+            str_endLine
+         );
+         goto fileErr_main_sec04;
+      } /*If: could not open the file*/
+
+      if(setup_outBuf(&statsStackST, 0, statsFILE))
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "memory error setting up -stats buffer%s",
+            str_endLine
+         );
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+   } /*If: user wanted kmerFind counters*/
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec03:
    ^   - demux the fastq files
@@ -1725,6 +2031,11 @@ main(
             goto fqFileErr_main_sec04;
       } /*Else: open a fastq file*/
 
+      begin_trace(
+         tblStackST.traceSTPtr,
+         (signed char *) "read sequence",
+         (signed char *) "parse"
+      );
       errSC =
          get_gzSeqST(
             &fileStackST,
@@ -1732,6 +2043,11 @@ main(
             &seqStackST,
             inFILE
          );
+      end_trace(
+         tblStackST.traceSTPtr,
+         (signed char *) "read sequence",
+         (signed char *) "parse"
+      );
       inFILE = 0; /*pointer is in fileStackST structure*/
       seqSL = 1;
 
@@ -1762,36 +2078,33 @@ main(
                );
 
             cpWhite_ulCp(tmpFileStr, seqStackST.idStr);
-            fprintf(
-               logFILE,
-               "%s\t%li\t%i",
-               tmpFileStr,
-               seqStackST.seqLenSL,
-               coordLenSI >> 2
-            );
+            addStr_outBuf(&logStackST, tmpFileStr);
+            addChar_outBuf(&logStackST, '\t');
+            addSL_outBuf(&logStackST, seqStackST.seqLenSL);
+            addChar_outBuf(&logStackST, '\t');
+            addSL_outBuf(&logStackST, coordLenSI >> 2);
 
             if(coordLenSI <= 0)
             { /*If: had no coords or error*/
                if(! coordLenSI && ! geneFaStr)
-                  fprintf(
-                     logFILE,
-                     "\tno-barcodes\tNA%s",
-                     str_endLine
+                  addStr_outBuf(
+                     &logStackST,
+                     (signed char *) "\tno-barcodes\tNA"
                   );
                else if(coordLenSI > -2 && ! geneFaStr)
-                  fprintf(
-                     logFILE,
-                     "\toverlap-barcodes\tNA%s",
-                     str_endLine
+                  addStr_outBuf(
+                     &logStackST,
+                     (signed char *) "\toverlap-barcodes\tNA"
                   );
                else
                { /*Else: memory error*/
                   if(! geneFaStr)
-                     fprintf(
-                        logFILE,
-                        "\tmemory-error\tNA%s",
-                        str_endLine
+                     addStr_outBuf(
+                        &logStackST,
+                        (signed char *) "\tmemory-error\tNA"
                      );
+                  addStr_outBuf(&logStackST, str_endLine);
+
                   fprintf(
                    stderr,
                    "memory error when finding patterns%s",
@@ -1800,6 +2113,7 @@ main(
                   goto memErr_main_sec04;
                } /*Else: memory error*/
 
+               addStr_outBuf(&logStackST, str_endLine);
                goto getNextSeq_main_sec03_sub06;
             } /*If: had no coords or error*/
          } /*If: not doing gene detection*/
@@ -1813,7 +2127,10 @@ main(
          { /*If: user is using barcode filtering*/
             if(geneFaStr && coordLenSI / 4 > splitSI)
             { /*If: to many barcodes*/
-               fprintf(logFILE, "\tto-many-barcodes");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tto-many-barcodes"
+               );
                goto pcoords_main_sec03_sub03;
             } /*If: to many barcodes*/
 
@@ -1830,16 +2147,26 @@ main(
             if(geneFaStr)
                ; /*gene mode does not use the log file*/
             else if(errSC == 3)
-               fprintf(logFILE, "\tbarcodes-at-both-ends");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tbarcodes-at-both-ends"
+               );
             else if(errSC == 4)
-               fprintf(
-                  logFILE,
-                   "\tbarcodes-next-to-each-other"
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *)
+                     "\tbarcodes-next-to-each-other"
                );
             else if(errSC)
-               fprintf(logFILE, "\tdemux-error");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tdemux-error"
+               );
             else
-               fprintf(logFILE, "\tkept");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tkept"
+               );
          } /*If: user is using barcode filtering*/
 
          /***********************************************\
@@ -1851,6 +2178,24 @@ main(
          { /*Else If: printing gene coordinates*/
             for(siGene = 0; siGene < barLenSI; ++siGene)
             { /*Loop: find hits*/
+               if(statsHeapAryST)
+                  tblStackST.statsSTPtr =
+                     &statsHeapAryST[siGene];
+
+               if(tblStackST.traceSTPtr)
+               { /*If: marking each gene*/
+                  cpWhite_ulCp(
+                     tmpFileStr,
+                     barHeapAryST[siGene].forSeqST->idStr
+                  );
+
+                  begin_trace(
+                     tblStackST.traceSTPtr,
+                     tmpFileStr,
+                     (signed char *) "gene"
+                  );
+               } /*If: marking each gene*/
+
                setChange_tblST_kmerFind(
                   &tblStackST,
                   extraNtF,
@@ -1869,6 +2214,12 @@ main(
                      &alnStackST
                   );
 
+               end_trace(
+                  tblStackST.traceSTPtr,
+                  tmpFileStr,
+                  (signed char *) "gene"
+               );
+
                if(coordLenSI <= 0)
                { /*If: had no coords or error*/
                   if(! coordLenSI && ! geneFaStr)
@@ -1892,15 +2243,96 @@ main(
                   continue;
                } /*If: had no coords or error*/
 
-               errSC =
-                  pGeneCoord_demux(
-                     &seqStackST,
-                     coordHeapArySI,
-                     coordLenSI,
-                     &headBl,
-                     &barHeapAryST[siGene],
-                     outFILE
+               if(scoreTblBl)
+               { /*If: saving hits for a score table*/
+                  cpWhite_ulCp(
+                     tmpFileStr,
+                     barHeapAryST[siGene].forSeqST->idStr
                   );
+                  hitStartSL = hitStackST.lenSL;
+
+                  for(
+                     siCoord = 0;
+                     siCoord < coordLenSI;
+                     siCoord += 4
+                  ){ /*Loop: add hits*/
+                     /*max scores are sums of match scores, so
+                     `  are whole numbers
+                     */
+                     if(coordHeapArySI[siCoord + 3] < 0)
+                        errSC =
+                           add_hitTbl(
+                              &hitStackST,
+                              tmpFileStr,
+                              def_reverse_hitTbl,
+                              -coordHeapArySI[siCoord + 3],
+                              (signed long)
+                                barHeapAryST[siGene].maxRevScoreF,
+                              coordHeapArySI[siCoord + 1] + 1,
+                              coordHeapArySI[siCoord + 2] + 1,
+                              def_NA_hitTbl,
+                              def_NA_hitTbl,
+                              barHeapAryST[
+                                 siGene
+                              ].forSeqST->seqLenSL,
+                                coordHeapArySI[siCoord + 2]
+                              - coordHeapArySI[siCoord + 1]
+                              + 1
+                           );
+                     else
+                        errSC =
+                           add_hitTbl(
+                              &hitStackST,
+                              tmpFileStr,
+                              def_forward_hitTbl,
+                              coordHeapArySI[siCoord + 3],
+                              (signed long)
+                                barHeapAryST[siGene].maxForScoreF,
+                              coordHeapArySI[siCoord + 1] + 1,
+                              coordHeapArySI[siCoord + 2] + 1,
+                              def_NA_hitTbl,
+                              def_NA_hitTbl,
+                              barHeapAryST[
+                                 siGene
+                              ].forSeqST->seqLenSL,
+                                coordHeapArySI[siCoord + 2]
+                              - coordHeapArySI[siCoord + 1]
+                              + 1
+                           );
+
+                     if(errSC)
+                     { /*If: memory error*/
+                        fprintf(
+                           stderr,
+                           "memory error saving hits%s",
+                           str_endLine
+                        );
+                        goto memErr_main_sec04;
+                     } /*If: memory error*/
+                  } /*Loop: add hits*/
+
+                  /*remove overlapping hits from this gene
+                  `  only, so hits from other genes (or
+                  `  other reference sequences) are kept
+                  */
+                  sort_hitTbl(
+                     &hitStackST,
+                     hitStartSL,
+                     def_refSort_hitTbl
+                  );
+                  overlap_hitTbl(&hitStackST, hitStartSL);
+               } /*If: saving hits for a score table*/
+
+               else
+                  errSC =
+                     pGeneCoord_demux(
+                        &seqStackST,
+                        coordHeapArySI,
+                        coordLenSI,
+                        &headBl,
+                        &barHeapAryST[siGene],
+                        &outStackST
+                     );
                free(coordHeapArySI);
                coordHeapArySI = 0;
             } /*Loop: find hits*/
@@ -1923,13 +2355,19 @@ main(
                   coordHeapArySI,
                   coordLenSI,
                   barHeapAryST,
-                  outFILE
+                  &outStackST
                );
 
             if(errSC <- 0)
-               fprintf(logFILE, "\tno-primers");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tno-primers"
+               );
             else
-               fprintf(logFILE, "\tprimers");
+               addStr_outBuf(
+                  &logStackST,
+                  (signed char *) "\tprimers"
+               );
          } /*Else: user is fitering reads*/
 
          pcoords_main_sec03_sub03:;
@@ -1941,17 +2379,28 @@ main(
                     coordHeapArySI[siCoord]
                   ].forSeqST->idStr
                );
-               fprintf(
-                  logFILE,
-                  "\t%s\t%i\t%i\t%i",
-                  tmpFileStr, /*barcode assigned*/
-                  coordHeapArySI[siCoord+1],/*start*/
-                  coordHeapArySI[siCoord+2],/*end*/
-                  coordHeapArySI[siCoord+3] /*score*/
+               addChar_outBuf(&logStackST, '\t');
+               addStr_outBuf(&logStackST, tmpFileStr);
+                  /*barcode assigned*/
+               addChar_outBuf(&logStackST, '\t');
+               addSL_outBuf(
+                  &logStackST,
+                  coordHeapArySI[siCoord + 1] /*start*/
+               );
+               addChar_outBuf(&logStackST, '\t');
+               addSL_outBuf(
+                  &logStackST,
+                  coordHeapArySI[siCoord + 2] /*end*/
+               );
+               addChar_outBuf(&logStackST, '\t');
+               addSL_outBuf(
+                  &logStackST,
+                  coordHeapArySI[siCoord + 3] /*score*/
                );
             } /*Loop: print out the coordinates*/
 
-            fprintf(logFILE, "\t*%s", str_endLine);
+            addStr_outBuf(&logStackST, (signed char *) "\t*");
+            addStr_outBuf(&logStackST, str_endLine);
 
          /***********************************************\
          * Main Sec03 Sub06:
@@ -1959,6 +2408,11 @@ main(
          \***********************************************/
 
          getNextSeq_main_sec03_sub06:;
+            begin_trace(
+               tblStackST.traceSTPtr,
+               (signed char *) "read sequence",
+               (signed char *) "parse"
+            );
             errSC =
                get_gzSeqST(
                   &fileStackST,
@@ -1966,6 +2420,11 @@ main(
                   &seqStackST,
                   0
                );
+            end_trace(
+               tblStackST.traceSTPtr,
+               (signed char *) "read sequence",
+               (signed char *) "parse"
+            );
             ++seqSL;
 
             if(coordHeapArySI)
@@ -1990,6 +2449,95 @@ main(
    ^   - clean up and return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+   if(scoreTblBl && geneFaStr)
+   { /*If: printing score table rows*/
+      /*overlapping hits were removed for each gene as
+      `  the hits were found (Main Sec03 Sub04)
+      */
+      for(seqSL = 0; seqSL < hitStackST.lenSL; ++seqSL)
+         pRow_hitTbl(&hitStackST, seqSL, &outStackST);
+
+      if(highFileStr)
+      { /*If: printing the highest scoring rows*/
+         highFILE = fopen((char *) highFileStr, "a");
+         if(! highFILE)
+         { /*If: could not open the file*/
+            fprintf(
+               stderr,
+               "could not open -high-tbl %s%s",
+               highFileStr,
+               str_endLine
+            );
+            goto fileErr_main_sec04;
+         } /*If: could not open the file*/
+
+         if(setup_outBuf(&highStackST, 0, highFILE))
+         { /*If: memory error*/
+            fprintf(
+               stderr,
+               "memory error setting up -high-tbl buffer%s",
+               str_endLine
+            );
+            goto memErr_main_sec04;
+         } /*If: memory error*/
+
+         pHigh_hitTbl(&hitStackST, 0, &highStackST);
+
+         if(flush_outBuf(&highStackST))
+         { /*If: could not write output*/
+            fprintf(
+               stderr,
+               "error writing -high-tbl %s%s",
+               highFileStr,
+               str_endLine
+            );
+            goto fileErr_main_sec04;
+         } /*If: could not write output*/
+      } /*If: printing the highest scoring rows*/
+   } /*If: printing score table rows*/
+
+   if(statsHeapAryST)
+   { /*If: printing kmerFind counters*/
+      pHeaderStats_kmerFind(&statsStackST);
+
+      if(! geneFaStr)
+         pStats_kmerFind(
+            statsHeapAryST,
+            (signed char *) "all",
+            &statsStackST
+         );
+
+      else
+      { /*Else: printing counters for each gene*/
+         for(siGene = 0; siGene < statsLenSI; ++siGene)
+         { /*Loop: print counters*/
+            cpWhite_ulCp(
+               tmpFileStr,
+               barHeapAryST[siGene].forSeqST->idStr
+            );
+
+            pStats_kmerFind(
+               &statsHeapAryST[siGene],
+               tmpFileStr,
+               &statsStackST
+            );
+         } /*Loop: print counters*/
+      } /*Else: printing counters for each gene*/
+   } /*If: printing kmerFind counters*/
+
+   if(
+         flush_outBuf(&outStackST)
+      || flush_outBuf(&logStackST)
+      || flush_outBuf(&statsStackST)
+   ){ /*If: could not write output*/
+      fprintf(
+         stderr,
+         "error writing output or log file%s",
+         str_endLine
+      );
+      goto fileErr_main_sec04;
+   }  /*If: could not write output*/
+
    fqFileSI = 0;
    goto ret_main_sec04;
 
@@ -2013,6 +2561,19 @@ main(
       goto ret_main_sec04;
 
    ret_main_sec04:;
+      flush_outBuf(&outStackST);
+      flush_outBuf(&logStackST);
+      freeStack_outBuf(&outStackST);
+      freeStack_outBuf(&logStackST);
+      freeStack_outBuf(&statsStackST);
+      freeStack_outBuf(&highStackST);
+      freeStack_trace(&traceStackST);
+      freeStack_hitTbl(&hitStackST);
+
+      if(statsHeapAryST)
+         free(statsHeapAryST);
+      statsHeapAryST = 0;
+
       freeStack_file_inflate(&fileStackST);
       freeStack_seqST(&seqStackST);
       freeStack_tblST_kmerFind(&tblStackST);
@@ -2060,6 +2621,19 @@ main(
       else fclose(logFILE);
       logFILE = 0; 
 
+      if(statsFILE)
+         fclose(statsFILE);
+      statsFILE = 0;
+
+      if(highFILE)
+         fclose(highFILE);
+      highFILE = 0;
+
+      pReport_memTag(
+         (signed char *) "demux",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
       return fqFileSI;
 } /*main*/
 
@@ -0,0 +1,1509 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF: Start Of File
+'   - extracts the mapped genes in a highScores.tsv (or
+'     scores.tsv) file from annotateASFV from the genome
+'   - can also translate the genes and build the Genbank
+'     feature table (replaces tranSeq + aaToFeature.awk)
+'   o header:
+'     - included libraries
+'   o fun01: pversion_extractGenes
+'     - prints extractGenes's version numbers
+'   o fun02: phelp_extractGenes
+'     - prints out extractGenes's help message
+'   o fun03: input_extractGenes
+'     - gets user input
+'   o fun04: open_extractGenes
+'     - opens an output file and sets up its buffer
+'   o main:
+'     - extract genes from a genome
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*--------------------------------------------------------\
+| Header:
+|  - Includes
+\--------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "../genLib/ulCp.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
+#include "../genLib/trace.h"
+#include "../genLib/ptrAry.h"
+#include "../genBio/seqST.h"
+#include "../genBio/codonFun.h"
+#include "../genAln/hitTbl.h"
+#include "../genAln/featTbl.h"
+
+/*only .h files*/
+#include "../bioTools.h" /*version number*/
+#include "../genLib/endLine.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden Libraries:
+!   - .c  #include "../genLib/base10str.h"
+!   - .c  #include "../genLib/numToStr.h"
+!   - .c  #include "../genLib/fileFun.h"
+!   - .h  #include "../genBio/ntTo2Bit.h"
+!   - .h  #include "../genBio/revNtTo2Bit.h"
+!   - .h  #include "../genBio/codonTbl.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*--------------------------------------------------------\
+| Fun01: pversion_extractGenes
+|  - prints extractGenes's version numbers
+| Input:
+|  - outFILE:
+|    o pointer to FILE to print to
+| Output:
+|  - Prints:
+|    o version number to outFILE
+\--------------------------------------------------------*/
+void
+pversion_extractGenes(
+   void *outFILE
+){
+   fprintf(
+      (FILE *) outFILE,
+      "extractGenes from bioTools version: %i-%02i-%02i%s",
+      def_year_bioTools,
+      def_month_bioTools,
+      def_day_bioTools,
+      str_endLine
+   );
+} /*pversion_extractGenes*/
+
+/*--------------------------------------------------------\
+| Fun02: phelp_extractGenes
+|  - prints out extractGenes's help message
+| Input:
+|  - outFILE:
+|    o pointer to FILE to print to
+| Output:
+|  - Prints:
+|    o help message to outFILE
+\--------------------------------------------------------*/
+void
+phelp_extractGenes(
+   void *outFILE
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun02 TOC:
+   '   o fun02 sec01:
+   '     - usage line
+   '   o fun02 sec02:
+   '     - input
+   '   o fun02 sec03:
+   '     - output
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec01:
+   ^   - usage line
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "extractGenes -ref genome.fa -hits highScores.tsv%s",
+      str_endLine
+   );
+
+   fprintf(
+     (FILE *) outFILE,
+     "  - extracts mapped genes from a genome%s",
+     str_endLine
+   );
+
+   fprintf(
+     (FILE *) outFILE,
+     "  - reverse genes are reverse complemented%s",
+     str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec02:
+   ^   - input
+   ^   o fun02 sec02 sub01:
+   ^     - reference (genome)
+   ^   o fun02 sec02 sub02:
+   ^     - score table
+   ^   o fun02 sec02 sub03:
+   ^     - output file
+   ^   o fun02 sec02 sub04:
+   ^     - translation and feature table files
+   ^   o fun02 sec02 sub05:
+   ^     - help message and version number
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "Input:%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub01:
+   *   - reference (genome)
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -ref genome.fa: [Required]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o fasta file with genome genes were mapped to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o only the first sequence is used%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub02:
+   *   - score table
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -hits highScores.tsv: [Optional; stdin]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o prefix-highScores.tsv or prefix-scores.tsv%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     from annotateASFV.sh%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o use \"-hits -\" for stdin input%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub03:
+   *   - output file
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -out genes.fa: [Optional; stdout]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o fasta file to save extracted genes to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o use \"-out -\" for stdout%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub04:
+   *   - translation and feature table files
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -aa aaSequences.fa: [Optional; not printed]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o fasta file to save translated genes to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o same format as \"tranSeq -orf-1\"%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -feat featureTable.tsv: [Optional; not printed]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o file to save the Genbank feature table to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -feat-err errors.tsv: [Optional; not printed]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o file to save duplicate genes and incomplete%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     reading frames to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -trace trace.json: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "   o add chrome/perfetto trace events (timings) to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "     trace.json; appends if trace.json exists%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub05:
+   *   - help message and version number
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -h: print this help message and exit%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -v: print version number and exit%s",
+      str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec03:
+   ^   - output
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "Output:%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints gene sequences to -out (fasta)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o header: >ref-gene-start-end-F/R%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      followed by tab deliminated gene details%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints translated genes to -aa (fasta)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints Genbank feature table to -feat%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o duplicates are genes with the same id or the%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      same reference start and end%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints genes with warnings to -feat-err (tsv)%s",
+      str_endLine
+   );
+} /*phelp_extractGenes*/
+
+/*--------------------------------------------------------\
+| Fun03: input_extractGenes
+|   - gets user input
+| Input:
+|   - numArgsSI:
+|     o number arguments user input
+|   - argAryStr:
+|     o c-string array with user input
+|   - refStrPtr:
+|     o c-string pointer to update with genome path
+|   - hitStrPtr:
+|     o c-string pointer to update with score table path
+|   - outStrPtr:
+|     o c-string pointer to update with output file path
+|   - aaStrPtr:
+|     o c-string pointer to update with amino acid
+|       sequence file path
+|   - featStrPtr:
+|     o c-string pointer to update with feature table
+|       file path
+|   - featErrStrPtr:
+|     o c-string pointer to update with feature error
+|       table file path
+|   - traceStrPtr:
+|     o c-string pointer to update with trace events
+|       file path
+| Output:
+|   - Modifies:
+|     o all input variables to have user input
+|   - Prints:
+|     o if had error; error message to stderr
+|   - Returns:
+|     o 0 for no errors
+|     o 1 if printed help message
+|     o 2 if had error
+\--------------------------------------------------------*/
+signed char
+input_extractGenes(
+   int numArgsSI,           /*number arguments input*/
+   char *argAryStr[],       /*arguments user input*/
+   signed char **refStrPtr, /*gets reference file*/
+   signed char **hitStrPtr, /*gets score table*/
+   signed char **outStrPtr, /*gets output file*/
+   signed char **aaStrPtr,  /*gets amino acid file*/
+   signed char **featStrPtr,   /*gets feature table*/
+   signed char **featErrStrPtr,/*gets feature errors*/
+   signed char **traceStrPtr   /*gets trace events file*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun03 TOC:
+   '   - gets user input
+   '   o fun03 sec01:
+   '     - variable declartions + input check
+   '   o fun03 sec02:
+   '     - get input
+   '   o fun03 sec03:
+   '     - return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec01:
+   ^   - variable declartions + input check
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed int siArg = 1;
+   signed char errSC = 0;
+
+   if(numArgsSI <= 1)
+      goto phelp_fun03_sec03;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec02:
+   ^   - get input
+   ^   o fun03 sec02 sub01:
+   ^     - file input/output + start loop
+   ^   o fun03 sec02 sub02:
+   ^     - help message requests
+   ^   o fun03 sec02 sub03:
+   ^     - version number requests
+   ^   o fun03 sec02 sub04:
+   ^     - invalid input
+   ^   o fun03 sec02 sub05:
+   ^     - move to next argument
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun03 Sec02 Sub01:
+   *   - file input/output + start loop
+   \*****************************************************/
+
+   while(siArg < numArgsSI)
+   { /*Loop: get user input*/
+      if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*If: reference file input*/
+         ++siArg;
+         *refStrPtr = (signed char *) argAryStr[siArg];
+      }  /*If: reference file input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-hits",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: score table input*/
+         ++siArg;
+         *hitStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: score table input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-out",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: output file input*/
+         ++siArg;
+         *outStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: output file input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-aa",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: amino acid output file*/
+         ++siArg;
+         *aaStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: amino acid output file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-feat",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: feature table output file*/
+         ++siArg;
+         *featStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: feature table output file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-feat-err",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: feature error output file*/
+         ++siArg;
+         *featErrStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: feature error output file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-trace",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: trace events file*/
+         ++siArg;
+         *traceStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: trace events file*/
+
+      /**************************************************\
+      * Fun03 Sec02 Sub02:
+      *   - help message requests
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03_sec03;
+
+      /**************************************************\
+      * Fun03 Sec02 Sub03:
+      *   - version number requests
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03_sec03;
+
+      /**************************************************\
+      * Fun03 Sec02 Sub04:
+      *   - invalid input
+      \**************************************************/
+
+      else
+      { /*Else: unrecognized input*/
+         fprintf(
+            stderr,
+            "%s is not recongnized%s",
+            argAryStr[siArg],
+            str_endLine
+         );
+
+         goto err_fun03_sec03;
+      } /*Else: unrecognized input*/
+
+      /**************************************************\
+      * Fun03 Sec02 Sub05:
+      *   - move to next argument
+      \**************************************************/
+
+      ++siArg;
+   } /*Loop: get user input*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec03:
+   ^   - return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(siArg > numArgsSI)
+   { /*If: last argument was missing its value*/
+      fprintf(
+         stderr,
+         "%s is missing a value%s",
+         argAryStr[numArgsSI - 1],
+         str_endLine
+      );
+
+      goto err_fun03_sec03;
+   } /*If: last argument was missing its value*/
+
+   errSC = 0;
+   goto ret_fun03_sec03;
+
+   phelp_fun03_sec03:;
+      errSC = 1;
+      phelp_extractGenes(stdout);
+      goto ret_fun03_sec03;
+   pversion_fun03_sec03:;
+      errSC = 1;
+      pversion_extractGenes(stdout);
+      goto ret_fun03_sec03;
+   err_fun03_sec03:;
+      errSC = 2;
+      goto ret_fun03_sec03;
+   ret_fun03_sec03:;
+      return errSC;
+} /*input_extractGenes*/
+
+/*--------------------------------------------------------\
+| Fun04: open_extractGenes
+|   - opens an output file and sets up its buffer
+| Input:
+|   - fileStr:
+|     o c-string with file to open
+|     o "-" for stdout
+|     o 0 to skip (nothing is opened)
+|   - flagStr:
+|     o c-string with the flag the file was input with
+|       (for error messages)
+|   - outFILEPtr:
+|     o FILE pointer to set to the opened file
+|   - outBufSTPtr:
+|     o outBuf struct pointer to set up for outFILEPtr
+| Output:
+|   - Modifies:
+|     o outFILEPtr to point to the opened file (or stdout)
+|     o outBufSTPtr to have a buffer for outFILEPtr
+|   - Prints:
+|     o if had file error; error message to stderr
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_outBuf for memory errors
+|     o def_fileErr_outBuf if could not open the file
+\--------------------------------------------------------*/
+signed char
+open_extractGenes(
+   signed char *fileStr,
+   signed char *flagStr,
+   FILE **outFILEPtr,
+   struct outBuf *outBufSTPtr
+){
+   if(! fileStr)
+      return 0; /*user did not want this file*/
+
+   if(fileStr[0] == '-')
+      *outFILEPtr = stdout;
+
+   else
+   { /*Else: user input output file*/
+      *outFILEPtr = fopen((char *) fileStr, "w");
+
+      if(! *outFILEPtr)
+      { /*If: could not open output file*/
+         fprintf(
+            stderr,
+            "could not open %s %s%s",
+            flagStr,
+            fileStr,
+            str_endLine
+         );
+
+         return def_fileErr_outBuf;
+      } /*If: could not open output file*/
+   } /*Else: user input output file*/
+
+   if(setup_outBuf(outBufSTPtr, 0, *outFILEPtr))
+      return def_memErr_outBuf;
+
+   return 0;
+} /*open_extractGenes*/
+
+/*--------------------------------------------------------\
+| Main:
+|   - extract genes from a genome
+| Input:
+|   - numArgsSI:
+|     o Number of arguments the user input
+|   - argAryStr:
+|     o Arguments and parameters the user input
+| Output:
+|   - Prints:
+|     o extracted genes to -out (fasta)
+|     o translated genes to -aa (fasta)
+|     o feature table to -feat and warnings to -feat-err
+\--------------------------------------------------------*/
+int main(
+   int numArgsSI,    /*number of arguments the user input*/
+   char *argAryStr[] /*Arguments/parameters input by user*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Main: main
+   '   - extract genes from a genome
+   '   o main sec01:
+   '     - variable declerations
+   '   o main sec02:
+   '     - get input, read in genome and hits
+   '   o main sec03:
+   '     - extract, translate, and print genes
+   '   o main sec04:
+   '     - clean up and exit
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec01:
+   ^   - variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *refFileStr = 0;
+   signed char *hitFileStr = 0;
+   signed char *outFileStr = 0;
+   signed char *aaFileStr = 0;
+   signed char *featFileStr = 0;
+   signed char *featErrFileStr = 0;
+   signed char *traceFileStr = 0;
+
+   signed char errSC = 0;
+   signed long lineSL = 0;
+   signed long indexSL = 0;
+
+   signed char *aaHeapStr = 0;
+   signed long lenAaSL = 0;
+   signed long sizeAaSL = 0;
+
+   FILE *inFILE = 0;
+   FILE *outFILE = 0;
+   FILE *aaFILE = 0;
+   FILE *featFILE = 0;
+   FILE *featErrFILE = 0;
+
+   struct seqST refStackST;
+   struct seqST geneStackST;
+   struct hitTbl hitStackST;
+   struct featTbl featStackST;
+
+   struct outBuf outStackST;
+   struct outBuf aaOutStackST;
+   struct outBuf featOutStackST;
+   struct outBuf errOutStackST;
+
+   struct trace traceStackST;
+   struct trace *traceSTPtr = 0; /*0 if not tracing*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec02:
+   ^   - get input, read in genome and hits
+   ^   o main sec02 sub01:
+   ^     - initialize structs and get input
+   ^   o main sec02 sub02:
+   ^     - read in the genome
+   ^   o main sec02 sub03:
+   ^     - read in the hits
+   ^   o main sec02 sub04:
+   ^     - open output files
+   ^   o main sec02 sub05:
+   ^     - find duplicates and print table headers
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Main Sec02 Sub01:
+   *   - initialize structs and get input
+   \******************************************************/
+
+   init_seqST(&refStackST);
+   init_seqST(&geneStackST);
+   init_hitTbl(&hitStackST);
+   init_featTbl(&featStackST);
+
+   init_outBuf(&outStackST);
+   init_outBuf(&aaOutStackST);
+   init_outBuf(&featOutStackST);
+   init_outBuf(&errOutStackST);
+   init_trace(&traceStackST);
+
+   errSC =
+      input_extractGenes(
+         numArgsSI,
+         argAryStr,
+         &refFileStr,
+         &hitFileStr,
+         &outFileStr,
+         &aaFileStr,
+         &featFileStr,
+         &featErrFileStr,
+         &traceFileStr
+      );
+
+   if(errSC)
+   { /*If: had error*/
+      --errSC; /*convert help/version to no error (0)*/
+      goto ret_main_sec04;
+   } /*If: had error*/
+
+   if(traceFileStr)
+   { /*If: user wanted trace events*/
+      errSC =
+         setup_trace(
+            &traceStackST,
+            traceFileStr,
+            2,
+            (signed char *) "extractGenes"
+         );
+
+      if(errSC == def_memErr_trace)
+         goto memErr_main_sec04;
+
+      else if(errSC)
+      { /*Else If: could not open trace file*/
+         fprintf(
+            stderr,
+            "could not open -trace %s%s",
+            traceFileStr,
+            str_endLine
+         );
+
+         goto err_main_sec04;
+      } /*Else If: could not open trace file*/
+
+      traceSTPtr = &traceStackST;
+   } /*If: user wanted trace events*/
+
+   /******************************************************\
+   * Main Sec02 Sub02:
+   *   - read in the genome
+   \******************************************************/
+
+   if(! refFileStr)
+   { /*If: no genome input*/
+      fprintf(
+         stderr,
+         "no genome input with -ref%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   } /*If: no genome input*/
+
+   inFILE = fopen((char *) refFileStr, "r");
+
+   if(! inFILE)
+   { /*If: could not open genome*/
+      fprintf(
+         stderr,
+         "could not open -ref %s%s",
+         refFileStr,
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   } /*If: could not open genome*/
+
+   begin_trace(
+      traceSTPtr,
+      (signed char *) "read reference",
+      (signed char *) "parse"
+   );
+
+   errSC = getFa_seqST(inFILE, &refStackST);
+
+   end_trace(
+      traceSTPtr,
+      (signed char *) "read reference",
+      (signed char *) "parse"
+   );
+
+   if(errSC == def_memErr_seqST)
+      goto memErr_main_sec04;
+
+   else if(errSC && errSC != def_EOF_seqST)
+   { /*Else If: invalid genome*/
+      fprintf(
+         stderr,
+         "-ref %s is not a fasta file%s",
+         refFileStr,
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   } /*Else If: invalid genome*/
+
+   fclose(inFILE);
+   inFILE = 0;
+
+   /******************************************************\
+   * Main Sec02 Sub03:
+   *   - read in the hits
+   \******************************************************/
+
+   if(
+         ! hitFileStr
+      || hitFileStr[0] == '-'
+   ){ /*If: reading hits from stdin*/
+      inFILE = stdin;
+      hitFileStr = (signed char *) "-";
+   }  /*If: reading hits from stdin*/
+
+   else
+   { /*Else: user input score table*/
+      inFILE = fopen((char *) hitFileStr, "r");
+
+      if(! inFILE)
+      { /*If: could not open score table*/
+         fprintf(
+            stderr,
+            "could not open -hits %s%s",
+            hitFileStr,
+            str_endLine
+         );
+
+         goto err_main_sec04;
+      } /*If: could not open score table*/
+   } /*Else: user input score table*/
+
+   begin_trace(
+      traceSTPtr,
+      (signed char *) "read hits",
+      (signed char *) "parse"
+   );
+
+   errSC = get_hitTbl(&hitStackST, inFILE, &lineSL);
+
+   end_trace(
+      traceSTPtr,
+      (signed char *) "read hits",
+      (signed char *) "parse"
+   );
+
+   if(errSC == def_memErr_hitTbl)
+      goto memErr_main_sec04;
+
+   else if(errSC)
+   { /*Else If: invalid line*/
+      fprintf(
+         stderr,
+         "line %li in -hits %s is not a hit%s",
+         lineSL,
+         hitFileStr,
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   } /*Else If: invalid line*/
+
+   if(inFILE != stdin)
+      fclose(inFILE);
+   inFILE = 0;
+
+   /******************************************************\
+   * Main Sec02 Sub04:
+   *   - open output files
+   \******************************************************/
+
+   if(! outFileStr)
+      outFileStr = (signed char *) "-";
+
+   errSC =
+      open_extractGenes(
+         outFileStr,
+         (signed char *) "-out",
+         &outFILE,
+         &outStackST
+      );
+   if(errSC == def_memErr_outBuf)
+      goto memErr_main_sec04;
+   else if(errSC)
+      goto err_main_sec04;
+
+   errSC =
+      open_extractGenes(
+         aaFileStr,
+         (signed char *) "-aa",
+         &aaFILE,
+         &aaOutStackST
+      );
+   if(errSC == def_memErr_outBuf)
+      goto memErr_main_sec04;
+   else if(errSC)
+      goto err_main_sec04;
+
+   errSC =
+      open_extractGenes(
+         featFileStr,
+         (signed char *) "-feat",
+         &featFILE,
+         &featOutStackST
+      );
+   if(errSC == def_memErr_outBuf)
+      goto memErr_main_sec04;
+   else if(errSC)
+      goto err_main_sec04;
+
+   errSC =
+      open_extractGenes(
+         featErrFileStr,
+         (signed char *) "-feat-err",
+         &featErrFILE,
+         &errOutStackST
+      );
+   if(errSC == def_memErr_outBuf)
+      goto memErr_main_sec04;
+   else if(errSC)
+      goto err_main_sec04;
+
+   /******************************************************\
+   * Main Sec02 Sub05:
+   *   - find duplicates and print table headers
+   \******************************************************/
+
+   begin_trace(
+      traceSTPtr,
+      (signed char *) "find duplicates",
+      (signed char *) "filter"
+   );
+
+   if(setup_featTbl(&featStackST, &hitStackST))
+      goto memErr_main_sec04;
+
+   dup_featTbl(&featStackST, &hitStackST);
+
+   end_trace(
+      traceSTPtr,
+      (signed char *) "find duplicates",
+      (signed char *) "filter"
+   );
+
+   pHead_featTbl(
+      refStackST.idStr,
+      featOutStackST.bufStr ? &featOutStackST : 0,
+      errOutStackST.bufStr ? &errOutStackST : 0
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec03:
+   ^   - extract, translate, and print genes
+   ^   o main sec03 sub01:
+   ^     - extract and print nucleotide sequence
+   ^   o main sec03 sub02:
+   ^     - translate and print amino acid sequence
+   ^   o main sec03 sub03:
+   ^     - print feature table entry
+   ^   o main sec03 sub04:
+   ^     - write any remaining output
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /******************************************************\
+   * Main Sec03 Sub01:
+   *   - extract and print nucleotide sequence
+   \******************************************************/
+
+   for(indexSL = 0; indexSL < hitStackST.lenSL; ++indexSL)
+   { /*Loop: extract genes*/
+      begin_trace(
+         traceSTPtr,
+         hitStackST.idST->strAry[indexSL],
+         (signed char *) "gene"
+      );
+
+      begin_trace(
+         traceSTPtr,
+         (signed char *) "extract",
+         (signed char *) "extract"
+      );
+
+      errSC =
+         getNt_hitTbl(
+            &hitStackST,
+            indexSL,
+            &refStackST,
+            &geneStackST
+         );
+
+      if(errSC == def_memErr_hitTbl)
+         goto memErr_main_sec04;
+
+      else if(errSC)
+      { /*Else If: hit is outside of the genome*/
+         fprintf(
+            stderr,
+            "%s (hit %li) is outside of -ref %s%s",
+            hitStackST.idST->strAry[indexSL],
+            indexSL + 1,
+            refFileStr,
+            str_endLine
+         );
+
+         goto err_main_sec04;
+      } /*Else If: hit is outside of the genome*/
+
+      pNt_hitTbl(
+         &hitStackST,
+         indexSL,
+         refStackST.idStr,
+         &geneStackST,
+         &outStackST
+      );
+
+      end_trace(
+         traceSTPtr,
+         (signed char *) "extract",
+         (signed char *) "extract"
+      );
+
+      /***************************************************\
+      * Main Sec03 Sub02:
+      *   - translate and print amino acid sequence
+      \***************************************************/
+
+      if(
+            ! aaOutStackST.bufStr
+         && ! featOutStackST.bufStr
+         && ! errOutStackST.bufStr
+      ){ /*If: only extracting genes*/
+         end_trace(
+            traceSTPtr,
+            hitStackST.idST->strAry[indexSL],
+            (signed char *) "gene"
+         );
+
+         continue;
+      }  /*If: only extracting genes*/
+
+      begin_trace(
+         traceSTPtr,
+         (signed char *) "translate",
+         (signed char *) "translate"
+      );
+
+      if(sizeAaSL < geneStackST.seqLenSL)
+      { /*If: need more memory*/
+         free(aaHeapStr);
+         aaHeapStr = 0;
+
+         aaHeapStr =
+            malloc(
+                 ((geneStackST.seqLenSL / 3) + 9)
+               * sizeof(signed char)
+            );
+         if(! aaHeapStr)
+            goto memErr_main_sec04;
+         sizeAaSL = geneStackST.seqLenSL;
+      } /*If: need more memory*/
+
+      lenAaSL =
+         seqToAA_codonFun(
+            geneStackST.seqStr,
+            aaHeapStr,
+            0,
+            geneStackST.seqLenSL
+         );
+
+      if(lenAaSL == def_unkownNt_codonFun)
+      { /*If: gene has an anonymous base*/
+         fprintf(
+            stderr,
+            "%s (hit %li) has an unknown base%s",
+            hitStackST.idST->strAry[indexSL],
+            indexSL + 1,
+            str_endLine
+         );
+
+         goto err_main_sec04;
+      } /*If: gene has an anonymous base*/
+
+      else if(lenAaSL == def_incomplete_codonFun)
+      { /*Else If: gene had extra bases at end*/
+         lenAaSL = 0;
+
+         while(aaHeapStr[lenAaSL])
+            ++lenAaSL;
+      } /*Else If: gene had extra bases at end*/
+
+      if(aaOutStackST.bufStr)
+         pAa_hitTbl(
+            &hitStackST,
+            indexSL,
+            refStackST.idStr,
+            geneStackST.seqLenSL,
+            aaHeapStr,
+            &aaOutStackST
+         );
+
+      end_trace(
+         traceSTPtr,
+         (signed char *) "translate",
+         (signed char *) "translate"
+      );
+
+      /***************************************************\
+      * Main Sec03 Sub03:
+      *   - print feature table entry
+      \***************************************************/
+
+      begin_trace(
+         traceSTPtr,
+         (signed char *) "feature table",
+         (signed char *) "feature"
+      );
+
+      orf_featTbl(&featStackST, indexSL, aaHeapStr, lenAaSL);
+
+      p_featTbl(
+         &featStackST,
+         &hitStackST,
+         indexSL,
+         featOutStackST.bufStr ? &featOutStackST : 0,
+         errOutStackST.bufStr ? &errOutStackST : 0
+      );
+
+      end_trace(
+         traceSTPtr,
+         (signed char *) "feature table",
+         (signed char *) "feature"
+      );
+
+      end_trace(
+         traceSTPtr,
+         hitStackST.idST->strAry[indexSL],
+         (signed char *) "gene"
+      );
+   } /*Loop: extract genes*/
+
+   /******************************************************\
+   * Main Sec03 Sub04:
+   *   - write any remaining output
+   \******************************************************/
+
+   if(flush_outBuf(&outStackST))
+   { /*If: could not write to output file*/
+      fprintf(
+         stderr,
+         "could not write to -out%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   } /*If: could not write to output file*/
+
+   if(
+         aaOutStackST.bufStr
+      && flush_outBuf(&aaOutStackST)
+   ){ /*If: could not write to amino acid file*/
+      fprintf(
+         stderr,
+         "could not write to -aa%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   }  /*If: could not write to amino acid file*/
+
+   if(
+         featOutStackST.bufStr
+      && flush_outBuf(&featOutStackST)
+   ){ /*If: could not write to feature table*/
+      fprintf(
+         stderr,
+         "could not write to -feat%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   }  /*If: could not write to feature table*/
+
+   if(
+         errOutStackST.bufStr
+      && flush_outBuf(&errOutStackST)
+   ){ /*If: could not write to feature error table*/
+      fprintf(
+         stderr,
+         "could not write to -feat-err%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+   }  /*If: could not write to feature error table*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec04:
+   ^   - clean up and exit
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errSC = 0;
+   goto ret_main_sec04;
+
+   memErr_main_sec04:;
+      fprintf(
+         stderr,
+         "memory error%s",
+         str_endLine
+      );
+
+      goto err_main_sec04;
+
+   err_main_sec04:;
+      errSC = 1;
+      goto ret_main_sec04;
+
+   ret_main_sec04:;
+      if(outStackST.bufStr)
+         flush_outBuf(&outStackST);
+      freeStack_outBuf(&outStackST);
+
+      if(aaOutStackST.bufStr)
+         flush_outBuf(&aaOutStackST);
+      freeStack_outBuf(&aaOutStackST);
+
+      if(featOutStackST.bufStr)
+         flush_outBuf(&featOutStackST);
+      freeStack_outBuf(&featOutStackST);
+
+      if(errOutStackST.bufStr)
+         flush_outBuf(&errOutStackST);
+      freeStack_outBuf(&errOutStackST);
+
+      freeStack_trace(&traceStackST);
+      traceSTPtr = 0;
+
+      if(aaHeapStr)
+         free(aaHeapStr);
+      aaHeapStr = 0;
+
+      freeStack_seqST(&refStackST);
+      freeStack_seqST(&geneStackST);
+      freeStack_hitTbl(&hitStackST);
+      freeStack_featTbl(&featStackST);
+
+      if(
+            inFILE
+         && inFILE != stdin
+         && inFILE != stdout
+         && inFILE != stderr
+      ) fclose(inFILE);
+      inFILE = 0;
+
+      if(
+            outFILE
+         && outFILE != stdin
+         && outFILE != stdout
+         && outFILE != stderr
+      ) fclose(outFILE);
+      outFILE = 0;
+
+      if(
+            aaFILE
+         && aaFILE != stdin
+         && aaFILE != stdout
+         && aaFILE != stderr
+      ) fclose(aaFILE);
+      aaFILE = 0;
+
+      if(
+            featFILE
+         && featFILE != stdin
+         && featFILE != stdout
+         && featFILE != stderr
+      ) fclose(featFILE);
+      featFILE = 0;
+
+      if(
+            featErrFILE
+         && featErrFILE != stdin
+         && featErrFILE != stdout
+         && featErrFILE != stderr
+      ) fclose(featErrFILE);
+      featErrFILE = 0;
+
+      pReport_memTag(
+         (signed char *) "extractGenes",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
+      return errSC;
+} /*main*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
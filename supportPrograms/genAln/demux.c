@@ -12,8 +12,16 @@
 '     - demux a read
 '   o fun04: read_demux
 '     - convert barcode coordinates to demuxed reads
-'   o fun05: primer_demux
+'   o .c fun05: pPrimCoord_demux
+'     - adds amplicon length, coordinates, and primer ids
+'       to the header of a primer_demux amplicon
+'   o .c fun06: pPrimMap_demux
+'     - adds a primers mapping coordinates and score to
+'       the header of a primer_demux amplicon
+'   o fun07: primer_demux
 '     - get primer target regins from the input sequence
+'   o fun08: pGeneCoord_demux
+'     - get coordinates of all genes found in target
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -32,9 +40,11 @@
 
 #include <stdio.h>
 
+#include "../genLib/outBuf.h"
 #include "../genBio/seqST.h"
 #include "alnSet.h"
 #include "kmerFind.h"
+#include "../genLib/trace.h"
 
 /*.h files only*/
 #include "../genLib/endLine.h"
@@ -46,6 +56,7 @@
 !   - .c  #include "../genAln/indexToCoord.h"
 !   - .c  #include "../genLib/shellSort.h"
 !   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genLib/numToStr.h"
 !   - .c  #include "memwater.h"
 !   - .h  #include "../genLib/genMath.h"
 !   - .h  #include "alnDefs.h"
@@ -382,6 +393,10 @@ sortStart_demux(
 |       - length of the returned array
 |       - -1 if had two different barcodes overlapping
 |       - -2 for memory errors
+|     o if tblSTPtr->statsSTPtr is set, adds the hits
+|       kept and overlapping hits dropped to it
+|     o if tblSTPtr->traceSTPtr is set, marks the time
+|       spent filtering the hits
 |   - Returns:
 |     o array with the barcode index, start, end, and
 |       score of each barcode
@@ -440,6 +455,7 @@ barcodeCoords_demux(
    signed int siMap = 0;
    signed int scoreSI = 0;
    signed int lastScoreSI = 0;
+   signed char traceBl = 0; /*1: need to end filter trace*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun03 Sec02:
@@ -502,6 +518,13 @@ barcodeCoords_demux(
    *   - filter by minimum scores
    \*****************************************************/
 
+   begin_trace(
+      tblSTPtr->traceSTPtr,
+      (signed char *) "filter",
+      (signed char *) "filter"
+   );
+   traceBl = 1;
+
    endSI = lenSI;
    lenSI = 0;
    if(minScoreSL > 0)
@@ -562,6 +585,9 @@ barcodeCoords_demux(
          else
             primArySS[siMap] = -1;
 
+         if(tblSTPtr->statsSTPtr)
+            ++tblSTPtr->statsSTPtr->overlapUL;
+
          if(siMap < 2)
             ++endSI; /*first comparision*/
       } /*If: barcode overlap or double map*/
@@ -644,6 +670,9 @@ barcodeCoords_demux(
 
    lenSI = siMap;
 
+   if(tblSTPtr->statsSTPtr)
+      tblSTPtr->statsSTPtr->hitUL += (lenSI >> 2);
+
    free(primArySS);
    primArySS = 0;
 
@@ -684,6 +713,13 @@ barcodeCoords_demux(
       goto ret_fun03_sec05;
 
    ret_fun03_sec05:;      
+      if(traceBl)
+         end_trace(
+            tblSTPtr->traceSTPtr,
+            (signed char *) "filter",
+            (signed char *) "filter"
+         );
+
       if(dirArySC)
          free(dirArySC);
       dirArySC = 0;
@@ -1123,7 +1159,101 @@ read_demux(
 } /*read_demux*/
 
 /*-------------------------------------------------------\
-| Fun05: primer_demux
+| Fun05: pPrimCoord_demux
+|   - adds amplicon length, coordinates, and primer ids to
+|     the header of a primer_demux amplicon
+| Input:
+|   - lenSI:
+|     o amplicon length
+|   - startSI:
+|     o first base in amplicon (index 0)
+|   - endSI:
+|     o last base in amplicon (index 0)
+|   - forIdStr:
+|     o c-string with forward primer id (or "NA")
+|   - revIdStr:
+|     o c-string with reverse primer id (or "NA")
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add header entries to
+| Output:
+|   - Prints:
+|     o "\tlen=\tstart=\tend=\tforPrim=\trevPrim=" entries
+|       to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pPrimCoord_demux(
+   signed int lenSI,
+   signed int startSI,
+   signed int endSI,
+   signed char *forIdStr,
+   signed char *revIdStr,
+   struct outBuf *outBufSTPtr
+){
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tlen=");
+   addSL_outBuf(outBufSTPtr, lenSI);
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tstart=");
+   addSL_outBuf(outBufSTPtr, startSI + 1);
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tend=");
+   addSL_outBuf(outBufSTPtr, endSI + 1);
+
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *) "\tforPrim="
+   );
+   addStr_outBuf(outBufSTPtr, forIdStr);
+
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *) "\trevPrim="
+   );
+   addStr_outBuf(outBufSTPtr, revIdStr);
+} /*pPrimCoord_demux*/
+
+/*-------------------------------------------------------\
+| Fun06: pPrimMap_demux
+|   - adds a primers mapping coordinates and score to the
+|     header of a primer_demux amplicon
+| Input:
+|   - tagStr:
+|     o c-string with the start tag to print
+|       (ex: "\tforStart=" or "\trevStart=")
+|     o the first four characters (\tfor or \trev) are
+|       reused for the end and score tags
+|   - startSI:
+|     o start of primer on amplicon (index 1)
+|   - endSI:
+|     o end of primer on amplicon (index 1)
+|   - scoreSI:
+|     o primer alignment score
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add header entries to
+| Output:
+|   - Prints:
+|     o "<tag>Start=\t<tag>End=\t<tag>Score=" entries
+|       to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pPrimMap_demux(
+   signed char *tagStr,
+   signed int startSI,
+   signed int endSI,
+   signed int scoreSI,
+   struct outBuf *outBufSTPtr
+){
+   addStr_outBuf(outBufSTPtr, tagStr);
+   addSL_outBuf(outBufSTPtr, startSI);
+
+   addLenStr_outBuf(outBufSTPtr, tagStr, 4);
+   addStr_outBuf(outBufSTPtr, (signed char *) "End=");
+   addSL_outBuf(outBufSTPtr, endSI);
+
+   addLenStr_outBuf(outBufSTPtr, tagStr, 4);
+   addStr_outBuf(outBufSTPtr, (signed char *) "Score=");
+   addSL_outBuf(outBufSTPtr, scoreSI);
+} /*pPrimMap_demux*/
+
+/*-------------------------------------------------------\
+| Fun07: primer_demux
 |   - get primer target regins from the input sequence
 | Input:
 |   - seqSTPtr:
@@ -1144,11 +1274,11 @@ read_demux(
 |   - barSTPtr:
 |     o refST_kmerFind struct pionter with the primer
 |       ids and the index of their mates (if paired)
-|   - outFILE:
-|     o FILE pionter to print reads to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print reads to
 | Output:
 |   - Prints:
-|     o amplicons to outFILE
+|     o amplicons to outBufSTPtr (flushed when full)
 |   - Returns:
 |     o number of amplicons found
 |     o 0 if no amplicons
@@ -1161,24 +1291,24 @@ primer_demux(
    signed int coordArySI[],/*has barcode mappings*/
    signed int coordLenSI, /*length of coordLenSI*/
    struct refST_kmerFind *barSTPtr,/*primer ids & mates*/
-   void *outFILE          /*print sequences to*/
+   struct outBuf *outBufSTPtr /*print sequences to*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun05 TOC:
+   ' Fun07 TOC:
    '   - get primer target regins from the input sequence
-   '   o fun05 sec01:
+   '   o fun07 sec01:
    '     - variable declarations
-   '   o fun05 sec02:
+   '   o fun07 sec02:
    '     - check if to many splits and print no split case
-   '   o fun05 sec03:
+   '   o fun07 sec03:
    '     - check if splits are to close and ending barcode
-   '   o fun05 sec04:
+   '   o fun07 sec04:
    '     - print split sequences
-   '   o fun05 sec05:
+   '   o fun07 sec05:
    '     - return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun05 Sec01:
+   ^ Fun07 Sec01:
    ^   - variable declarations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1196,23 +1326,23 @@ primer_demux(
    signed int siNext = 0;/*finding next primer in a pair*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun05 Sec02:
+   ^ Fun07 Sec02:
    ^   - check if to many splits and print no split case
-   ^   o fun05 sec02 sub01:
+   ^   o fun07 sec02 sub01:
    ^     - check if have primers and start primer loop
-   ^   o fun05 sec02 sub02:
+   ^   o fun07 sec02 sub02:
    ^     - deal with primer pairs
-   ^   o fun05 sec02 sub03:
+   ^   o fun07 sec02 sub03:
    ^     - non-paired primers
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun05 Sec02 Sub01:
+   * Fun07 Sec02 Sub01:
    *   - check if have primers and start primer loop
    \*****************************************************/
 
    if(coordLenSI < 4)
-      goto noBarcodes_fun05_sec05;
+      goto noBarcodes_fun07_sec05;
 
    for(siCoord = 0; siCoord < coordLenSI; siCoord += 4)
    { /*Loop: print primers*/
@@ -1220,17 +1350,17 @@ primer_demux(
       mateSI = barSTPtr[barSI].mateSI;
 
       /**************************************************\
-      * Fun05 Sec02 Sub02:
+      * Fun07 Sec02 Sub02:
       *   - deal with primer pairs
-      *   o fun05 sec02 sub02 cat01:
+      *   o fun07 sec02 sub02 cat01:
       *     - find the mate for the current primer
-      *   o fun05 sec02 sub02 cat02:
+      *   o fun07 sec02 sub02 cat02:
       *     - print the sequence from primer start to
       *       the mates primer end
       \**************************************************/
 
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun05 Sec02 Sub02 Cat01:
+      + Fun07 Sec02 Sub02 Cat01:
       +   - find the mate for the current primer
       \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
@@ -1258,7 +1388,7 @@ primer_demux(
             continue;
 
          /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun05 Sec02 Sub02 Cat02:
+         + Fun07 Sec02 Sub02 Cat02:
          +   - print the sequence from primer start to
          +     the mates primer end
          \++++++++++++++++++++++++++++++++++++++++++++++*/
@@ -1285,103 +1415,95 @@ primer_demux(
                   seqSTPtr->qStr[coordArySI[siNext +2]+1];
                seqSTPtr->qStr[coordArySI[siNext +2] +1] =
                   0;
-               fprintf(
-                  (FILE *) outFILE,
-                  "@%s-%03i",
-                  seqSTPtr->idStr,
-                  cntSI++
-               );
+               addChar_outBuf(outBufSTPtr, '@');
             } /*If: have quality score entry*/
 
             else
-               fprintf(
-                  (FILE *) outFILE,
-                  ">%s-%03i",
-                  seqSTPtr->idStr,
-                  cntSI++
-               );
+               addChar_outBuf(outBufSTPtr, '>');
+
+            addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+            addChar_outBuf(outBufSTPtr, '-');
+            addPadUL_outBuf(outBufSTPtr, cntSI++, 3);
+
+            addStr_outBuf(outBufSTPtr, (signed char *) "\tdir=");
 
             if(mateSI < barSI)
             { /*If: reverse complemet*/
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tdir=rev\tlen=%i\tstart=%i\tend=%i",
-                  lenSI,
-                  startSI + 1,
-                  endSI + 1
+               addStr_outBuf(
+                  outBufSTPtr,
+                  (signed char *) "rev"
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tforPrim=%s\trevPrim=%s",
+               pPrimCoord_demux(
+                  lenSI,
+                  startSI,
+                  endSI,
                   barSTPtr[mateSI].forSeqST->idStr,
-                  barSTPtr[barSI].forSeqST->idStr
+                  barSTPtr[barSI].forSeqST->idStr,
+                  outBufSTPtr
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tforStart=%i\tforEnd=%i\tforScore=%i",
+               pPrimMap_demux(
+                  (signed char *) "\tforStart=",
                   coordArySI[siNext + 1] - startSI + 1,
                   coordArySI[siNext + 2] - startSI + 1,
-                  coordArySI[siNext + 3] * -1
+                  coordArySI[siNext + 3] * -1,
+                  outBufSTPtr
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\trevStart=%i\trevEnd=%i\trevScore=%i",
+               pPrimMap_demux(
+                  (signed char *) "\trevStart=",
                   coordArySI[siCoord + 1] - startSI + 1,
                   coordArySI[siCoord + 2] - startSI + 1,
-                  coordArySI[siCoord + 3]
+                  coordArySI[siCoord + 3],
+                  outBufSTPtr
                );
             } /*If: reverse complemet*/
                
             else
             { /*Else: forward*/
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tdir=for\tlen=%i\tstart=%i\tend=%i",
-                  lenSI,
-                  startSI + 1,
-                  endSI + 1
+               addStr_outBuf(
+                  outBufSTPtr,
+                  (signed char *) "for"
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tforPrim=%s\trevPrim=%s",
+               pPrimCoord_demux(
+                  lenSI,
+                  startSI,
+                  endSI,
                   barSTPtr[barSI].forSeqST->idStr,
-                  barSTPtr[mateSI].forSeqST->idStr
+                  barSTPtr[mateSI].forSeqST->idStr,
+                  outBufSTPtr
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\tforStart=%i\tforEnd=%i\tforScore=%i",
+               pPrimMap_demux(
+                  (signed char *) "\tforStart=",
                   coordArySI[siCoord + 1] - startSI + 1,
                   coordArySI[siCoord + 2] - startSI + 1,
-                  coordArySI[siCoord + 3]
+                  coordArySI[siCoord + 3],
+                  outBufSTPtr
                );
-               fprintf(
-                  (FILE *) outFILE,
-                  "\trevStart=%i\trevEnd=%i\trevScore=%i",
+               pPrimMap_demux(
+                  (signed char *) "\trevStart=",
                   coordArySI[siNext + 1] - startSI + 1,
                   coordArySI[siNext + 2] - startSI + 1,
-                  coordArySI[siNext + 3] * -1
+                  coordArySI[siNext + 3] * -1,
+                  outBufSTPtr
                );
             } /*Else: forward*/
 
-            if(! seqSTPtr->qStr || ! seqSTPtr->qStr[0])
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[coordArySI[siCoord+1]],
-                 str_endLine
-               );
-            else
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s+%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[coordArySI[siCoord+1]],
-                 str_endLine, /*end of sequence*/
-                 str_endLine, /*for +*/
-                 &seqSTPtr->qStr[coordArySI[siCoord + 1]],
-                 str_endLine  /*for q-score entry*/
+            addStr_outBuf(outBufSTPtr, str_endLine);
+            addStr_outBuf(
+               outBufSTPtr,
+               &seqSTPtr->seqStr[coordArySI[siCoord + 1]]
+            );
+            addStr_outBuf(outBufSTPtr, str_endLine);
+
+            if(seqSTPtr->qStr && seqSTPtr->qStr[0])
+            { /*If: have q-score entry*/
+               addChar_outBuf(outBufSTPtr, '+');
+               addStr_outBuf(outBufSTPtr, str_endLine);
+               addStr_outBuf(
+                  outBufSTPtr,
+                  &seqSTPtr->qStr[coordArySI[siCoord + 1]]
                );
+               addStr_outBuf(outBufSTPtr, str_endLine);
+            } /*If: have q-score entry*/
                
             seqSTPtr->seqStr[coordArySI[siNext + 2] + 1] =
                tmpSeqSC;
@@ -1393,16 +1515,16 @@ primer_demux(
       } /*If: have a reverse barcode*/
 
       /**************************************************\
-      * Fun05 Sec02 Sub03:
+      * Fun07 Sec02 Sub03:
       *   - non-paired primers
-      *   o fun05 sec02 sub03 cat01:
+      *   o fun07 sec02 sub03 cat01:
       *     - non-paired else + deal with reverse primers
-      *   o fun05 sec02 sub03 cat02:
+      *   o fun07 sec02 sub03 cat02:
       *     - deal with single forward primers
       \**************************************************/
 
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun05 Sec02 Sub03 Cat01:
+      + Fun07 Sec02 Sub03 Cat01:
       +   - non-paired else + deal with reverse primers
       \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
@@ -1445,66 +1567,58 @@ primer_demux(
                   seqSTPtr->qStr[coordArySI[siCoord+2]+1];
                seqSTPtr->qStr[coordArySI[siCoord+2]+1]=0;
 
-               fprintf(
-                  (FILE *) outFILE,
-                  "@%s-%03i\tdir=rev\tlen=%i\t",
-                  seqSTPtr->idStr,
-                  cntSI++,
-                  lenSI
-               );
+               addChar_outBuf(outBufSTPtr, '@');
             } /*If: have quality score entry*/
 
             else
-               fprintf(
-                  (FILE *) outFILE,
-                  ">%s-%03i\tdir=rev\tlen=%i\t",
-                  seqSTPtr->idStr,
-                  cntSI++,
-                  lenSI
-               );
+               addChar_outBuf(outBufSTPtr, '>');
+
+            addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+            addChar_outBuf(outBufSTPtr, '-');
+            addPadUL_outBuf(outBufSTPtr, cntSI++, 3);
+            addStr_outBuf(
+               outBufSTPtr,
+               (signed char *) "\tdir=rev"
+            );
 
-            fprintf(
-               (FILE *) outFILE,
-               "start=%i\tend=%i\tforPrim=NA\trevPrim=%s",
-               startSI + 1,
-               endSI + 1,
-               barSTPtr[barSI].forSeqST->idStr
+            pPrimCoord_demux(
+               lenSI,
+               startSI,
+               endSI,
+               (signed char *) "NA",
+               barSTPtr[barSI].forSeqST->idStr,
+               outBufSTPtr
             );
-            fprintf(
-               (FILE *) outFILE,
-               "\tforStart=NA\tforEnd=NA\tforScore=NA"
+            addStr_outBuf(
+               outBufSTPtr,
+               (signed char *)
+                  "\tforStart=NA\tforEnd=NA\tforScore=NA"
             );
-            fprintf(
-               (FILE *) outFILE,
-               "\trevStart=%i\trevEnd=%i\trevScore=%i",
+            pPrimMap_demux(
+               (signed char *) "\trevStart=",
                coordArySI[siCoord + 1] - startSI + 1,
                coordArySI[siCoord + 2] - startSI + 1,
-               coordArySI[siCoord + 3] * -1
+               coordArySI[siCoord + 3] * -1,
+               outBufSTPtr
             );
 
-            if(! seqSTPtr->qStr || ! seqSTPtr->qStr[0])
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[
-                    coordArySI[siCoord - 2] + 1
-                 ],
-                 str_endLine
-               );
-            else
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s+%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[
-                    coordArySI[siCoord - 2] + 1
-                 ],
-                 str_endLine, /*end of sequence*/
-                 str_endLine, /*for +*/
-                 &seqSTPtr->qStr[coordArySI[barSI + 1]],
-                 str_endLine  /*for q-score entry*/
+            addStr_outBuf(outBufSTPtr, str_endLine);
+            addStr_outBuf(
+               outBufSTPtr,
+               &seqSTPtr->seqStr[coordArySI[siCoord - 2] + 1]
+            );
+            addStr_outBuf(outBufSTPtr, str_endLine);
+
+            if(seqSTPtr->qStr && seqSTPtr->qStr[0])
+            { /*If: have q-score entry*/
+               addChar_outBuf(outBufSTPtr, '+');
+               addStr_outBuf(outBufSTPtr, str_endLine);
+               addStr_outBuf(
+                  outBufSTPtr,
+                  &seqSTPtr->qStr[coordArySI[barSI + 1]]
                );
+               addStr_outBuf(outBufSTPtr, str_endLine);
+            } /*If: have q-score entry*/
 
             seqSTPtr->seqStr[coordArySI[siCoord + 2]+1] =
                tmpSeqSC;
@@ -1514,7 +1628,7 @@ primer_demux(
          } /*If: need to go backwards*/
 
          /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun05 Sec02 Sub03 Cat02:
+         + Fun07 Sec02 Sub03 Cat02:
          +   - deal with single forward primers
          \++++++++++++++++++++++++++++++++++++++++++++++*/
 
@@ -1556,64 +1670,58 @@ primer_demux(
                seqSTPtr->qStr[coordArySI[siCoord + 6]+1] =
                   0;
 
-               fprintf(
-                  (FILE *) outFILE,
-                  ">%s-%03i\tdir=for\tlen=%i\t",
-                  seqSTPtr->idStr,
-                  cntSI++,
-                  lenSI
-               );
+               addChar_outBuf(outBufSTPtr, '>');
             } /*If: have a quality score entry*/
 
             else
-            { /*Else: is a fastq file*/
-               fprintf(
-                  (FILE *) outFILE,
-                  "@%s-%03i\tdir=for\tlen=%i\t",
-                  seqSTPtr->idStr,
-                  cntSI++,
-                  lenSI
-               );
-            } /*Else: is a fastq file*/
-
-            fprintf(
-               (FILE *) outFILE,
-               "start=%i\tend=%i\tforPrim=%s\trevPrim=NA",
-               startSI + 1,
-               endSI + 1,
-               barSTPtr[siNext].forSeqST->idStr
+               addChar_outBuf(outBufSTPtr, '@');
+
+            addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+            addChar_outBuf(outBufSTPtr, '-');
+            addPadUL_outBuf(outBufSTPtr, cntSI++, 3);
+            addStr_outBuf(
+               outBufSTPtr,
+               (signed char *) "\tdir=for"
+            );
+
+            pPrimCoord_demux(
+               lenSI,
+               startSI,
+               endSI,
+               barSTPtr[siNext].forSeqST->idStr,
+               (signed char *) "NA",
+               outBufSTPtr
             );
-            fprintf(
-               (FILE *) outFILE,
-               "\tforStart=%i\tforEnd=%i\tforScore=%i",
+            pPrimMap_demux(
+               (signed char *) "\tforStart=",
                coordArySI[siCoord + 1] - startSI + 1,
                coordArySI[siCoord + 2] - startSI + 1,
-               coordArySI[siCoord + 3]
+               coordArySI[siCoord + 3],
+               outBufSTPtr
             );
-            fprintf(
-               (FILE *) outFILE,
-               "\trevStart=NA\trevEnd=NA\trevScore=NA"
+            addStr_outBuf(
+               outBufSTPtr,
+               (signed char *)
+                  "\trevStart=NA\trevEnd=NA\trevScore=NA"
             );
 
-            if(! seqSTPtr->qStr || ! seqSTPtr->qStr[0])
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[coordArySI[siCoord+1]],
-                 str_endLine
-               );
-            else
-               fprintf(
-                 (FILE *) outFILE,
-                 "%s%s%s+%s%s%s",
-                 str_endLine, /*for end of header*/
-                 &seqSTPtr->seqStr[coordArySI[siCoord+1]],
-                 str_endLine, /*end of sequence*/
-                 str_endLine, /*for +*/
-                 &seqSTPtr->qStr[coordArySI[barSI + 1]],
-                 str_endLine  /*for q-score entry*/
+            addStr_outBuf(outBufSTPtr, str_endLine);
+            addStr_outBuf(
+               outBufSTPtr,
+               &seqSTPtr->seqStr[coordArySI[siCoord + 1]]
+            );
+            addStr_outBuf(outBufSTPtr, str_endLine);
+
+            if(seqSTPtr->qStr && seqSTPtr->qStr[0])
+            { /*If: have q-score entry*/
+               addChar_outBuf(outBufSTPtr, '+');
+               addStr_outBuf(outBufSTPtr, str_endLine);
+               addStr_outBuf(
+                  outBufSTPtr,
+                  &seqSTPtr->qStr[coordArySI[barSI + 1]]
                );
+               addStr_outBuf(outBufSTPtr, str_endLine);
+            } /*If: have q-score entry*/
 
             seqSTPtr->seqStr[coordArySI[siCoord + 6]+1] =
                tmpSeqSC;
@@ -1626,22 +1734,22 @@ primer_demux(
    } /*Loop: print primers*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun05 Sec05:
+   ^ Fun07 Sec05:
    ^   - return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   goto ret_fun05_sec05;
+   goto ret_fun07_sec05;
 
-   noBarcodes_fun05_sec05:;
+   noBarcodes_fun07_sec05:;
       cntSI = 0;
-      goto ret_fun05_sec05;
+      goto ret_fun07_sec05;
 
-   ret_fun05_sec05:;
+   ret_fun07_sec05:;
       return cntSI;
 } /*primer_demux*/
 
 /*-------------------------------------------------------\
-| Fun06: pGeneCoord_demux
+| Fun08: pGeneCoord_demux
 |   - get coordinates of all genes found in target
 | Input:
 |   - seqSTPtr:
@@ -1664,11 +1772,13 @@ primer_demux(
 |   - geneSTPtr
 |     o refST_kmerFind struct pionter with the genes
 |       to find
-|   - outFILE:
-|     o FILE pionter to print gene coordinates
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print gene coordinates
+|       to
 | Output:
 |   - Prints:
-|     o gene coordinates to outFILE
+|     o gene coordinates to outBufSTPtr (flushed when
+|       full)
 |   - Returns:
 |     o number of amplicons found
 |     o 0 if no genes
@@ -1680,24 +1790,24 @@ pGeneCoord_demux(
    signed int coordLenSI, /*length of coordLenSI*/
    signed char *headBlPtr,/*1: print header + set to 0*/
    struct refST_kmerFind *geneSTPtr,/*genes searched*/
-   void *outFILE          /*print sequences to*/
+   struct outBuf *outBufSTPtr /*print coordinates to*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun06 TOC:
+   ' Fun08 TOC:
    '   - get coordinates of all genes found in target
-   '   o fun06 sec01:
+   '   o fun08 sec01:
    '     - variable declarations
-   '   o fun06 sec02:
+   '   o fun08 sec02:
    '     - print header if needed
-   '   o fun06 sec03:
+   '   o fun08 sec03:
    '     - print gene coordinates
-   '   o fun06 sec04:
+   '   o fun08 sec04:
    '     - print split sequences
-   '   o fun06 sec04:
+   '   o fun08 sec04:
    '     - return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun06 Sec01:
+   ^ Fun08 Sec01:
    ^   - variable declarations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1710,29 +1820,30 @@ pGeneCoord_demux(
    signed int *coordHeapArySI = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun06 Sec02:
+   ^ Fun08 Sec02:
    ^   - print header if needed
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    if(coordLenSI < 4)
-      goto noGenes_fun06_sec04;
+      goto noGenes_fun08_sec04;
 
    if(*headBlPtr)
    { /*If: printing the header*/
-      fprintf(
-         (FILE *) outFILE,
-         "id-count\tgene\tdir\tscore\tmaxScore\tlength"
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *)
+            "id-count\tgene\tdir\tscore\tmaxScore\tlength"
       );
-      fprintf(
-         (FILE *) outFILE,
-         "\tmaxLength\tstart\tend%s",
-         str_endLine
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tmaxLength\tstart\tend"
       );
+      addStr_outBuf(outBufSTPtr, str_endLine);
       *headBlPtr = 0;
    } /*If: printing the header*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun06 Sec03:
+   ^ Fun08 Sec03:
    ^   - print gene coordinates
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1741,50 +1852,67 @@ pGeneCoord_demux(
       geneSI = coordArySI[siCoord];
       lenSI =
           coordArySI[siCoord+2] - coordArySI[siCoord+1]+1;
+
+      addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+      addChar_outBuf(outBufSTPtr, '-');
+      addPadUL_outBuf(outBufSTPtr, cntSI++, 3);
+      addChar_outBuf(outBufSTPtr, '\t');
+      addStr_outBuf(
+         outBufSTPtr,
+         geneSTPtr[geneSI].forSeqST->idStr
+      );
+
       if(coordArySI[siCoord + 3] < 0)
-         fprintf(
-           (FILE *) outFILE,
-           "%s-%03i\t%s\tR\t%i\t%0.2f\t%i\t%li\t%i\t%i%s",
-           seqSTPtr->idStr,
-           cntSI++,                 /*number of genes*/
-           geneSTPtr[geneSI].forSeqST->idStr,
-           coordArySI[siCoord + 3], /*score*/
-           geneSTPtr[geneSI].maxRevScoreF,
-           lenSI,
-           geneSTPtr[geneSI].forSeqST->seqLenSL,
-           coordArySI[siCoord + 1] + 1,     /*start*/
-           coordArySI[siCoord + 2] + 1,     /*end*/
-           str_endLine
+      { /*If: reverse complement mapping*/
+         addStr_outBuf(outBufSTPtr, (signed char *) "\tR\t");
+         addSL_outBuf(outBufSTPtr, coordArySI[siCoord+3]);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addDbl_outBuf(
+            outBufSTPtr,
+            geneSTPtr[geneSI].maxRevScoreF,
+            2
          );
+      } /*If: reverse complement mapping*/
+
       else
-         fprintf(
-           (FILE *) outFILE,
-           "%s-%03i\t%s\tF\t%i\t%0.2f\t%i\t%li\t%i\t%i%s",
-           seqSTPtr->idStr,
-           cntSI++,                       /*number genes*/
-           geneSTPtr[geneSI].forSeqST->idStr,
-           coordArySI[siCoord + 3],   /*score*/
-           geneSTPtr[geneSI].maxForScoreF,
-           lenSI,
-           geneSTPtr[geneSI].forSeqST->seqLenSL,
-           coordArySI[siCoord +1] +1, /*start*/
-           coordArySI[siCoord +2] +1, /*end*/
-           str_endLine
+      { /*Else: forward mapping*/
+         addStr_outBuf(outBufSTPtr, (signed char *) "\tF\t");
+         addSL_outBuf(outBufSTPtr, coordArySI[siCoord+3]);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addDbl_outBuf(
+            outBufSTPtr,
+            geneSTPtr[geneSI].maxForScoreF,
+            2
          );
+      } /*Else: forward mapping*/
+
+      addChar_outBuf(outBufSTPtr, '\t');
+      addSL_outBuf(outBufSTPtr, lenSI);
+      addChar_outBuf(outBufSTPtr, '\t');
+      addSL_outBuf(
+         outBufSTPtr,
+         geneSTPtr[geneSI].forSeqST->seqLenSL
+      );
+
+      addChar_outBuf(outBufSTPtr, '\t');
+      addSL_outBuf(outBufSTPtr, coordArySI[siCoord+1] + 1);
+      addChar_outBuf(outBufSTPtr, '\t');
+      addSL_outBuf(outBufSTPtr, coordArySI[siCoord+2] + 1);
+      addStr_outBuf(outBufSTPtr, str_endLine);
    } /*Loop: print gene coordinates*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun06 Sec04:
+   ^ Fun08 Sec04:
    ^   - return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   goto ret_fun06_sec04;
+   goto ret_fun08_sec04;
 
-   noGenes_fun06_sec04:;
+   noGenes_fun08_sec04:;
       cntSI = 0;
-      goto ret_fun06_sec04;
+      goto ret_fun08_sec04;
 
-   ret_fun06_sec04:;
+   ret_fun08_sec04:;
       if(coordHeapArySI)
          free(coordHeapArySI);
       coordHeapArySI = 0;
@@ -15,8 +15,16 @@
 '     - demux a read
 '   o fun04: read_demux
 '     - convert barcode coordinates to demuxed reads
-'   o fun05: primer_demux
+'   o .c fun05: pPrimCoord_demux
+'     - adds amplicon length, coordinates, and primer ids
+'       to the header of a primer_demux amplicon
+'   o .c fun06: pPrimMap_demux
+'     - adds a primers mapping coordinates and score to
+'       the header of a primer_demux amplicon
+'   o fun07: primer_demux
 '     - get primer target regins from the input sequence
+'   o fun08: pGeneCoord_demux
+'     - get coordinates of all genes found in target
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -30,6 +38,7 @@
 #define DE_MULTIPLEX_READS_H
 
 struct seqST;
+struct outBuf;
 struct tblST_kmerFind;
 struct refST_kmerFind;
 
@@ -65,6 +74,8 @@ struct refST_kmerFind;
 |       - length of the returned array
 |       - -1 if had two different barcodes overlapping
 |       - -2 for memory errors
+|     o if tblSTPtr->statsSTPtr is set, adds the hits
+|       kept and overlapping hits dropped to it
 |   - Returns:
 |     o array with the barcode index, start, end, and
 |       score of each barcode
@@ -139,7 +150,7 @@ read_demux(
 );
 
 /*-------------------------------------------------------\
-| Fun05: primer_demux
+| Fun07: primer_demux
 |   - get primer target regins from the input sequence
 | Input:
 |   - seqSTPtr:
@@ -160,11 +171,11 @@ read_demux(
 |   - barSTPtr:
 |     o refs_kmerFind struct pionter with the primer
 |       ids and the index of their mates (if paired)
-|   - outFILE:
-|     o FILE pionter to print reads to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print reads to
 | Output:
 |   - Prints:
-|     o amplicons to outFILE
+|     o amplicons to outBufSTPtr (flushed when full)
 |   - Returns:
 |     o number of amplicons found
 |     o 0 if no amplicons
@@ -177,11 +188,11 @@ primer_demux(
    signed int coordArySI[],/*has barcode mappings*/
    signed int coordLenSI, /*length of coordLenSI*/
    struct refST_kmerFind *barSTPtr,/*primer ids & mates*/
-   void *outFILE          /*print sequences to*/
+   struct outBuf *outBufSTPtr /*print sequences to*/
 );
 
 /*-------------------------------------------------------\
-| Fun06: pGeneCoord_demux
+| Fun08: pGeneCoord_demux
 |   - get coordinates of all genes found in target
 | Input:
 |   - seqSTPtr:
@@ -204,11 +215,13 @@ primer_demux(
 |   - geneSTPtr
 |     o refST_kmerFind struct pionter with the genes
 |       to find
-|   - outFILE:
-|     o FILE pionter to print gene coordinates
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print gene coordinates
+|       to
 | Output:
 |   - Prints:
-|     o gene coordinates to outFILE
+|     o gene coordinates to outBufSTPtr (flushed when
+|       full)
 |   - Returns:
 |     o number of amplicons found
 |     o 0 if no genes
@@ -220,7 +233,7 @@ pGeneCoord_demux(
    signed int coordLenSI, /*length of coordLenSI*/
    signed char *headBlPtr,/*1: print header + set to 0*/
    struct refST_kmerFind *geneSTPtr,/*genes searched*/
-   void *outFILE          /*print sequences to*/
+   struct outBuf *outBufSTPtr /*print coordinates to*/
 );
 
 #endif
@@ -0,0 +1,802 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' featTbl SOF: Start Of File
+'   - builds a Genbank feature table and a feature errors
+'     table from the hits in a hitTbl struct
+'   o header:
+'     - included libraries
+'   o fun01: blank_featTbl
+'     - sets the number of features to 0
+'   o fun02: init_featTbl
+'     - initializes a featTbl struct
+'   o fun03: freeStack_featTbl
+'     - frees the arrays in a featTbl struct
+'   o fun04: freeHeap_featTbl
+'     - frees a featTbl struct
+'   o fun05: setup_featTbl
+'     - sets up a featTbl struct for the hits in a hitTbl
+'   o .c fun06: cmp_featTbl
+'     - compares two hits by position or by id
+'   o .c fun07: sort_featTbl
+'     - sorts an index array of hits by position or id
+'   o fun08: dup_featTbl
+'     - finds duplicate features (same id or same
+'       reference interval)
+'   o fun09: orf_featTbl
+'     - checks if a hit has a complete reading frame
+'   o fun10: pHead_featTbl
+'     - prints the headers for the feature and feature
+'       error tables
+'   o fun11: p_featTbl
+'     - prints a hit to the feature and feature error
+'       tables
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include "featTbl.h"
+
+#include "../genLib/ptrAry.h"
+#include "../genLib/outBuf.h"
+#include "hitTbl.h"
+
+/*.h files only*/
+#include "../genLib/endLine.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden libraries:
+!   - .c  #include "../genLib/numToStr.h"
+!   - .c  #include "../genLib/ulCp.h"
+!   - .c  #include "../genLib/base10str.h"
+!   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genBio/seqST.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*-------------------------------------------------------\
+| Fun01: blank_featTbl
+|   - sets the number of features to 0
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL in featSTPtr to be 0 (memory is kept)
+\-------------------------------------------------------*/
+void
+blank_featTbl(
+   struct featTbl *featSTPtr
+){
+   featSTPtr->lenSL = 0;
+} /*blank_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun02: init_featTbl
+|   - initializes a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in featSTPtr to be 0 (null) and calls
+|       blank_featTbl
+\-------------------------------------------------------*/
+void
+init_featTbl(
+   struct featTbl *featSTPtr
+){
+   featSTPtr->flagAryUC = 0;
+   featSTPtr->posArySL = 0;
+   featSTPtr->idArySL = 0;
+
+   featSTPtr->sizeSL = 0;
+   blank_featTbl(featSTPtr);
+} /*init_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_featTbl
+|   - frees the arrays in a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with arrays to free
+| Output:
+|   - Frees:
+|     o all arrays in featSTPtr and then initializes
+\-------------------------------------------------------*/
+void
+freeStack_featTbl(
+   struct featTbl *featSTPtr
+){
+   if(! featSTPtr)
+      return;
+
+   if(featSTPtr->flagAryUC)
+      free(featSTPtr->flagAryUC);
+   if(featSTPtr->posArySL)
+      free(featSTPtr->posArySL);
+   if(featSTPtr->idArySL)
+      free(featSTPtr->idArySL);
+
+   init_featTbl(featSTPtr);
+} /*freeStack_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_featTbl
+|   - frees a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to free
+| Output:
+|   - Frees:
+|     o featSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_featTbl(
+   struct featTbl *featSTPtr
+){
+   if(! featSTPtr)
+      return;
+
+   freeStack_featTbl(featSTPtr);
+   free(featSTPtr);
+} /*freeHeap_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun05: setup_featTbl
+|   - sets up a featTbl struct for the hits in a hitTbl
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to set up
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to build the
+|       feature table for
+| Output:
+|   - Modifies:
+|     o arrays in featSTPtr to have one entry per hit
+|     o flagAryUC in featSTPtr to be 0 or
+|       def_nonCoding_featTbl
+|     o posArySL and idArySL to be the hit indexes (not
+|       sorted yet, see dup_featTbl)
+|     o lenSL in featSTPtr to be the number of hits
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_featTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr
+){
+   unsigned char *swapUCPtr = 0;
+   signed long *swapSLPtr = 0;
+   signed long sizeSL = hitSTPtr->lenSL;
+   signed long indexSL = 0;
+
+   if(sizeSL < 1)
+      sizeSL = 1; /*avoid realloc(ptr, 0)*/
+
+   if(featSTPtr->sizeSL < sizeSL)
+   { /*If: need more memory*/
+      swapUCPtr =
+         realloc(
+            featSTPtr->flagAryUC,
+            sizeSL * sizeof(unsigned char)
+         );
+      if(! swapUCPtr)
+         goto memErr_fun05;
+      featSTPtr->flagAryUC = swapUCPtr;
+
+      swapSLPtr =
+         realloc(
+            featSTPtr->posArySL,
+            sizeSL * sizeof(signed long)
+         );
+      if(! swapSLPtr)
+         goto memErr_fun05;
+      featSTPtr->posArySL = swapSLPtr;
+
+      swapSLPtr =
+         realloc(
+            featSTPtr->idArySL,
+            sizeSL * sizeof(signed long)
+         );
+      if(! swapSLPtr)
+         goto memErr_fun05;
+      featSTPtr->idArySL = swapSLPtr;
+
+      featSTPtr->sizeSL = sizeSL;
+   } /*If: need more memory*/
+
+   for(
+      indexSL = 0;
+      indexSL < hitSTPtr->lenSL;
+      ++indexSL
+   ){ /*Loop: set up each feature*/
+      featSTPtr->posArySL[indexSL] = indexSL;
+      featSTPtr->idArySL[indexSL] = indexSL;
+
+      if(
+         nonCoding_hitTbl(hitSTPtr->idST->strAry[indexSL])
+         < 0
+      ) featSTPtr->flagAryUC[indexSL] = 0;
+      else
+         featSTPtr->flagAryUC[indexSL] =
+            def_nonCoding_featTbl;
+   } /*Loop: set up each feature*/
+
+   featSTPtr->lenSL = hitSTPtr->lenSL;
+   return 0;
+
+   memErr_fun05:;
+      return def_memErr_featTbl;
+} /*setup_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun06: cmp_featTbl
+|   - compares two hits by position or by id
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to compare
+|   - qrySL:
+|     o index of query hit
+|   - refSL:
+|     o index of reference hit
+|   - idBl:
+|     o 1: compare ids
+|     o 0: compare reference start, then reference end
+| Output:
+|   - Returns:
+|     o 0 if hits are equal
+|     o > 0 if query is greater
+|     o < 0 if reference is greater
+\-------------------------------------------------------*/
+signed long
+cmp_featTbl(
+   struct hitTbl *hitSTPtr,
+   signed long qrySL,
+   signed long refSL,
+   signed char idBl
+){
+   signed char *qryStr = 0;
+   signed char *refStr = 0;
+
+   if(! idBl)
+   { /*If: comparing positions*/
+      if(
+            hitSTPtr->refStartArySL[qrySL]
+         != hitSTPtr->refStartArySL[refSL]
+      ) return
+              hitSTPtr->refStartArySL[qrySL]
+            - hitSTPtr->refStartArySL[refSL];
+
+      return
+           hitSTPtr->refEndArySL[qrySL]
+         - hitSTPtr->refEndArySL[refSL];
+   } /*If: comparing positions*/
+
+   qryStr = hitSTPtr->idST->strAry[qrySL];
+   refStr = hitSTPtr->idST->strAry[refSL];
+
+   while(*qryStr && *qryStr == *refStr)
+   { /*Loop: find first difference*/
+      ++qryStr;
+      ++refStr;
+   } /*Loop: find first difference*/
+
+   return
+        (signed long) (unsigned char) *qryStr
+      - (signed long) (unsigned char) *refStr;
+} /*cmp_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun07: sort_featTbl
+|   - sorts an index array of hits by position or id
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to sort by
+|   - indexArySL:
+|     o signed long array with hit indexes to sort
+|   - lenSL:
+|     o number of indexes in indexArySL
+|   - idBl:
+|     o 1: sort by id
+|     o 0: sort by reference start, then reference end
+| Output:
+|   - Modifies:
+|     o indexArySL to be sorted (shell sort)
+\-------------------------------------------------------*/
+void
+sort_featTbl(
+   struct hitTbl *hitSTPtr,
+   signed long *indexArySL,
+   signed long lenSL,
+   signed char idBl
+){
+   signed long subSL = 1;
+   signed long startSL = 0;
+   signed long onSL = 0;
+   signed long lastSL = 0;
+   signed long swapSL = 0;
+
+   if(lenSL <= 1)
+      return; /*nothing to do*/
+
+   /*Recursion formuia: h[0] = 1, h[n] = 3 * h[n - 1] +1*/
+   while(subSL < lenSL - 1)
+      subSL = (3 * subSL) + 1;
+
+   while(subSL > 0)
+   { /*Loop: all rounds*/
+      for(
+         startSL = subSL;
+         startSL < lenSL;
+         ++startSL
+      ){ /*Loop: insertion sort sub arrays*/
+         swapSL = indexArySL[startSL];
+         onSL = startSL;
+
+         while(onSL >= subSL)
+         { /*Loop: move element back*/
+            lastSL = onSL - subSL;
+
+            if(
+               cmp_featTbl(
+                  hitSTPtr,
+                  indexArySL[lastSL],
+                  swapSL,
+                  idBl
+               ) <= 0
+            ) break; /*found position*/
+
+            indexArySL[onSL] = indexArySL[lastSL];
+            onSL = lastSL;
+         } /*Loop: move element back*/
+
+         indexArySL[onSL] = swapSL;
+      } /*Loop: insertion sort sub arrays*/
+
+      subSL = (subSL - 1) / 3; /*Move to next round*/
+   } /*Loop: all rounds*/
+} /*sort_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun08: dup_featTbl
+|   - finds duplicate features (same id or same
+|     reference interval)
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with features (from
+|       setup_featTbl)
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits used to set up
+|       featSTPtr
+| Output:
+|   - Modifies:
+|     o posArySL in featSTPtr to be sorted by reference
+|       start and then reference end
+|     o idArySL in featSTPtr to be sorted by id
+|     o flagAryUC in featSTPtr to have def_dup_featTbl
+|       set for each duplicate feature
+|   - Returns:
+|     o number of duplicate features
+\-------------------------------------------------------*/
+signed long
+dup_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr
+){
+   signed long indexSL = 0;
+   signed long dupSL = 0;
+   signed long *arySL = 0;
+   signed char idBl = 0;
+
+   for(idBl = 0; idBl < 2; ++idBl)
+   { /*Loop: check positions and then ids*/
+      if(idBl)
+         arySL = featSTPtr->idArySL;
+      else
+         arySL = featSTPtr->posArySL;
+
+      sort_featTbl(
+         hitSTPtr,
+         arySL,
+         featSTPtr->lenSL,
+         idBl
+      );
+
+      /*duplicates are next to each other after sorting*/
+      for(
+         indexSL = 1;
+         indexSL < featSTPtr->lenSL;
+         ++indexSL
+      ){ /*Loop: find duplicates*/
+         if(
+            cmp_featTbl(
+               hitSTPtr,
+               arySL[indexSL - 1],
+               arySL[indexSL],
+               idBl
+            )
+         ) continue;
+
+         featSTPtr->flagAryUC[arySL[indexSL - 1]] |=
+            def_dup_featTbl;
+         featSTPtr->flagAryUC[arySL[indexSL]] |=
+            def_dup_featTbl;
+      } /*Loop: find duplicates*/
+   } /*Loop: check positions and then ids*/
+
+   for(
+      indexSL = 0;
+      indexSL < featSTPtr->lenSL;
+      ++indexSL
+   ) dupSL +=
+        featSTPtr->flagAryUC[indexSL] & def_dup_featTbl;
+
+   return dupSL;
+} /*dup_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun09: orf_featTbl
+|   - checks if a hit has a complete reading frame
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to add warnings to
+|   - indexSL:
+|     o index of hit the amino acid sequence is for
+|   - aaStr:
+|     o c-string with the translated hit
+|   - lenAaSL:
+|     o length of aaStr
+| Output:
+|   - Modifies:
+|     o flagAryUC[indexSL] in featSTPtr to have
+|       def_noStart_featTbl set if aaStr does not start
+|       with 'M' and def_noEnd_featTbl set if aaStr does
+|       not end with '*' (non-coding is not checked)
+\-------------------------------------------------------*/
+void
+orf_featTbl(
+   struct featTbl *featSTPtr,
+   signed long indexSL,
+   signed char *aaStr,
+   signed long lenAaSL
+){
+   unsigned char *flagUCPtr =
+      &featSTPtr->flagAryUC[indexSL];
+
+   if(*flagUCPtr & def_nonCoding_featTbl)
+      return; /*non-coding regions have no ORF*/
+
+   if(lenAaSL < 1)
+   { /*If: nothing was translated*/
+      *flagUCPtr |= def_noStart_featTbl;
+      *flagUCPtr |= def_noEnd_featTbl;
+      return;
+   } /*If: nothing was translated*/
+
+   if((aaStr[0] & ~32) != 'M')
+      *flagUCPtr |= def_noStart_featTbl;
+
+   if(aaStr[lenAaSL - 1] != '*')
+      *flagUCPtr |= def_noEnd_featTbl;
+} /*orf_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun10: pHead_featTbl
+|   - prints the headers for the feature and feature
+|     error tables
+| Input:
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - featOutSTPtr:
+|     o outBuf struct pointer to print the feature table
+|       header to (0 to not print)
+|   - errOutSTPtr:
+|     o outBuf struct pointer to print the feature error
+|       table header to (0 to not print)
+| Output:
+|   - Prints:
+|     o ">Feature\trefId" to featOutSTPtr
+|     o column names to errOutSTPtr
+\-------------------------------------------------------*/
+void
+pHead_featTbl(
+   signed char *refIdStr,
+   struct outBuf *featOutSTPtr,
+   struct outBuf *errOutSTPtr
+){
+   signed long lenSL = 0;
+
+   if(featOutSTPtr)
+   { /*If: printing the feature table header*/
+      while(refIdStr[lenSL] > 32)
+         ++lenSL;
+
+      addStr_outBuf(
+         featOutSTPtr,
+         (signed char *) ">Feature\t"
+      );
+      addLenStr_outBuf(featOutSTPtr, refIdStr, lenSL);
+      addStr_outBuf(featOutSTPtr, str_endLine);
+   } /*If: printing the feature table header*/
+
+   if(errOutSTPtr)
+   { /*If: printing the error table header*/
+      addStr_outBuf(
+         errOutSTPtr,
+         (signed char *)
+            "gene\tduplicate\tno_orf_start\tno_orf_end"
+      );
+      addStr_outBuf(
+         errOutSTPtr,
+         (signed char *) "\tdirection\tstart\tend"
+      );
+      addStr_outBuf(errOutSTPtr, str_endLine);
+   } /*If: printing the error table header*/
+} /*pHead_featTbl*/
+
+/*-------------------------------------------------------\
+| Fun11: p_featTbl
+|   - prints a hit to the feature and feature error
+|     tables
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with hit warnings
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - featOutSTPtr:
+|     o outBuf struct pointer to print the feature to
+|       (0 to not print)
+|   - errOutSTPtr:
+|     o outBuf struct pointer to print the warnings to
+|       (0 to not print)
+| Output:
+|   - Prints:
+|     o gene and CDS entries (coding) or a single line
+|       (non-coding) to featOutSTPtr, with a note if the
+|       hit had warnings
+|     o hit warnings to errOutSTPtr (only if the hit had
+|       warnings)
+\-------------------------------------------------------*/
+void
+p_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct outBuf *featOutSTPtr,
+   struct outBuf *errOutSTPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun11 TOC:
+   '   - prints a hit to the feature and feature error
+   '     tables
+   '   o fun11 sec01:
+   '     - variable declarations
+   '   o fun11 sec02:
+   '     - print the feature entry
+   '   o fun11 sec03:
+   '     - print the feature error entry
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *idStr = hitSTPtr->idST->strAry[indexSL];
+   signed long nonCodeSL = nonCoding_hitTbl(idStr);
+   unsigned char flagUC = featSTPtr->flagAryUC[indexSL];
+
+   signed long firstSL = hitSTPtr->refStartArySL[indexSL];
+   signed long secSL = hitSTPtr->refEndArySL[indexSL];
+
+   signed char *trueStr = (signed char *) "\tTrue";
+   signed char *falseStr = (signed char *) "\tFalse";
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec02:
+   ^   - print the feature entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+   { /*If: reverse feature; Genbank wants end first*/
+      firstSL = hitSTPtr->refEndArySL[indexSL];
+      secSL = hitSTPtr->refStartArySL[indexSL];
+   } /*If: reverse feature; Genbank wants end first*/
+
+   if(! featOutSTPtr)
+      goto errTbl_fun11_sec03;
+
+   addSL_outBuf(featOutSTPtr, firstSL);
+   addChar_outBuf(featOutSTPtr, '\t');
+   addSL_outBuf(featOutSTPtr, secSL);
+
+   if(nonCodeSL >= 0)
+   { /*If: non-coding feature*/
+      /*id has non-coding removed (same as nt headers)*/
+      addChar_outBuf(featOutSTPtr, '\t');
+      addLenStr_outBuf(featOutSTPtr, idStr, nonCodeSL);
+      addStr_outBuf(
+         featOutSTPtr,
+         &idStr[nonCodeSL + def_lenNonCoding_hitTbl]
+      );
+      addStr_outBuf(featOutSTPtr, str_endLine);
+   } /*If: non-coding feature*/
+
+   else
+   { /*Else: coding (gene) feature*/
+      addStr_outBuf(featOutSTPtr, (signed char *) "\tgene");
+      addStr_outBuf(featOutSTPtr, str_endLine);
+
+      addStr_outBuf(
+         featOutSTPtr,
+         (signed char *) "\t\t\t\tgene\t"
+      );
+      addStr_outBuf(featOutSTPtr, idStr);
+      addStr_outBuf(featOutSTPtr, str_endLine);
+
+      addSL_outBuf(featOutSTPtr, firstSL);
+      addChar_outBuf(featOutSTPtr, '\t');
+      addSL_outBuf(featOutSTPtr, secSL);
+      addStr_outBuf(featOutSTPtr, (signed char *) "\tCDS");
+      addStr_outBuf(featOutSTPtr, str_endLine);
+
+      addStr_outBuf(
+         featOutSTPtr,
+         (signed char *) "\t\t\t\tproduct\t"
+      );
+      addStr_outBuf(featOutSTPtr, idStr);
+      addStr_outBuf(featOutSTPtr, str_endLine);
+   } /*Else: coding (gene) feature*/
+
+   if(flagUC & def_dup_featTbl)
+   { /*If: duplicate feature*/
+      addStr_outBuf(
+         featOutSTPtr,
+         (signed char *) "\t\t\t\tnote\tWARNING_DUPLICATE"
+      );
+
+      if(flagUC & (def_noStart_featTbl |def_noEnd_featTbl))
+         addStr_outBuf(
+            featOutSTPtr,
+            (signed char *) "____WARNING_INCOMPLETE_ORF"
+         );
+
+      addStr_outBuf(featOutSTPtr, str_endLine);
+   } /*If: duplicate feature*/
+
+   else if(
+      flagUC & (def_noStart_featTbl | def_noEnd_featTbl)
+   ){ /*Else If: incomplete reading frame*/
+      addStr_outBuf(
+         featOutSTPtr,
+         (signed char *)"\t\t\t\tnote\tWARNING_INCOMPLETE_ORF"
+      );
+      addStr_outBuf(featOutSTPtr, str_endLine);
+   } /*Else If: incomplete reading frame*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec03:
+   ^   - print the feature error entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errTbl_fun11_sec03:;
+
+   if(! errOutSTPtr)
+      return;
+
+   if(! (flagUC & ~def_nonCoding_featTbl))
+      return; /*no warnings for this hit*/
+
+   addStr_outBuf(errOutSTPtr, idStr);
+
+   if(flagUC & def_dup_featTbl)
+      addStr_outBuf(errOutSTPtr, trueStr);
+   else
+      addStr_outBuf(errOutSTPtr, falseStr);
+
+   if(flagUC & def_noStart_featTbl)
+      addStr_outBuf(errOutSTPtr, trueStr);
+   else
+      addStr_outBuf(errOutSTPtr, falseStr);
+
+   if(flagUC & def_noEnd_featTbl)
+      addStr_outBuf(errOutSTPtr, trueStr);
+   else
+      addStr_outBuf(errOutSTPtr, falseStr);
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+      addStr_outBuf(errOutSTPtr, (signed char *)"\treverse");
+   else
+      addStr_outBuf(errOutSTPtr, (signed char *)"\tforward");
+
+   addChar_outBuf(errOutSTPtr, '\t');
+   addSL_outBuf(errOutSTPtr,hitSTPtr->refStartArySL[indexSL]);
+   addChar_outBuf(errOutSTPtr, '\t');
+   addSL_outBuf(errOutSTPtr, hitSTPtr->refEndArySL[indexSL]);
+   addStr_outBuf(errOutSTPtr, str_endLine);
+} /*p_featTbl*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
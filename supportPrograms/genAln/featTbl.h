@@ -0,0 +1,346 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' featTbl SOF: Start Of File
+'   - builds a Genbank feature table and a feature errors
+'     table from the hits in a hitTbl struct
+'   o header:
+'     - guards and defined variables
+'   o .h st01: featTbl
+'     - holds the warnings for each hit and the hits
+'       sorted by position and id
+'   o fun01: blank_featTbl
+'     - sets the number of features to 0
+'   o fun02: init_featTbl
+'     - initializes a featTbl struct
+'   o fun03: freeStack_featTbl
+'     - frees the arrays in a featTbl struct
+'   o fun04: freeHeap_featTbl
+'     - frees a featTbl struct
+'   o fun05: setup_featTbl
+'     - sets up a featTbl struct for the hits in a hitTbl
+'   o .c fun06: cmp_featTbl
+'     - compares two hits by position or by id
+'   o .c fun07: sort_featTbl
+'     - sorts an index array of hits by position or id
+'   o fun08: dup_featTbl
+'     - finds duplicate features (same id or same
+'       reference interval)
+'   o fun09: orf_featTbl
+'     - checks if a hit has a complete reading frame
+'   o fun10: pHead_featTbl
+'     - prints the headers for the feature and feature
+'       error tables
+'   o fun11: p_featTbl
+'     - prints a hit to the feature and feature error
+'       tables
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards and defined variables
+\-------------------------------------------------------*/
+
+#ifndef FEATURE_TABLE_H
+#define FEATURE_TABLE_H
+
+struct hitTbl;
+struct outBuf;
+
+#define def_memErr_featTbl 1
+
+/*flags in flagAryUC*/
+#define def_dup_featTbl 1       /*duplicate feature*/
+#define def_noStart_featTbl 2   /*no start codon*/
+#define def_noEnd_featTbl 4     /*no stop codon*/
+#define def_nonCoding_featTbl 8 /*non-coding feature*/
+
+/*-------------------------------------------------------\
+| ST01: featTbl
+|   - holds the warnings for each hit and the hits sorted
+|     by position and id
+\-------------------------------------------------------*/
+typedef struct featTbl
+{
+   unsigned char *flagAryUC; /*def_dup_featTbl | ...*/
+   signed long *posArySL;    /*hits sorted by start, end*/
+   signed long *idArySL;     /*hits sorted by id*/
+
+   signed long lenSL;        /*number of features*/
+   signed long sizeSL;       /*size of the arrays*/
+}featTbl;
+
+/*-------------------------------------------------------\
+| Fun01: blank_featTbl
+|   - sets the number of features to 0
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL in featSTPtr to be 0 (memory is kept)
+\-------------------------------------------------------*/
+void
+blank_featTbl(
+   struct featTbl *featSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun02: init_featTbl
+|   - initializes a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in featSTPtr to be 0 (null) and calls
+|       blank_featTbl
+\-------------------------------------------------------*/
+void
+init_featTbl(
+   struct featTbl *featSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_featTbl
+|   - frees the arrays in a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with arrays to free
+| Output:
+|   - Frees:
+|     o all arrays in featSTPtr and then initializes
+\-------------------------------------------------------*/
+void
+freeStack_featTbl(
+   struct featTbl *featSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_featTbl
+|   - frees a featTbl struct
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to free
+| Output:
+|   - Frees:
+|     o featSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_featTbl(
+   struct featTbl *featSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun05: setup_featTbl
+|   - sets up a featTbl struct for the hits in a hitTbl
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to set up
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to build the
+|       feature table for
+| Output:
+|   - Modifies:
+|     o arrays in featSTPtr to have one entry per hit
+|     o flagAryUC in featSTPtr to be 0 or
+|       def_nonCoding_featTbl
+|     o posArySL and idArySL to be the hit indexes (not
+|       sorted yet, see dup_featTbl)
+|     o lenSL in featSTPtr to be the number of hits
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_featTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun08: dup_featTbl
+|   - finds duplicate features (same id or same
+|     reference interval)
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with features (from
+|       setup_featTbl)
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits used to set up
+|       featSTPtr
+| Output:
+|   - Modifies:
+|     o posArySL in featSTPtr to be sorted by reference
+|       start and then reference end
+|     o idArySL in featSTPtr to be sorted by id
+|     o flagAryUC in featSTPtr to have def_dup_featTbl
+|       set for each duplicate feature
+|   - Returns:
+|     o number of duplicate features
+\-------------------------------------------------------*/
+signed long
+dup_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun09: orf_featTbl
+|   - checks if a hit has a complete reading frame
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer to add warnings to
+|   - indexSL:
+|     o index of hit the amino acid sequence is for
+|   - aaStr:
+|     o c-string with the translated hit
+|   - lenAaSL:
+|     o length of aaStr
+| Output:
+|   - Modifies:
+|     o flagAryUC[indexSL] in featSTPtr to have
+|       def_noStart_featTbl set if aaStr does not start
+|       with 'M' and def_noEnd_featTbl set if aaStr does
+|       not end with '*' (non-coding is not checked)
+\-------------------------------------------------------*/
+void
+orf_featTbl(
+   struct featTbl *featSTPtr,
+   signed long indexSL,
+   signed char *aaStr,
+   signed long lenAaSL
+);
+
+/*-------------------------------------------------------\
+| Fun10: pHead_featTbl
+|   - prints the headers for the feature and feature
+|     error tables
+| Input:
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - featOutSTPtr:
+|     o outBuf struct pointer to print the feature table
+|       header to (0 to not print)
+|   - errOutSTPtr:
+|     o outBuf struct pointer to print the feature error
+|       table header to (0 to not print)
+| Output:
+|   - Prints:
+|     o ">Feature\trefId" to featOutSTPtr
+|     o column names to errOutSTPtr
+\-------------------------------------------------------*/
+void
+pHead_featTbl(
+   signed char *refIdStr,
+   struct outBuf *featOutSTPtr,
+   struct outBuf *errOutSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun11: p_featTbl
+|   - prints a hit to the feature and feature error
+|     tables
+| Input:
+|   - featSTPtr:
+|     o featTbl struct pointer with hit warnings
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - featOutSTPtr:
+|     o outBuf struct pointer to print the feature to
+|       (0 to not print)
+|   - errOutSTPtr:
+|     o outBuf struct pointer to print the warnings to
+|       (0 to not print)
+| Output:
+|   - Prints:
+|     o gene and CDS entries (coding) or a single line
+|       (non-coding) to featOutSTPtr, with a note if the
+|       hit had warnings
+|     o hit warnings to errOutSTPtr (only if the hit had
+|       warnings)
+\-------------------------------------------------------*/
+void
+p_featTbl(
+   struct featTbl *featSTPtr,
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct outBuf *featOutSTPtr,
+   struct outBuf *errOutSTPtr
+);
+
+#endif
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
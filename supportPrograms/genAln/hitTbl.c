@@ -0,0 +1,1558 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' hitTbl SOF: Start Of File
+'   - holds the gene mappings (hits) from a scores.tsv or
+'     highScores.tsv file made by annotateASFV and has
+'     functions to extract the mapped gene sequences
+'   - also filters and prints the hits from the mappers
+'     (demux and memwaterScan -score-tbl)
+'   o header:
+'     - included libraries
+'   o fun01: blank_hitTbl
+'     - sets the number of hits in a hitTbl struct to 0
+'   o fun02: init_hitTbl
+'     - initializes a hitTbl struct
+'   o fun03: freeStack_hitTbl
+'     - frees the arrays in a hitTbl struct
+'   o fun04: freeHeap_hitTbl
+'     - frees a hitTbl struct
+'   o fun05: resize_hitTbl
+'     - resizes the arrays in a hitTbl struct
+'   o .c fun06: getNum_hitTbl
+'     - gets a number or NA from a score table column
+'   o .c fun07: addLine_hitTbl
+'     - adds a line from a score table to a hitTbl struct
+'   o fun08: get_hitTbl
+'     - reads in all hits from a score table (tsv)
+'   o fun09: getNt_hitTbl
+'     - extracts the nucleotide sequence of a hit from
+'       the reference (reverse complements reverse hits)
+'   o fun10: nonCoding_hitTbl
+'     - finds if a gene id is for a non-coding region
+'   o fun11: pHead_hitTbl
+'     - prints the fasta header for a hit
+'   o fun12: pNt_hitTbl
+'     - prints the nucleotide sequence of a hit as a
+'       fasta entry
+'   o fun13: pAa_hitTbl
+'     - prints the amino acid sequence of a hit as a
+'       fasta entry (same format as tranSeq -orf-1)
+'   o fun14: add_hitTbl
+'     - adds a hit (gene mapping) to a hitTbl struct
+'   o fun15: swap_hitTbl
+'     - swaps two hits in a hitTbl struct
+'   o .c fun16: cmpNum_hitTbl
+'     - compares two numbers as c-strings (as sort does)
+'   o .c fun17: cmp_hitTbl
+'     - compares two hits for sort_hitTbl
+'   o fun18: sort_hitTbl
+'     - sorts the hits in a hitTbl struct
+'   o fun19: overlap_hitTbl
+'     - removes hits with a reference start inside a
+'       higher (or same) scoring hit
+'   o fun20: pRow_hitTbl
+'     - prints a hit as a score table (scores.tsv) row
+'   o fun21: pHigh_hitTbl
+'     - prints the highest scoring hit(s) as score table
+'       (highScores.tsv) rows
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "hitTbl.h"
+
+#include "../genLib/base10str.h"
+#include "../genLib/ulCp.h"
+#include "../genLib/fileFun.h"
+#include "../genLib/ptrAry.h"
+#include "../genLib/numToStr.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
+#include "../genBio/seqST.h"
+
+/*.h files only*/
+#include "../genLib/endLine.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden libraries:
+!   - .c  #include "../genLib/numToStr.h" (outBuf)
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*-------------------------------------------------------\
+| Fun01: blank_hitTbl
+|   - sets the number of hits in a hitTbl struct to 0
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL in hitSTPtr to be 0 (memory is kept)
+\-------------------------------------------------------*/
+void
+blank_hitTbl(
+   struct hitTbl *hitSTPtr
+){
+   hitSTPtr->lenSL = 0;
+} /*blank_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun02: init_hitTbl
+|   - initializes a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to be 0 (null) and calls
+|       blank_hitTbl
+\-------------------------------------------------------*/
+void
+init_hitTbl(
+   struct hitTbl *hitSTPtr
+){
+   hitSTPtr->idST = 0;
+   hitSTPtr->dirAryUC = 0;
+
+   hitSTPtr->scoreArySL = 0;
+   hitSTPtr->maxScoreArySL = 0;
+
+   hitSTPtr->refStartArySL = 0;
+   hitSTPtr->refEndArySL = 0;
+   hitSTPtr->qryStartArySL = 0;
+   hitSTPtr->qryEndArySL = 0;
+   hitSTPtr->qryLenArySL = 0;
+   hitSTPtr->alnLenArySL = 0;
+
+   hitSTPtr->sizeSL = 0;
+   blank_hitTbl(hitSTPtr);
+} /*init_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_hitTbl
+|   - frees the arrays in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with arrays to free
+| Output:
+|   - Frees:
+|     o all arrays in hitSTPtr and then initializes
+\-------------------------------------------------------*/
+void
+freeStack_hitTbl(
+   struct hitTbl *hitSTPtr
+){
+   if(! hitSTPtr)
+      return;
+
+   if(hitSTPtr->idST)
+      freeHeap_str_ptrAry(hitSTPtr->idST);
+
+   if(hitSTPtr->dirAryUC)
+      free(hitSTPtr->dirAryUC);
+
+   if(hitSTPtr->scoreArySL)
+      free(hitSTPtr->scoreArySL);
+   if(hitSTPtr->maxScoreArySL)
+      free(hitSTPtr->maxScoreArySL);
+
+   if(hitSTPtr->refStartArySL)
+      free(hitSTPtr->refStartArySL);
+   if(hitSTPtr->refEndArySL)
+      free(hitSTPtr->refEndArySL);
+
+   if(hitSTPtr->qryStartArySL)
+      free(hitSTPtr->qryStartArySL);
+   if(hitSTPtr->qryEndArySL)
+      free(hitSTPtr->qryEndArySL);
+   if(hitSTPtr->qryLenArySL)
+      free(hitSTPtr->qryLenArySL);
+
+   if(hitSTPtr->alnLenArySL)
+      free(hitSTPtr->alnLenArySL);
+
+   init_hitTbl(hitSTPtr);
+} /*freeStack_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_hitTbl
+|   - frees a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to free
+| Output:
+|   - Frees:
+|     o hitSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_hitTbl(
+   struct hitTbl *hitSTPtr
+){
+   if(! hitSTPtr)
+      return;
+
+   freeStack_hitTbl(hitSTPtr);
+   free(hitSTPtr);
+} /*freeHeap_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun05: resize_hitTbl
+|   - resizes the arrays in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to resize
+|   - sizeSL:
+|     o new size of the arrays
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to hold sizeSL hits
+|     o sizeSL in hitSTPtr to be sizeSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+resize_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long sizeSL
+){
+   unsigned char *swapUCPtr = 0;
+   signed long *swapSLPtr = 0;
+
+   if(! hitSTPtr->idST)
+   { /*If: need to make the id array*/
+      hitSTPtr->idST = mk_str_ptrAry(sizeSL);
+
+      if(! hitSTPtr->idST)
+         goto memErr_fun05;
+   } /*If: need to make the id array*/
+
+   else if(resize_str_ptrAry(hitSTPtr->idST, sizeSL))
+      goto memErr_fun05;
+
+   swapUCPtr =
+      realloc(
+         hitSTPtr->dirAryUC,
+         sizeSL * sizeof(unsigned char)
+      );
+   if(! swapUCPtr)
+      goto memErr_fun05;
+   hitSTPtr->dirAryUC = swapUCPtr;
+
+   /*realloc(0, size) is the same as malloc(size)*/
+   swapSLPtr =
+      realloc(
+         hitSTPtr->scoreArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->scoreArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->maxScoreArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->maxScoreArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->refStartArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->refStartArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->refEndArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->refEndArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->qryStartArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->qryStartArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->qryEndArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->qryEndArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->qryLenArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->qryLenArySL = swapSLPtr;
+
+   swapSLPtr =
+      realloc(
+         hitSTPtr->alnLenArySL,
+         sizeSL * sizeof(signed long)
+      );
+   if(! swapSLPtr)
+      goto memErr_fun05;
+   hitSTPtr->alnLenArySL = swapSLPtr;
+
+   hitSTPtr->sizeSL = sizeSL;
+   return 0;
+
+   memErr_fun05:;
+      return def_memErr_hitTbl;
+} /*resize_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun06: getNum_hitTbl
+|   - gets a number or NA from a score table column
+| Input:
+|   - lineStr:
+|     o c-string with column to get number from
+|   - numSLPtr:
+|     o signed long pointer to get the number
+| Output:
+|   - Modifies:
+|     o numSLPtr to have the number or def_NA_hitTbl if
+|       the column was NA
+|   - Returns:
+|     o number of characters in the column
+|     o 0 if the column was not a number
+\-------------------------------------------------------*/
+signed int
+getNum_hitTbl(
+   signed char *lineStr,
+   signed long *numSLPtr
+){
+   signed int retSI = 0;
+
+   if(lineStr[0] == 'N' && lineStr[1] == 'A')
+   { /*If: no value was given*/
+      *numSLPtr = def_NA_hitTbl;
+      retSI = 2;
+   } /*If: no value was given*/
+
+   else
+      retSI = strToSL_base10str(lineStr, numSLPtr);
+
+   if(! retSI)
+      return 0;
+   else if(lineStr[retSI] > 32)
+      return 0; /*column has non-numeric characters*/
+
+   return retSI;
+} /*getNum_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun07: addLine_hitTbl
+|   - adds a line from a score table to a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to add hit to
+|   - lineStr:
+|     o c-string with line to add
+| Output:
+|   - Modifies:
+|     o hitSTPtr to have the hit at index lenSL (arrays
+|       are resized if needed) and increments lenSL
+|     o lineStr; the tab after the id is set to '\0'
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+|     o def_invalidEntry_hitTbl if lineStr is not a hit
+\-------------------------------------------------------*/
+signed char
+addLine_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed char *lineStr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun07 TOC:
+   '   - adds a line from a score table to a hitTbl struct
+   '   o fun07 sec01:
+   '     - variable declarations
+   '   o fun07 sec02:
+   '     - make sure have memory and get gene id
+   '   o fun07 sec03:
+   '     - get direction
+   '   o fun07 sec04:
+   '     - get numeric columns
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun07 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long indexSL = hitSTPtr->lenSL;
+   signed int posSI = 0;
+   signed int lenSI = 0;
+   signed char colSC = 0;
+
+   signed long *colArySL[8];
+      /*score to aln_len columns (in table order)*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun07 Sec02:
+   ^   - make sure have memory and get gene id
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(indexSL >= hitSTPtr->sizeSL)
+   { /*If: need more memory*/
+      if(
+         resize_hitTbl(
+            hitSTPtr,
+            hitSTPtr->sizeSL + (hitSTPtr->sizeSL >> 1) + 16
+         )
+      ) return def_memErr_hitTbl;
+   } /*If: need more memory*/
+
+   while(lineStr[posSI] > 32)
+      ++posSI;
+
+   if(! posSI || lineStr[posSI] != '\t')
+      return def_invalidEntry_hitTbl;
+
+   lineStr[posSI] = '\0';
+
+   if(add_str_ptrAry(lineStr, hitSTPtr->idST, indexSL))
+      return def_memErr_hitTbl;
+
+   ++posSI;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun07 Sec03:
+   ^   - get direction
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if((lineStr[posSI] | 32) == 'f')
+      hitSTPtr->dirAryUC[indexSL] = def_forward_hitTbl;
+   else if((lineStr[posSI] | 32) == 'r')
+      hitSTPtr->dirAryUC[indexSL] = def_reverse_hitTbl;
+   else
+      return def_invalidEntry_hitTbl;
+
+   while(lineStr[posSI] > 32)
+      ++posSI;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun07 Sec04:
+   ^   - get numeric columns
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   colArySL[0] = &hitSTPtr->scoreArySL[indexSL];
+   colArySL[1] = &hitSTPtr->maxScoreArySL[indexSL];
+   colArySL[2] = &hitSTPtr->refStartArySL[indexSL];
+   colArySL[3] = &hitSTPtr->refEndArySL[indexSL];
+   colArySL[4] = &hitSTPtr->qryStartArySL[indexSL];
+   colArySL[5] = &hitSTPtr->qryEndArySL[indexSL];
+   colArySL[6] = &hitSTPtr->qryLenArySL[indexSL];
+   colArySL[7] = &hitSTPtr->alnLenArySL[indexSL];
+
+   for(colSC = 0; colSC < 8; ++colSC)
+   { /*Loop: get numeric columns*/
+      if(lineStr[posSI] != '\t')
+         return def_invalidEntry_hitTbl;
+
+      ++posSI;
+      lenSI = getNum_hitTbl(&lineStr[posSI], colArySL[colSC]);
+
+      if(! lenSI)
+         return def_invalidEntry_hitTbl;
+
+      posSI += lenSI;
+   } /*Loop: get numeric columns*/
+
+   ++hitSTPtr->lenSL;
+   return 0;
+} /*addLine_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun08: get_hitTbl
+|   - reads in all hits from a score table (tsv)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to add hits to
+|   - inFILE:
+|     o FILE pointer to the score table (header lines
+|       starting with gene_id are skipped)
+|   - lineSLPtr:
+|     o signed long pointer to get the line number an
+|       error happened on
+| Output:
+|   - Modifies:
+|     o hitSTPtr to have the hits in inFILE (appended to
+|       the end of any previous hits)
+|     o lineSLPtr to have line number of error or the
+|       number of lines read in
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+|     o def_invalidEntry_hitTbl if a line is not a hit
+\-------------------------------------------------------*/
+signed char
+get_hitTbl(
+   struct hitTbl *hitSTPtr,
+   void *inFILE,
+   signed long *lineSLPtr
+){
+   signed char errSC = 0;
+   signed char *lineHeapStr = 0;
+   signed long sizeSL = 0;
+   signed long lenSL = 0;
+   signed long bytesSL = 0;
+
+   signed char *headStr = (signed char *) "gene_id";
+   signed int posSI = 0;
+
+   *lineSLPtr = 0;
+
+   while(1)
+   { /*Loop: read in hits*/
+      lenSL =
+         getFullLine_fileFun(
+            inFILE,
+            &lineHeapStr,
+            &sizeSL,
+            &bytesSL,
+            0
+         );
+
+      if(! lenSL)
+         break; /*EOF*/
+      else if(lenSL < 0)
+         goto memErr_fun08;
+
+      ++(*lineSLPtr);
+
+      if(lineHeapStr[0] < 33)
+         continue; /*blank line*/
+
+      for(posSI = 0; headStr[posSI]; ++posSI)
+      { /*Loop: check if header*/
+         if(lineHeapStr[posSI] != headStr[posSI])
+            break;
+      } /*Loop: check if header*/
+
+      if(! headStr[posSI] && lineHeapStr[posSI] < 33)
+         continue; /*header*/
+
+      errSC = addLine_hitTbl(hitSTPtr, lineHeapStr);
+
+      if(errSC)
+         goto ret_fun08;
+   } /*Loop: read in hits*/
+
+   errSC = 0;
+   goto ret_fun08;
+
+   memErr_fun08:;
+      errSC = def_memErr_hitTbl;
+      goto ret_fun08;
+
+   ret_fun08:;
+      if(lineHeapStr)
+         free(lineHeapStr);
+      lineHeapStr = 0;
+
+      return errSC;
+} /*get_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun09: getNt_hitTbl
+|   - extracts the nucleotide sequence of a hit from
+|     the reference (reverse complements reverse hits)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to extract
+|   - indexSL:
+|     o index of hit to extract
+|   - refSTPtr:
+|     o seqST struct pointer with reference sequence
+|   - geneSTPtr:
+|     o seqST struct pointer to get the gene sequence
+| Output:
+|   - Modifies:
+|     o seqStr in geneSTPtr to have the aln_len bases
+|       starting at ref_start (resized if needed)
+|     o seqLenSL in geneSTPtr to have sequence length
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+|     o def_rangeErr_hitTbl if the hit starts after the
+|       end of the reference
+\-------------------------------------------------------*/
+signed char
+getNt_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct seqST *refSTPtr,
+   struct seqST *geneSTPtr
+){
+   signed long startSL =
+      hitSTPtr->refStartArySL[indexSL] - 1;
+   signed long endSL =
+      startSL + hitSTPtr->alnLenArySL[indexSL];
+   signed long lenSL = 0;
+
+   if(startSL < 0)
+      startSL = 0;
+
+   if(endSL > refSTPtr->seqLenSL)
+      endSL = refSTPtr->seqLenSL;
+
+   if(startSL >= endSL)
+      return def_rangeErr_hitTbl;
+
+   lenSL = endSL - startSL;
+
+   if(geneSTPtr->seqSizeSL < lenSL)
+   { /*If: need more memory*/
+      if(geneSTPtr->seqStr)
+      { /*If: have an old buffer to free*/
+         free(geneSTPtr->seqStr);
+         resize_memTag(
+            def_seqST_memTag,
+            geneSTPtr->seqSizeSL,
+            0
+         );
+      } /*If: have an old buffer to free*/
+
+      geneSTPtr->seqStr =
+         malloc((lenSL + 9) * sizeof(signed char));
+      geneSTPtr->seqSizeSL = 0;
+
+      if(! geneSTPtr->seqStr)
+         return def_memErr_hitTbl;
+
+      geneSTPtr->seqSizeSL = lenSL;
+      resize_memTag(def_seqST_memTag, 0, lenSL);
+   } /*If: need more memory*/
+
+   cpLen_ulCp(
+      geneSTPtr->seqStr,
+      &refSTPtr->seqStr[startSL],
+      (unsigned int) lenSL
+   );
+
+   geneSTPtr->seqLenSL = lenSL;
+
+   if(geneSTPtr->qStr)
+      geneSTPtr->qStr[0] = '\0';
+   geneSTPtr->qLenSL = 0;
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+      revComp_seqST(geneSTPtr);
+
+   return 0;
+} /*getNt_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun10: nonCoding_hitTbl
+|   - finds if a gene id is for a non-coding region
+| Input:
+|   - idStr:
+|     o c-string with gene id to check
+| Output:
+|   - Returns:
+|     o index of "non-coding" in idStr
+|     o -1 if idStr does not have "non-coding"
+\-------------------------------------------------------*/
+signed long
+nonCoding_hitTbl(
+   signed char *idStr
+){
+   signed char *nonCodeStr = (signed char *) "non-coding";
+   signed long posSL = 0;
+   signed long lenSL = 0;
+
+   for(posSL = 0; idStr[posSL]; ++posSL)
+   { /*Loop: find non-coding in the id*/
+      lenSL = 0;
+
+      while(
+            nonCodeStr[lenSL]
+         && idStr[posSL + lenSL] == nonCodeStr[lenSL]
+      ) ++lenSL;
+
+      if(! nonCodeStr[lenSL])
+         return posSL;
+   } /*Loop: find non-coding in the id*/
+
+   return -1;
+} /*nonCoding_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun11: pHead_hitTbl
+|   - prints the fasta header for a hit
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header to outBufSTPtr (no line break)
+|     o header: ">ref-id-start-end-F/R\tcoding\tid=..."
+|       + non-coding entries (id has non-coding) have
+|         "\tnon-coding" and the "non-coding" is removed
+|         from the id= entry
+\-------------------------------------------------------*/
+void
+pHead_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   struct outBuf *outBufSTPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun11 TOC:
+   '   - prints the fasta header for a hit
+   '   o fun11 sec01:
+   '     - variable declarations
+   '   o fun11 sec02:
+   '     - print reference id, gene id, and coordinates
+   '   o fun11 sec03:
+   '     - print coding status and id= entry
+   '   o fun11 sec04:
+   '     - print rest of header
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *idStr = hitSTPtr->idST->strAry[indexSL];
+   signed long lenSL = 0;
+   signed long matchSL = 0; /*start of non-coding*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec02:
+   ^   - print reference id, gene id, and coordinates
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(refIdStr[lenSL] > 32)
+      ++lenSL;
+
+   addChar_outBuf(outBufSTPtr, '>');
+   addLenStr_outBuf(outBufSTPtr, refIdStr, lenSL);
+   addChar_outBuf(outBufSTPtr, '-');
+   addStr_outBuf(outBufSTPtr, idStr);
+   addChar_outBuf(outBufSTPtr, '-');
+   addSL_outBuf(
+      outBufSTPtr,
+      hitSTPtr->refStartArySL[indexSL]
+   );
+   addChar_outBuf(outBufSTPtr, '-');
+   addSL_outBuf(outBufSTPtr, hitSTPtr->refEndArySL[indexSL]);
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+      addStr_outBuf(outBufSTPtr, (signed char *) "-R");
+   else
+      addStr_outBuf(outBufSTPtr, (signed char *) "-F");
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec03:
+   ^   - print coding status and id= entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   matchSL = nonCoding_hitTbl(idStr);
+
+   if(matchSL < 0)
+   { /*If: coding gene*/
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tcoding\tid="
+      );
+      addStr_outBuf(outBufSTPtr, idStr);
+   } /*If: coding gene*/
+
+   else
+   { /*Else: non-coding region*/
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tnon-coding\tid="
+      );
+      addLenStr_outBuf(outBufSTPtr, idStr, matchSL);
+      addStr_outBuf(
+         outBufSTPtr,
+         &idStr[matchSL + def_lenNonCoding_hitTbl]
+      );
+   } /*Else: non-coding region*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun11 Sec04:
+   ^   - print rest of header
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tstart=");
+   addSL_outBuf(
+      outBufSTPtr,
+      hitSTPtr->refStartArySL[indexSL]
+   );
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tend=");
+   addSL_outBuf(outBufSTPtr, hitSTPtr->refEndArySL[indexSL]);
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tscore=");
+   addSL_outBuf(outBufSTPtr, hitSTPtr->scoreArySL[indexSL]);
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tdirection=reverse"
+      );
+   else
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tdirection=forward"
+      );
+
+   addStr_outBuf(outBufSTPtr, (signed char *) "\tlength=");
+   addSL_outBuf(outBufSTPtr, hitSTPtr->alnLenArySL[indexSL]);
+} /*pHead_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun12: pNt_hitTbl
+|   - prints the nucleotide sequence of a hit as a
+|     fasta entry
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - geneSTPtr:
+|     o seqST struct pointer with the extracted sequence
+|       (from getNt_hitTbl)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header (see pHead_hitTbl) and sequence to
+|       outBufSTPtr
+\-------------------------------------------------------*/
+void
+pNt_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   struct seqST *geneSTPtr,
+   struct outBuf *outBufSTPtr
+){
+   pHead_hitTbl(hitSTPtr, indexSL, refIdStr, outBufSTPtr);
+   addStr_outBuf(outBufSTPtr, str_endLine);
+
+   addLenStr_outBuf(
+      outBufSTPtr,
+      geneSTPtr->seqStr,
+      geneSTPtr->seqLenSL
+   );
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pNt_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun13: pAa_hitTbl
+|   - prints the amino acid sequence of a hit as a
+|     fasta entry (same format as tranSeq -orf-1)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - ntLenSL:
+|     o number of nucleotides translated
+|   - aaStr:
+|     o c-string with the amino acid sequence
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header (see pHead_hitTbl), with
+|       "-ORF1\tstart=0\tend=ntLenSL" appended, and the
+|       amino acid sequence to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pAa_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   signed long ntLenSL,
+   signed char *aaStr,
+   struct outBuf *outBufSTPtr
+){
+   pHead_hitTbl(hitSTPtr, indexSL, refIdStr, outBufSTPtr);
+
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *) "-ORF1\tstart=0\tend="
+   );
+   addSL_outBuf(outBufSTPtr, ntLenSL);
+   addStr_outBuf(outBufSTPtr, str_endLine);
+
+   addStr_outBuf(outBufSTPtr, aaStr);
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pAa_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun14: add_hitTbl
+|   - adds a hit (gene mapping) to a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to add hit to
+|   - idStr:
+|     o c-string with gene id (copied up to first null)
+|   - dirUC:
+|     o def_forward_hitTbl or def_reverse_hitTbl
+|   - scoreSL:
+|     o score of the mapping
+|   - maxScoreSL:
+|     o maximum possible score
+|   - refStartSL:
+|     o first reference base (index 1)
+|   - refEndSL:
+|     o last reference base (index 1)
+|   - qryStartSL:
+|     o first gene base (index 1) or def_NA_hitTbl
+|   - qryEndSL:
+|     o last gene base (index 1) or def_NA_hitTbl
+|   - qryLenSL:
+|     o length of gene
+|   - alnLenSL:
+|     o length of mapping
+| Output:
+|   - Modifies:
+|     o hitSTPtr to have the hit at index lenSL (arrays
+|       are resized if needed) and increments lenSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+add_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed char *idStr,
+   unsigned char dirUC,
+   signed long scoreSL,
+   signed long maxScoreSL,
+   signed long refStartSL,
+   signed long refEndSL,
+   signed long qryStartSL,
+   signed long qryEndSL,
+   signed long qryLenSL,
+   signed long alnLenSL
+){
+   signed long indexSL = hitSTPtr->lenSL;
+
+   if(indexSL >= hitSTPtr->sizeSL)
+   { /*If: need more memory*/
+      if(
+         resize_hitTbl(
+            hitSTPtr,
+            hitSTPtr->sizeSL + (hitSTPtr->sizeSL >> 1) + 16
+         )
+      ) return def_memErr_hitTbl;
+   } /*If: need more memory*/
+
+   if(add_str_ptrAry(idStr, hitSTPtr->idST, indexSL))
+      return def_memErr_hitTbl;
+
+   hitSTPtr->dirAryUC[indexSL] = dirUC;
+   hitSTPtr->scoreArySL[indexSL] = scoreSL;
+   hitSTPtr->maxScoreArySL[indexSL] = maxScoreSL;
+   hitSTPtr->refStartArySL[indexSL] = refStartSL;
+   hitSTPtr->refEndArySL[indexSL] = refEndSL;
+   hitSTPtr->qryStartArySL[indexSL] = qryStartSL;
+   hitSTPtr->qryEndArySL[indexSL] = qryEndSL;
+   hitSTPtr->qryLenArySL[indexSL] = qryLenSL;
+   hitSTPtr->alnLenArySL[indexSL] = alnLenSL;
+
+   ++hitSTPtr->lenSL;
+   return 0;
+} /*add_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun15: swap_hitTbl
+|   - swaps two hits in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to swap
+|   - firstSL:
+|     o index of first hit to swap
+|   - secSL:
+|     o index of second hit to swap
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to have firstSL and secSL
+|       swapped
+\-------------------------------------------------------*/
+void
+swap_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long firstSL,
+   signed long secSL
+){
+   signed long *colArySL[8];
+   signed long tmpSL = 0;
+   unsigned char tmpUC = 0;
+   signed char colSC = 0;
+
+   if(firstSL == secSL)
+      return;
+
+   swap_str_ptrAry(hitSTPtr->idST, firstSL, secSL);
+
+   tmpUC = hitSTPtr->dirAryUC[firstSL];
+   hitSTPtr->dirAryUC[firstSL] = hitSTPtr->dirAryUC[secSL];
+   hitSTPtr->dirAryUC[secSL] = tmpUC;
+
+   colArySL[0] = hitSTPtr->scoreArySL;
+   colArySL[1] = hitSTPtr->maxScoreArySL;
+   colArySL[2] = hitSTPtr->refStartArySL;
+   colArySL[3] = hitSTPtr->refEndArySL;
+   colArySL[4] = hitSTPtr->qryStartArySL;
+   colArySL[5] = hitSTPtr->qryEndArySL;
+   colArySL[6] = hitSTPtr->qryLenArySL;
+   colArySL[7] = hitSTPtr->alnLenArySL;
+
+   for(colSC = 0; colSC < 8; ++colSC)
+   { /*Loop: swap numeric columns*/
+      tmpSL = colArySL[colSC][firstSL];
+      colArySL[colSC][firstSL] = colArySL[colSC][secSL];
+      colArySL[colSC][secSL] = tmpSL;
+   } /*Loop: swap numeric columns*/
+} /*swap_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun16: cmpNum_hitTbl
+|   - compares two numbers as c-strings (as sort does)
+| Input:
+|   - firstSL:
+|     o first number to compare (def_NA_hitTbl is NA)
+|   - secSL:
+|     o second number to compare (def_NA_hitTbl is NA)
+| Output:
+|   - Returns:
+|     o < 0 if firstSL comes before secSL
+|     o 0 if firstSL and secSL are the same
+|     o > 0 if firstSL comes after secSL
+\-------------------------------------------------------*/
+signed int
+cmpNum_hitTbl(
+   signed long firstSL,
+   signed long secSL
+){
+   signed char firstStr[32];
+   signed char secStr[32];
+   signed int posSI = 0;
+
+   if(firstSL == secSL)
+      return 0;
+
+   if(firstSL < 0)
+   { /*If: NA*/
+      firstStr[0] = 'N';
+      firstStr[1] = 'A';
+      firstStr[2] = '\0';
+   } /*If: NA*/
+
+   else
+      numToStr(firstStr, (unsigned long) firstSL);
+
+   if(secSL < 0)
+   { /*If: NA*/
+      secStr[0] = 'N';
+      secStr[1] = 'A';
+      secStr[2] = '\0';
+   } /*If: NA*/
+
+   else
+      numToStr(secStr, (unsigned long) secSL);
+
+   while(
+         firstStr[posSI]
+      && firstStr[posSI] == secStr[posSI]
+   ) ++posSI;
+
+   return
+        (unsigned char) firstStr[posSI]
+      - (unsigned char) secStr[posSI];
+} /*cmpNum_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun17: cmp_hitTbl
+|   - compares two hits for sort_hitTbl
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to compare
+|   - firstSL:
+|     o index of first hit to compare
+|   - secSL:
+|     o index of second hit to compare
+|   - highBl:
+|     o def_refSort_hitTbl to compare by reference start
+|     o def_highSort_hitTbl to compare by high score
+| Output:
+|   - Returns:
+|     o > 0 if firstSL should come after secSL
+|     o <= 0 if firstSL can stay before secSL
+\-------------------------------------------------------*/
+signed int
+cmp_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long firstSL,
+   signed long secSL,
+   signed char highBl
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun17 TOC:
+   '   - compares two hits for sort_hitTbl
+   '   o fun17 sec01:
+   '     - variable declarations
+   '   o fun17 sec02:
+   '     - compare the sort keys
+   '   o fun17 sec03:
+   '     - break ties by line (as sort does)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long *colArySL[8];
+   signed char colSC = 0;
+   signed int cmpSI = 0;
+   signed char *firstStr = hitSTPtr->idST->strAry[firstSL];
+   signed char *secStr = hitSTPtr->idST->strAry[secSL];
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec02:
+   ^   - compare the sort keys
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(highBl == def_refSort_hitTbl)
+   { /*If: reference start, then highest score*/
+      if(
+           hitSTPtr->refStartArySL[firstSL]
+         > hitSTPtr->refStartArySL[secSL]
+      ) return 1;
+
+      if(
+           hitSTPtr->refStartArySL[firstSL]
+         < hitSTPtr->refStartArySL[secSL]
+      ) return -1;
+   } /*If: reference start, then highest score*/
+
+   if(
+        hitSTPtr->scoreArySL[firstSL]
+      < hitSTPtr->scoreArySL[secSL]
+   ) return 1;
+
+   if(
+        hitSTPtr->scoreArySL[firstSL]
+      > hitSTPtr->scoreArySL[secSL]
+   ) return -1;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec03:
+   ^   - break ties by line (as sort does)
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(*firstStr && *firstStr == *secStr)
+   { /*Loop: compare gene ids*/
+      ++firstStr;
+      ++secStr;
+   } /*Loop: compare gene ids*/
+
+   cmpSI = (unsigned char) *firstStr - (unsigned char) *secStr;
+
+   if(! cmpSI)
+      cmpSI =
+           (signed int) hitSTPtr->dirAryUC[firstSL]
+         - (signed int) hitSTPtr->dirAryUC[secSL];
+      /*forward (0) is before reverse (1)*/
+
+   colArySL[0] = hitSTPtr->scoreArySL;
+   colArySL[1] = hitSTPtr->maxScoreArySL;
+   colArySL[2] = hitSTPtr->refStartArySL;
+   colArySL[3] = hitSTPtr->refEndArySL;
+   colArySL[4] = hitSTPtr->qryStartArySL;
+   colArySL[5] = hitSTPtr->qryEndArySL;
+   colArySL[6] = hitSTPtr->qryLenArySL;
+   colArySL[7] = hitSTPtr->alnLenArySL;
+
+   for(colSC = 0; ! cmpSI && colSC < 8; ++colSC)
+      cmpSI =
+         cmpNum_hitTbl(
+            colArySL[colSC][firstSL],
+            colArySL[colSC][secSL]
+         );
+
+   if(highBl == def_highSort_hitTbl)
+      cmpSI = -cmpSI; /*sort -r also reverses ties*/
+
+   return cmpSI;
+} /*cmp_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun18: sort_hitTbl
+|   - sorts the hits in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to sort
+|   - startSL:
+|     o first hit to sort (hits before are not touched)
+|   - highBl:
+|     o def_refSort_hitTbl; sort by reference start,
+|       then highest score (same as
+|       `sort -n -k 5,5 -k 3,3r` on a score table)
+|     o def_highSort_hitTbl; sort by highest score
+|       (same as `sort -r -n -k 3` on a score table)
+|     o ties are sorted as sort would (whole line in
+|       C locale byte order)
+| Output:
+|   - Modifies:
+|     o arrays in hitSTPtr to be sorted from startSL to
+|       lenSL - 1
+\-------------------------------------------------------*/
+void
+sort_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL,
+   signed char highBl
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun18 TOC:
+   '   - sorts the hits in a hitTbl struct
+   '   o fun18 sec01:
+   '     - variable declarations
+   '   o fun18 sec02:
+   '     - find the number of rounds to sort for
+   '   o fun18 sec03:
+   '     - sort the hits (shell sort)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun18 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long numElmSL = hitSTPtr->lenSL - startSL;
+   signed long subSL = 0;
+   signed long siIndex = 0;
+   signed long siElm = 0;
+   signed long siSwap = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun18 Sec02:
+   ^   - find the number of rounds to sort for
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(numElmSL < 2)
+      return;
+
+   /*Recursion formula: h[0] = 1, h[n] = 3 * h[n - 1] +1*/
+   subSL = 1;
+
+   while(subSL < numElmSL / 3)
+      subSL = (3 * subSL) + 1;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun18 Sec03:
+   ^   - sort the hits (shell sort)
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(subSL > 0)
+   { /*Loop: all rounds*/
+      for(
+         siIndex = startSL + subSL;
+         siIndex < hitSTPtr->lenSL;
+         ++siIndex
+      ){ /*Loop: insertion sort each sub array*/
+         siElm = siIndex;
+
+         while(siElm - subSL >= startSL)
+         { /*Loop: move hit back*/
+            siSwap = siElm - subSL;
+
+            if(cmp_hitTbl(hitSTPtr, siSwap, siElm, highBl) <= 0)
+               break;
+
+            swap_hitTbl(hitSTPtr, siSwap, siElm);
+            siElm = siSwap;
+         } /*Loop: move hit back*/
+      } /*Loop: insertion sort each sub array*/
+
+      subSL = (subSL - 1) / 3; /*Move to next round*/
+   } /*Loop: all rounds*/
+} /*sort_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun19: overlap_hitTbl
+|   - removes hits with a reference start inside a
+|     higher (or same) scoring hit
+|   - this is the memwaterScan filter mapGene.sh used;
+|     demux uses it on each gene's hits
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to filter; hits
+|       from startSL on must be sorted by sort_hitTbl
+|       with def_refSort_hitTbl
+|   - startSL:
+|     o first hit to filter (hits before are not touched)
+| Output:
+|   - Modifies:
+|     o arrays in hitSTPtr to only have kept hits
+|     o lenSL in hitSTPtr to be the number of kept hits
+|   - Returns:
+|     o number of kept hits (from startSL on)
+\-------------------------------------------------------*/
+signed long
+overlap_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL
+){
+   signed long keepSL = startSL; /*hit being checked*/
+   signed long outSL = startSL;  /*next kept position*/
+   signed long siHit = 0;
+
+   if(startSL >= hitSTPtr->lenSL)
+      return 0;
+
+   for(siHit = startSL + 1; siHit < hitSTPtr->lenSL; ++siHit)
+   { /*Loop: remove overlapping hits*/
+      if(
+            hitSTPtr->refStartArySL[siHit]
+               >= hitSTPtr->refStartArySL[keepSL]
+         &&
+            hitSTPtr->refStartArySL[siHit]
+               <= hitSTPtr->refEndArySL[keepSL]
+      ){ /*If: hit starts in the kept hit*/
+         if(
+              hitSTPtr->scoreArySL[siHit]
+           <= hitSTPtr->scoreArySL[keepSL]
+         ) continue; /*kept hit is better*/
+      } /*If: hit starts in the kept hit*/
+
+      else if(hitSTPtr->scoreArySL[keepSL] > 0)
+         swap_hitTbl(hitSTPtr, outSL++, keepSL);
+         /*no overlap, so keep the last hit*/
+
+      keepSL = siHit;
+   } /*Loop: remove overlapping hits*/
+
+   if(hitSTPtr->scoreArySL[keepSL] > 0)
+      swap_hitTbl(hitSTPtr, outSL++, keepSL);
+
+   hitSTPtr->lenSL = outSL;
+   return outSL - startSL;
+} /*overlap_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun20: pRow_hitTbl
+|   - prints a hit as a score table (scores.tsv) row
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o gene_id, gene_direction, score, max_score,
+|       ref_start, ref_end, qry_start, qry_end, qry_len,
+|       and aln_len (tab separated) and a line break to
+|       outBufSTPtr; def_NA_hitTbl is printed as NA
+\-------------------------------------------------------*/
+void
+pRow_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct outBuf *outBufSTPtr
+){
+   signed long *colArySL[8];
+   signed char colSC = 0;
+
+   addStr_outBuf(
+      outBufSTPtr,
+      hitSTPtr->idST->strAry[indexSL]
+   );
+
+   if(hitSTPtr->dirAryUC[indexSL] == def_reverse_hitTbl)
+      addStr_outBuf(outBufSTPtr, (signed char *) "\treverse");
+   else
+      addStr_outBuf(outBufSTPtr, (signed char *) "\tforward");
+
+   colArySL[0] = hitSTPtr->scoreArySL;
+   colArySL[1] = hitSTPtr->maxScoreArySL;
+   colArySL[2] = hitSTPtr->refStartArySL;
+   colArySL[3] = hitSTPtr->refEndArySL;
+   colArySL[4] = hitSTPtr->qryStartArySL;
+   colArySL[5] = hitSTPtr->qryEndArySL;
+   colArySL[6] = hitSTPtr->qryLenArySL;
+   colArySL[7] = hitSTPtr->alnLenArySL;
+
+   for(colSC = 0; colSC < 8; ++colSC)
+   { /*Loop: print numeric columns*/
+      addChar_outBuf(outBufSTPtr, '\t');
+
+      if(colArySL[colSC][indexSL] == def_NA_hitTbl)
+         addStr_outBuf(outBufSTPtr, (signed char *) "NA");
+      else
+         addSL_outBuf(
+            outBufSTPtr,
+            colArySL[colSC][indexSL]
+         );
+   } /*Loop: print numeric columns*/
+
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pRow_hitTbl*/
+
+/*-------------------------------------------------------\
+| Fun21: pHigh_hitTbl
+|   - prints the highest scoring hit(s) as score table
+|     (highScores.tsv) rows
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to print
+|   - startSL:
+|     o first hit to check (hits before are ignored)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Modifies:
+|     o hits from startSL on to be sorted by score
+|       (sort_hitTbl with def_highSort_hitTbl)
+|   - Prints:
+|     o every hit with the highest score to outBufSTPtr
+|   - Returns:
+|     o number of printed hits
+\-------------------------------------------------------*/
+signed long
+pHigh_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL,
+   struct outBuf *outBufSTPtr
+){
+   signed long siHit = startSL;
+
+   if(startSL >= hitSTPtr->lenSL)
+      return 0;
+
+   sort_hitTbl(hitSTPtr, startSL, def_highSort_hitTbl);
+
+   while(
+         siHit < hitSTPtr->lenSL
+      &&
+           hitSTPtr->scoreArySL[siHit]
+        == hitSTPtr->scoreArySL[startSL]
+   ) pRow_hitTbl(hitSTPtr, siHit++, outBufSTPtr);
+
+   return siHit - startSL;
+} /*pHigh_hitTbl*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
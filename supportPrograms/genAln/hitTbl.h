@@ -0,0 +1,616 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' hitTbl SOF: Start Of File
+'   - holds the gene mappings (hits) from a scores.tsv or
+'     highScores.tsv file made by annotateASFV and has
+'     functions to extract the mapped gene sequences
+'   - also filters and prints the hits from the mappers
+'     (demux and memwaterScan -score-tbl)
+'   o header:
+'     - guards and defined variables
+'   o .h st01: hitTbl
+'     - holds the hits (gene mappings) from a score table
+'   o fun01: blank_hitTbl
+'     - sets the number of hits in a hitTbl struct to 0
+'   o fun02: init_hitTbl
+'     - initializes a hitTbl struct
+'   o fun03: freeStack_hitTbl
+'     - frees the arrays in a hitTbl struct
+'   o fun04: freeHeap_hitTbl
+'     - frees a hitTbl struct
+'   o fun05: resize_hitTbl
+'     - resizes the arrays in a hitTbl struct
+'   o .c fun06: getNum_hitTbl
+'     - gets a number or NA from a score table column
+'   o .c fun07: addLine_hitTbl
+'     - adds a line from a score table to a hitTbl struct
+'   o fun08: get_hitTbl
+'     - reads in all hits from a score table (tsv)
+'   o fun09: getNt_hitTbl
+'     - extracts the nucleotide sequence of a hit from
+'       the reference (reverse complements reverse hits)
+'   o fun10: nonCoding_hitTbl
+'     - finds if a gene id is for a non-coding region
+'   o fun11: pHead_hitTbl
+'     - prints the fasta header for a hit
+'   o fun12: pNt_hitTbl
+'     - prints the nucleotide sequence of a hit as a
+'       fasta entry
+'   o fun13: pAa_hitTbl
+'     - prints the amino acid sequence of a hit as a
+'       fasta entry (same format as tranSeq -orf-1)
+'   o fun14: add_hitTbl
+'     - adds a hit (gene mapping) to a hitTbl struct
+'   o fun15: swap_hitTbl
+'     - swaps two hits in a hitTbl struct
+'   o .c fun16: cmpNum_hitTbl
+'     - compares two numbers as c-strings (as sort does)
+'   o .c fun17: cmp_hitTbl
+'     - compares two hits for sort_hitTbl
+'   o fun18: sort_hitTbl
+'     - sorts the hits in a hitTbl struct
+'   o fun19: overlap_hitTbl
+'     - removes hits with a reference start inside a
+'       higher (or same) scoring hit
+'   o fun20: pRow_hitTbl
+'     - prints a hit as a score table (scores.tsv) row
+'   o fun21: pHigh_hitTbl
+'     - prints the highest scoring hit(s) as score table
+'       (highScores.tsv) rows
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards and defined variables
+\-------------------------------------------------------*/
+
+#ifndef GENE_HIT_TABLE_H
+#define GENE_HIT_TABLE_H
+
+struct str_ptrAry;
+struct seqST;
+struct outBuf;
+
+#define def_memErr_hitTbl 1
+#define def_fileErr_hitTbl 2
+#define def_invalidEntry_hitTbl 4
+#define def_rangeErr_hitTbl 8 /*hit is outside reference*/
+
+#define def_forward_hitTbl 0
+#define def_reverse_hitTbl 1
+
+#define def_NA_hitTbl -1 /*column was NA in the table*/
+#define def_lenNonCoding_hitTbl 10 /*length of non-coding*/
+
+#define def_refSort_hitTbl 0  /*sort_hitTbl by ref start*/
+#define def_highSort_hitTbl 1 /*sort_hitTbl by high score*/
+
+/*-------------------------------------------------------\
+| ST01: hitTbl
+|   - holds the hits (gene mappings) from a score table
+|   - columns: gene_id, gene_direction, score, max_score,
+|     ref_start, ref_end, qry_start, qry_end, qry_len,
+|     and aln_len
+\-------------------------------------------------------*/
+typedef struct hitTbl
+{
+   struct str_ptrAry *idST;     /*gene ids*/
+   unsigned char *dirAryUC;     /*def_forward/reverse*/
+
+   signed long *scoreArySL;     /*score of mapping*/
+   signed long *maxScoreArySL;  /*maximum possible score*/
+
+   signed long *refStartArySL;  /*first reference base*/
+   signed long *refEndArySL;    /*last reference base*/
+   signed long *qryStartArySL;  /*first gene base or NA*/
+   signed long *qryEndArySL;    /*last gene base or NA*/
+   signed long *qryLenArySL;    /*length of gene*/
+   signed long *alnLenArySL;    /*length of mapping*/
+
+   signed long lenSL;           /*number of hits*/
+   signed long sizeSL;          /*size of the arrays*/
+}hitTbl;
+
+/*-------------------------------------------------------\
+| Fun01: blank_hitTbl
+|   - sets the number of hits in a hitTbl struct to 0
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL in hitSTPtr to be 0 (memory is kept)
+\-------------------------------------------------------*/
+void
+blank_hitTbl(
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun02: init_hitTbl
+|   - initializes a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to be 0 (null) and calls
+|       blank_hitTbl
+\-------------------------------------------------------*/
+void
+init_hitTbl(
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_hitTbl
+|   - frees the arrays in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with arrays to free
+| Output:
+|   - Frees:
+|     o all arrays in hitSTPtr and then initializes
+\-------------------------------------------------------*/
+void
+freeStack_hitTbl(
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_hitTbl
+|   - frees a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to free
+| Output:
+|   - Frees:
+|     o hitSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_hitTbl(
+   struct hitTbl *hitSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun05: resize_hitTbl
+|   - resizes the arrays in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to resize
+|   - sizeSL:
+|     o new size of the arrays
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to hold sizeSL hits
+|     o sizeSL in hitSTPtr to be sizeSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+resize_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long sizeSL
+);
+
+/*-------------------------------------------------------\
+| Fun08: get_hitTbl
+|   - reads in all hits from a score table (tsv)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to add hits to
+|   - inFILE:
+|     o FILE pointer to the score table (header lines
+|       starting with gene_id are skipped)
+|   - lineSLPtr:
+|     o signed long pointer to get the line number an
+|       error happened on
+| Output:
+|   - Modifies:
+|     o hitSTPtr to have the hits in inFILE (appended to
+|       the end of any previous hits)
+|     o lineSLPtr to have line number of error or the
+|       number of lines read in
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+|     o def_invalidEntry_hitTbl if a line is not a hit
+\-------------------------------------------------------*/
+signed char
+get_hitTbl(
+   struct hitTbl *hitSTPtr,
+   void *inFILE,
+   signed long *lineSLPtr
+);
+
+/*-------------------------------------------------------\
+| Fun09: getNt_hitTbl
+|   - extracts the nucleotide sequence of a hit from
+|     the reference (reverse complements reverse hits)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to extract
+|   - indexSL:
+|     o index of hit to extract
+|   - refSTPtr:
+|     o seqST struct pointer with reference sequence
+|   - geneSTPtr:
+|     o seqST struct pointer to get the gene sequence
+| Output:
+|   - Modifies:
+|     o seqStr in geneSTPtr to have the aln_len bases
+|       starting at ref_start (resized if needed)
+|     o seqLenSL in geneSTPtr to have sequence length
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+|     o def_rangeErr_hitTbl if the hit starts after the
+|       end of the reference
+\-------------------------------------------------------*/
+signed char
+getNt_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct seqST *refSTPtr,
+   struct seqST *geneSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun10: nonCoding_hitTbl
+|   - finds if a gene id is for a non-coding region
+| Input:
+|   - idStr:
+|     o c-string with gene id to check
+| Output:
+|   - Returns:
+|     o index of "non-coding" in idStr
+|     o -1 if idStr does not have "non-coding"
+\-------------------------------------------------------*/
+signed long
+nonCoding_hitTbl(
+   signed char *idStr
+);
+
+/*-------------------------------------------------------\
+| Fun11: pHead_hitTbl
+|   - prints the fasta header for a hit
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header to outBufSTPtr (no line break)
+|     o header: ">ref-id-start-end-F/R\tcoding\tid=..."
+|       + non-coding entries (id has non-coding) have
+|         "\tnon-coding" and the "non-coding" is removed
+|         from the id= entry
+\-------------------------------------------------------*/
+void
+pHead_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun12: pNt_hitTbl
+|   - prints the nucleotide sequence of a hit as a
+|     fasta entry
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - geneSTPtr:
+|     o seqST struct pointer with the extracted sequence
+|       (from getNt_hitTbl)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header (see pHead_hitTbl) and sequence to
+|       outBufSTPtr
+\-------------------------------------------------------*/
+void
+pNt_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   struct seqST *geneSTPtr,
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun13: pAa_hitTbl
+|   - prints the amino acid sequence of a hit as a
+|     fasta entry (same format as tranSeq -orf-1)
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - refIdStr:
+|     o c-string with reference id (only up to first
+|       white space is printed)
+|   - ntLenSL:
+|     o number of nucleotides translated
+|   - aaStr:
+|     o c-string with the amino acid sequence
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o header (see pHead_hitTbl), with
+|       "-ORF1\tstart=0\tend=ntLenSL" appended, and the
+|       amino acid sequence to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pAa_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   signed char *refIdStr,
+   signed long ntLenSL,
+   signed char *aaStr,
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun14: add_hitTbl
+|   - adds a hit (gene mapping) to a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer to add hit to
+|   - idStr:
+|     o c-string with gene id (copied up to first null)
+|   - dirUC:
+|     o def_forward_hitTbl or def_reverse_hitTbl
+|   - scoreSL:
+|     o score of the mapping
+|   - maxScoreSL:
+|     o maximum possible score
+|   - refStartSL:
+|     o first reference base (index 1)
+|   - refEndSL:
+|     o last reference base (index 1)
+|   - qryStartSL:
+|     o first gene base (index 1) or def_NA_hitTbl
+|   - qryEndSL:
+|     o last gene base (index 1) or def_NA_hitTbl
+|   - qryLenSL:
+|     o length of gene
+|   - alnLenSL:
+|     o length of mapping
+| Output:
+|   - Modifies:
+|     o hitSTPtr to have the hit at index lenSL (arrays
+|       are resized if needed) and increments lenSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_hitTbl for memory errors
+\-------------------------------------------------------*/
+signed char
+add_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed char *idStr,
+   unsigned char dirUC,
+   signed long scoreSL,
+   signed long maxScoreSL,
+   signed long refStartSL,
+   signed long refEndSL,
+   signed long qryStartSL,
+   signed long qryEndSL,
+   signed long qryLenSL,
+   signed long alnLenSL
+);
+
+/*-------------------------------------------------------\
+| Fun15: swap_hitTbl
+|   - swaps two hits in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to swap
+|   - firstSL:
+|     o index of first hit to swap
+|   - secSL:
+|     o index of second hit to swap
+| Output:
+|   - Modifies:
+|     o all arrays in hitSTPtr to have firstSL and secSL
+|       swapped
+\-------------------------------------------------------*/
+void
+swap_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long firstSL,
+   signed long secSL
+);
+
+/*-------------------------------------------------------\
+| Fun18: sort_hitTbl
+|   - sorts the hits in a hitTbl struct
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to sort
+|   - startSL:
+|     o first hit to sort (hits before are not touched)
+|   - highBl:
+|     o def_refSort_hitTbl; sort by reference start,
+|       then highest score (same as
+|       `sort -n -k 5,5 -k 3,3r` on a score table)
+|     o def_highSort_hitTbl; sort by highest score
+|       (same as `sort -r -n -k 3` on a score table)
+|     o ties are sorted as sort would (whole line in
+|       C locale byte order)
+| Output:
+|   - Modifies:
+|     o arrays in hitSTPtr to be sorted from startSL to
+|       lenSL - 1
+\-------------------------------------------------------*/
+void
+sort_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL,
+   signed char highBl
+);
+
+/*-------------------------------------------------------\
+| Fun19: overlap_hitTbl
+|   - removes hits with a reference start inside a
+|     higher (or same) scoring hit
+|   - this is the memwaterScan filter mapGene.sh used;
+|     demux uses it on each gene's hits
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to filter; hits
+|       from startSL on must be sorted by sort_hitTbl
+|       with def_refSort_hitTbl
+|   - startSL:
+|     o first hit to filter (hits before are not touched)
+| Output:
+|   - Modifies:
+|     o arrays in hitSTPtr to only have kept hits
+|     o lenSL in hitSTPtr to be the number of kept hits
+|   - Returns:
+|     o number of kept hits (from startSL on)
+\-------------------------------------------------------*/
+signed long
+overlap_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL
+);
+
+/*-------------------------------------------------------\
+| Fun20: pRow_hitTbl
+|   - prints a hit as a score table (scores.tsv) row
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hit to print
+|   - indexSL:
+|     o index of hit to print
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Prints:
+|     o gene_id, gene_direction, score, max_score,
+|       ref_start, ref_end, qry_start, qry_end, qry_len,
+|       and aln_len (tab separated) and a line break to
+|       outBufSTPtr; def_NA_hitTbl is printed as NA
+\-------------------------------------------------------*/
+void
+pRow_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long indexSL,
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun21: pHigh_hitTbl
+|   - prints the highest scoring hit(s) as score table
+|     (highScores.tsv) rows
+| Input:
+|   - hitSTPtr:
+|     o hitTbl struct pointer with hits to print
+|   - startSL:
+|     o first hit to check (hits before are ignored)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print to
+| Output:
+|   - Modifies:
+|     o hits from startSL on to be sorted by score
+|       (sort_hitTbl with def_highSort_hitTbl)
+|   - Prints:
+|     o every hit with the highest score to outBufSTPtr
+|   - Returns:
+|     o number of printed hits
+\-------------------------------------------------------*/
+signed long
+pHigh_hitTbl(
+   struct hitTbl *hitSTPtr,
+   signed long startSL,
+   struct outBuf *outBufSTPtr
+);
+
+#endif
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -7,6 +7,8 @@
 '     - holds the kmer tables for detecting spoligytpes
 '   o .h st02: refST_kmerFind
 '     - holds the kmer pattern for the reference
+'   o .h st03: stats_kmerFind
+'     - counters for where kmerFind spends its time
 '   o fun01: blank_tblST_kmerFind
 '     - blanks all stored values in an tblST_kmerFind
 '   o fun02: qckBlank_tblST_kmerFind
@@ -92,10 +94,20 @@
 '       using an faster kmer search followed by an slower
 '       waterman to finalize alignments
 '     - this version finds all possible primers
-'   o fun29: phit_kmerFind
+'   o .c fun29: pHitStats_kmerFind
+'     - adds the score, maximum score, number of maps, and
+'       primer coordinates for one primer to a
+'       phit_kmerFind (fun30) row
+'   o fun30: phit_kmerFind
 '     - prints out the primer hits for a sequence
-'   o fun30: pHeaderHit_kmerFind
-'      - prints header for phit_kmerFind (fun29)
+'   o fun31: pHeaderHit_kmerFind
+'      - prints header for phit_kmerFind (fun30)
+'   o fun32: blank_stats_kmerFind
+'     - sets all counters in a stats_kmerFind struct to 0
+'   o fun33: pStats_kmerFind
+'     - prints the counters in a stats_kmerFind struct
+'   o fun34: pHeaderStats_kmerFind
+'     - prints header for pStats_kmerFind (fun33)
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -117,8 +129,11 @@
 #include <stdio.h>
 
 #include "../genLib/ulCp.h"
+#include "../genLib/memTag.h"
 #include "../genLib/shellSort.h"
 #include "../genLib/fileFun.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/trace.h"
 
 #include "../genBio/seqST.h"
 
@@ -135,6 +150,7 @@
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden libraries:
 !   - .c  #include "../genLib/base10Str.h"
+!   - .c  #include "../genLib/numToStr.h"
 !   - .c  #include "../genAln/indexToCoord.h"
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
@@ -278,6 +294,8 @@ init_tblST_kmerFind(
       return;
 
    tblSTPtr->seqSTPtr = 0; /*just in case have memory error*/
+   tblSTPtr->statsSTPtr = 0;
+   tblSTPtr->traceSTPtr = 0;
    tblSTPtr->lenTblUI = 0;
    tblSTPtr->tblSI = 0;
 
@@ -347,14 +365,15 @@ setup_tblST_kmerFind(
    ) tblSTPtr->lenTblUI <<= 2; /*multiply by 4*/
 
    if(tblSTPtr->tblSI)
-      free(tblSTPtr->tblSI);
+      free_memTag(tblSTPtr->tblSI);
 
    tblSTPtr->tblSI = 0;
 
    tblSTPtr->tblSI =
-      calloc(
+      calloc_memTag(
          (tblSTPtr->lenTblUI + 1),
-         sizeof(signed int)
+         sizeof(signed int),
+         def_tblKmerFind_memTag
       );
 
    if(! tblSTPtr->tblSI)
@@ -423,13 +442,13 @@ freeStack_tblST_kmerFind(
       return;
 
    if(tblSTPtr->kmerArySI)
-      free(tblSTPtr->kmerArySI);
+      free_memTag(tblSTPtr->kmerArySI);
 
    if(tblSTPtr->seqSTPtr)
       freeHeap_seqST(tblSTPtr->seqSTPtr);
 
    if(tblSTPtr->tblSI)
-      free(tblSTPtr->tblSI);
+      free_memTag(tblSTPtr->tblSI);
 
    init_tblST_kmerFind(tblSTPtr);
 } /*freeStack_tblST_kmerFind*/
@@ -632,16 +651,16 @@ freeStack_refST_kmerFind(
       return;
 
    if(refSTPtr->forKmerArySI)
-      free(refSTPtr->forKmerArySI);
+      free_memTag(refSTPtr->forKmerArySI);
 
    if(refSTPtr->forRepAryUI)
-      free(refSTPtr->forRepAryUI);
+      free_memTag(refSTPtr->forRepAryUI);
 
    if(refSTPtr->revKmerArySI)
-      free(refSTPtr->revKmerArySI);
+      free_memTag(refSTPtr->revKmerArySI);
 
    if(refSTPtr->revRepAryUI)
-      free(refSTPtr->revRepAryUI);
+      free_memTag(refSTPtr->revRepAryUI);
 
    if(refSTPtr->forSeqST)
       freeHeap_seqST(refSTPtr->forSeqST);
@@ -950,13 +969,14 @@ addSeqToRefST_kmerFind(
    { /*Else: need more memory*/
 
       if(refSTPtr->forKmerArySI)
-         free(refSTPtr->forKmerArySI);
+         free_memTag(refSTPtr->forKmerArySI);
       refSTPtr->forKmerArySI = 0;
 
       refSTPtr->forKmerArySI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
 
       if(! refSTPtr->forKmerArySI)
@@ -964,13 +984,14 @@ addSeqToRefST_kmerFind(
 
 
       if(refSTPtr->revKmerArySI)
-         free(refSTPtr->revKmerArySI);
+         free_memTag(refSTPtr->revKmerArySI);
       refSTPtr->revKmerArySI = 0;
 
       refSTPtr->revKmerArySI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
 
       if(! refSTPtr->revKmerArySI)
@@ -992,13 +1013,14 @@ addSeqToRefST_kmerFind(
    else
    { /*Else: reverse kmer table need more memory*/
       if(refSTPtr->forRepAryUI)
-         free(refSTPtr->forRepAryUI);
+         free_memTag(refSTPtr->forRepAryUI);
       refSTPtr->forRepAryUI = 0;
 
       refSTPtr->forRepAryUI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
 
       if(! refSTPtr->forRepAryUI)
@@ -1006,13 +1028,14 @@ addSeqToRefST_kmerFind(
 
 
       if(refSTPtr->revRepAryUI)
-         free(refSTPtr->revRepAryUI);
+         free_memTag(refSTPtr->revRepAryUI);
       refSTPtr->revRepAryUI = 0;
 
       refSTPtr->revRepAryUI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
 
       if(! refSTPtr->revRepAryUI)
@@ -1441,24 +1464,26 @@ addNoIndexSeqToRefST_kmerFind(
    { /*Else: need more memory*/
 
       if(refSTPtr->forKmerArySI)
-         free(refSTPtr->forKmerArySI);
+         free_memTag(refSTPtr->forKmerArySI);
       refSTPtr->forKmerArySI = 0;
 
       refSTPtr->forKmerArySI =
-         malloc(
-            (refSTPtr->lenRepSI + 9) * sizeof(signed int)
+         malloc_memTag(
+            (refSTPtr->lenRepSI + 9) * sizeof(signed int),
+            def_refKmerFind_memTag
          );
       if(! refSTPtr->forKmerArySI)
          goto memErr_fun14_sec06;
 
 
       if(refSTPtr->revKmerArySI)
-         free(refSTPtr->revKmerArySI);
+         free_memTag(refSTPtr->revKmerArySI);
       refSTPtr->revKmerArySI = 0;
 
       refSTPtr->revKmerArySI =
-         malloc(
-            (refSTPtr->lenRepSI + 9) * sizeof(signed int)
+         malloc_memTag(
+            (refSTPtr->lenRepSI + 9) * sizeof(signed int),
+            def_refKmerFind_memTag
          );
       if(! refSTPtr->revKmerArySI)
          goto memErr_fun14_sec06;
@@ -1479,26 +1504,28 @@ addNoIndexSeqToRefST_kmerFind(
    else
    { /*Else: reverse kmer table need more memory*/
       if(refSTPtr->forRepAryUI)
-         free(refSTPtr->forRepAryUI);
+         free_memTag(refSTPtr->forRepAryUI);
       refSTPtr->forRepAryUI = 0;
 
       refSTPtr->forRepAryUI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
       if(! refSTPtr->forRepAryUI)
          goto memErr_fun14_sec06;
 
 
       if(refSTPtr->revRepAryUI)
-         free(refSTPtr->revRepAryUI);
+         free_memTag(refSTPtr->revRepAryUI);
       refSTPtr->revRepAryUI = 0;
 
       refSTPtr->revRepAryUI =
-         malloc(
+         malloc_memTag(
               (refSTPtr->lenRepSI + 9)
-            * sizeof(unsigned int)
+            * sizeof(unsigned int),
+            def_refKmerFind_memTag
          );
       if(! refSTPtr->revRepAryUI)
          goto memErr_fun14_sec06;
@@ -1722,12 +1749,15 @@ prep_tblST_kmerFind(
    if(tblSTPtr->kmerSizeUI < lenKmerAryUI)
    { /*If: the array is to small*/
       if(tblSTPtr->kmerArySI)
-         free(tblSTPtr->kmerArySI); /*have an old table*/
+         free_memTag(tblSTPtr->kmerArySI); /*have an old table*/
 
       tblSTPtr->kmerArySI = 0;
 
       tblSTPtr->kmerArySI =
-         malloc((lenKmerAryUI + 1) * sizeof(signed int));
+         malloc_memTag(
+            (lenKmerAryUI + 1) * sizeof(signed int),
+            def_tblKmerFind_memTag
+         );
 
       if(! tblSTPtr->kmerArySI)
          goto memErr_fun18; /*memory error*/
@@ -1748,12 +1778,13 @@ prep_tblST_kmerFind(
    if(tblSTPtr->lenTblUI < (unsigned int) siSeq)
    { /*If: need more memory*/
       if(tblSTPtr->tblSI)
-         free(tblSTPtr->tblSI);
+         free_memTag(tblSTPtr->tblSI);
       tblSTPtr->tblSI = 0;
       tblSTPtr->tblSI =
-          calloc(
+          calloc_memTag(
              (siSeq + 1),
-             sizeof(signed int)
+             sizeof(signed int),
+             def_tblKmerFind_memTag
           );
       if(! tblSTPtr->tblSI)
          goto memErr_fun18; /*memory error*/
@@ -1824,11 +1855,14 @@ setChange_tblST_kmerFind(
    if(tblSTPtr->kmerSizeUI < lenKmerAryUI)
    { /*If: the array is to small*/
       if(tblSTPtr->kmerArySI)
-         free(tblSTPtr->kmerArySI); /*have an old table*/
+         free_memTag(tblSTPtr->kmerArySI); /*have an old table*/
       tblSTPtr->kmerArySI = 0;
 
       tblSTPtr->kmerArySI =
-         malloc((lenKmerAryUI + 1) * sizeof(signed int));
+         malloc_memTag(
+            (lenKmerAryUI + 1) * sizeof(signed int),
+            def_tblKmerFind_memTag
+         );
 
       if(! tblSTPtr->kmerArySI)
          goto memErr_fun18; /*memory error*/
@@ -1863,10 +1897,13 @@ setChange_tblST_kmerFind(
    if(tblSTPtr->lenTblUI < (unsigned int) siSeq)
    { /*If: need more memory*/
       if(tblSTPtr->tblSI)
-         free(tblSTPtr->tblSI);
+         free_memTag(tblSTPtr->tblSI);
       tblSTPtr->tblSI = 0;
       tblSTPtr->tblSI =
-          calloc((siSeq + 1), sizeof(signed int));
+          calloc_memTag(
+             (siSeq + 1), sizeof(signed int),
+             def_tblKmerFind_memTag
+          );
       if(! tblSTPtr->tblSI)
          goto memErr_fun18; /*memory error*/
       tblSTPtr->lenTblUI = (unsigned int) siSeq;
@@ -3425,6 +3462,12 @@ findRefInChunk_kmerFind(
          refSTPtr
       );
 
+   if(tblSTPtr->statsSTPtr)
+   { /*If: counting windows*/
+      ++tblSTPtr->statsSTPtr->winUL;
+      tblSTPtr->statsSTPtr->passUL += (matchBl & 1);
+   } /*If: counting windows*/
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun24 Sec03:
    ^   - prepare for alignemnt (if passed kmer check)
@@ -3445,6 +3488,20 @@ findRefInChunk_kmerFind(
       /*convert index 1 to index 0*/
       --tblSTPtr->seqSTPtr->endAlnSL;
 
+      if(tblSTPtr->statsSTPtr)
+      { /*If: counting alignments*/
+         ++tblSTPtr->statsSTPtr->alnUL;
+
+         tblSTPtr->statsSTPtr->cellUL +=
+              (unsigned long)
+              (   tblSTPtr->seqSTPtr->endAlnSL
+                - tblSTPtr->seqSTPtr->offsetSL
+                + 1
+              )
+            * (unsigned long) refSTPtr->forSeqST->seqLenSL;
+            /*forward and reverse are same length*/
+      } /*If: counting alignments*/
+
       /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
       ^ Fun24 Sec04:
       ^   - do alignment and check if passes min score
@@ -3459,6 +3516,12 @@ findRefInChunk_kmerFind(
       *   - do the alignment
       \**************************************************/
 
+      begin_trace(
+         tblSTPtr->traceSTPtr,
+         (signed char *) "memwater",
+         (signed char *) "memwater"
+      );
+
       if(matchBl & 2)
       { /*If: this was an reverse alignment*/
          *(scoreSL) =
@@ -3493,6 +3556,12 @@ findRefInChunk_kmerFind(
          percScoreF /= refSTPtr->maxForScoreF;
       } /*Else: this is an foward alignment*/
 
+      end_trace(
+         tblSTPtr->traceSTPtr,
+         (signed char *) "memwater",
+         (signed char *) "memwater"
+      );
+
       /**************************************************\
       * Fun24 Sec04 Sub02:
       *   - check if it passes the alignment
@@ -3500,6 +3569,9 @@ findRefInChunk_kmerFind(
 
       matchBl &= ( -(percScoreF >= minPercScoreF) );
       ++tblSTPtr->seqSTPtr->endAlnSL;
+
+      if(tblSTPtr->statsSTPtr)
+         tblSTPtr->statsSTPtr->lowScoreUL += (! matchBl);
    } /*If: I had enough kmers to do an alignment*/
 
    else
@@ -4530,7 +4602,61 @@ fxAllFindPrims_kmerFind(
 } /*fxAllFindPrims_kmerFind*/
 
 /*-------------------------------------------------------\
-| Fun29: phit_kmerFind
+| Fun29: pHitStats_kmerFind
+|   - adds the score, maximum score, number of maps, and
+|     primer coordinates for one primer to a phit_kmerFind
+|     (fun30) row
+| Input:
+|   - scoreF:
+|     o best score for the primer
+|   - maxScoreF:
+|     o maximum possible score for the primer
+|   - numMapsUI:
+|     o number of times the primer mapped
+|   - startUL:
+|     o start of the alignment on the primer (index 0)
+|   - endUL:
+|     o end of the alignment on the primer (index 0)
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print the stats to
+| Output:
+|   - Prints:
+|     o "\tscore\tmax_score\tnum_maps\tstart\tend" to
+|       outBufSTPtr
+\-------------------------------------------------------*/
+void
+pHitStats_kmerFind(
+   float scoreF,
+   float maxScoreF,
+   unsigned int numMapsUI,
+   unsigned long startUL,
+   unsigned long endUL,
+   struct outBuf *outBufSTPtr
+){
+   addChar_outBuf(outBufSTPtr, '\t');
+   addDbl_outBuf(
+      outBufSTPtr,
+      (float) (scoreF / def_scoreAdj_alnDefs),
+      2
+   );
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addDbl_outBuf(
+      outBufSTPtr,
+      (float) (maxScoreF / def_scoreAdj_alnDefs),
+      2
+   );
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, numMapsUI);
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, startUL + 1);
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, endUL + 1);
+} /*pHitStats_kmerFind*/
+
+/*-------------------------------------------------------\
+| Fun30: phit_kmerFind
 |   - prints out the primer hits for a sequence
 | Input:
 |   - refAryST:
@@ -4566,8 +4692,8 @@ fxAllFindPrims_kmerFind(
 |     o pointer to a unsigned long array with the
 |       sequences ending position on the primer for the
 |       best score
-|   - outFILE:
-|     o file to print the stats to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print the stats to
 \-------------------------------------------------------*/
 void
 phit_kmerFind(
@@ -4581,7 +4707,7 @@ phit_kmerFind(
    unsigned long *seqEndAryUL,
    unsigned long *primStartAryUL,
    unsigned long *primEndAryUL,
-   void *outFILE
+   struct outBuf *outBufSTPtr
 ){
    signed int siRef = 0;
    signed int siMate = 0;
@@ -4599,18 +4725,18 @@ phit_kmerFind(
    *oldSeqStr = '\0';
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun29 Sec02:
+   ^ Fun30 Sec02:
    ^   - print out mapped primers
-   ^   o fun29 sec02 sub01:
+   ^   o fun30 sec02 sub01:
    ^     - start loop and check primers that mapped
-   ^   o fun29 sec02 sub02:
+   ^   o fun30 sec02 sub02:
    ^     - primer mate (pairing) stats printout
-   ^   o fun29 sec02 sub03:
+   ^   o fun30 sec02 sub03:
    ^     - non-primer mate (no pairing) stats printout
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun29 Sec02 Sub01:
+   * Fun30 Sec02 Sub01:
    *   - start loop and check primers that mapped
    \*****************************************************/
 
@@ -4620,13 +4746,13 @@ phit_kmerFind(
    while(siRef < numRefsSI)
    { /*Loop: print out hits*/
       if(codeAryUI[siRef] == 0)
-         goto nextRef_fun29_sec02_sub04;
+         goto nextRef_fun30_sec02_sub04;
 
       if(dirArySC[siRef] == 'N')
-         goto nextRef_fun29_sec02_sub04;
+         goto nextRef_fun30_sec02_sub04;
 
       /**************************************************\
-      * Fun29 Sec02 Sub02:
+      * Fun30 Sec02 Sub02:
       *   - primer mate (pairing) stats printout
       \**************************************************/
 
@@ -4637,65 +4763,59 @@ phit_kmerFind(
          if(codeAryUI[siMate] == 0)
          { /*If: the mate did not map*/
             ++siRef; /*move past mate*/
-            goto nextRef_fun29_sec02_sub04;
+            goto nextRef_fun30_sec02_sub04;
          } /*If: the mate did not map*/
 
          if(dirArySC[siMate] == 'N')
          { /*If: the mate did not map*/
             ++siRef; /*move past mate*/
-            goto nextRef_fun29_sec02_sub04;
+            goto nextRef_fun30_sec02_sub04;
          } /*If: the mate did not map*/
 
          if(dirArySC[siRef] == dirArySC[siMate])
          { /*If: the mate was in the same direction*/
             ++siRef; /*move past mate*/
-            goto nextRef_fun29_sec02_sub04;
+            goto nextRef_fun30_sec02_sub04;
          } /*If: the mate was in the same direction*/
 
-         fprintf(
-             (FILE *) outFILE,
-             "%s\t%s",
-             seqSTPtr->idStr,
-             refAryST[siRef].forSeqST->idStr
-                + skip1stCharUC
+         addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addStr_outBuf(
+            outBufSTPtr,
+            refAryST[siRef].forSeqST->idStr + skip1stCharUC
          ); /*ids*/
 
+         addChar_outBuf(outBufSTPtr, '\t');
+         addSL_outBuf(outBufSTPtr, seqSTPtr->seqLenSL);
+         addChar_outBuf(outBufSTPtr, '\t');
+
          /*print out aligned length*/
          if(seqStartAryUL[siRef] < seqEndAryUL[siMate])
-         { /*If: the mate comes last (forward read)*/
-            fprintf(
-               (FILE *) outFILE,
-               "\t%li\t%lu",
-               seqSTPtr->seqLenSL,
+            addUL_outBuf(
+               outBufSTPtr,
                seqEndAryUL[siMate] - seqStartAryUL[siRef]
-            ); /*sequence length including primers*/
-         } /*If: the mate comes last (foward read)*/
-
+            ); /*mate comes last (forward read)*/
          else
-         { /*Else: the mate comes first (reverse read)*/
-            fprintf(
-               (FILE *) outFILE,
-               "\t%li\t%lu",
-               seqSTPtr->seqLenSL,
+            addUL_outBuf(
+               outBufSTPtr,
                seqEndAryUL[siRef] - seqStartAryUL[siMate]
-            ); /*sequence length including primers*/
-         } /*Else: the mate comes first (reverse read)*/
-
-         fprintf(
-             (FILE *) outFILE,
-             "\t%c\t%lu\t%lu",
-             dirArySC[siRef],
-             seqStartAryUL[siRef] + 1,
-             seqEndAryUL[siRef] + 1
-         ); /*forward primer mapping coordinates*/
-
-         fprintf(
-             (FILE *) outFILE,
-             "\t%c\t%lu\t%lu",
-             dirArySC[siMate],
-             seqStartAryUL[siMate] + 1,
-             seqEndAryUL[siMate] + 1
-         ); /*reverse primer mapping coordinates*/
+            ); /*mate comes first (reverse read)*/
+
+         addChar_outBuf(outBufSTPtr, '\t');
+         addChar_outBuf(outBufSTPtr, dirArySC[siRef]);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addUL_outBuf(outBufSTPtr, seqStartAryUL[siRef] + 1);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addUL_outBuf(outBufSTPtr, seqEndAryUL[siRef] + 1);
+            /*forward primer mapping coordinates*/
+
+         addChar_outBuf(outBufSTPtr, '\t');
+         addChar_outBuf(outBufSTPtr, dirArySC[siMate]);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addUL_outBuf(outBufSTPtr, seqStartAryUL[siMate]+1);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addUL_outBuf(outBufSTPtr, seqEndAryUL[siMate] + 1);
+            /*reverse primer mapping coordinates*/
 
          oldRefStr = refAryST[siRef].forSeqST->idStr;
          oldRefStr += (*oldRefStr == '>');
@@ -4707,17 +4827,13 @@ phit_kmerFind(
          *oldRefStr = '\0';
 
          /*print primer ids*/
-         fprintf(
-             (FILE *) outFILE,
-             "\t%0.2f\t%0.2f\t%i\t%lu\t%lu",
-             (float)
-                scoreArySL[siRef] / def_scoreAdj_alnDefs,
-             (float)
-                  refAryST[siRef].maxForScoreF
-                / def_scoreAdj_alnDefs,
-             codeAryUI[siRef],
-             primStartAryUL[siRef] + 1,
-             primEndAryUL[siRef] + 1
+         pHitStats_kmerFind(
+            (float) scoreArySL[siRef],
+            refAryST[siRef].maxForScoreF,
+            codeAryUI[siRef],
+            primStartAryUL[siRef],
+            primEndAryUL[siRef],
+            outBufSTPtr
          ); /*forward primer mapping stats*/
 
          oldRefStr = refAryST[siMate].forSeqST->idStr;
@@ -4730,46 +4846,50 @@ phit_kmerFind(
          oldRefBreakSC = *oldRefStr;
          *oldRefStr = '\0';
 
-         fprintf(
-             (FILE *) outFILE,
-             "\t%0.2f\t%0.2f\t%i\t%lu\t%lu%s",
-             (float)
-                scoreArySL[siMate] / def_scoreAdj_alnDefs,
-             (float)
-                 refAryST[siRef].maxRevScoreF
-               / def_scoreAdj_alnDefs,
-             codeAryUI[siMate],
-             primStartAryUL[siMate] + 1,
-             primEndAryUL[siMate] + 1,
-             str_endLine
+         pHitStats_kmerFind(
+            (float) scoreArySL[siMate],
+            refAryST[siRef].maxRevScoreF,
+            codeAryUI[siMate],
+            primStartAryUL[siMate],
+            primEndAryUL[siMate],
+            outBufSTPtr
          ); /*reverse primer mapping stats*/
 
+         addStr_outBuf(outBufSTPtr, str_endLine);
+
          *oldRefStr = oldRefBreakSC;
          ++siRef; /*move past mate*/
       } /*If: I have a mate primer*/
 
       /**************************************************\
-      * Fun29 Sec02 Sub03:
+      * Fun30 Sec02 Sub03:
       *   - non-primer mate (no pairing) stats printout
       \**************************************************/
 
       else
       { /*Else: I have no mate primers*/
-         fprintf(
-             (FILE *) outFILE,
-             "%s\t%s\t%li\tNA\t%c\t%li\t%lu",
-             seqSTPtr->idStr,
-             refAryST[siRef].forSeqST->idStr
-                + skip1stCharUC,
-             seqSTPtr->seqLenSL,
-             dirArySC[siRef],
-             seqStartAryUL[siRef] + 1,
-             seqEndAryUL[siRef] + 1
-         ); /*sequence alignment stats*/
-
-         fprintf(
-             (FILE *) outFILE,
-             "\tNA\tNA\tNA"
+         addStr_outBuf(outBufSTPtr, seqSTPtr->idStr);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addStr_outBuf(
+            outBufSTPtr,
+            refAryST[siRef].forSeqST->idStr + skip1stCharUC
+         );
+         addChar_outBuf(outBufSTPtr, '\t');
+         addSL_outBuf(outBufSTPtr, seqSTPtr->seqLenSL);
+         addStr_outBuf(outBufSTPtr, (signed char *) "\tNA\t");
+         addChar_outBuf(outBufSTPtr, dirArySC[siRef]);
+         addChar_outBuf(outBufSTPtr, '\t');
+         addSL_outBuf(
+            outBufSTPtr,
+            (signed long) seqStartAryUL[siRef] + 1
+         );
+         addChar_outBuf(outBufSTPtr, '\t');
+         addUL_outBuf(outBufSTPtr, seqEndAryUL[siRef] + 1);
+            /*sequence alignment stats*/
+
+         addStr_outBuf(
+            outBufSTPtr,
+            (signed char *) "\tNA\tNA\tNA"
          ); /*mate coordinates and mapped length*/
 
          oldRefStr = refAryST[siRef].forSeqST->idStr;
@@ -4781,34 +4901,30 @@ phit_kmerFind(
          oldRefBreakSC = *oldRefStr;
          *oldRefStr = '\0';
 
-         fprintf(
-             (FILE *) outFILE,
-             "\t%0.2f\t%0.2f\t%i\t%lu\t%lu",
-             (float)
-                scoreArySL[siRef] / def_scoreAdj_alnDefs,
-             (float)
-                  refAryST[siRef].maxForScoreF
-                / def_scoreAdj_alnDefs,
-             codeAryUI[siRef],        /*total mapps*/
-             primStartAryUL[siRef] + 1,/*start of map*/
-             primEndAryUL[siRef] + 1   /*end of map*/
+         pHitStats_kmerFind(
+            (float) scoreArySL[siRef],
+            refAryST[siRef].maxForScoreF,
+            codeAryUI[siRef],
+            primStartAryUL[siRef],
+            primEndAryUL[siRef],
+            outBufSTPtr
          ); /*foward primer mapping stats*/
 
          *oldRefStr = oldRefBreakSC;
 
-         fprintf(
-             (FILE *) outFILE,
-             "\tNA\tNA\tNA\tNA\tNA%s",
-             str_endLine
+         addStr_outBuf(
+            outBufSTPtr,
+            (signed char *) "\tNA\tNA\tNA\tNA\tNA"
          ); /*reverse primer mapping stats*/
+         addStr_outBuf(outBufSTPtr, str_endLine);
       } /*Else: I have no mate primers*/
 
       /**************************************************\
-      * Fun29 Sec02 Sub04:
+      * Fun30 Sec02 Sub04:
       *   - move to the next reference
       \**************************************************/
 
-      nextRef_fun29_sec02_sub04:;
+      nextRef_fun30_sec02_sub04:;
 
       ++siRef;
    } /*Loop: print out hits*/
@@ -4817,51 +4933,158 @@ phit_kmerFind(
 } /*phit_kmerFind*/
 
 /*-------------------------------------------------------\
-| Fun30: pHeaderHit_kmerFind
-|    - prints header for phit_kmerFind (fun29)
+| Fun31: pHeaderHit_kmerFind
+|    - prints header for phit_kmerFind (fun30)
 | Input:
-|   - outFILE:
-|     o file to print header to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print header to
 | Output:
 |   - Prints:
-|     o header to outFILE
+|     o header to outBufSTPtr
 \-------------------------------------------------------*/
 void
 pHeaderHit_kmerFind(
-   void *outFILE
+   struct outBuf *outBufSTPtr
 ){
-   fprintf(
-      (FILE *) outFILE,
-      "ref\tprim_id\tref_len\taln_len\tfor_dir"
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "ref\tprim_id\tref_len\taln_len\tfor_dir"
    );
 
-   fprintf(
-      (FILE *) outFILE,
-      "\tfor_seq_start\tfor_seq_end\trev_dir\trev_start"
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "\tfor_seq_start\tfor_seq_end\trev_dir\trev_start"
    );
 
-   fprintf(
-      (FILE *) outFILE,
-      "\trev_end\tfor_score\tfor_max_score"
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "\trev_end\tfor_score\tfor_max_score"
    );
 
-   fprintf(
-      (FILE *) outFILE,
-      "\tfor_num_maps\tfor_prim_start\tfor_prim_end"
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "\tfor_num_maps\tfor_prim_start\tfor_prim_end"
    );
 
-   fprintf(
-      (FILE *) outFILE,
-      "\trev_score\trev_max_score\trev_num_maps"
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "\trev_score\trev_max_score\trev_num_maps"
    );
 
-   fprintf(
-      (FILE *) outFILE,
-      "\trev_prim_start\trev_prim_end%s",
-      str_endLine
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *) "\trev_prim_start\trev_prim_end"
    );
+
+   addStr_outBuf(outBufSTPtr, str_endLine);
 } /*pHeader_kmerFind*/
 
+/*-------------------------------------------------------\
+| Fun32: blank_stats_kmerFind
+|   - sets all counters in a stats_kmerFind struct to 0
+| Input:
+|   - statsSTPtr:
+|     o stats_kmerFind struct pointer to blank
+| Output:
+|   - Modifies:
+|     o all counters in statsSTPtr to be 0
+\-------------------------------------------------------*/
+void
+blank_stats_kmerFind(
+   struct stats_kmerFind *statsSTPtr
+){
+   if(! statsSTPtr)
+      return;
+
+   statsSTPtr->winUL = 0;
+   statsSTPtr->passUL = 0;
+   statsSTPtr->alnUL = 0;
+   statsSTPtr->cellUL = 0;
+   statsSTPtr->lowScoreUL = 0;
+   statsSTPtr->overlapUL = 0;
+   statsSTPtr->hitUL = 0;
+} /*blank_stats_kmerFind*/
+
+/*-------------------------------------------------------\
+| Fun33: pStats_kmerFind
+|   - prints the counters in a stats_kmerFind struct
+| Input:
+|   - statsSTPtr:
+|     o stats_kmerFind struct pointer with counters
+|   - idStr:
+|     o c-string with id (gene or barcode) counters are
+|       for
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print the counters to
+| Output:
+|   - Prints:
+|     o one tsv row with the counters to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pStats_kmerFind(
+   struct stats_kmerFind *statsSTPtr,
+   signed char *idStr,
+   struct outBuf *outBufSTPtr
+){
+   addStr_outBuf(outBufSTPtr, idStr);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->winUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->passUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->alnUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->cellUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->lowScoreUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->overlapUL);
+
+   addChar_outBuf(outBufSTPtr, '\t');
+   addUL_outBuf(outBufSTPtr, statsSTPtr->hitUL);
+
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pStats_kmerFind*/
+
+/*-------------------------------------------------------\
+| Fun34: pHeaderStats_kmerFind
+|   - prints header for pStats_kmerFind (fun33)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print header to
+| Output:
+|   - Prints:
+|     o header to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pHeaderStats_kmerFind(
+   struct outBuf *outBufSTPtr
+){
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *)
+         "id\twindows\tkmer_pass\taln_calls\tdp_cells"
+   );
+
+   addStr_outBuf(
+      outBufSTPtr,
+      (signed char *) "\tlow_score\toverlap_drop\thits"
+   );
+
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pHeaderStats_kmerFind*/
+
 /*=======================================================\
 : License:
 : 
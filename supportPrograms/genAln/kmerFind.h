@@ -7,6 +7,8 @@
 '     - holds the kmer tables for detecting spoligytpes
 '   o .h st02: refST_kmerFind
 '     - holds the kmer pattern for the reference
+'   o .h st03: stats_kmerFind
+'     - counters for where kmerFind spends its time
 '   o fun01: blank_tblST_kmerFind
 '     - blanks all stored values in an tblST_kmerFind
 '   o fun02: qckBlank_tblST_kmerFind
@@ -92,10 +94,20 @@
 '       using an faster kmer search followed by an slower
 '       waterman to finalize alignments
 '     - this version finds all possible primers
-'   o fun29: phit_kmerFind
+'   o .c fun29: pHitStats_kmerFind
+'     - adds the score, maximum score, number of maps, and
+'       primer coordinates for one primer to a
+'       phit_kmerFind (fun30) row
+'   o fun30: phit_kmerFind
 '     - prints out the primer hits for a sequence
-'   o fun30: pHeaderHit_kmerFind
-'      - prints header for phit_kmerFind (fun29)
+'   o fun31: pHeaderHit_kmerFind
+'      - prints header for phit_kmerFind (fun30)
+'   o fun32: blank_stats_kmerFind
+'     - sets all counters in a stats_kmerFind struct to 0
+'   o fun33: pStats_kmerFind
+'     - prints the counters in a stats_kmerFind struct
+'   o fun34: pHeaderStats_kmerFind
+'     - prints header for pStats_kmerFind (fun33)
 '   o license:
 '     - Licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -110,6 +122,9 @@
 
 struct seqST;
 struct alnSet;
+struct outBuf;
+struct stats_kmerFind;
+struct trace;
 
 #define def_noPrim_kmerFind 1
 #define def_fileErr_kmerFind 2
@@ -158,6 +173,11 @@ typedef struct tblST_kmerFind
 
    unsigned long seqPosUL; /*position at in sequence*/
    struct seqST *seqSTPtr; /*sequence working on*/
+
+   struct stats_kmerFind *statsSTPtr;
+      /*counters to update; 0 (default) for no counting*/
+   struct trace *traceSTPtr;
+      /*marks each memwater call; 0 (default) for none*/
 }tblST_kmerFind;
 
 /*-------------------------------------------------------\
@@ -198,6 +218,24 @@ typedef struct refST_kmerFind
    signed int mateSI; /*matching primer*/
 }refST_kmerFind;
 
+/*-------------------------------------------------------\
+| ST03: stats_kmerFind
+|   - counters for where kmerFind spends its time
+|   - filled by findRefInChunk_kmerFind (fun24) and
+|     barcodeCoords_demux (demux.c) when a tblST_kmerFind
+|     statsSTPtr points to one
+\-------------------------------------------------------*/
+typedef struct stats_kmerFind
+{
+   unsigned long winUL;     /*windows scanned*/
+   unsigned long passUL;    /*windows passing matchCheck*/
+   unsigned long alnUL;     /*memwater calls*/
+   unsigned long cellUL;    /*memwater cells (qry * ref)*/
+   unsigned long lowScoreUL;/*hits under min % score*/
+   unsigned long overlapUL; /*overlapping hits dropped*/
+   unsigned long hitUL;     /*hits kept*/
+}stats_kmerFind;
+
 /*-------------------------------------------------------\
 | Fun01: blank_tblST_kmerFind
 |   - blanks all stored values in an tblST_kmerFind
@@ -1209,7 +1247,7 @@ fxAllFindPrims_kmerFind(
 );
 
 /*-------------------------------------------------------\
-| Fun29: phit_kmerFind
+| Fun30: phit_kmerFind
 |   - prints out the primer hits for a sequence
 | Input:
 |   - refAryST:
@@ -1245,8 +1283,8 @@ fxAllFindPrims_kmerFind(
 |     o pointer to a unsigned long array with the
 |       sequences ending position on the primer for the
 |       best score
-|   - outFILE:
-|     o file to print the stats to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print the stats to
 \-------------------------------------------------------*/
 void
 phit_kmerFind(
@@ -1260,22 +1298,74 @@ phit_kmerFind(
    unsigned long *seqEndAryUL,
    unsigned long *primStartAryUL,
    unsigned long *primEndAryUL,
-   void *outFILE
+   struct outBuf *outBufSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun30: pHeaderHit_kmerFind
-|    - prints header for phit_kmerFind (fun29)
+| Fun31: pHeaderHit_kmerFind
+|    - prints header for phit_kmerFind (fun30)
 | Input:
-|   - outFILE:
-|     o file to print header to
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print header to
 | Output:
 |   - Prints:
-|     o header to outFILE
+|     o header to outBufSTPtr
 \-------------------------------------------------------*/
 void
 pHeaderHit_kmerFind(
-   void *outFILE
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun32: blank_stats_kmerFind
+|   - sets all counters in a stats_kmerFind struct to 0
+| Input:
+|   - statsSTPtr:
+|     o stats_kmerFind struct pointer to blank
+| Output:
+|   - Modifies:
+|     o all counters in statsSTPtr to be 0
+\-------------------------------------------------------*/
+void
+blank_stats_kmerFind(
+   struct stats_kmerFind *statsSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun33: pStats_kmerFind
+|   - prints the counters in a stats_kmerFind struct
+| Input:
+|   - statsSTPtr:
+|     o stats_kmerFind struct pointer with counters
+|   - idStr:
+|     o c-string with id (gene or barcode) counters are
+|       for
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print the counters to
+| Output:
+|   - Prints:
+|     o one tsv row with the counters to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pStats_kmerFind(
+   struct stats_kmerFind *statsSTPtr,
+   signed char *idStr,
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun34: pHeaderStats_kmerFind
+|   - prints header for pStats_kmerFind (fun33)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to print header to
+| Output:
+|   - Prints:
+|     o header to outBufSTPtr
+\-------------------------------------------------------*/
+void
+pHeaderStats_kmerFind(
+   struct outBuf *outBufSTPtr
 );
 
 #endif
@@ -88,10 +88,43 @@
 '       sub-aligment
 '   o fun37: align_mapRead
 '     - maps read to reference
+'   * .h st06: kmerTbl_mapRead
+'     - finds the first sorted reference index for a kmer
+'       with a direct address or open addressing hash table
+'     o fun38: init_kmerTbl_mapRead
+'       - initializes a kmerTbl_mapRead struct
+'     o fun39: freeStack_kmerTbl_mapRead
+'       - frees variables in a kmerTbl_mapRead struct
+'     o fun40: freeHeap_kmerTbl_mapRead
+'       - frees a kmerTbl_mapRead struct
+'     o fun41: addRef_kmerTbl_mapRead
+'       - builds a kmer table from sorted reference kmers
+'     o fun42: find_kmerTbl_mapRead
+'       - finds the first sorted reference index of a kmer
+'   * ref_mapRead index files (fun20/fun21 format)
+'     o fun43: freeBin_ref_mapRead
+'       - frees the index file a ref_mapRead points into
+'     o fun44: checkBinHead_mapRead
+'       - checks the header of a ref_mapRead index file
+'     o fun45: setBin_ref_mapRead
+'       - points a ref_mapRead struct into an index file
+'         that is already in memory
+'     o fun46: mmapRefBin_ref_mapRead
+'       - memory maps a ref_mapRead index file
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*mmap is posix only; needs to be set before any system
+`  header is included
+*/
+#if !defined(PLAN9) && !defined(_WIN32) && !defined(NO_MMAP)
+   #define MMAP_mapRead
+   #ifndef _POSIX_C_SOURCE
+      #define _POSIX_C_SOURCE 200112L
+   #endif
+#endif
+
 #ifdef PLAN9
    #include <u.h>
    #include <libc.h>
@@ -99,6 +132,14 @@
    #include <stdlib.h>
 #endif
 
+#ifdef MMAP_mapRead
+   #include <sys/types.h>
+   #include <sys/stat.h>
+   #include <sys/mman.h>
+   #include <fcntl.h>
+   #include <unistd.h>
+#endif
+
 #include "mapRead.h"
 
 #include <stdio.h>
@@ -106,6 +147,7 @@
 #include "../genLib/numToStr.h"
 #include "../genLib/ulCp.h"
 #include "../genLib/shellSort.h"
+#include "../genLib/checkSum.h"
 
 #include "../genBio/kmerFun.h"
 #include "../genBio/seqST.h"
@@ -141,6 +183,45 @@
    `     o clears all bits except the negative (min value)
    */
 
+/*entries in an index file header (format is in fun21)*/
+#define def_magicBin_mapRead 0
+#define def_versionBin_mapRead 1
+#define def_endinBin_mapRead 2
+#define def_headCrcBin_mapRead 3
+#define def_dataCrcBin_mapRead 4
+#define def_intBytesBin_mapRead 5
+#define def_kmerLenBin_mapRead 6
+#define def_minChainBin_mapRead 7
+#define def_idLenBin_mapRead 8
+#define def_seqLenBin_mapRead 9
+#define def_numKmerBin_mapRead 10
+#define def_tblSizeBin_mapRead 11
+#define def_tblBitsBin_mapRead 12
+#define def_tblHashBin_mapRead 13
+#define def_numRefBin_mapRead 14
+#define def_fileLenBin_mapRead 15
+#define def_idOffBin_mapRead 16 /*first section offset*/
+#define def_seqOffBin_mapRead 17
+#define def_kmerOffBin_mapRead 18
+#define def_indexOffBin_mapRead 19
+#define def_tblOffBin_mapRead 20
+#define def_keyOffBin_mapRead 21
+#define def_startOffBin_mapRead 22
+#define def_lenRefOffBin_mapRead 23
+#define def_refIdOffBin_mapRead 24
+
+#define def_numSecBin_mapRead 9 /*sections after header*/
+#define def_headBytesBin_mapRead (def_binHeadLen_mapRead * sizeof(unsigned int))
+
+#define blocks_mapRead(bytesMac) ( ((bytesMac) + def_binAlign_mapRead) / def_binAlign_mapRead )
+   /*Logic: 64 byte blocks to hold a section
+   `   - always has at least one extra byte, so every
+   `     section ends in a null (for c-strings)
+   */
+
+#define inBin_mapRead(ptrMac, refMac) ( (unsigned char *) (ptrMac) >= (refMac)->binAryUC && (unsigned char *) (ptrMac) < (refMac)->binAryUC + (refMac)->lenBinUL )
+   /*Logic: 1 if pointer is in an index file*/
+
 /*-------------------------------------------------------\
 | ST05: hit_mapRead
 |   - private structure to create a linked list of chain
@@ -853,6 +934,17 @@ init_ref_mapRead(
    refSTPtr->sizeKmerSI = 0;
    refSTPtr->sizeIndexSI = 0;
    refSTPtr->lenSI = 0;
+   refSTPtr->tblSTPtr = 0;
+
+   refSTPtr->binAryUC = 0;
+   refSTPtr->lenBinUL = 0;
+   refSTPtr->mmapBl = 0;
+
+   refSTPtr->numRefSI = 0;
+   refSTPtr->sizeRefSI = 0;
+   refSTPtr->startArySI = 0;
+   refSTPtr->lenRefArySI = 0;
+   refSTPtr->idAryStr = 0;
 
    blank_ref_mapRead(refSTPtr);
 } /*init_ref_mapRead*/
@@ -876,6 +968,9 @@ freeStack_ref_mapRead(
    if(! refSTPtr)
       return;
 
+    freeBin_ref_mapRead(refSTPtr);
+       /*removes pointers into the index file*/
+
     if(refSTPtr->seqSTPtr)
        freeHeap_seqST(refSTPtr->seqSTPtr);
     refSTPtr->seqSTPtr = 0;
@@ -884,6 +979,15 @@ freeStack_ref_mapRead(
        free(refSTPtr->kmerArySI);
     if(refSTPtr->indexArySI)
        free(refSTPtr->indexArySI);
+    if(refSTPtr->tblSTPtr)
+       freeHeap_kmerTbl_mapRead(refSTPtr->tblSTPtr);
+
+    if(refSTPtr->startArySI)
+       free(refSTPtr->startArySI);
+    if(refSTPtr->lenRefArySI)
+       free(refSTPtr->lenRefArySI);
+    if(refSTPtr->idAryStr)
+       free(refSTPtr->idAryStr);
 
     init_ref_mapRead(refSTPtr);
 } /*freeStack_ref_mapRead*/
@@ -921,6 +1025,8 @@ freeHeap_ref_mapRead(
 |     o on success, you should set this to null, but do
 |       not free
 |     o on failure, free seqSTPtr; only assigned on succes
+|     o can not be a sequence from an index file (fun20,
+|       fun45, or fun46)
 |   - setSTPtr:
 |     o set_mapRead struct with settings for alignment
 | Output:
@@ -934,6 +1040,8 @@ freeHeap_ref_mapRead(
 |       sortKmerArySI index to kmerArySI index
 |     o lenKmerUC and minChainLenSI to bet set to their
 |       correct values in setSTPtr
+|     o numRefSI in refSTPtr to be 0 (not a panel; see
+|       getPanel_ref_mapRead)
 |   - Returns:
 |     o 0 for no errors
 |     o def_memErr_mapRead for memory errors
@@ -958,6 +1066,8 @@ addRef_ref_mapRead(
    '   o fun17 sec05:
    '     - copy kmers into sorted array and sort kmers
    '   o fun17 sec06:
+   '     - build kmer lookup table
+   '   o fun17 sec07:
    '     - set seqsTPtr pointer and return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -970,15 +1080,15 @@ addRef_ref_mapRead(
    signed int siPos = 0;
 
    if(! refSTPtr)
-      goto noStruct_fun17_sec06;
+      goto noStruct_fun17_sec07;
    else if(! seqSTPtr)
-      goto noStruct_fun17_sec06;
+      goto noStruct_fun17_sec07;
    else if(! seqSTPtr->seqStr)
-      goto noStruct_fun17_sec06;
+      goto noStruct_fun17_sec07;
    else if(seqSTPtr->seqStr[0] == '\0')
-      goto noStruct_fun17_sec06;
+      goto noStruct_fun17_sec07;
    else if(! setSTPtr)
-      goto noStruct_fun17_sec06;
+      goto noStruct_fun17_sec07;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun17 Sec02:
@@ -1012,6 +1122,14 @@ addRef_ref_mapRead(
    ^   - build kmer arrays
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+   freeBin_ref_mapRead(refSTPtr);
+      /*kmer arrays can not point into an index file*/
+
+   refSTPtr->numRefSI = 0;
+      /*single reference; getPanel_ref_mapRead sets the
+      `  panel after this call
+      */
+
    refSTPtr->lenSI =
       seqToKmer_kmerFun(
          seqSTPtr->seqStr,
@@ -1022,7 +1140,7 @@ addRef_ref_mapRead(
       );
 
    if(! refSTPtr->lenSI)
-      goto memErr_fun17_sec06;
+      goto memErr_fun17_sec07;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun17 Sec04:
@@ -1042,7 +1160,7 @@ addRef_ref_mapRead(
          );
 
       if(! refSTPtr->indexArySI)
-         goto memErr_fun17_sec06;
+         goto memErr_fun17_sec07;
 
       refSTPtr->sizeIndexSI = refSTPtr->lenSI;
    } /*If: need more memory*/
@@ -1073,21 +1191,45 @@ addRef_ref_mapRead(
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun17 Sec06:
+   ^   - build kmer lookup table
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! refSTPtr->tblSTPtr)
+   { /*If: need a kmer table*/
+      refSTPtr->tblSTPtr =
+         malloc(sizeof(struct kmerTbl_mapRead));
+      if(! refSTPtr->tblSTPtr)
+         goto memErr_fun17_sec07;
+      init_kmerTbl_mapRead(refSTPtr->tblSTPtr);
+   } /*If: need a kmer table*/
+
+   if(
+      addRef_kmerTbl_mapRead(
+         refSTPtr->tblSTPtr,
+         refSTPtr->lenKmerUC,
+         refSTPtr->kmerArySI,
+         refSTPtr->indexArySI,
+         refSTPtr->lenSI
+      )
+   ) goto memErr_fun17_sec07;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec07:
    ^   - set seqSTPtr pointer and return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    refSTPtr->seqSTPtr = seqSTPtr;
    return 0;
 
-   memErr_fun17_sec06:;
+   memErr_fun17_sec07:;
      siKmer = def_memErr_mapRead;
-     goto errRet_fun17_sec06;
+     goto errRet_fun17_sec07;
 
-   noStruct_fun17_sec06:;
+   noStruct_fun17_sec07:;
      siKmer = def_noStruct_mapRead;
-     goto errRet_fun17_sec06;
+     goto errRet_fun17_sec07;
 
-   errRet_fun17_sec06:;
+   errRet_fun17_sec07:;
       indexToSeq_alnSet(seqSTPtr->seqStr);
       return (signed char) siKmer;
 } /*addRef_ref_mapRead*/
@@ -1228,6 +1370,9 @@ getRef_ref_mapRead(
       goto badFile_fun19_sec05;
       /*currently not supported*/
 
+   freeBin_ref_mapRead(refSTPtr);
+      /*sequence can not point into an index file*/
+
    if(! refSTPtr->seqSTPtr)
    { /*If: need a sequence structure*/
       refSTPtr->seqSTPtr = malloc( sizeof(struct seqST) );
@@ -1319,53 +1464,50 @@ getRef_ref_mapRead(
 /*-------------------------------------------------------\
 | Fun20: getRefBin_ref_mapRead
 |   - gets a binary file with reference
+|   - reads the index file into one buffer and uses the
+|     buffer in place (see mmapRefBin_ref_mapRead to share
+|     the file between processes instead)
 | Input:
 |   - refSTPtr:
 |     o ref_mapRead struct to add reference to
 |   - refFILE:
-|     o FILE pointer to binary file with reference
-|       sequence, kmers, sorted index's, minimum chain
-|       length, and kmer length
-|     o Format:
-|       1: kmer length [of one kmer] (unsigned char)
-|       2: minimum kmers in a chain (signed int)
-|       3: length of reference id (name) (signed int)
-|       4: reference id (signed char)
-|       5: length of reference sequence (signed int)
-|       6: reference sequence (signed char)
-|       7: length of kmer sequence (signed int)
-|       8: reference kmer sequence (signed int)
-|       9: sorted index's for kmer sequence (signed int)
+|     o FILE pointer to index file made by
+|       writeRefBin_ref_mapRead (format is in fun21)
+|     o can be a stream (stdin), no seeking is done
+|   - chkBl:
+|     o 1: check the crc32 of the data
+|     o 0: only check the header crc32
 | Output:
 |   - Modifies:
 |     o refSTPtr to have values in refFILE
+|       * seqSTPtr->seqStr, kmerArySI, indexArySI, the
+|         kmer table (tblSTPtr), and the panel arrays
+|         (startArySI, lenRefArySI, and idAryStr) point
+|         into binAryUC
+|       * seqSTPtr->idStr is a copy (is edited by callers)
+|     o refFILE to be after the index
 |   - Returns:
 |     o 0 for no errors
 |     o def_memErr_mapRead for memory errors
 |     o def_noStruct_mapRead if no structure input
-|     o def_badFile_mapRead if no file input or if had
-|       file error
+|     o def_badFile_mapRead if no file input, if had
+|       file error, or if a checksum did not match
 \-------------------------------------------------------*/
 signed char
 getRefBin_ref_mapRead(
    struct ref_mapRead *refSTPtr,/*gets reference*/
-   void *refFILE               /*bin file with reference*/
+   void *refFILE,              /*bin file with reference*/
+   signed char chkBl           /*1: check data crc32*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun20 TOC:
    '   - gets a binary file with reference
    '   o fun20 sec01:
    '     - variable declartions
    '   o fun20 sec02:
-   '     - check input & allocate memory for seqST struct
+   '     - check input and get the header
    '   o fun20 sec03:
-   '     - get kmer size and minimum chain length
+   '     - read the index and point refSTPtr into it
    '   o fun20 sec04:
-   '     - get reference id
-   '   o fun20 sec05:
-   '     - get reference sequence
-   '   o fun20 sec06:
-   '     - get kmer sequence and sorted kmer index's
-   '   o fun20 sec07:
    '     - return result/errors
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -1374,366 +1516,102 @@ getRefBin_ref_mapRead(
    ^   - variable declartions
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   unsigned long tmpUL = 0;
-   signed int tmpSI = 0;
+   signed char errSC = 0;
+   unsigned int headAryUI[def_binHeadLen_mapRead];
+   unsigned long lenUL = 0;
+   unsigned char *binHeapAryUC = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun20 Sec02:
-   ^   - check input and allocate memory for seqST struct
+   ^   - check input and get the header
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    if(! refSTPtr)
-      goto noStruct_fun20_sec07;
+      goto noStruct_fun20_sec04;
    if(! refFILE)
-      goto noFile_fun20_sec07;
-
-   if(! refSTPtr->seqSTPtr)
-   { /*If: need new sequence struct*/
-      refSTPtr->seqSTPtr = malloc(sizeof(struct seqST));
-      if(! refSTPtr->seqSTPtr)
-         goto memErr_fun20_sec07;
-      init_seqST(refSTPtr->seqSTPtr);
-   } /*If: need new sequence struct*/
-
-   else
-      blank_seqST(refSTPtr->seqSTPtr);
-
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun20 Sec03:
-   ^   - get kmer size and minimum chain length
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   tmpUL =
-      fread(
-         &refSTPtr->lenKmerUC,
-         sizeof(unsigned char),
-         1,
-         (FILE *) refFILE
-      );
-
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-
-   tmpUL =
-      fread(
-         &refSTPtr->minChainLenSI,
-         sizeof(signed int),
-         1,
-         (FILE *) refFILE
-      );
-
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun20 Sec04:
-   ^   - get reference id
-   ^   o fun20 sec04 sub01:
-   ^     - get id length from file
-   ^   o fun20 sec04 sub02:
-   ^     - allocate memory for id string
-   ^   o fun20 sec04 sub03:
-   ^     - get id from file
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   /*****************************************************\
-   * Fun20 Sec04 Sub01:
-   *   - get id length from file
-   \*****************************************************/
-
-   tmpUL =
-      fread(
-         &refSTPtr->lenSI,
-         sizeof(signed int),
-         1,
-         (FILE *) refFILE
-      );
-
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-
-   /*****************************************************\
-   * Fun20 Sec04 Sub02:
-   *   - allocate memory for id string
-   \*****************************************************/
-
-   if(refSTPtr->seqSTPtr->idStr)
-   { /*If: have id buffer*/
-
-      if(refSTPtr->seqSTPtr->idSizeSL < refSTPtr->lenSI)
-      { /*If: id buffer is to short*/
-         free(refSTPtr->seqSTPtr->idStr);
-         refSTPtr->seqSTPtr->idStr = 0;
-      }  /*If: id buffer is to short*/
-   } /*If: have id buffer*/
-
-   if(! refSTPtr->seqSTPtr->idStr)
-   { /*If: need more memory*/
-      refSTPtr->seqSTPtr->idStr =
-         malloc(
-           (refSTPtr->lenSI + 8) * sizeof(signed char)
-         );
-      if(! refSTPtr->seqSTPtr->idStr)
-         goto memErr_fun20_sec07;
-      refSTPtr->seqSTPtr->idSizeSL = refSTPtr->lenSI;
-   } /*If: need more memory*/
-
-   /*****************************************************\
-   * Fun20 Sec04 Sub03:
-   *   - get id from file
-   \*****************************************************/
+      goto badFile_fun20_sec04;
 
-   refSTPtr->seqSTPtr->idLenSL =
-      fread(
-         refSTPtr->seqSTPtr->idStr,
-         sizeof(signed char),
-         refSTPtr->lenSI,
-         (FILE *) refFILE
-      );
+   if(
+         fread(
+            headAryUI,
+            sizeof(unsigned int),
+            def_binHeadLen_mapRead,
+            (FILE *) refFILE
+         )
+      != def_binHeadLen_mapRead
+   ) goto badFile_fun20_sec04;
 
-   if(! refSTPtr->seqSTPtr->idLenSL)
-      goto badEntry_fun20_sec07;
-   if(refSTPtr->seqSTPtr->idLenSL < refSTPtr->lenSI)
-      goto badEntry_fun20_sec07; /*hit EOF early*/
+   lenUL = checkBinHead_mapRead(headAryUI);
 
-   refSTPtr->seqSTPtr->idStr[
-      refSTPtr->seqSTPtr->idLenSL
-   ] = '\0';
+   if(lenUL < def_headBytesBin_mapRead)
+      goto badFile_fun20_sec04;
+      /*also catches invalid headers (lenUL = 0)*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun20 Sec05:
-   ^   - get reference sequence
-   ^   o fun20 sec05 sub01:
-   ^     - get sequence length from file
-   ^   o fun20 sec05 sub02:
-   ^     - allocate memory for sequence
-   ^   o fun20 sec05 sub03:
-   ^     - set q-score entry to null
-   ^   o fun20 sec05 sub04:
-   ^     - get sequence from file
+   ^ Fun20 Sec03:
+   ^   - read the index and point refSTPtr into it
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*****************************************************\
-   * Fun20 Sec05 Sub01:
-   *   - get sequence length from file
-   \*****************************************************/
-
-   tmpUL =
-      fread(
-         &refSTPtr->lenSI,
-         sizeof(signed int),
-         1,
-         (FILE *) refFILE
-      );
-
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-
-   /*****************************************************\
-   * Fun20 Sec05 Sub02:
-   *   - allocate memory for sequence
-   \*****************************************************/
-
-   if(refSTPtr->seqSTPtr->seqStr)
-   { /*If: have sequence buffer*/
-
-      if(refSTPtr->seqSTPtr->seqSizeSL < refSTPtr->lenSI)
-      { /*If: need more memory*/
-         free(refSTPtr->seqSTPtr->seqStr);
-         refSTPtr->seqSTPtr->seqStr = 0;
-      }  /*If: need more memory*/
-   } /*If: have sequence buffer*/
-
-   if(! refSTPtr->seqSTPtr->seqStr)
-   { /*If: need to allocate memory*/
-      refSTPtr->seqSTPtr->seqStr =
-         malloc(
-            (refSTPtr->lenSI + 8) * sizeof(signed char)
-         );
-      if(! refSTPtr->seqSTPtr->seqStr)
-         goto memErr_fun20_sec07;
-      refSTPtr->seqSTPtr->seqSizeSL = refSTPtr->lenSI;
-   } /*If: need to allocate memory*/
-
-   /*****************************************************\
-   * Fun20 Sec05 Sub03:
-   *   - set q-score entry to null
-   \*****************************************************/
-
-   if(! refSTPtr->seqSTPtr->qStr)
-   { /*If: need memory for q-score entry*/
-      refSTPtr->seqSTPtr->qStr =
-         malloc(9 * sizeof(signed char));
-      if(! refSTPtr->seqSTPtr->qStr)
-         goto memErr_fun20_sec07;
-      refSTPtr->seqSTPtr->qSizeSL = 1;
-   } /*If: need memory for q-score entry*/
-
-   refSTPtr->seqSTPtr->qStr[0] = '\0';
-   refSTPtr->seqSTPtr->qLenSL = 0;
-
-   /*****************************************************\
-   * Fun20 Sec05 Sub04:
-   *   - get sequence from file
-   \*****************************************************/
+   binHeapAryUC = malloc(lenUL * sizeof(unsigned char));
+   if(! binHeapAryUC)
+      goto memErr_fun20_sec04;
 
-   refSTPtr->seqSTPtr->seqLenSL =
-      fread(
-         refSTPtr->seqSTPtr->seqStr,
-         sizeof(signed char),
-         refSTPtr->lenSI,
-         (FILE *) refFILE
-      );
+   cpLen_ulCp(
+      (signed char *) binHeapAryUC,
+      (signed char *) headAryUI,
+      def_headBytesBin_mapRead
+   );
 
-   if(! refSTPtr->seqSTPtr->seqLenSL)
-      goto badEntry_fun20_sec07;
    if(
-        refSTPtr->seqSTPtr->seqLenSL
-      < (unsigned int) refSTPtr->lenSI
-   ) goto badEntry_fun20_sec07;
-     /*hit EOF early*/
-
-   refSTPtr->seqSTPtr->seqStr[
-      refSTPtr->seqSTPtr->seqLenSL
-   ] = '\0';
-
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun20 Sec06:
-   ^   - get kmer sequence and sorted kmer index's
-   ^   o fun20 sec06 sub01:
-   ^     - get kmer sequence length
-   ^   o fun20 sec06 sub03:
-   ^     - allocate memory for kmer sequence
-   ^   o fun20 sec06 sub04:
-   ^     - allocate memory for sorted kmer indexs
-   ^   o fun20 sec06 sub04:
-   ^     - get kmer sequence and sorted kmer index
-   ^   o fun20 sec06 sub05:
-   ^     - get sorted kmer index's
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-   /*****************************************************\
-   * Fun20 Sec06:
-   *   - get kmer sequence and sorted kmer index's
-   \*****************************************************/
-
-   tmpUL =
-      fread(
-         &tmpSI,
-         sizeof(signed int),
-         1,
-         (FILE *) refFILE
-      );
-
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-
-   /*****************************************************\
-   * Fun20 Sec06 Sub02:
-   *   - allocate memory for kmer sequence
-   \*****************************************************/
-
-   if(refSTPtr->kmerArySI)
-   { /*If: have kmer sequence buffer*/
-
-      if(refSTPtr->sizeKmerSI < tmpSI)
-      { /*If: need more memory*/
-         free(refSTPtr->kmerArySI);
-         refSTPtr->kmerArySI = 0;
-      }  /*If: need more memory*/
-   } /*If: have kmer sequence buffer*/
-
-
-   if(! refSTPtr->kmerArySI)
-   { /*If: need to allocate memory*/
-      refSTPtr->kmerArySI =
-         malloc((tmpSI + 8) * sizeof(signed int));
-      if(! refSTPtr->kmerArySI)
-         goto memErr_fun20_sec07;
-      refSTPtr->sizeKmerSI = tmpSI;
-   } /*If: need to allocate memory*/
-
-   /*****************************************************\
-   * Fun20 Sec06 Sub03:
-   *   - allocate memory for sorted kmer index's
-   \*****************************************************/
-
-   if(refSTPtr->indexArySI)
-   { /*If: have kmer sequence buffer*/
-
-      if(refSTPtr->sizeIndexSI < tmpSI)
-      { /*If: need more memory*/
-         free(refSTPtr->indexArySI);
-         refSTPtr->indexArySI = 0;
-      }  /*If: need more memory*/
-   } /*If: have kmer sequence buffer*/
-
-
-   if(! refSTPtr->indexArySI)
-   { /*If: need to allocate memory*/
-      refSTPtr->indexArySI =
-         malloc((tmpSI + 8) * sizeof(signed int));
-      if(! refSTPtr->indexArySI)
-         goto memErr_fun20_sec07;
-      refSTPtr->sizeIndexSI = tmpSI;
-   } /*If: need to allocate memory*/
-
-   /*****************************************************\
-   * Fun20 Sec06 Sub04:
-   *   - get kmer sequence
-   \*****************************************************/
+         fread(
+            binHeapAryUC + def_headBytesBin_mapRead,
+            sizeof(unsigned char),
+            lenUL - def_headBytesBin_mapRead,
+            (FILE *) refFILE
+         )
+      != lenUL - def_headBytesBin_mapRead
+   ) goto badFile_fun20_sec04; /*hit EOF early*/
 
-   tmpUL =
-      fread(
-         refSTPtr->kmerArySI,
-         sizeof(signed int),
-         tmpSI,
-         (FILE *) refFILE
+   errSC =
+      setBin_ref_mapRead(
+         refSTPtr,
+         binHeapAryUC,
+         lenUL,
+         0,        /*from malloc*/
+         chkBl
       );
 
-   if(! tmpUL)
-      goto badEntry_fun20_sec07;
-   if(tmpUL < (unsigned int) tmpSI)
-      goto badEntry_fun20_sec07;
-      /*hit EOF early*/
-
-   /*****************************************************\
-   * Fun20 Sec06 Sub05:
-   *   - get sorted kmer index's
-   \*****************************************************/
-
-   refSTPtr->lenSI  =
-      fread(
-         refSTPtr->indexArySI,
-         sizeof(signed int),
-         tmpSI,
-         (FILE *) refFILE
-      );
+   if(errSC)
+      goto ret_fun20_sec04;
 
-   if(! refSTPtr->lenSI)
-      goto badEntry_fun20_sec07;
-   if(refSTPtr->lenSI < tmpSI)
-      goto badEntry_fun20_sec07;
-      /*hit EOF early*/
+   binHeapAryUC = 0; /*refSTPtr owns the index now*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun20 Sec07:
+   ^ Fun20 Sec04:
    ^   - return result/errors
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   return 0;
+   errSC = 0;
+   goto ret_fun20_sec04;
 
-   memErr_fun20_sec07:;
-     return def_memErr_mapRead;
+   memErr_fun20_sec04:;
+     errSC = def_memErr_mapRead;
+     goto ret_fun20_sec04;
 
-   noFile_fun20_sec07:;
-     return def_badFile_mapRead;
+   noStruct_fun20_sec04:;
+     errSC = def_noStruct_mapRead;
+     goto ret_fun20_sec04;
 
-   noStruct_fun20_sec07:;
-     return def_noStruct_mapRead;
+   badFile_fun20_sec04:;
+     errSC = def_badFile_mapRead;
+     goto ret_fun20_sec04;
 
-   badEntry_fun20_sec07:;
-     return def_badFile_mapRead;
+   ret_fun20_sec04:;
+     if(binHeapAryUC)
+        free(binHeapAryUC);
+     binHeapAryUC = 0;
+
+     return errSC;
 } /*getRefBin_ref_mapRead*/
 
 /*-------------------------------------------------------\
@@ -1746,20 +1624,39 @@ getRefBin_ref_mapRead(
 |     o FILE pointer to write contents of refSTPtr to
 | Output:
 |   - Prints:
-|     o refSTPtr to file
-|       1: kmer length [of one kmer] (unsigned char)
-|       2: minimum kmers in a chain (signed int)
-|       3: length of reference id (name) (signed int)
-|       4: reference id (signed char)
-|       5: length of reference sequence (signed int)
-|       6: reference sequence (signed char)
-|       7: length of kmer sequence (signed int)
-|       8: reference kmer sequence (signed int)
-|       9: sorted index's for kmer sequence (signed int)
+|     o refSTPtr to refFILE as an index file
+|       * every section starts on a def_binAlign_mapRead
+|         (64) byte boundary and ends in at least one null
+|         byte, so the file can be used in place
+|       * numbers are in the writting machines byte order
+|     o header (def_binHeadLen_mapRead unsigned ints):
+|       0: def_binMagic_mapRead ("MRIX")
+|       1: def_binVersion_mapRead
+|       2: def_binEndin_mapRead (byte order check)
+|       3: crc32 of header (with this entry set to 0)
+|       4: crc32 of everything after the header
+|       5: bytes in a signed int
+|       6: kmer length [of one kmer]
+|       7: minimum kmers in a chain
+|       8: length of reference id (name)
+|       9: length of reference sequence
+|       10: number of kmers
+|       11: kmer table slots (0 if no table saved)
+|       12: kmer table hash bits
+|       13: 1 if kmer table is a hash table, 0 if direct
+|       14: offset of reference id
+|       15: offset of reference sequence (alnSet index's)
+|       16: offset of kmer sequence (signed int)
+|       17: offset of sorted kmer index's (signed int)
+|       18: offset of kmer table (signed int)
+|       19: offset of kmer table keys (signed int; hash)
+|       20: length of file
+|       * offsets and file length are in 64 byte blocks
 |   - Returns:
 |     o 0 for no errors
 |     o def_noStruct_mapRead if refSTPtr is 0/null
-|     o def_badFile_mapRead if refFILE is 0/null
+|     o def_badFile_mapRead if refFILE is 0/null or if
+|       could not write to refFILE
 \-------------------------------------------------------*/
 signed char
 writeRefBin_ref_mapRead(
@@ -1771,11 +1668,11 @@ writeRefBin_ref_mapRead(
    '   o fun21 sec01:
    '     - variable declarations and initial checks
    '   o fun21 sec02:
-   '     - print kmer length and min chain length
+   '     - find section lengths and offsets
    '   o fun21 sec03:
-   '     - print id and sequence
+   '     - get the data and header crc32s
    '   o fun21 sec04:
-   '     - print kmer sequence and sorted kmer index's
+   '     - print header and sections
    '   o fun21 sec05:
    '     - return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -1785,95 +1682,209 @@ writeRefBin_ref_mapRead(
    ^   - variable declarations and initial checks
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   signed int tmpSI = 0;
+   unsigned int headAryUI[def_binHeadLen_mapRead];
+   unsigned char padAryUC[def_binAlign_mapRead];
+
+   unsigned char *secAryUC[def_numSecBin_mapRead];
+   unsigned long lenSecAryUL[def_numSecBin_mapRead];
+   signed int siSec = 0;
+
+   unsigned long offUL = 0;
+   unsigned long padUL = 0;
+   unsigned long byteUL = 0;
+   unsigned int crc32UI = 0;
 
    if(! refSTPtr)
       goto noStruct_fun21_sec05;
+   if(! refSTPtr->seqSTPtr)
+      goto noStruct_fun21_sec05;
    if(! refFILE)
       goto badFile_fun21_sec05;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun21 Sec02:
-   ^   - print kmer length and min chain length
+   ^   - find section lengths and offsets
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   fwrite(
-      &refSTPtr->lenKmerUC,
-      sizeof(unsigned char),
-      1,
-      (FILE *) refFILE
-   );
+   for(siSec = 0; siSec < def_binHeadLen_mapRead; ++siSec)
+      headAryUI[siSec] = 0;
+   for(siSec = 0; siSec < def_binAlign_mapRead; ++siSec)
+      padAryUC[siSec] = 0;
 
-   fwrite(
-      &refSTPtr->minChainLenSI,
-      sizeof(signed int),
-      1,
-      (FILE *) refFILE
-   );
+   secAryUC[0] = (unsigned char *) refSTPtr->seqSTPtr->idStr;
+   lenSecAryUL[0] = refSTPtr->seqSTPtr->idLenSL;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun21 Sec03:
-   ^   - print id and sequence
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+   secAryUC[1] =
+      (unsigned char *) refSTPtr->seqSTPtr->seqStr;
+   lenSecAryUL[1] = refSTPtr->seqSTPtr->seqLenSL;
 
-   tmpSI = refSTPtr->seqSTPtr->idLenSL;
+   secAryUC[2] = (unsigned char *) refSTPtr->kmerArySI;
+   lenSecAryUL[2] = refSTPtr->lenSI * sizeof(signed int);
 
-   fwrite(
-      &tmpSI,
-      sizeof(signed int),
-      1,
-      (FILE *) refFILE
-   );
+   secAryUC[3] = (unsigned char *) refSTPtr->indexArySI;
+   lenSecAryUL[3] = lenSecAryUL[2];
 
-   fwrite(
-      refSTPtr->seqSTPtr->idStr,
-      sizeof(signed char),
-      refSTPtr->seqSTPtr->idLenSL,
-      (FILE *) refFILE
-   );
+   secAryUC[4] = 0;
+   lenSecAryUL[4] = 0;
+   secAryUC[5] = 0;
+   lenSecAryUL[5] = 0;
 
+   secAryUC[6] = (unsigned char *) refSTPtr->startArySI;
+   lenSecAryUL[6] = refSTPtr->numRefSI * sizeof(signed int);
 
-   tmpSI = refSTPtr->seqSTPtr->seqLenSL;
+   secAryUC[7] = (unsigned char *) refSTPtr->lenRefArySI;
+   lenSecAryUL[7] = lenSecAryUL[6];
 
-   fwrite(
-      &tmpSI,
-      sizeof(signed int),
-      1,
-      (FILE *) refFILE
-   );
+   secAryUC[8] = (unsigned char *) refSTPtr->idAryStr;
+   lenSecAryUL[8] =
+      refSTPtr->numRefSI * def_lenPanelId_mapRead;
 
-   fwrite(
-      refSTPtr->seqSTPtr->seqStr,
-      sizeof(signed char),
-      refSTPtr->seqSTPtr->seqLenSL,
-      (FILE *) refFILE
-   );
+   if(
+         refSTPtr->tblSTPtr
+      && refSTPtr->tblSTPtr->tblArySI
+   ){ /*If: saving the kmer lookup table*/
+      headAryUI[def_tblSizeBin_mapRead] =
+         (unsigned int) refSTPtr->tblSTPtr->sizeTblSI;
+      headAryUI[def_tblBitsBin_mapRead] =
+         refSTPtr->tblSTPtr->bitsUC;
+      headAryUI[def_tblHashBin_mapRead] =
+         (unsigned int) refSTPtr->tblSTPtr->hashBl;
+
+      secAryUC[4] =
+         (unsigned char *) refSTPtr->tblSTPtr->tblArySI;
+      lenSecAryUL[4] =
+           refSTPtr->tblSTPtr->sizeTblSI
+         * sizeof(signed int);
+
+      if(refSTPtr->tblSTPtr->hashBl)
+      { /*If: hash table; need keys*/
+         secAryUC[5] =
+            (unsigned char *) refSTPtr->tblSTPtr->keyArySI;
+         lenSecAryUL[5] = lenSecAryUL[4];
+      } /*If: hash table; need keys*/
+   } /*If: saving the kmer lookup table*/
+
+   offUL =
+        (def_headBytesBin_mapRead + def_binAlign_mapRead - 1)
+      / def_binAlign_mapRead;
+
+   for(siSec = 0; siSec < def_numSecBin_mapRead; ++siSec)
+   { /*Loop: find section offsets*/
+      headAryUI[def_idOffBin_mapRead + siSec] =
+         (unsigned int) offUL;
+      offUL += blocks_mapRead(lenSecAryUL[siSec]);
+   } /*Loop: find section offsets*/
+
+   headAryUI[def_fileLenBin_mapRead] = (unsigned int) offUL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun21 Sec03:
+   ^   - get the data and header crc32s
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   crc32UI = (unsigned int) -1;
+
+   for(siSec = 0; siSec < def_numSecBin_mapRead; ++siSec)
+   { /*Loop: get crc32 of each section*/
+      for(byteUL = 0; byteUL < lenSecAryUL[siSec]; ++byteUL)
+         crc32UI =
+            crc32Byte_checkSum(
+               secAryUC[siSec][byteUL],
+               crc32UI
+            );
+
+      padUL =
+           blocks_mapRead(lenSecAryUL[siSec])
+         * def_binAlign_mapRead
+         - lenSecAryUL[siSec];
+
+      while(padUL--)
+         crc32UI = crc32Byte_checkSum(0, crc32UI);
+   } /*Loop: get crc32 of each section*/
+
+   headAryUI[def_dataCrcBin_mapRead] =
+      crc32Finish_checkSum(crc32UI);
+
+   headAryUI[def_magicBin_mapRead] = def_binMagic_mapRead;
+   headAryUI[def_versionBin_mapRead] =
+      def_binVersion_mapRead;
+   headAryUI[def_endinBin_mapRead] = def_binEndin_mapRead;
+   headAryUI[def_intBytesBin_mapRead] = sizeof(signed int);
+   headAryUI[def_kmerLenBin_mapRead] = refSTPtr->lenKmerUC;
+   headAryUI[def_minChainBin_mapRead] =
+      (unsigned int) refSTPtr->minChainLenSI;
+   headAryUI[def_idLenBin_mapRead] =
+      (unsigned int) refSTPtr->seqSTPtr->idLenSL;
+   headAryUI[def_seqLenBin_mapRead] =
+      (unsigned int) refSTPtr->seqSTPtr->seqLenSL;
+   headAryUI[def_numKmerBin_mapRead] =
+      (unsigned int) refSTPtr->lenSI;
+   headAryUI[def_numRefBin_mapRead] =
+      (unsigned int) refSTPtr->numRefSI;
+
+   headAryUI[def_headCrcBin_mapRead] =
+      crc32_checkSum(
+         (unsigned char *) headAryUI,
+         def_headBytesBin_mapRead
+      ); /*crc32 entry is 0 when crc32 is found*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun21 Sec04:
-   ^   - print kmer sequence and sorted kmer index's
+   ^   - print header and sections
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   fwrite(
-      &refSTPtr->lenSI,
-      sizeof(signed int),
-      1,
-      (FILE *) refFILE
-   );
+   if(
+         fwrite(
+            headAryUI,
+            sizeof(unsigned int),
+            def_binHeadLen_mapRead,
+            (FILE *) refFILE
+         )
+      != def_binHeadLen_mapRead
+   ) goto badFile_fun21_sec05;
 
-   fwrite(
-      refSTPtr->kmerArySI,
-      sizeof(signed int),
-      refSTPtr->lenSI,
-      (FILE *) refFILE
-   );
+   padUL =
+        headAryUI[def_idOffBin_mapRead]
+      * def_binAlign_mapRead
+      - def_headBytesBin_mapRead;
 
-   fwrite(
-      refSTPtr->indexArySI,
-      sizeof(signed int),
-      refSTPtr->lenSI,
-      (FILE *) refFILE
-   );
+   if(
+         fwrite(
+            padAryUC,
+            sizeof(unsigned char),
+            padUL,
+            (FILE *) refFILE
+         )
+      != padUL
+   ) goto badFile_fun21_sec05;
+
+   for(siSec = 0; siSec < def_numSecBin_mapRead; ++siSec)
+   { /*Loop: print sections*/
+      if(
+            lenSecAryUL[siSec]
+         && fwrite(
+               secAryUC[siSec],
+               sizeof(unsigned char),
+               lenSecAryUL[siSec],
+               (FILE *) refFILE
+            ) != lenSecAryUL[siSec]
+      ) goto badFile_fun21_sec05;
+
+      padUL =
+           blocks_mapRead(lenSecAryUL[siSec])
+         * def_binAlign_mapRead
+         - lenSecAryUL[siSec];
+
+      if(
+            fwrite(
+               padAryUC,
+               sizeof(unsigned char),
+               padUL,
+               (FILE *) refFILE
+            )
+         != padUL
+      ) goto badFile_fun21_sec05;
+   } /*Loop: print sections*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun21 Sec05:
@@ -2408,6 +2419,10 @@ findChain_chains_mapRead(
 |     o signed int array with refKmerArySI index's sorted
 |       by kmer
 |     o create with fun28 sortKmerIndex_mapRead
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with the first
+|       refIndexArySI index for each kmer (fun41)
+|     o 0 (null) to use a binary search of refIndexArySI
 |   - lenRefSI:
 |     o number kmers in refKmerArySI
 |   - refStartSI:
@@ -2442,6 +2457,7 @@ kmerChain_mapRead(
    signed int *refKmerArySI,          /*reference kmers*/
    signed int *refIndexArySI,
      /*sorted refernce kmer index's (fun28)*/
+   struct kmerTbl_mapRead *tblSTPtr,  /*0 binary search*/
    signed int lenRefSI,               /*number ref kmers*/
    signed int refStartSI              /*first ref base*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
@@ -2571,18 +2587,26 @@ kmerChain_mapRead(
             break; /*no more query kmers*/
       } /*If: anonymous kmer or end of kmers*/
 
-      indexSL =
-         findKmer_mapRead(
-            refIndexArySI,
-            refKmerArySI,
-            (unsigned int) qryKmerArySI[siKmer],
-            0,
-            lenRefSI
-         ); /*find first query kmer for ref*/
-            /*O[log(r)] ref-find*/
-            /*unsigned int forces so negative values
-            `  to be at end
-            */
+      if(tblSTPtr)
+         indexSL =
+            find_kmerTbl_mapRead(
+               tblSTPtr,
+               qryKmerArySI[siKmer]
+            ); /*O[1] ref-find*/
+
+      else
+         indexSL =
+            findKmer_mapRead(
+               refIndexArySI,
+               refKmerArySI,
+               (unsigned int) qryKmerArySI[siKmer],
+               0,
+               lenRefSI
+            ); /*find first query kmer for ref*/
+               /*O[log(r)] ref-find*/
+               /*unsigned int forces so negative values
+               `  to be at end
+               */
 
       if(indexSL < 0)
          continue; /*no match*/
@@ -5106,8 +5130,14 @@ scoreSub_mapRead(
 
    if(! subBl)
       goto ret_fun35_sec05;
-   else if(bestStartUI == bestEndUI)
+   else if(bestScoreSL <= 0)
+      goto noScore_fun35_sec05; /*no sub-alignment*/
+   else if(bestStartUI && bestStartUI == bestEndUI)
       goto noScore_fun35_sec05;
+      /*start is masked, so nothing is left; when both
+      `  are 0 the best sub-alignment is the first cigar
+      `  entry (ex: 150=), which is the whole alignment
+      */
    else if(bestStartUI >= samSTPtr->cigLenUI)
       goto noScore_fun35_sec05;
 
@@ -5618,6 +5648,8 @@ chainToAln_mapRead(
 | Output:
 |   - Modifies:
 |     o samSTPtr to have highest scoring alignment
+|       * for a panel, ties go to the first reference
+|         in the panel (lowest start)
 |     o seqStr in qrySTPtr to be lookup index's, you can
 |       undo this with indexToSeq_alnSet(qrySTPtr->seqStr)
 |     o mapIndexSLPtr to have index of chain used to find
@@ -5798,6 +5830,7 @@ align_mapRead(
          alnSTPtr->lenSI,
          refSTPtr->kmerArySI,
          refSTPtr->indexArySI,
+         refSTPtr->tblSTPtr,
          refSTPtr->lenSI,
          0
       )
@@ -5893,7 +5926,13 @@ align_mapRead(
                iterSTPtr = iterSTPtr->nextST;
             } /*Loop: find insert position*/
 
-            if(! iterSTPtr)
+            if(iterSTPtr == hitHeapST)
+               ; /*new index is still in order; moving
+                 `  the head after itself would loop it
+                 `  and lose (leak) it
+                 */
+
+            else if(! iterSTPtr)
             { /*If: new index goes to end*/
                swapSTPtr = hitHeapST->nextST;
                tailSTPtr->nextST = hitHeapST;
@@ -5903,10 +5942,13 @@ align_mapRead(
 
             else
             { /*Else: index is inserted*/
-              swapSTPtr = hitHeapST; 
+              swapSTPtr = hitHeapST;
               hitHeapST = hitHeapST->nextST;
               swapSTPtr->nextST = iterSTPtr->nextST;
               iterSTPtr->nextST = swapSTPtr;
+
+              if(iterSTPtr == tailSTPtr)
+                 tailSTPtr = swapSTPtr;
             } /*Else: index is inserted*/
          } /*Else: need to position new index*/
 
@@ -6003,14 +6045,24 @@ align_mapRead(
          continue; /*no alingment*/
 
       if(scoreSL > bestScoreSL)
-      { /*If: new best alignment*/
-         bestScoreSL = scoreSL;
+         ;
+      else if(scoreSL < bestScoreSL)
+         continue;
+      else if(refSTPtr->numRefSI <= 0)
+         continue; /*not a panel; keep first alignment*/
+      else if(samStackST.refStartUI >= samSTPtr->refStartUI)
+         continue;
+         /*panel tie; references are in file order, so the
+         `  lowest start is the first panel reference
+         */
 
-         swap_samEntry(
-            &samStackST,
-            samSTPtr
-         );
-      } /*If: new best alignment*/
+      /*new best alignment*/
+      bestScoreSL = scoreSL;
+
+      swap_samEntry(
+         &samStackST,
+         samSTPtr
+      );
    } /*Loop: find best alignment*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -6059,6 +6111,1386 @@ align_mapRead(
       return bestScoreSL;
 } /*align_mapRead*/
 
+/*-------------------------------------------------------\
+| Fun38: init_kmerTbl_mapRead
+|   - initializes a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o sets arrays in tblSTPtr to 0/null and sizes to 0
+\-------------------------------------------------------*/
+void
+init_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+){
+   if(! tblSTPtr)
+      return;
+
+   tblSTPtr->tblArySI = 0;
+   tblSTPtr->keyArySI = 0;
+   tblSTPtr->sizeTblSI = 0;
+   tblSTPtr->bitsUC = 0;
+   tblSTPtr->hashBl = 0;
+} /*init_kmerTbl_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun39: freeStack_kmerTbl_mapRead
+|   - frees variables in a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with arrays to free
+| Output:
+|   - Modifies:
+|     o frees arrays in tblSTPtr and initializes
+\-------------------------------------------------------*/
+void
+freeStack_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+){
+   if(! tblSTPtr)
+      return;
+
+   if(tblSTPtr->tblArySI)
+      free(tblSTPtr->tblArySI);
+   if(tblSTPtr->keyArySI)
+      free(tblSTPtr->keyArySI);
+
+   init_kmerTbl_mapRead(tblSTPtr);
+} /*freeStack_kmerTbl_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun40: freeHeap_kmerTbl_mapRead
+|   - frees a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to free
+| Output:
+|   - Modifies:
+|     o frees tblSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+){
+   if(! tblSTPtr)
+      return;
+
+   freeStack_kmerTbl_mapRead(tblSTPtr);
+   free(tblSTPtr);
+} /*freeHeap_kmerTbl_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun41: addRef_kmerTbl_mapRead
+|   - builds a kmer table from sorted reference kmers
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to build table in
+|   - lenKmerUC:
+|     o length of one kmer
+|   - refKmerArySI:
+|     o signed int array with reference kmers
+|   - refIndexArySI:
+|     o signed int array with refKmerArySI index's sorted
+|       by kmer (fun28 sortKmerIndex_mapRead)
+|   - lenRefSI:
+|     o number kmers in refIndexArySI
+| Output:
+|   - Modifies:
+|     o tblSTPtr to have the first refIndexArySI index for
+|       each kmer in refKmerArySI
+|       * direct address (4^lenKmerUC slots) if lenKmerUC
+|         is at most def_directKmer_mapRead and the table
+|         has at most def_directPerKmer_mapRead slots per
+|         reference kmer
+|       * otherwise, an open addressing hash table (linear
+|         probing) with at least 2x slots than kmers
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+\-------------------------------------------------------*/
+signed char
+addRef_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr,
+   unsigned char lenKmerUC,
+   signed int *refKmerArySI,
+   signed int *refIndexArySI,
+   signed int lenRefSI
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun41 TOC:
+   '   - builds a kmer table from sorted reference kmers
+   '   o fun41 sec01:
+   '     - variable declarations
+   '   o fun41 sec02:
+   '     - count kmers and pick direct address or hash
+   '   o fun41 sec03:
+   '     - allocate memory for the table
+   '   o fun41 sec04:
+   '     - add the first sorted index for each kmer
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun41 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed int siIndex = 0;
+   signed int kmerSI = 0;
+   signed int lastKmerSI = -1;
+   signed int numKmerSI = 0;  /*number unique kmers*/
+   signed long sizeSL = 0;    /*number slots in table*/
+   unsigned long slotUL = 0;
+   unsigned long maskUL = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun41 Sec02:
+   ^   - count kmers and pick direct address or hash
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(siIndex = 0; siIndex < lenRefSI; ++siIndex)
+   { /*Loop: count unique kmers*/
+      kmerSI = refKmerArySI[ refIndexArySI[siIndex] ];
+
+      if(kmerSI < 0)
+         break;
+         /*sorted as unsigned, so anonymous kmers are at
+         `  the end
+         */
+
+      numKmerSI += (kmerSI != lastKmerSI);
+      lastKmerSI = kmerSI;
+   } /*Loop: count unique kmers*/
+
+   lenRefSI = siIndex; /*only kmers without anonymous*/
+   tblSTPtr->hashBl = 1;
+
+   if(lenKmerUC <= def_directKmer_mapRead)
+   { /*If: direct address table is possible*/
+      sizeSL = 1L << (lenKmerUC * def_bitsPerKmer_kmerFun);
+
+      if(
+            sizeSL
+         <= (signed long) lenRefSI * def_directPerKmer_mapRead
+      ) tblSTPtr->hashBl = 0;
+   } /*If: direct address table is possible*/
+
+   if(tblSTPtr->hashBl)
+   { /*If: using a hash table*/
+      tblSTPtr->bitsUC = 4; /*at least 16 slots*/
+
+      while(
+           (1L << tblSTPtr->bitsUC)
+         < ((signed long) numKmerSI << 1)
+      ) ++tblSTPtr->bitsUC; /*at most 50% full*/
+
+      sizeSL = 1L << tblSTPtr->bitsUC;
+      maskUL = (unsigned long) sizeSL - 1;
+   } /*If: using a hash table*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun41 Sec03:
+   ^   - allocate memory for the table
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(tblSTPtr->sizeTblSI < sizeSL)
+   { /*If: need more memory*/
+      if(tblSTPtr->tblArySI)
+         free(tblSTPtr->tblArySI);
+      tblSTPtr->tblArySI = 0;
+
+      if(tblSTPtr->keyArySI)
+         free(tblSTPtr->keyArySI);
+      tblSTPtr->keyArySI = 0;
+
+      tblSTPtr->sizeTblSI = 0;
+   } /*If: need more memory*/
+
+   if(! tblSTPtr->tblArySI)
+   { /*If: need to allocate the table*/
+      tblSTPtr->tblArySI =
+         malloc(sizeSL * sizeof(signed int));
+      if(! tblSTPtr->tblArySI)
+         goto memErr_fun41_sec04;
+      tblSTPtr->sizeTblSI = (signed int) sizeSL;
+   } /*If: need to allocate the table*/
+
+   if(tblSTPtr->hashBl && ! tblSTPtr->keyArySI)
+   { /*If: need to allocate the hash keys*/
+      tblSTPtr->keyArySI =
+         malloc(tblSTPtr->sizeTblSI * sizeof(signed int));
+      if(! tblSTPtr->keyArySI)
+         goto memErr_fun41_sec04;
+   } /*If: need to allocate the hash keys*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun41 Sec04:
+   ^   - add the first sorted index for each kmer
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(slotUL = 0; slotUL < (unsigned long) sizeSL; ++slotUL)
+      tblSTPtr->tblArySI[slotUL] = -1;
+
+   if(tblSTPtr->hashBl)
+   { /*If: using a hash table*/
+      for(
+         slotUL = 0;
+         slotUL < (unsigned long) sizeSL;
+         ++slotUL
+      ) tblSTPtr->keyArySI[slotUL] = -1;
+   } /*If: using a hash table*/
+
+   lastKmerSI = -1;
+
+   for(siIndex = 0; siIndex < lenRefSI; ++siIndex)
+   { /*Loop: add kmers*/
+      kmerSI = refKmerArySI[ refIndexArySI[siIndex] ];
+
+      if(kmerSI == lastKmerSI)
+         continue; /*already have first index*/
+
+      lastKmerSI = kmerSI;
+
+      if(! tblSTPtr->hashBl)
+      { /*If: direct address*/
+         tblSTPtr->tblArySI[kmerSI] = siIndex;
+         continue;
+      } /*If: direct address*/
+
+      /*multiplicative (Knuth) hash; top bitsUC bits*/
+      slotUL =
+           ((unsigned long) kmerSI * 2654435761UL)
+         & 0xffffffffUL;
+      slotUL >>= (32 - tblSTPtr->bitsUC);
+
+      while(tblSTPtr->keyArySI[slotUL] >= 0)
+         slotUL = (slotUL + 1) & maskUL;
+
+      tblSTPtr->keyArySI[slotUL] = kmerSI;
+      tblSTPtr->tblArySI[slotUL] = siIndex;
+   } /*Loop: add kmers*/
+
+   return 0;
+
+   memErr_fun41_sec04:;
+      freeStack_kmerTbl_mapRead(tblSTPtr);
+      return def_memErr_mapRead;
+} /*addRef_kmerTbl_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun42: find_kmerTbl_mapRead
+|   - finds the first sorted reference index of a kmer
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with table to search
+|       (from addRef_kmerTbl_mapRead)
+|   - kmerSI:
+|     o kmer to find
+| Output:
+|   - Returns:
+|     o first index in refIndexArySI with kmerSI (same
+|       index findKmer_mapRead returns)
+|     o -1 if kmerSI is not in the reference
+\-------------------------------------------------------*/
+signed long
+find_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr,
+   signed int kmerSI
+){
+   unsigned long slotUL = 0;
+   unsigned long maskUL = 0;
+
+   if(kmerSI < 0)
+      return -1; /*anonymous kmer*/
+
+   if(! tblSTPtr->hashBl)
+      return tblSTPtr->tblArySI[kmerSI];
+
+   maskUL = (1UL << tblSTPtr->bitsUC) - 1;
+   slotUL =
+        ((unsigned long) kmerSI * 2654435761UL)
+      & 0xffffffffUL;
+   slotUL >>= (32 - tblSTPtr->bitsUC);
+
+   while(tblSTPtr->keyArySI[slotUL] >= 0)
+   { /*Loop: probe for kmer*/
+      if(tblSTPtr->keyArySI[slotUL] == kmerSI)
+         return tblSTPtr->tblArySI[slotUL];
+
+      slotUL = (slotUL + 1) & maskUL;
+   } /*Loop: probe for kmer*/
+
+   return -1; /*kmer not in reference*/
+} /*find_kmerTbl_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun43: freeBin_ref_mapRead
+|   - frees the index file a ref_mapRead points into
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer with index to free
+| Output:
+|   - Modifies:
+|     o sets arrays in refSTPtr that point into binAryUC
+|       (reference sequence, kmers, sorted index's, kmer
+|       table, and panel) to 0/null and their sizes to 0
+|     o unmaps (mmapBl = 1) or frees binAryUC and sets
+|       binAryUC, lenBinUL, and mmapBl to 0
+\-------------------------------------------------------*/
+void
+freeBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr
+){
+   if(! refSTPtr)
+      return;
+   if(! refSTPtr->binAryUC)
+      return;
+
+   if(
+         refSTPtr->seqSTPtr
+      && inBin_mapRead(refSTPtr->seqSTPtr->seqStr, refSTPtr)
+   ){ /*If: sequence is in the index*/
+      refSTPtr->seqSTPtr->seqStr = 0;
+      refSTPtr->seqSTPtr->seqSizeSL = 0;
+      refSTPtr->seqSTPtr->seqLenSL = 0;
+   }  /*If: sequence is in the index*/
+
+   if( inBin_mapRead(refSTPtr->kmerArySI, refSTPtr) )
+   { /*If: kmers are in the index*/
+      refSTPtr->kmerArySI = 0;
+      refSTPtr->sizeKmerSI = 0;
+      refSTPtr->lenSI = 0;
+   } /*If: kmers are in the index*/
+
+   if( inBin_mapRead(refSTPtr->indexArySI, refSTPtr) )
+   { /*If: sorted index's are in the index*/
+      refSTPtr->indexArySI = 0;
+      refSTPtr->sizeIndexSI = 0;
+      refSTPtr->lenSI = 0;
+   } /*If: sorted index's are in the index*/
+
+   if(refSTPtr->tblSTPtr)
+   { /*If: have a kmer table*/
+      if(inBin_mapRead(refSTPtr->tblSTPtr->tblArySI,refSTPtr))
+      { /*If: table is in the index*/
+         refSTPtr->tblSTPtr->tblArySI = 0;
+         refSTPtr->tblSTPtr->sizeTblSI = 0;
+      } /*If: table is in the index*/
+
+      if(inBin_mapRead(refSTPtr->tblSTPtr->keyArySI,refSTPtr))
+         refSTPtr->tblSTPtr->keyArySI = 0;
+   } /*If: have a kmer table*/
+
+   if( inBin_mapRead(refSTPtr->startArySI, refSTPtr) )
+   { /*If: panel is in the index*/
+      refSTPtr->startArySI = 0;
+      refSTPtr->lenRefArySI = 0;
+      refSTPtr->idAryStr = 0;
+      refSTPtr->sizeRefSI = 0;
+      refSTPtr->numRefSI = 0;
+   } /*If: panel is in the index*/
+
+   #ifdef MMAP_mapRead
+      if(refSTPtr->mmapBl)
+         munmap(refSTPtr->binAryUC, refSTPtr->lenBinUL);
+      else
+         free(refSTPtr->binAryUC);
+   #else
+      free(refSTPtr->binAryUC);
+   #endif
+
+   refSTPtr->binAryUC = 0;
+   refSTPtr->lenBinUL = 0;
+   refSTPtr->mmapBl = 0;
+} /*freeBin_ref_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun44: checkBinHead_mapRead
+|   - checks the header of a ref_mapRead index file
+| Input:
+|   - headAryUI:
+|     o unsigned int array with the index header (first
+|       def_binHeadLen_mapRead unsigned ints of file)
+| Output:
+|   - Returns:
+|     o length of the index file in bytes
+|     o 0 if the magic number, version, byte order, int
+|       size, or header crc32 do not match
+\-------------------------------------------------------*/
+unsigned long
+checkBinHead_mapRead(
+   unsigned int *headAryUI
+){
+   unsigned int tmpAryUI[def_binHeadLen_mapRead];
+   signed int siPos = 0;
+
+   if(! headAryUI)
+      return 0;
+   if(headAryUI[def_magicBin_mapRead]!=def_binMagic_mapRead)
+      return 0;
+   if(
+         headAryUI[def_versionBin_mapRead]
+      != def_binVersion_mapRead
+   ) return 0;
+   if(headAryUI[def_endinBin_mapRead]!=def_binEndin_mapRead)
+      return 0; /*index made on different byte order*/
+   if(headAryUI[def_intBytesBin_mapRead]!=sizeof(signed int))
+      return 0;
+
+   for(siPos = 0; siPos < def_binHeadLen_mapRead; ++siPos)
+      tmpAryUI[siPos] = headAryUI[siPos];
+   tmpAryUI[def_headCrcBin_mapRead] = 0;
+
+   if(
+         crc32_checkSum(
+            (unsigned char *) tmpAryUI,
+            def_headBytesBin_mapRead
+         )
+      != headAryUI[def_headCrcBin_mapRead]
+   ) return 0;
+
+   return
+        (unsigned long) headAryUI[def_fileLenBin_mapRead]
+      * def_binAlign_mapRead;
+} /*checkBinHead_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun45: setBin_ref_mapRead
+|   - points a ref_mapRead struct into an index file
+|     that is already in memory
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to add reference to
+|   - binAryUC:
+|     o unsigned char array with the index file
+|     o must be aligned for an unsigned int (malloc and
+|       mmap are)
+|   - lenBinUL:
+|     o number bytes in binAryUC
+|   - mmapBl:
+|     o 1: binAryUC was from mmap (freed with munmap)
+|     o 0: binAryUC was from malloc (freed with free)
+|   - chkBl:
+|     o 1: check the crc32 of the data (reads the file)
+|     o 0: only check the header crc32
+| Output:
+|   - Modifies:
+|     o refSTPtr to have the reference in binAryUC
+|       * seqSTPtr->seqStr, kmerArySI, indexArySI, the
+|         kmer table (tblSTPtr), and the panel arrays
+|         (startArySI, lenRefArySI, and idAryStr) point
+|         into binAryUC
+|       * seqSTPtr->idStr is a copy (is edited by callers)
+|       * kmer table is built if it was not in the index
+|     o on success refSTPtr owns binAryUC (it is freed by
+|       freeBin_ref_mapRead and freeStack_ref_mapRead)
+|     o on failure, binAryUC is not used (you free it)
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if no structure input
+|     o def_badFile_mapRead if binAryUC is not a valid
+|       index file or a checksum did not match
+\-------------------------------------------------------*/
+signed char
+setBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   unsigned char *binAryUC,
+   unsigned long lenBinUL,
+   signed char mmapBl,
+   signed char chkBl
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun45 TOC:
+   '   - points a ref_mapRead struct into an index file
+   '   o fun45 sec01:
+   '     - variable declarations
+   '   o fun45 sec02:
+   '     - check the header and section offsets
+   '   o fun45 sec03:
+   '     - allocate memory (id, q-score, and kmer table)
+   '   o fun45 sec04:
+   '     - point refSTPtr into the index
+   '   o fun45 sec05:
+   '     - return result/errors
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun45 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned int *headAryUI = (unsigned int *) binAryUC;
+   unsigned long lenSecAryUL[def_numSecBin_mapRead];
+   unsigned long offUL = 0;
+   unsigned long firstUL = 0; /*first section offset*/
+   signed int siSec = 0;
+
+   signed int idLenSI = 0;
+   signed int seqLenSI = 0;
+   signed int numKmerSI = 0;
+   signed int sizeTblSI = 0;
+   signed int *kmerArySI = 0;
+   signed int *indexArySI = 0;
+
+   signed int numRefSI = 0;
+   signed int *startArySI = 0;
+   signed int *lenRefArySI = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun45 Sec02:
+   ^   - check the header and section offsets
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! refSTPtr)
+      goto noStruct_fun45_sec05;
+   if(! binAryUC)
+      goto badFile_fun45_sec05;
+   if(lenBinUL < def_headBytesBin_mapRead)
+      goto badFile_fun45_sec05;
+
+   offUL = checkBinHead_mapRead(headAryUI);
+
+   if(offUL < def_headBytesBin_mapRead)
+      goto badFile_fun45_sec05; /*invalid header*/
+   if(offUL > lenBinUL)
+      goto badFile_fun45_sec05; /*file is truncated*/
+
+   idLenSI = (signed int) headAryUI[def_idLenBin_mapRead];
+   seqLenSI = (signed int) headAryUI[def_seqLenBin_mapRead];
+   numKmerSI =
+      (signed int) headAryUI[def_numKmerBin_mapRead];
+   sizeTblSI =
+      (signed int) headAryUI[def_tblSizeBin_mapRead];
+   numRefSI = (signed int) headAryUI[def_numRefBin_mapRead];
+
+   if(idLenSI < 0 || seqLenSI <= 0)
+      goto badFile_fun45_sec05;
+   if(numKmerSI <= 0 || sizeTblSI < 0)
+      goto badFile_fun45_sec05;
+   if(numRefSI < 0)
+      goto badFile_fun45_sec05;
+
+   lenSecAryUL[0] = (unsigned long) idLenSI;
+   lenSecAryUL[1] = (unsigned long) seqLenSI;
+   lenSecAryUL[2] = numKmerSI * sizeof(signed int);
+   lenSecAryUL[3] = lenSecAryUL[2];
+   lenSecAryUL[4] = sizeTblSI * sizeof(signed int);
+   lenSecAryUL[5] = 0;
+
+   if(headAryUI[def_tblHashBin_mapRead])
+      lenSecAryUL[5] = lenSecAryUL[4];
+
+   lenSecAryUL[6] = numRefSI * sizeof(signed int);
+   lenSecAryUL[7] = lenSecAryUL[6];
+   lenSecAryUL[8] = numRefSI * def_lenPanelId_mapRead;
+
+   firstUL =
+        (def_headBytesBin_mapRead + def_binAlign_mapRead - 1)
+      / def_binAlign_mapRead;
+   offUL = firstUL;
+
+   for(siSec = 0; siSec < def_numSecBin_mapRead; ++siSec)
+   { /*Loop: check sections are in order and in file*/
+      if(headAryUI[def_idOffBin_mapRead + siSec] < offUL)
+         goto badFile_fun45_sec05;
+
+      offUL =
+           headAryUI[def_idOffBin_mapRead + siSec]
+         + blocks_mapRead(lenSecAryUL[siSec]);
+   } /*Loop: check sections are in order and in file*/
+
+   if(offUL > headAryUI[def_fileLenBin_mapRead])
+      goto badFile_fun45_sec05;
+
+   if(chkBl)
+   { /*If: checking the data*/
+      offUL =
+           (headAryUI[def_fileLenBin_mapRead] - firstUL)
+         * def_binAlign_mapRead;
+
+      if(
+            crc32_checkSum(
+               binAryUC + firstUL * def_binAlign_mapRead,
+               offUL
+            )
+         != headAryUI[def_dataCrcBin_mapRead]
+      ) goto badFile_fun45_sec05;
+   } /*If: checking the data*/
+
+   kmerArySI =
+      (signed int *)
+      (
+           binAryUC
+         +   headAryUI[def_kmerOffBin_mapRead]
+           * def_binAlign_mapRead
+      );
+
+   indexArySI =
+      (signed int *)
+      (
+           binAryUC
+         +   headAryUI[def_indexOffBin_mapRead]
+           * def_binAlign_mapRead
+      );
+
+   startArySI =
+      (signed int *)
+      (
+           binAryUC
+         +   headAryUI[def_startOffBin_mapRead]
+           * def_binAlign_mapRead
+      );
+
+   lenRefArySI =
+      (signed int *)
+      (
+           binAryUC
+         +   headAryUI[def_lenRefOffBin_mapRead]
+           * def_binAlign_mapRead
+      );
+
+   offUL = 0; /*end of last panel reference*/
+
+   for(siSec = 0; siSec < numRefSI; ++siSec)
+   { /*Loop: check panel references are in sequence*/
+      if(startArySI[siSec] < 0 || lenRefArySI[siSec] <= 0)
+         goto badFile_fun45_sec05;
+      if((unsigned long) startArySI[siSec] < offUL)
+         goto badFile_fun45_sec05; /*not in order*/
+
+      offUL =
+           (unsigned long) startArySI[siSec]
+         + lenRefArySI[siSec];
+
+      if(offUL > (unsigned long) seqLenSI)
+         goto badFile_fun45_sec05;
+   } /*Loop: check panel references are in sequence*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun45 Sec03:
+   ^   - allocate memory (id, q-score, and kmer table)
+   ^   o fun45 sec03 sub01:
+   ^     - remove old index and get sequence struct
+   ^   o fun45 sec03 sub02:
+   ^     - copy reference id
+   ^   o fun45 sec03 sub03:
+   ^     - set q-score entry to null
+   ^   o fun45 sec03 sub04:
+   ^     - get kmer table struct (build if not saved)
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun45 Sec03 Sub01:
+   *   - remove old index and get sequence struct
+   \*****************************************************/
+
+   freeBin_ref_mapRead(refSTPtr);
+
+   if(! refSTPtr->seqSTPtr)
+   { /*If: need new sequence struct*/
+      refSTPtr->seqSTPtr = malloc(sizeof(struct seqST));
+      if(! refSTPtr->seqSTPtr)
+         goto memErr_fun45_sec05;
+      init_seqST(refSTPtr->seqSTPtr);
+   } /*If: need new sequence struct*/
+
+   /*****************************************************\
+   * Fun45 Sec03 Sub02:
+   *   - copy reference id
+   \*****************************************************/
+
+   if(refSTPtr->seqSTPtr->idSizeSL < idLenSI)
+   { /*If: id buffer is to short*/
+      if(refSTPtr->seqSTPtr->idStr)
+         free(refSTPtr->seqSTPtr->idStr);
+      refSTPtr->seqSTPtr->idStr = 0;
+      refSTPtr->seqSTPtr->idSizeSL = 0;
+   }  /*If: id buffer is to short*/
+
+   if(! refSTPtr->seqSTPtr->idStr)
+   { /*If: need more memory*/
+      refSTPtr->seqSTPtr->idStr =
+         malloc((idLenSI + 8) * sizeof(signed char));
+      if(! refSTPtr->seqSTPtr->idStr)
+         goto memErr_fun45_sec05;
+      refSTPtr->seqSTPtr->idSizeSL = idLenSI;
+   } /*If: need more memory*/
+
+   cpLen_ulCp(
+      refSTPtr->seqSTPtr->idStr,
+      (signed char *)
+      (
+           binAryUC
+         +   headAryUI[def_idOffBin_mapRead]
+           * def_binAlign_mapRead
+      ),
+      (unsigned int) idLenSI
+   );
+
+   refSTPtr->seqSTPtr->idStr[idLenSI] = '\0';
+   refSTPtr->seqSTPtr->idLenSL = idLenSI;
+
+   /*****************************************************\
+   * Fun45 Sec03 Sub03:
+   *   - set q-score entry to null
+   \*****************************************************/
+
+   if(! refSTPtr->seqSTPtr->qStr)
+   { /*If: need memory for q-score entry*/
+      refSTPtr->seqSTPtr->qStr =
+         malloc(9 * sizeof(signed char));
+      if(! refSTPtr->seqSTPtr->qStr)
+         goto memErr_fun45_sec05;
+      refSTPtr->seqSTPtr->qSizeSL = 1;
+   } /*If: need memory for q-score entry*/
+
+   refSTPtr->seqSTPtr->qStr[0] = '\0';
+   refSTPtr->seqSTPtr->qLenSL = 0;
+
+   /*****************************************************\
+   * Fun45 Sec03 Sub04:
+   *   - get kmer table struct (build if not saved)
+   \*****************************************************/
+
+   if(! refSTPtr->tblSTPtr)
+   { /*If: need a kmer table*/
+      refSTPtr->tblSTPtr =
+         malloc(sizeof(struct kmerTbl_mapRead));
+      if(! refSTPtr->tblSTPtr)
+         goto memErr_fun45_sec05;
+      init_kmerTbl_mapRead(refSTPtr->tblSTPtr);
+   } /*If: need a kmer table*/
+
+   if(! sizeTblSI)
+   { /*If: table was not saved in the index*/
+      if(
+         addRef_kmerTbl_mapRead(
+            refSTPtr->tblSTPtr,
+            (unsigned char)
+               headAryUI[def_kmerLenBin_mapRead],
+            kmerArySI,
+            indexArySI,
+            numKmerSI
+         )
+      ) goto memErr_fun45_sec05;
+   } /*If: table was not saved in the index*/
+
+   else
+      freeStack_kmerTbl_mapRead(refSTPtr->tblSTPtr);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun45 Sec04:
+   ^   - point refSTPtr into the index
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(refSTPtr->seqSTPtr->seqStr)
+      free(refSTPtr->seqSTPtr->seqStr);
+
+   refSTPtr->seqSTPtr->seqStr =
+      (signed char *)
+      (
+           binAryUC
+         +   headAryUI[def_seqOffBin_mapRead]
+           * def_binAlign_mapRead
+      );
+   refSTPtr->seqSTPtr->seqLenSL = seqLenSI;
+   refSTPtr->seqSTPtr->seqSizeSL = seqLenSI;
+
+   if(refSTPtr->kmerArySI)
+      free(refSTPtr->kmerArySI);
+   refSTPtr->kmerArySI = kmerArySI;
+   refSTPtr->sizeKmerSI = numKmerSI;
+
+   if(refSTPtr->indexArySI)
+      free(refSTPtr->indexArySI);
+   refSTPtr->indexArySI = indexArySI;
+   refSTPtr->sizeIndexSI = numKmerSI;
+
+   refSTPtr->lenSI = numKmerSI;
+   refSTPtr->lenKmerUC =
+      (unsigned char) headAryUI[def_kmerLenBin_mapRead];
+   refSTPtr->minChainLenSI =
+      (signed int) headAryUI[def_minChainBin_mapRead];
+
+   if(sizeTblSI)
+   { /*If: using the saved kmer table*/
+      refSTPtr->tblSTPtr->tblArySI =
+         (signed int *)
+         (
+              binAryUC
+            +   headAryUI[def_tblOffBin_mapRead]
+              * def_binAlign_mapRead
+         );
+
+      refSTPtr->tblSTPtr->keyArySI = 0;
+
+      if(headAryUI[def_tblHashBin_mapRead])
+         refSTPtr->tblSTPtr->keyArySI =
+            (signed int *)
+            (
+                 binAryUC
+               +   headAryUI[def_keyOffBin_mapRead]
+                 * def_binAlign_mapRead
+            );
+
+      refSTPtr->tblSTPtr->sizeTblSI = sizeTblSI;
+      refSTPtr->tblSTPtr->bitsUC =
+         (unsigned char) headAryUI[def_tblBitsBin_mapRead];
+      refSTPtr->tblSTPtr->hashBl =
+         (signed char) headAryUI[def_tblHashBin_mapRead];
+   } /*If: using the saved kmer table*/
+
+   if(refSTPtr->startArySI)
+      free(refSTPtr->startArySI);
+   if(refSTPtr->lenRefArySI)
+      free(refSTPtr->lenRefArySI);
+   if(refSTPtr->idAryStr)
+      free(refSTPtr->idAryStr);
+
+   refSTPtr->startArySI = 0;
+   refSTPtr->lenRefArySI = 0;
+   refSTPtr->idAryStr = 0;
+   refSTPtr->sizeRefSI = 0;
+   refSTPtr->numRefSI = numRefSI;
+
+   if(numRefSI)
+   { /*If: index is a reference panel*/
+      refSTPtr->startArySI = startArySI;
+      refSTPtr->lenRefArySI = lenRefArySI;
+      refSTPtr->idAryStr =
+         (signed char *)
+         (
+              binAryUC
+            +   headAryUI[def_refIdOffBin_mapRead]
+              * def_binAlign_mapRead
+         );
+      refSTPtr->sizeRefSI = numRefSI;
+   } /*If: index is a reference panel*/
+
+   refSTPtr->binAryUC = binAryUC;
+   refSTPtr->lenBinUL = lenBinUL;
+   refSTPtr->mmapBl = mmapBl;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun45 Sec05:
+   ^   - return result/errors
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   return 0;
+
+   memErr_fun45_sec05:;
+     return def_memErr_mapRead;
+
+   noStruct_fun45_sec05:;
+     return def_noStruct_mapRead;
+
+   badFile_fun45_sec05:;
+     return def_badFile_mapRead;
+} /*setBin_ref_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun46: mmapRefBin_ref_mapRead
+|   - memory maps a ref_mapRead index file
+|   - the mapping is private and copy on write, so many
+|     processes mapping one index share one page cached
+|     copy and loading costs almost nothing
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to add reference to
+|   - fileStr:
+|     o c-string with path to index file made by
+|       writeRefBin_ref_mapRead
+|   - chkBl:
+|     o 1: check the crc32 of the data (reads the file)
+|     o 0: only check the header crc32
+| Output:
+|   - Modifies:
+|     o refSTPtr to have the reference in fileStr (see
+|       setBin_ref_mapRead)
+|     o uses getRefBin_ref_mapRead (fread) if built with
+|       -DNO_MMAP, for plan9, or for windows
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if no structure input
+|     o def_badFile_mapRead if could not open fileStr, if
+|       fileStr is not an index, or if a checksum did not
+|       match
+\-------------------------------------------------------*/
+signed char
+mmapRefBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   signed char *fileStr,
+   signed char chkBl
+){
+   signed char errSC = 0;
+
+   #ifdef MMAP_mapRead
+      signed int fileSI = 0;
+      struct stat statST;
+      void *mapPtr = 0;
+      unsigned long lenUL = 0;
+   #else
+      FILE *binFILE = 0;
+   #endif
+
+   if(! refSTPtr)
+      return def_noStruct_mapRead;
+   if(! fileStr)
+      return def_badFile_mapRead;
+
+   #ifdef MMAP_mapRead
+      fileSI = open((char *) fileStr, O_RDONLY);
+      if(fileSI < 0)
+         return def_badFile_mapRead;
+
+      if(fstat(fileSI, &statST))
+      { /*If: could not get file length*/
+         close(fileSI);
+         return def_badFile_mapRead;
+      } /*If: could not get file length*/
+
+      lenUL = (unsigned long) statST.st_size;
+
+      if(lenUL < def_headBytesBin_mapRead)
+      { /*If: file to small to be an index*/
+         close(fileSI);
+         return def_badFile_mapRead;
+      } /*If: file to small to be an index*/
+
+      mapPtr =
+         mmap(
+            0,
+            lenUL,
+            PROT_READ | PROT_WRITE, /*writes are private*/
+            MAP_PRIVATE,
+            fileSI,
+            0
+         );
+      close(fileSI); /*mapping stays after close*/
+
+      if(mapPtr == MAP_FAILED)
+         return def_badFile_mapRead;
+
+      errSC =
+         setBin_ref_mapRead(
+            refSTPtr,
+            (unsigned char *) mapPtr,
+            lenUL,
+            1,     /*from mmap*/
+            chkBl
+         );
+
+      if(errSC)
+         munmap(mapPtr, lenUL);
+   #else
+      binFILE = fopen((char *) fileStr, "rb");
+      if(! binFILE)
+         return def_badFile_mapRead;
+
+      errSC = getRefBin_ref_mapRead(refSTPtr,binFILE,chkBl);
+      fclose(binFILE);
+   #endif
+
+   return errSC;
+} /*mmapRefBin_ref_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun47: getPanel_ref_mapRead
+|   - gets every reference in a file as one panel
+|     (ex: one reference per genotype), so reads are
+|     mapped once to the best reference with one kmer
+|     table
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to store panel in
+|   - setSTPtr:
+|     o set_mapRead struct with settings for alignment
+|   - fxBl:
+|     o tells if file is fastq (1) or regular fasta (0)
+|   - gzBl:
+|     o tells if file is gziped (1) or regular fasta (0)
+|     o TODO: add gzip support
+|   - refFILE:
+|     o FILE pointer to file with references to store
+| Output:
+|   - Modifies:
+|     o seqSTPtr in refSTPtr to have all references
+|       joined by def_panelGap_mapRead N's and the id of
+|       the first reference
+|     o numRefSI, startArySI, lenRefArySI, and idAryStr
+|       in refSTPtr to have the panel references
+|       * ids are the first word of the header and are
+|         cut at def_lenPanelId_mapRead - 1 characters
+|     o kmerArySI, indexArySI, and tblSTPtr in refSTPtr
+|       to have the kmers of the panel (addRef_ref_mapRead)
+|     o refFILE to be at the end of the file
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if setSTPtr or refSTPtr is 0
+|     o def_badFile_mapRead for invalid fastx entries, no
+|       sequences, or gz files (currently not supported)
+\-------------------------------------------------------*/
+signed char
+getPanel_ref_mapRead(
+   struct ref_mapRead *refSTPtr,/*gets reference panel*/
+   struct set_mapRead *setSTPtr,/*has settings to add*/
+   signed char fxBl,            /*1: fastq; 0: fasta*/
+   signed char gzBl,            /*1: gzipped; 0: not*/
+   void *refFILE                /*fx file with panel*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun47 TOC:
+   '   - gets every reference in a file as one panel
+   '   o fun47 sec01:
+   '     - variable declarations
+   '   o fun47 sec02:
+   '     - checks and memory allocation
+   '   o fun47 sec03:
+   '     - read in references and add to the panel
+   '   o fun47 sec04:
+   '     - set panel id and build the kmer arrays
+   '   o fun47 sec05:
+   '     - return result
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun47 Sec01:
+   ^   - variable declarations
+   \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+   signed char errSC = 0;
+   signed char eofBl = 0;
+   signed int numRefSI = 0;   /*references in panel*/
+   signed long lenSL = 0;     /*panel length with gap*/
+   signed long posSL = 0;
+
+   struct seqST seqStackST;   /*holds one reference*/
+   struct seqST *panelSTPtr = 0;
+   signed char *idStr = 0;    /*id in panel id array*/
+   signed char *swapStr = 0;  /*for reallocs*/
+   signed int *swapArySI = 0; /*for reallocs*/
+
+   init_seqST(&seqStackST);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun47 Sec02:
+   ^   - checks and memory allocation
+   \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+   if(! refSTPtr)
+      goto noStruct_fun47_sec05;
+   else if(! setSTPtr)
+      goto noStruct_fun47_sec05;
+   else if(gzBl)
+      goto badFile_fun47_sec05;
+      /*currently not supported*/
+
+   freeBin_ref_mapRead(refSTPtr);
+      /*sequence can not point into an index file*/
+
+   if(! refSTPtr->seqSTPtr)
+   { /*If: need a sequence structure*/
+      refSTPtr->seqSTPtr = malloc( sizeof(struct seqST) );
+
+      if(! refSTPtr->seqSTPtr)
+         goto memErr_fun47_sec05;
+      init_seqST(refSTPtr->seqSTPtr);
+   } /*If: need a sequence structure*/
+
+   panelSTPtr = refSTPtr->seqSTPtr;
+   panelSTPtr->seqLenSL = 0;
+   panelSTPtr->qLenSL = 0;
+   if(panelSTPtr->qStr)
+      panelSTPtr->qStr[0] = '\0';
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun47 Sec03:
+   ^   - read in references and add to the panel
+   ^   o fun47 sec03 sub01:
+   ^     - get the next reference
+   ^   o fun47 sec03 sub02:
+   ^     - make sure have memory for the reference
+   ^   o fun47 sec03 sub03:
+   ^     - add reference to the panel
+   \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+   while(! eofBl)
+   { /*Loop: read in references*/
+
+      /**************************************************\
+      * Fun47 Sec03 Sub01:
+      *   - get the next reference
+      \**************************************************/
+
+      /*TODO add gzip support*/
+      if(fxBl)
+         errSC = getFq_seqST(refFILE, &seqStackST);
+      else
+         errSC = getFa_seqST(refFILE, &seqStackST);
+
+      if(errSC)
+      { /*If: had error*/
+         if(errSC & def_fileErr_seqST)
+            goto badFile_fun47_sec05;
+         else if(errSC & def_memErr_seqST)
+            goto memErr_fun47_sec05;
+
+         eofBl = 1;
+
+         if(! seqStackST.idLenSL || ! seqStackST.seqLenSL)
+            break; /*end of file; no new reference*/
+      } /*If: had error*/
+
+      /**************************************************\
+      * Fun47 Sec03 Sub02:
+      *   - make sure have memory for the reference
+      \**************************************************/
+
+      if(numRefSI >= refSTPtr->sizeRefSI)
+      { /*If: need more panel memory*/
+         lenSL = (refSTPtr->sizeRefSI << 1) + 8;
+
+         swapArySI =
+            realloc(
+               refSTPtr->startArySI,
+               lenSL * sizeof(signed int)
+            );
+         if(! swapArySI)
+            goto memErr_fun47_sec05;
+         refSTPtr->startArySI = swapArySI;
+
+         swapArySI =
+            realloc(
+               refSTPtr->lenRefArySI,
+               lenSL * sizeof(signed int)
+            );
+         if(! swapArySI)
+            goto memErr_fun47_sec05;
+         refSTPtr->lenRefArySI = swapArySI;
+
+         swapStr =
+            realloc(
+               refSTPtr->idAryStr,
+               lenSL * def_lenPanelId_mapRead
+            );
+         if(! swapStr)
+            goto memErr_fun47_sec05;
+         refSTPtr->idAryStr = swapStr;
+
+         refSTPtr->sizeRefSI = (signed int) lenSL;
+      } /*If: need more panel memory*/
+
+      lenSL =
+           panelSTPtr->seqLenSL
+         + seqStackST.seqLenSL
+         + def_panelGap_mapRead;
+
+      if(lenSL >= panelSTPtr->seqSizeSL)
+      { /*If: need more sequence memory*/
+         lenSL += (lenSL >> 1);
+
+         swapStr =
+            realloc(
+               panelSTPtr->seqStr,
+               (lenSL + 9) * sizeof(signed char)
+            );
+         if(! swapStr)
+            goto memErr_fun47_sec05;
+
+         panelSTPtr->seqStr = swapStr;
+         panelSTPtr->seqSizeSL = lenSL;
+      } /*If: need more sequence memory*/
+
+      /**************************************************\
+      * Fun47 Sec03 Sub03:
+      *   - add reference to the panel
+      \**************************************************/
+
+      refSTPtr->startArySI[numRefSI] =
+         (signed int) panelSTPtr->seqLenSL;
+      refSTPtr->lenRefArySI[numRefSI] =
+         (signed int) seqStackST.seqLenSL;
+
+      idStr =
+           refSTPtr->idAryStr
+         + numRefSI * def_lenPanelId_mapRead;
+
+      for(
+         posSL = 0;
+         posSL < def_lenPanelId_mapRead;
+         ++posSL
+      ){ /*Loop: copy first word of reference id*/
+         if(
+               posSL >= seqStackST.idLenSL
+            || seqStackST.idStr[posSL] < 33
+            || posSL == def_lenPanelId_mapRead - 1
+         ) idStr[posSL] = '\0';
+         else
+            idStr[posSL] = seqStackST.idStr[posSL];
+      }  /*Loop: copy first word of reference id*/
+
+      cpLen_ulCp(
+         panelSTPtr->seqStr + panelSTPtr->seqLenSL,
+         seqStackST.seqStr,
+         (unsigned int) seqStackST.seqLenSL
+      );
+      panelSTPtr->seqLenSL += seqStackST.seqLenSL;
+
+      for(posSL = 0; posSL < def_panelGap_mapRead; ++posSL)
+         panelSTPtr->seqStr[panelSTPtr->seqLenSL++] = 'N';
+
+      if(! numRefSI)
+      { /*If: first reference; use id for the panel*/
+         swapStr = panelSTPtr->idStr;
+         panelSTPtr->idStr = seqStackST.idStr;
+         seqStackST.idStr = swapStr;
+
+         lenSL = panelSTPtr->idSizeSL;
+         panelSTPtr->idSizeSL = seqStackST.idSizeSL;
+         seqStackST.idSizeSL = lenSL;
+
+         panelSTPtr->idLenSL = seqStackST.idLenSL;
+      } /*If: first reference; use id for the panel*/
+
+      ++numRefSI;
+   } /*Loop: read in references*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun47 Sec04:
+   ^   - set panel id and build the kmer arrays
+   \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+   if(! numRefSI)
+      goto badFile_fun47_sec05;
+
+   panelSTPtr->seqLenSL -= def_panelGap_mapRead;
+   panelSTPtr->seqStr[panelSTPtr->seqLenSL] = '\0';
+      /*remove gap after last reference*/
+
+   errSC =
+      addRef_ref_mapRead(
+         refSTPtr,
+         panelSTPtr,
+         setSTPtr
+      );
+
+   if(errSC)
+      goto memErr_fun47_sec05;
+      /*already know structures exist, so must be memory
+      `   error
+      */
+
+   refSTPtr->numRefSI = numRefSI;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun47 Sec05:
+   ^   - return result
+   \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
+
+   errSC = 0;
+   goto ret_fun47_sec05;
+
+   memErr_fun47_sec05:;
+      errSC = def_memErr_mapRead;
+      goto ret_fun47_sec05;
+
+   noStruct_fun47_sec05:;
+      errSC = def_noStruct_mapRead;
+      goto ret_fun47_sec05;
+
+   badFile_fun47_sec05:;
+      errSC = def_badFile_mapRead;
+      goto ret_fun47_sec05;
+
+   ret_fun47_sec05:;
+      freeStack_seqST(&seqStackST);
+      return errSC;
+} /*getPanel_ref_mapRead*/
+
+/*-------------------------------------------------------\
+| Fun48: panelCoord_ref_mapRead
+|   - converts a panel mapping to the coordinates and
+|     id of the reference it mapped to
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer with panel the read
+|       was mapped to
+|   - samSTPtr:
+|     o samEntry struct with a mapped read (from
+|       align_mapRead) to convert
+| Output:
+|   - Modifies:
+|     o refStartUI, refEndUI, refIdStr, and refIdLenUC in
+|       samSTPtr to be from the panel reference the read
+|       mapped to (nothing is changed if not a panel)
+|   - Returns:
+|     o index of the panel reference the read mapped to
+|     o 0 if refSTPtr is not a panel
+|     o -1 if the read crosses the end of a reference
+|       (is in the N's between two references)
+\-------------------------------------------------------*/
+signed int
+panelCoord_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   struct samEntry *samSTPtr
+){
+   signed int leftSI = 0;
+   signed int rightSI = 0;
+   signed int midSI = 0;
+   signed char *idStr = 0;
+   unsigned char lenUC = 0;
+
+   if(refSTPtr->numRefSI <= 0)
+      return 0;
+
+   /*find last reference starting at or before the read*/
+   rightSI = refSTPtr->numRefSI - 1;
+
+   while(leftSI < rightSI)
+   { /*Loop: binary search for reference*/
+      midSI = (leftSI + rightSI + 1) >> 1;
+
+      if(
+            (unsigned int) refSTPtr->startArySI[midSI]
+         <= samSTPtr->refStartUI
+      ) leftSI = midSI;
+      else
+         rightSI = midSI - 1;
+   } /*Loop: binary search for reference*/
+
+   if(
+         samSTPtr->refEndUI
+      >= (unsigned int)
+         (
+              refSTPtr->startArySI[leftSI]
+            + refSTPtr->lenRefArySI[leftSI]
+         )
+   ) return -1; /*read is (partly) in the gap*/
+
+   samSTPtr->refStartUI -=
+      (unsigned int) refSTPtr->startArySI[leftSI];
+   samSTPtr->refEndUI -=
+      (unsigned int) refSTPtr->startArySI[leftSI];
+
+   idStr =
+        refSTPtr->idAryStr
+      + leftSI * def_lenPanelId_mapRead;
+
+   while(
+         lenUC < def_lenPanelId_mapRead - 1
+      && idStr[lenUC] != '\0'
+   ){ /*Loop: copy reference id*/
+      samSTPtr->refIdStr[lenUC] = idStr[lenUC];
+      ++lenUC;
+   }  /*Loop: copy reference id*/
+
+   samSTPtr->refIdStr[lenUC] = '\0';
+   samSTPtr->refIdLenUC = lenUC;
+
+   return leftSI;
+} /*panelCoord_ref_mapRead*/
+
 /*=======================================================\
 : License:
 : 
@@ -89,8 +89,41 @@
 '       sub-aligment
 '   o fun37: align_mapRead
 '     - maps read to reference
+'   * .h st06: kmerTbl_mapRead
+'     - finds the first sorted reference index for a kmer
+'       with a direct address or open addressing hash table
+'     o fun38: init_kmerTbl_mapRead
+'       - initializes a kmerTbl_mapRead struct
+'     o fun39: freeStack_kmerTbl_mapRead
+'       - frees variables in a kmerTbl_mapRead struct
+'     o fun40: freeHeap_kmerTbl_mapRead
+'       - frees a kmerTbl_mapRead struct
+'     o fun41: addRef_kmerTbl_mapRead
+'       - builds a kmer table from sorted reference kmers
+'     o fun42: find_kmerTbl_mapRead
+'       - finds the first sorted reference index of a kmer
+'   * ref_mapRead index files (fun20/fun21 format)
+'     o fun43: freeBin_ref_mapRead
+'       - frees the index file a ref_mapRead points into
+'     o fun44: checkBinHead_mapRead
+'       - checks the header of a ref_mapRead index file
+'     o fun45: setBin_ref_mapRead
+'       - points a ref_mapRead struct into an index file
+'         that is already in memory
+'     o fun46: mmapRefBin_ref_mapRead
+'       - memory maps a ref_mapRead index file
+'   * ref_mapRead reference panels
+'     o fun47: getPanel_ref_mapRead
+'       - gets every reference in a file as one panel
+'     o fun48: panelCoord_ref_mapRead
+'       - converts a panel mapping to the coordinates and
+'         id of the reference it mapped to
 '   o license:
 '     - licensing for this code (public domain / mit)
+'   o options:
+'     - -DNO_MMAP makes mmapRefBin_ref_mapRead read the
+'       index with fread instead of mmap (mmap is never
+'       used for plan9 or windows)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*-------------------------------------------------------\
@@ -105,6 +138,7 @@ struct FILE;
 struct seqST;
 struct samEntry;
 struct alnSet;
+struct kmerTbl_mapRead;
 
 /*keep these negative, merge Chains returns postive/0 on
 `  success
@@ -117,6 +151,36 @@ struct alnSet;
 #define def_badFile_mapRead -32
 #define def_EOF_mapRead -64
 
+#define def_directKmer_mapRead 13
+   /*longest kmer to use a direct address table for*/
+#define def_directPerKmer_mapRead 16
+   /*max direct address table entries per reference kmer;
+   `  a hash table is used for larger tables, so 13mers
+   `  only use a direct table for references with over
+   `  4 million bases (4^13 / 16)
+   */
+
+/*index file (writeRefBin_ref_mapRead) settings*/
+#define def_binMagic_mapRead 0x5849524D /*"MRIX"*/
+#define def_binVersion_mapRead 3
+   /*version 1 was the unaligned field by field format;
+   `  version 2 had no reference panel
+   */
+#define def_binEndin_mapRead 0x01020304
+#define def_binHeadLen_mapRead 32 /*unsigned ints*/
+#define def_binAlign_mapRead 64   /*section alignment*/
+
+/*reference panel (getPanel_ref_mapRead) settings*/
+#define def_panelGap_mapRead 64
+   /*anonymous bases (N) put between panel references;
+   `  must be longer than the longest kmer so no kmer
+   `  (or chain) crosses two references
+   */
+#define def_lenPanelId_mapRead 64
+   /*bytes saved per panel reference id (63 characters
+   `  and a null)
+   */
+
 /*-------------------------------------------------------\
 | ST01: chains_mapRead
 |   - holds kmer chains build from kmerChain_mapRead
@@ -207,6 +271,29 @@ typedef struct ref_mapRead
       */
    signed int sizeIndexSI;    /*sized of sorted arrays*/
    signed int lenSI;          /*number kmers in arrays*/
+
+   struct kmerTbl_mapRead *tblSTPtr;
+      /*first indexArySI index for each kmer; O(1) kmer
+      `  lookups instead of a binary search
+      */
+
+   /*index file the arrays point into (fun45/fun46)*/
+   unsigned char *binAryUC;   /*index file in memory*/
+   unsigned long lenBinUL;    /*bytes in binAryUC*/
+   signed char mmapBl;        /*1: binAryUC is mmapped*/
+
+   /*reference panel (fun47); seqSTPtr has every panel
+   `  reference, with def_panelGap_mapRead N's between
+   `  references, so one kmer table covers all references
+   */
+   signed int numRefSI;       /*0: not a panel*/
+   signed int sizeRefSI;      /*size of panel arrays*/
+   signed int *startArySI;    /*first base of each ref*/
+   signed int *lenRefArySI;   /*length of each reference*/
+   signed char *idAryStr;
+      /*reference ids; each id is def_lenPanelId_mapRead
+      `  bytes long (null padded)
+      */
 }ref_mapRead;
 
 /*-------------------------------------------------------\
@@ -528,6 +615,8 @@ freeHeap_ref_mapRead(
 |     o on success, you should set this to null, but do
 |       not free
 |     o on failure, free seqSTPtr; only assigned on succes
+|     o can not be a sequence from an index file (fun20,
+|       fun45, or fun46)
 |   - setSTPtr:
 |     o set_mapRead struct with settings for alignment
 | Output:
@@ -539,6 +628,8 @@ freeHeap_ref_mapRead(
 |       sortKmerArySI index to kmerArySI index
 |     o lenKmerUC and minChainLenSI to bet set to their
 |       correct values in setSTPtr
+|     o numRefSI in refSTPtr to be 0 (not a panel; see
+|       getPanel_ref_mapRead)
 |   - Returns:
 |     o 0 for no errors
 |     o def_memErr_mapRead for memory errors
@@ -620,37 +711,40 @@ getRef_ref_mapRead(
 /*-------------------------------------------------------\
 | Fun20: getRefBin_ref_mapRead
 |   - gets a binary file with reference
+|   - reads the index file into one buffer and uses the
+|     buffer in place (see mmapRefBin_ref_mapRead to share
+|     the file between processes instead)
 | Input:
 |   - refSTPtr:
 |     o ref_mapRead struct to add reference to
 |   - refFILE:
-|     o FILE pointer to binary file with reference
-|       sequence, kmers, sorted index's, minimum chain
-|       length, and kmer length
-|     o Format:
-|       1: kmer length [of one kmer] (unsigned char)
-|       2: minimum kmers in a chain (signed int)
-|       3: length of reference id (name) (signed int)
-|       4: reference id (signed char)
-|       5: length of reference sequence (signed int)
-|       6: reference sequence (signed char)
-|       7: length of kmer sequence (signed int)
-|       8: reference kmer sequence (signed int)
-|       9: sorted index's for kmer sequence (signed int)
+|     o FILE pointer to index file made by
+|       writeRefBin_ref_mapRead (format is in fun21)
+|     o can be a stream (stdin), no seeking is done
+|   - chkBl:
+|     o 1: check the crc32 of the data
+|     o 0: only check the header crc32
 | Output:
 |   - Modifies:
 |     o refSTPtr to have values in refFILE
+|       * seqSTPtr->seqStr, kmerArySI, indexArySI, the
+|         kmer table (tblSTPtr), and the panel arrays
+|         (startArySI, lenRefArySI, and idAryStr) point
+|         into binAryUC
+|       * seqSTPtr->idStr is a copy (is edited by callers)
+|     o refFILE to be after the index
 |   - Returns:
 |     o 0 for no errors
 |     o def_memErr_mapRead for memory errors
 |     o def_noStruct_mapRead if no structure input
-|     o def_badRead_mapRead if no file input or if had
-|       file error
+|     o def_badFile_mapRead if no file input, if had
+|       file error, or if a checksum did not match
 \-------------------------------------------------------*/
 signed char
 getRefBin_ref_mapRead(
    struct ref_mapRead *refSTPtr,/*gets reference*/
-   void *refFILE               /*bin file with reference*/
+   void *refFILE,              /*bin file with reference*/
+   signed char chkBl           /*1: check data crc32*/
 );
 
 /*-------------------------------------------------------\
@@ -663,20 +757,44 @@ getRefBin_ref_mapRead(
 |     o FILE pointer to write contents of refSTPtr to
 | Output:
 |   - Prints:
-|     o refSTPtr to file
-|       1: kmer length [of one kmer] (unsigned char)
-|       2: minimum kmers in a chain (signed int)
-|       3: length of reference id (name) (signed int)
-|       4: reference id (signed char)
-|       5: length of reference sequence (signed int)
-|       6: reference sequence (signed char)
-|       7: length of kmer sequence (signed int)
-|       8: reference kmer sequence (signed int)
-|       9: sorted index's for kmer sequence (signed int)
+|     o refSTPtr to refFILE as an index file
+|       * every section starts on a def_binAlign_mapRead
+|         (64) byte boundary and ends in at least one null
+|         byte, so the file can be used in place
+|       * numbers are in the writting machines byte order
+|     o header (def_binHeadLen_mapRead unsigned ints):
+|       0: def_binMagic_mapRead ("MRIX")
+|       1: def_binVersion_mapRead
+|       2: def_binEndin_mapRead (byte order check)
+|       3: crc32 of header (with this entry set to 0)
+|       4: crc32 of everything after the header
+|       5: bytes in a signed int
+|       6: kmer length [of one kmer]
+|       7: minimum kmers in a chain
+|       8: length of reference id (name)
+|       9: length of reference sequence
+|       10: number of kmers
+|       11: kmer table slots (0 if no table saved)
+|       12: kmer table hash bits
+|       13: 1 if kmer table is a hash table, 0 if direct
+|       14: number of panel references (0 not a panel)
+|       15: length of file
+|       16: offset of reference id
+|       17: offset of reference sequence (alnSet index's)
+|       18: offset of kmer sequence (signed int)
+|       19: offset of sorted kmer index's (signed int)
+|       20: offset of kmer table (signed int)
+|       21: offset of kmer table keys (signed int; hash)
+|       22: offset of panel reference starts (signed int)
+|       23: offset of panel reference lengths (signed int)
+|       24: offset of panel reference ids
+|           (def_lenPanelId_mapRead bytes per id)
+|       * offsets and file length are in 64 byte blocks
 |   - Returns:
 |     o 0 for no errors
 |     o def_noStruct_mapRead if refSTPtr is 0/null
-|     o def_badFile_mapRead if refFILE is 0/null
+|     o def_badFile_mapRead if refFILE is 0/null or if
+|       could not write to refFILE
 \-------------------------------------------------------*/
 signed char
 writeRefBin_ref_mapRead(
@@ -833,6 +951,10 @@ sortKmerIndex_mapRead(
 |     o signed int array with refKmerArySI index's sorted
 |       by kmer
 |     o create with fun28 sortKmerIndex_mapRead
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with the first
+|       refIndexArySI index for each kmer (fun41)
+|     o 0 (null) to use a binary search of refIndexArySI
 |   - lenRefSI:
 |     o number kmers in refKmerArySI
 |   - refStartSI:
@@ -867,6 +989,7 @@ kmerChain_mapRead(
    signed int *refKmerArySI,          /*reference kmers*/
    signed int *refIndexArySI,
      /*sorted refernce kmer index's (fun28)*/
+   struct kmerTbl_mapRead *tblSTPtr,  /*0 binary search*/
    signed int lenRefSI,               /*number ref kmers*/
    signed int refStartSI              /*first ref base*/
 );
@@ -1106,6 +1229,8 @@ chainToAln_mapRead(
 | Output:
 |   - Modifies:
 |     o samSTPtr to have highest scoring alignment
+|       * for a panel, ties go to the first reference
+|         in the panel (lowest start)
 |     o seqStr in qrySTPtr to be lookup index's, you can
 |       undo this with indexToSeq_alnSet(qrySTPtr->seqStr)
 |     o mapIndexSLPtr to have index of chain used to find
@@ -1137,6 +1262,324 @@ align_mapRead(
    signed char *errSCPtr        /*gets errors*/
 );
 
+/*-------------------------------------------------------\
+| ST06: kmerTbl_mapRead
+|   - finds the first sorted reference index for a kmer
+|     with a direct address or open addressing hash table
+|   - the positions for a kmer are the run of refIndexArySI
+|     (sortKmerIndex_mapRead order) starting at the index
+\-------------------------------------------------------*/
+typedef struct kmerTbl_mapRead
+{
+   signed int *tblArySI;
+      /*direct: first sorted index for each kmer
+      `  hash: first sorted index for kmer in keyArySI
+      `  -1 if kmer is not in the reference
+      */
+   signed int *keyArySI;   /*hash: kmer in slot (-1 empty)*/
+   signed int sizeTblSI;   /*number slots in arrays*/
+   unsigned char bitsUC;   /*hash: log2(sizeTblSI)*/
+   signed char hashBl;     /*1: hash table; 0: direct*/
+}kmerTbl_mapRead;
+
+/*-------------------------------------------------------\
+| Fun38: init_kmerTbl_mapRead
+|   - initializes a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o sets arrays in tblSTPtr to 0/null and sizes to 0
+\-------------------------------------------------------*/
+void
+init_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun39: freeStack_kmerTbl_mapRead
+|   - frees variables in a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with arrays to free
+| Output:
+|   - Modifies:
+|     o frees arrays in tblSTPtr and initializes
+\-------------------------------------------------------*/
+void
+freeStack_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun40: freeHeap_kmerTbl_mapRead
+|   - frees a kmerTbl_mapRead struct
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to free
+| Output:
+|   - Modifies:
+|     o frees tblSTPtr (you must set to 0/null)
+\-------------------------------------------------------*/
+void
+freeHeap_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun41: addRef_kmerTbl_mapRead
+|   - builds a kmer table from sorted reference kmers
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer to build table in
+|   - lenKmerUC:
+|     o length of one kmer
+|   - refKmerArySI:
+|     o signed int array with reference kmers
+|   - refIndexArySI:
+|     o signed int array with refKmerArySI index's sorted
+|       by kmer (fun28 sortKmerIndex_mapRead)
+|   - lenRefSI:
+|     o number kmers in refIndexArySI
+| Output:
+|   - Modifies:
+|     o tblSTPtr to have the first refIndexArySI index for
+|       each kmer in refKmerArySI
+|       * direct address (4^lenKmerUC slots) if lenKmerUC
+|         is at most def_directKmer_mapRead and the table
+|         has at most def_directPerKmer_mapRead slots per
+|         reference kmer
+|       * otherwise, an open addressing hash table (linear
+|         probing) with at least 2x slots than kmers
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+\-------------------------------------------------------*/
+signed char
+addRef_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr,
+   unsigned char lenKmerUC,
+   signed int *refKmerArySI,
+   signed int *refIndexArySI,
+   signed int lenRefSI
+);
+
+/*-------------------------------------------------------\
+| Fun42: find_kmerTbl_mapRead
+|   - finds the first sorted reference index of a kmer
+| Input:
+|   - tblSTPtr:
+|     o kmerTbl_mapRead struct pointer with table to search
+|       (from addRef_kmerTbl_mapRead)
+|   - kmerSI:
+|     o kmer to find
+| Output:
+|   - Returns:
+|     o first index in refIndexArySI with kmerSI (same
+|       index findKmer_mapRead returns)
+|     o -1 if kmerSI is not in the reference
+\-------------------------------------------------------*/
+signed long
+find_kmerTbl_mapRead(
+   struct kmerTbl_mapRead *tblSTPtr,
+   signed int kmerSI
+);
+
+/*-------------------------------------------------------\
+| Fun43: freeBin_ref_mapRead
+|   - frees the index file a ref_mapRead points into
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer with index to free
+| Output:
+|   - Modifies:
+|     o sets arrays in refSTPtr that point into binAryUC
+|       (reference sequence, kmers, sorted index's, kmer
+|       table, and panel) to 0/null and their sizes to 0
+|     o unmaps (mmapBl = 1) or frees binAryUC and sets
+|       binAryUC, lenBinUL, and mmapBl to 0
+\-------------------------------------------------------*/
+void
+freeBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun44: checkBinHead_mapRead
+|   - checks the header of a ref_mapRead index file
+| Input:
+|   - headAryUI:
+|     o unsigned int array with the index header (first
+|       def_binHeadLen_mapRead unsigned ints of file)
+| Output:
+|   - Returns:
+|     o length of the index file in bytes
+|     o 0 if the magic number, version, byte order, int
+|       size, or header crc32 do not match
+\-------------------------------------------------------*/
+unsigned long
+checkBinHead_mapRead(
+   unsigned int *headAryUI
+);
+
+/*-------------------------------------------------------\
+| Fun45: setBin_ref_mapRead
+|   - points a ref_mapRead struct into an index file
+|     that is already in memory
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to add reference to
+|   - binAryUC:
+|     o unsigned char array with the index file
+|     o must be aligned for an unsigned int (malloc and
+|       mmap are)
+|   - lenBinUL:
+|     o number bytes in binAryUC
+|   - mmapBl:
+|     o 1: binAryUC was from mmap (freed with munmap)
+|     o 0: binAryUC was from malloc (freed with free)
+|   - chkBl:
+|     o 1: check the crc32 of the data (reads the file)
+|     o 0: only check the header crc32
+| Output:
+|   - Modifies:
+|     o refSTPtr to have the reference in binAryUC
+|       * seqSTPtr->seqStr, kmerArySI, indexArySI, the
+|         kmer table (tblSTPtr), and the panel arrays
+|         (startArySI, lenRefArySI, and idAryStr) point
+|         into binAryUC
+|       * seqSTPtr->idStr is a copy (is edited by callers)
+|       * kmer table is built if it was not in the index
+|     o on success refSTPtr owns binAryUC (it is freed by
+|       freeBin_ref_mapRead and freeStack_ref_mapRead)
+|     o on failure, binAryUC is not used (you free it)
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if no structure input
+|     o def_badFile_mapRead if binAryUC is not a valid
+|       index file or a checksum did not match
+\-------------------------------------------------------*/
+signed char
+setBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   unsigned char *binAryUC,
+   unsigned long lenBinUL,
+   signed char mmapBl,
+   signed char chkBl
+);
+
+/*-------------------------------------------------------\
+| Fun46: mmapRefBin_ref_mapRead
+|   - memory maps a ref_mapRead index file
+|   - the mapping is private and copy on write, so many
+|     processes mapping one index share one page cached
+|     copy and loading costs almost nothing
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to add reference to
+|   - fileStr:
+|     o c-string with path to index file made by
+|       writeRefBin_ref_mapRead
+|   - chkBl:
+|     o 1: check the crc32 of the data (reads the file)
+|     o 0: only check the header crc32
+| Output:
+|   - Modifies:
+|     o refSTPtr to have the reference in fileStr (see
+|       setBin_ref_mapRead)
+|     o uses getRefBin_ref_mapRead (fread) if built with
+|       -DNO_MMAP, for plan9, or for windows
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if no structure input
+|     o def_badFile_mapRead if could not open fileStr, if
+|       fileStr is not an index, or if a checksum did not
+|       match
+\-------------------------------------------------------*/
+signed char
+mmapRefBin_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   signed char *fileStr,
+   signed char chkBl
+);
+
+/*-------------------------------------------------------\
+| Fun47: getPanel_ref_mapRead
+|   - gets every reference in a file as one panel
+|     (ex: one reference per genotype), so reads are
+|     mapped once to the best reference with one kmer
+|     table
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer to store panel in
+|   - setSTPtr:
+|     o set_mapRead struct with settings for alignment
+|   - fxBl:
+|     o tells if file is fastq (1) or regular fasta (0)
+|   - gzBl:
+|     o tells if file is gziped (1) or regular fasta (0)
+|     o TODO: add gzip support
+|   - refFILE:
+|     o FILE pointer to file with references to store
+| Output:
+|   - Modifies:
+|     o seqSTPtr in refSTPtr to have all references
+|       joined by def_panelGap_mapRead N's and the id of
+|       the first reference
+|     o numRefSI, startArySI, lenRefArySI, and idAryStr
+|       in refSTPtr to have the panel references
+|       * ids are the first word of the header and are
+|         cut at def_lenPanelId_mapRead - 1 characters
+|     o kmerArySI, indexArySI, and tblSTPtr in refSTPtr
+|       to have the kmers of the panel (addRef_ref_mapRead)
+|     o refFILE to be at the end of the file
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_mapRead for memory errors
+|     o def_noStruct_mapRead if setSTPtr or refSTPtr is 0
+|     o def_badFile_mapRead for invalid fastx entries, no
+|       sequences, or gz files (currently not supported)
+\-------------------------------------------------------*/
+signed char
+getPanel_ref_mapRead(
+   struct ref_mapRead *refSTPtr,/*gets reference panel*/
+   struct set_mapRead *setSTPtr,/*has settings to add*/
+   signed char fxBl,            /*1: fastq; 0: fasta*/
+   signed char gzBl,            /*1: gzipped; 0: not*/
+   void *refFILE                /*fx file with panel*/
+);
+
+/*-------------------------------------------------------\
+| Fun48: panelCoord_ref_mapRead
+|   - converts a panel mapping to the coordinates and
+|     id of the reference it mapped to
+| Input:
+|   - refSTPtr:
+|     o ref_mapRead struct pointer with panel the read
+|       was mapped to
+|   - samSTPtr:
+|     o samEntry struct with a mapped read (from
+|       align_mapRead) to convert
+| Output:
+|   - Modifies:
+|     o refStartUI, refEndUI, refIdStr, and refIdLenUC in
+|       samSTPtr to be from the panel reference the read
+|       mapped to (nothing is changed if not a panel)
+|   - Returns:
+|     o index of the panel reference the read mapped to
+|     o 0 if refSTPtr is not a panel
+|     o -1 if the read crosses the end of a reference
+|       (is in the N's between two references)
+\-------------------------------------------------------*/
+signed int
+panelCoord_ref_mapRead(
+   struct ref_mapRead *refSTPtr,
+   struct samEntry *samSTPtr
+);
+
 #endif
 
 /*=======================================================\
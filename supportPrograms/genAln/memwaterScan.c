@@ -32,11 +32,16 @@
 '   o fun09: merge_aln_memwaterScan
 '     - merges one aln_memwaterScan struct into another
 '       aln_memwaterScan struct
-'   o fun10 memwaterScan:
+'   o .c fun10: addTop_memwaterScan
+'     - adds an alignment to the top K alignments,
+'       removing lower scoring overlapping alignments
+'   o fun11 memwaterScan:
 '     - performs a memory efficent Smith Waterman scan
 '       (keep best alignment for each query/reference base)
 '       alignment on a pair of sequences
-'   o fun11: simple_memwaterScan
+'     - keeps the top K non-overlapping alignments
+'       instead if topKSL is set
+'   o fun12: simple_memwaterScan
 '     - performs a memory efficent Smith Waterman scan
 '       (keep best alignment for each query/reference
 '       base) alignment on a pair of sequences
@@ -60,6 +65,7 @@
 
 #include "memwaterScan.h"
 
+#include "../genLib/memTag.h"
 #include "../genBio/seqST.h"
 
 #include "alnSet.h"
@@ -133,6 +139,9 @@ init_aln_memwaterScan(
    alnSTPtr->dirRowSC = 0;
    alnSTPtr->rowSizeSI = 0;
 
+   alnSTPtr->topKSL = 0;
+   alnSTPtr->topMinScoreSL = 0;
+
    blank_aln_memwaterScan(alnSTPtr);
 } /*init_aln_memwaterScan*/
 
@@ -155,18 +164,18 @@ freeStack_aln_memwaterScan(
       return;
 
    if(alnSTPtr->startArySL)
-      free(alnSTPtr->startArySL);
+      free_memTag(alnSTPtr->startArySL);
    if(alnSTPtr->endArySL)
-      free(alnSTPtr->endArySL);
+      free_memTag(alnSTPtr->endArySL);
    if(alnSTPtr->scoreArySL)
-      free(alnSTPtr->scoreArySL);
+      free_memTag(alnSTPtr->scoreArySL);
 
    if(alnSTPtr->scoreRowSL)
-      free(alnSTPtr->scoreRowSL);
+      free_memTag(alnSTPtr->scoreRowSL);
    if(alnSTPtr->indexRowSL)
-      free(alnSTPtr->indexRowSL);
+      free_memTag(alnSTPtr->indexRowSL);
    if(alnSTPtr->dirRowSC)
-      free(alnSTPtr->dirRowSC);
+      free_memTag(alnSTPtr->dirRowSC);
 
    init_aln_memwaterScan(alnSTPtr);
 } /*freeStack_aln_memwaterScan*/
@@ -810,14 +819,16 @@ merge_aln_memwaterScan(
    { /*If: need to resize the output struct*/
       if(! outSTPtr->startArySL)
          tmpSLPtr =
-            malloc(
-               (newOutLenSL + 16) * sizeof(unsigned long)
+            malloc_memTag(
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       else
          tmpSLPtr =
-            realloc(
+            realloc_memTag(
                outSTPtr->startArySL,
-               (newOutLenSL + 16) * sizeof(unsigned long)
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       if(! tmpSLPtr)
          goto memErr_fun09_sec0x;
@@ -826,14 +837,16 @@ merge_aln_memwaterScan(
 
       if(! outSTPtr->endArySL)
          tmpSLPtr =
-            malloc(
-               (newOutLenSL + 16) * sizeof(unsigned long)
+            malloc_memTag(
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       else
          tmpSLPtr =
-            realloc(
+            realloc_memTag(
                outSTPtr->endArySL,
-               (newOutLenSL + 16) * sizeof(unsigned long)
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       if(! tmpSLPtr)
          goto memErr_fun09_sec0x;
@@ -842,14 +855,16 @@ merge_aln_memwaterScan(
 
       if(! outSTPtr->scoreArySL)
          tmpSLPtr =
-            malloc(
-               (newOutLenSL + 16) * sizeof(unsigned long)
+            malloc_memTag(
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       else
          tmpSLPtr =
-            realloc(
+            realloc_memTag(
                outSTPtr->scoreArySL,
-               (newOutLenSL + 16) * sizeof(unsigned long)
+               (newOutLenSL + 16) * sizeof(unsigned long),
+               def_hitMemwaterScan_memTag
             );
       if(! tmpSLPtr)
          goto memErr_fun09_sec0x;
@@ -900,14 +915,174 @@ merge_aln_memwaterScan(
 
    ret_fun09_sec0x:;
       if(tmpSLPtr)
-         free(tmpSLPtr);
+         free_memTag(tmpSLPtr);
       tmpSLPtr = 0;
 
       return newOutLenSL;
 } /*merge_aln_memwaterScan*/
 
 /*-------------------------------------------------------\
-| Fun10: memwaterScan
+| Fun10: addTop_memwaterScan
+|   - adds an alignment to the top K alignments, removing
+|     lower scoring alignments it overlaps
+| Input:
+|   - alnSTPtr:
+|     o aln_memwaterScan struct with the top K alignments
+|       (startArySL, endArySL, scoreArySL, and outLenSL)
+|       and topKSL/topMinScoreSL set
+|   - startSL:
+|     o matrix index of the alignments first base
+|   - endSL:
+|     o matrix index of the alignments last base
+|   - scoreSL:
+|     o score of the alignment
+| Output:
+|   - Modifies:
+|     o startArySL, endArySL, scoreArySL, and outLenSL in
+|       alnSTPtr to have the alignment if it is kept
+|       * kept if no higher or equal scoring alignment
+|         overlaps it on the reference and it is in the
+|         top K (lowest scoring alignment is removed)
+|   - Returns:
+|     o the score an alignment must be above to change the
+|       top K alignments
+\-------------------------------------------------------*/
+signed long
+addTop_memwaterScan(
+   struct aln_memwaterScan *alnSTPtr,
+   signed long startSL,
+   signed long endSL,
+   signed long scoreSL
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun10 TOC:
+   '   - adds an alignment to the top K alignments
+   '   o fun10 sec01:
+   '     - variable declarations
+   '   o fun10 sec02:
+   '     - check if a better alignment overlaps
+   '   o fun10 sec03:
+   '     - remove lower scoring overlaps and add alignment
+   '   o fun10 sec04:
+   '     - find the new minimum score
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long refStartUL =
+      refCoord_indexToCoord(alnSTPtr->refLenSI, startSL);
+   unsigned long refEndUL =
+      refCoord_indexToCoord(alnSTPtr->refLenSI, endSL);
+
+   unsigned long hitStartUL = 0;
+   unsigned long hitEndUL = 0;
+
+   signed long posSL = 0;
+   signed long minPosSL = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec02:
+   ^   - check if a better alignment overlaps
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(posSL = 0; posSL < alnSTPtr->outLenSL; ++posSL)
+   { /*Loop: check for better overlapping alignments*/
+      if(alnSTPtr->scoreArySL[posSL] < scoreSL)
+         continue;
+
+      hitStartUL =
+         refCoord_indexToCoord(
+            alnSTPtr->refLenSI,
+            alnSTPtr->startArySL[posSL]
+         );
+      hitEndUL =
+         refCoord_indexToCoord(
+            alnSTPtr->refLenSI,
+            alnSTPtr->endArySL[posSL]
+         );
+
+      if(hitStartUL <= refEndUL && refStartUL <= hitEndUL)
+         goto getMin_fun10_sec04;
+         /*better alignment at this position*/
+   } /*Loop: check for better overlapping alignments*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec03:
+   ^   - remove lower scoring overlaps and add alignment
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   posSL = 0;
+   while(posSL < alnSTPtr->outLenSL)
+   { /*Loop: remove lower scoring overlaps*/
+      hitStartUL =
+         refCoord_indexToCoord(
+            alnSTPtr->refLenSI,
+            alnSTPtr->startArySL[posSL]
+         );
+      hitEndUL =
+         refCoord_indexToCoord(
+            alnSTPtr->refLenSI,
+            alnSTPtr->endArySL[posSL]
+         );
+
+      if(hitStartUL <= refEndUL && refStartUL <= hitEndUL)
+      { /*If: overlaps; this alignment is better*/
+         --alnSTPtr->outLenSL;
+         alnSTPtr->startArySL[posSL] =
+            alnSTPtr->startArySL[alnSTPtr->outLenSL];
+         alnSTPtr->endArySL[posSL] =
+            alnSTPtr->endArySL[alnSTPtr->outLenSL];
+         alnSTPtr->scoreArySL[posSL] =
+            alnSTPtr->scoreArySL[alnSTPtr->outLenSL];
+      } /*If: overlaps; this alignment is better*/
+
+      else
+         ++posSL;
+   } /*Loop: remove lower scoring overlaps*/
+
+   if(alnSTPtr->outLenSL < alnSTPtr->topKSL)
+      posSL = alnSTPtr->outLenSL++;
+   else
+   { /*Else: full, replace the lowest scoring alignment*/
+      for(posSL = 1; posSL < alnSTPtr->outLenSL; ++posSL)
+      { /*Loop: find lowest scoring alignment*/
+         if(
+              alnSTPtr->scoreArySL[posSL]
+            < alnSTPtr->scoreArySL[minPosSL]
+         ) minPosSL = posSL;
+      } /*Loop: find lowest scoring alignment*/
+
+      posSL = minPosSL;
+   } /*Else: full, replace the lowest scoring alignment*/
+
+   alnSTPtr->startArySL[posSL] = startSL;
+   alnSTPtr->endArySL[posSL] = endSL;
+   alnSTPtr->scoreArySL[posSL] = scoreSL;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec04:
+   ^   - find the new minimum score
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   getMin_fun10_sec04:;
+      if(alnSTPtr->outLenSL < alnSTPtr->topKSL)
+         return alnSTPtr->topMinScoreSL - 1;
+
+      scoreSL = alnSTPtr->scoreArySL[0];
+
+      for(posSL = 1; posSL < alnSTPtr->outLenSL; ++posSL)
+      { /*Loop: find lowest score*/
+         if(alnSTPtr->scoreArySL[posSL] < scoreSL)
+            scoreSL = alnSTPtr->scoreArySL[posSL];
+      } /*Loop: find lowest score*/
+
+      return scoreSL;
+} /*addTop_memwaterScan*/
+
+/*-------------------------------------------------------\
+| Fun11: memwaterScan
 |   - performs a memory efficent Smith Waterman scan
 |     (keep best alignment for each query/reference base)
 |     alignment on a pair of sequences
@@ -923,6 +1098,9 @@ merge_aln_memwaterScan(
 |   - alnSTPtr:
 |     o pointer to aln_memwaterScan structure to hold the
 |       results of the alignment
+|     o if topKSL is > 0, only the topKSL best alignments
+|       scoring at least topMinScoreSL that do not overlap
+|       on the reference are kept (sorted by coordinate)
 |   - settings:
 |     o pointer to an alnSet structure with the gap open,
 |       gap extend, and scoring matrix for the alingment
@@ -940,45 +1118,47 @@ memwaterScan(
    struct aln_memwaterScan *alnSTPtr,/*gets alignment*/
    struct alnSet *settings
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun10 TOC:
+   ' Fun11 TOC:
    '   - performs a memory efficent Smith Waterman scan
    '     (keep best alignment for each query/reference
    '     base) alignment on a pair of sequences
    '  - Run a memory efficent Waterman Smith alignment on
    '    input sequences
-   '  o fun10 sec01:
+   '  o fun11 sec01:
    '    - Variable declerations
-   '  o fun10 sec02:
+   '  o fun11 sec02:
    '    - Allocate memory for alignment
-   '  o fun10 sec03:
+   '  o fun11 sec03:
    '    - Fill in initial negatives for ref
    '  o fun0 sec04:
    '    - Fill the matrix with scores
-   '  o fun10 sec05:
+   '  o fun11 sec05:
    '    - Set up for returing matrix (clean up/wrap up)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec01: Variable declerations
-   ^  o fun10 sec01 sub01:
+   ^ Fun11 Sec01: Variable declerations
+   ^  o fun11 sec01 sub01:
    ^    - Variables dealing with the query and reference
    ^      starting positions
-   ^  o fun10 sec01 sub02:
+   ^  o fun11 sec01 sub02:
    ^    - Variables holding the scores (only two rows)
-   ^  o fun10 sec01 sub03:
+   ^  o fun11 sec01 sub03:
    ^    - Directinol matrix variables
-   ^  o fun10 sec01 sub04:
+   ^  o fun11 sec01 sub04:
    ^    - Variables for building returend alignment array
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun10 Sec01 Sub01:
+   * Fun11 Sec01 Sub01:
    *  - Variables dealing with the query and reference
    *    starting positions
    \*****************************************************/
 
    signed long scoreSL = 0;     /*score to return*/
    signed long bestScoreSL = 0;
+   signed long topCutSL = alnSTPtr->topMinScoreSL - 1;
+      /*score needed to change the top K alignments*/
 
    /*Get start & end of query and reference sequences*/
    signed char *refSeqStr = 0;
@@ -995,7 +1175,7 @@ memwaterScan(
    signed long slQry = 0;
 
    /*****************************************************\
-   * Fun10 Sec01 Sub02:
+   * Fun11 Sec01 Sub02:
    *  - Variables holding the scores (only two rows)
    \*****************************************************/
 
@@ -1005,7 +1185,7 @@ memwaterScan(
    signed long nextSnpScoreSL = 0;/*next match/snp score*/
 
    /*****************************************************\
-   * Fun10 Sec01 Sub03:
+   * Fun11 Sec01 Sub03:
    *  - Directional matrix variables
    \*****************************************************/
 
@@ -1018,18 +1198,18 @@ memwaterScan(
    signed long startSL = refLenSL;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec02:
+   ^ Fun11 Sec02:
    ^  - Allocate memory for alignment
-   ^  o fun10 sec02 sub01:
+   ^  o fun11 sec02 sub01:
    ^    - get lengths and offsets
-   ^  o fun10 sec02 sub02:
+   ^  o fun11 sec02 sub02:
    ^    - output alignment coodinates memory allocation
-   ^  o fun10 sec02 sub03:
+   ^  o fun11 sec02 sub03:
    ^    - alignment rows memory allocate
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun10 Sec02 Sub01:
+   * Fun11 Sec02 Sub01:
    *   - get lengths and offsets
    \****************************************************/
 
@@ -1038,72 +1218,93 @@ memwaterScan(
    alnSTPtr->refOffsetSI = refSTPtr->offsetSL;
    alnSTPtr->qryOffsetSI = qrySTPtr->offsetSL;
 
-   alnSTPtr->outLenSL = refLenSL + qryLenSL;
+   if(alnSTPtr->topKSL > 0)
+      alnSTPtr->outLenSL = alnSTPtr->topKSL;
+   else
+      alnSTPtr->outLenSL = refLenSL + qryLenSL;
 
    /*****************************************************\
-   * Fun10 Sec02 Sub02:
+   * Fun11 Sec02 Sub02:
    *   - output alignment coodinates memory allocation
    \****************************************************/
 
    if(alnSTPtr->outSizeSL < alnSTPtr->outLenSL)
    { /*If: need to resize the alignment coordinates*/
       if(alnSTPtr->startArySL)
-         free(alnSTPtr->startArySL);
+         free_memTag(alnSTPtr->startArySL);
       alnSTPtr->startArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->startArySL)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       if(alnSTPtr->endArySL)
-         free(alnSTPtr->endArySL);
+         free_memTag(alnSTPtr->endArySL);
       alnSTPtr->endArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->endArySL)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       if(alnSTPtr->scoreArySL)
-         free(alnSTPtr->scoreArySL);
+         free_memTag(alnSTPtr->scoreArySL);
       alnSTPtr->scoreArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->scoreArySL)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       alnSTPtr->outSizeSL = alnSTPtr->outLenSL;
    } /*If: need to resize the alignment coordinates*/
 
    /*****************************************************\
-   * Fun10 Sec02 Sub03:
+   * Fun11 Sec02 Sub03:
    *   - alignment rows memory allocate
    \****************************************************/
 
    if(alnSTPtr->rowSizeSI < refLenSL)
    { /*If: need more memory for alignment rows*/
       if(alnSTPtr->indexRowSL)
-         free(alnSTPtr->indexRowSL);
+         free_memTag(alnSTPtr->indexRowSL);
       alnSTPtr->indexRowSL =
-         malloc((refLenSL + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSL + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->indexRowSL)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       if(alnSTPtr->scoreRowSL)
-         free(alnSTPtr->scoreRowSL);
+         free_memTag(alnSTPtr->scoreRowSL);
       alnSTPtr->scoreRowSL =
-         malloc((refLenSL + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSL + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->scoreRowSL)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       if(alnSTPtr->dirRowSC)
-         free(alnSTPtr->dirRowSC);
+         free_memTag(alnSTPtr->dirRowSC);
       alnSTPtr->dirRowSC =
-         malloc((refLenSL + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSL + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->dirRowSC)
-         goto memErr_fun10_sec05_sub03;
+         goto memErr_fun11_sec05_sub03;
 
       alnSTPtr->rowSizeSI = refLenSL;
    } /*If: need more memory for alignment rows*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec03:
+   ^ Fun11 Sec03:
    ^  - initialize all values
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1114,6 +1315,9 @@ memwaterScan(
       alnSTPtr->scoreArySL[indexSL] = -1;
    } /*loop; till have initalized the query scores*/
 
+   if(alnSTPtr->topKSL > 0)
+      alnSTPtr->outLenSL = 0; /*no top alignments yet*/
+
    for(indexSL = 0; indexSL <= refLenSL; ++indexSL)
    { /*loop; till have initalized the first row*/
       alnSTPtr->dirRowSC[indexSL] = def_mvStop_alnDefs;
@@ -1122,24 +1326,24 @@ memwaterScan(
    } /*loop; till have initalized the first row*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec04:
+   ^ Fun11 Sec04:
    ^  - Fill the matrix with scores
-   ^  o fun10 sec04 sub01:
+   ^  o fun11 sec04 sub01:
    ^    - Final set up before scoring the matrix
-   ^  o fun10 sec04 sub02:
+   ^  o fun11 sec04 sub02:
    ^    - get snp and ins scores + start loop
-   ^  o fun10 sec04 sub03:
+   ^  o fun11 sec04 sub03:
    ^    - find high score
-   ^  o fun10 sec04 sub04:
+   ^  o fun11 sec04 sub04:
    ^    - check if keep score (score > 0)
-   ^  o fun10 sec04 sub05:
+   ^  o fun11 sec04 sub05:
    ^    - find next deletion score and move to next index
-   ^  o fun10 sec04 sub07:
+   ^  o fun11 sec04 sub07:
    ^    - prepare to score the next row in the matrix
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun10 Sec04 Sub01:
+   * Fun11 Sec04 Sub01:
    *  - Final set up before scoring the matrix
    \*****************************************************/
 
@@ -1160,7 +1364,7 @@ memwaterScan(
       */
 
    /*****************************************************\
-   * Fun10 Sec04 Sub02:
+   * Fun11 Sec04 Sub02:
    *  - get snp and ins scores + start loop
    \*****************************************************/
 
@@ -1194,7 +1398,7 @@ memwaterScan(
          #endif
 
          /***********************************************\
-         * Fun10 Sec04 Sub03:
+         * Fun11 Sec04 Sub03:
          *   - find high score
          \***********************************************/
 
@@ -1253,7 +1457,7 @@ memwaterScan(
          ); /*find if del is best (5 Op)*/
             
          /***********************************************\
-         * Fun10 Sec04 Sub04:
+         * Fun11 Sec04 Sub04:
          *   - check if keep score (score > 0)
          \***********************************************/
 
@@ -1266,6 +1470,23 @@ memwaterScan(
             /* branchless method is slower here*/
          }
 
+         else if(alnSTPtr->topKSL > 0)
+         { /*Else If: only keeping the top K alignments*/
+            scoreSL = alnSTPtr->scoreRowSL[slRef];
+
+            if(scoreSL > topCutSL)
+               topCutSL =
+                  addTop_memwaterScan(
+                     alnSTPtr,
+                     alnSTPtr->indexRowSL[slRef],
+                     indexSL,
+                     scoreSL
+                  ); /*may be a top alignment*/
+
+            if(scoreSL > bestScoreSL)
+               bestScoreSL = scoreSL;
+         } /*Else If: only keeping the top K alignments*/
+
          else
          { /*Else: check if have new high score*/
             scoreSL = alnSTPtr->scoreRowSL[slRef];
@@ -1298,7 +1519,7 @@ memwaterScan(
          } /*Else: check if have new high score*/
 
          /***********************************************\
-         * Fun10 Sec04 Sub05:
+         * Fun11 Sec04 Sub05:
          *   - find next deletion score and move to next
          \***********************************************/
 
@@ -1318,7 +1539,7 @@ memwaterScan(
       } /*loop; compare one query to one reference base*/
 
      /***************************************************\
-     *  Fun10 Sec04 Sub07:
+     *  Fun11 Sec04 Sub07:
      *   - prepare for the next round
      \***************************************************/
 
@@ -1333,22 +1554,25 @@ memwaterScan(
    } /*loop; compare query base against all ref bases*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec05:
+   ^ Fun11 Sec05:
    ^  - set up for returing the matrix (clean up/wrap up)
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   goto cleanUp_fun10_sec05;
+   if(alnSTPtr->topKSL > 0)
+      refCoordSort_aln_memwaterScan(alnSTPtr);
+
+   goto cleanUp_fun11_sec05;
 
-   memErr_fun10_sec05_sub03:;
+   memErr_fun11_sec05_sub03:;
       bestScoreSL = -1;
-      goto cleanUp_fun10_sec05;
+      goto cleanUp_fun11_sec05;
 
-   cleanUp_fun10_sec05:;
+   cleanUp_fun11_sec05:;
       return bestScoreSL;
 } /*memwaterScan*/
 
 /*-------------------------------------------------------\
-| Fun11: simple_memwaterScan
+| Fun12: simple_memwaterScan
 |   - performs a memory efficent Smith Waterman scan
 |     (keep best alignment for each query/reference base)
 |     alignment on a pair of sequences
@@ -1381,39 +1605,39 @@ simple_memwaterScan(
    signed int refLenSI,      /*reference sequence length*/
    struct aln_memwaterScan *alnSTPtr /*gets alignment*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun11 TOC: simple_memwaterScan
+   ' Fun12 TOC: simple_memwaterScan
    '   - performs a memory efficent Smith Waterman scan
    '     (keep best alignment for each query/reference
    '     base) alignment on a pair of sequences
    '   - simple means no settings or seqST structure used
    '     and no match matrix
-   '  o fun11 sec01:
+   '  o fun12 sec01:
    '    - Variable declerations
-   '  o fun11 sec02:
+   '  o fun12 sec02:
    '    - Allocate memory for alignment
-   '  o fun11 sec03:
+   '  o fun12 sec03:
    '    - Fill in initial negatives for ref
    '  o fun0 sec04:
    '    - Fill the matrix with scores
-   '  o fun11 sec05:
+   '  o fun12 sec05:
    '    - Set up for returing matrix (clean up/wrap up)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun11 Sec01: Variable declerations
-   ^  o fun11 sec01 sub01:
+   ^ Fun12 Sec01: Variable declerations
+   ^  o fun12 sec01 sub01:
    ^    - Variables dealing with the query and reference
    ^      starting positions
-   ^  o fun11 sec01 sub02:
+   ^  o fun12 sec01 sub02:
    ^    - Variables holding the scores (only two rows)
-   ^  o fun11 sec01 sub03:
+   ^  o fun12 sec01 sub03:
    ^    - Directinol matrix variables
-   ^  o fun11 sec01 sub04:
+   ^  o fun12 sec01 sub04:
    ^    - Variables for building returend alignment array
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun11 Sec01 Sub01:
+   * Fun12 Sec01 Sub01:
    *  - Variables dealing with the query and reference
    *    starting positions
    \*****************************************************/
@@ -1426,7 +1650,7 @@ simple_memwaterScan(
    signed int siQry = 0;
 
    /*****************************************************\
-   * Fun11 Sec01 Sub02:
+   * Fun12 Sec01 Sub02:
    *  - Variables holding the scores (only two rows)
    \*****************************************************/
 
@@ -1436,7 +1660,7 @@ simple_memwaterScan(
    signed long nextSnpScoreSL = 0;/*next match/snp score*/
 
    /*****************************************************\
-   * Fun11 Sec01 Sub03:
+   * Fun12 Sec01 Sub03:
    *  - Directional matrix variables
    \*****************************************************/
 
@@ -1452,18 +1676,18 @@ simple_memwaterScan(
    signed int delArySI[4];
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun11 Sec02:
+   ^ Fun12 Sec02:
    ^  - Allocate memory for alignment
-   ^  o fun11 sec02 sub01:
+   ^  o fun12 sec02 sub01:
    ^    - get lengths and offsets
-   ^  o fun11 sec02 sub02:
+   ^  o fun12 sec02 sub02:
    ^    - output alignment coodinates memory allocation
-   ^  o fun11 sec02 sub03:
+   ^  o fun12 sec02 sub03:
    ^    - alignment rows memory allocate
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun11 Sec02 Sub01:
+   * Fun12 Sec02 Sub01:
    *   - get lengths and offsets
    \****************************************************/
 
@@ -1485,69 +1709,87 @@ simple_memwaterScan(
    delArySI[def_mvIns_alnDefs] = def_gapOpen_alnDefs;
 
    /*****************************************************\
-   * Fun11 Sec02 Sub02:
+   * Fun12 Sec02 Sub02:
    *   - output alignment coodinates memory allocation
    \****************************************************/
 
    if(alnSTPtr->outSizeSL < alnSTPtr->outLenSL)
    { /*If: need to resize the alignment coordinates*/
       if(alnSTPtr->startArySL)
-         free(alnSTPtr->startArySL);
+         free_memTag(alnSTPtr->startArySL);
       alnSTPtr->startArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->startArySL)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       if(alnSTPtr->endArySL)
-         free(alnSTPtr->endArySL);
+         free_memTag(alnSTPtr->endArySL);
       alnSTPtr->endArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->endArySL)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       if(alnSTPtr->scoreArySL)
-         free(alnSTPtr->scoreArySL);
+         free_memTag(alnSTPtr->scoreArySL);
       alnSTPtr->scoreArySL =
-         malloc(alnSTPtr->outLenSL * sizeof(signed long));
+         malloc_memTag(
+            alnSTPtr->outLenSL * sizeof(signed long),
+            def_hitMemwaterScan_memTag
+         );
       if(! alnSTPtr->scoreArySL)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       alnSTPtr->outSizeSL = alnSTPtr->outLenSL;
    } /*If: need to resize the alignment coordinates*/
 
    /*****************************************************\
-   * Fun11 Sec02 Sub03:
+   * Fun12 Sec02 Sub03:
    *   - alignment rows memory allocate
    \****************************************************/
 
    if(alnSTPtr->rowSizeSI < refLenSI)
    { /*If: need more memory for alignment rows*/
       if(alnSTPtr->indexRowSL)
-         free(alnSTPtr->indexRowSL);
+         free_memTag(alnSTPtr->indexRowSL);
       alnSTPtr->indexRowSL =
-         malloc((refLenSI + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSI + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->indexRowSL)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       if(alnSTPtr->scoreRowSL)
-         free(alnSTPtr->scoreRowSL);
+         free_memTag(alnSTPtr->scoreRowSL);
       alnSTPtr->scoreRowSL =
-         malloc((refLenSI + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSI + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->scoreRowSL)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       if(alnSTPtr->dirRowSC)
-         free(alnSTPtr->dirRowSC);
+         free_memTag(alnSTPtr->dirRowSC);
       alnSTPtr->dirRowSC =
-         malloc((refLenSI + 1) * sizeof(signed long));
+         malloc_memTag(
+            (refLenSI + 1) * sizeof(signed long),
+            def_rowMemwaterScan_memTag
+         );
       if(! alnSTPtr->dirRowSC)
-         goto memErr_fun11_sec05_sub03;
+         goto memErr_fun12_sec05_sub03;
 
       alnSTPtr->rowSizeSI = refLenSI;
    } /*If: need more memory for alignment rows*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun11 Sec03:
+   ^ Fun12 Sec03:
    ^  - initialize all values
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1566,24 +1808,24 @@ simple_memwaterScan(
    } /*loop; till have initalized the first row*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun11 Sec04:
+   ^ Fun12 Sec04:
    ^  - Fill the matrix with scores
-   ^  o fun11 sec04 sub01:
+   ^  o fun12 sec04 sub01:
    ^    - Final set up before scoring the matrix
-   ^  o fun11 sec04 sub02:
+   ^  o fun12 sec04 sub02:
    ^    - get snp and ins scores + start loop
-   ^  o fun11 sec04 sub03:
+   ^  o fun12 sec04 sub03:
    ^    - find high score
-   ^  o fun11 sec04 sub04:
+   ^  o fun12 sec04 sub04:
    ^    - check if keep score (score > 0)
-   ^  o fun11 sec04 sub05:
+   ^  o fun12 sec04 sub05:
    ^    - find next deletion score and move to next index
-   ^  o fun11 sec04 sub07:
+   ^  o fun12 sec04 sub07:
    ^    - prepare to score the next row in the matrix
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun11 Sec04 Sub01:
+   * Fun12 Sec04 Sub01:
    *  - Final set up before scoring the matrix
    \*****************************************************/
 
@@ -1603,7 +1845,7 @@ simple_memwaterScan(
       */
 
    /*****************************************************\
-   * Fun11 Sec04 Sub02:
+   * Fun12 Sec04 Sub02:
    *  - get snp and ins scores + start loop
    \*****************************************************/
 
@@ -1639,7 +1881,7 @@ simple_memwaterScan(
          #endif
 
          /***********************************************\
-         * Fun11 Sec04 Sub03:
+         * Fun12 Sec04 Sub03:
          *   - find high score
          \***********************************************/
 
@@ -1698,7 +1940,7 @@ simple_memwaterScan(
          ); /*find if del is best (5 Op)*/
             
          /***********************************************\
-         * Fun11 Sec04 Sub04:
+         * Fun12 Sec04 Sub04:
          *   - check if keep score (score > 0)
          \***********************************************/
 
@@ -1743,7 +1985,7 @@ simple_memwaterScan(
          } /*Else: check if have new high score*/
 
          /***********************************************\
-         * Fun11 Sec04 Sub05:
+         * Fun12 Sec04 Sub05:
          *   - find next deletion score and move to next
          \***********************************************/
 
@@ -1760,7 +2002,7 @@ simple_memwaterScan(
       } /*loop; compare one query to one reference base*/
 
      /***************************************************\
-     *  Fun11 Sec04 Sub07:
+     *  Fun12 Sec04 Sub07:
      *   - prepare for the next round
      \***************************************************/
 
@@ -1775,17 +2017,17 @@ simple_memwaterScan(
    } /*loop; compare query base against all ref bases*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun11 Sec05:
+   ^ Fun12 Sec05:
    ^  - set up for returing the matrix (clean up/wrap up)
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   goto cleanUp_fun11_sec05;
+   goto cleanUp_fun12_sec05;
 
-   memErr_fun11_sec05_sub03:;
+   memErr_fun12_sec05_sub03:;
       bestScoreSL = -1;
-      goto cleanUp_fun11_sec05;
+      goto cleanUp_fun12_sec05;
 
-   cleanUp_fun11_sec05:;
+   cleanUp_fun12_sec05:;
       return bestScoreSL;
 } /*simple_memwaterScan*/
 
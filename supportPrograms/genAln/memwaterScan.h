@@ -30,11 +30,13 @@
 '   o fun09: merge_aln_memwaterScan
 '     - merges one aln_memwaterScan struct into another
 '       aln_memwaterScan struct
-'   o fun10 memwaterScan:
+'   o fun11 memwaterScan:
 '     - performs a memory efficent Smith Waterman scan
 '       (keep best alignment for each query/reference base)
 '       alignment on a pair of sequences
-'   o fun11: simple_memwaterScan
+'     - keeps the top K non-overlapping alignments
+'       instead if topKSL is set
+'   o fun12: simple_memwaterScan
 '     - performs a memory efficent Smith Waterman scan
 '       (keep best alignment for each query/reference
 '       base) alignment on a pair of sequences
@@ -85,6 +87,13 @@ typedef struct aln_memwaterScan
    signed long outSizeSL;
    signed long outLenSL;
 
+   /*top K mode (set by user, not blanked); memwaterScan
+   `  only keeps the topKSL best alignments that do not
+   `  overlap on the reference (0 is best for each base)
+   */
+   signed long topKSL;
+   signed long topMinScoreSL; /*min score to keep hit*/
+
    /*general variables used by memwaterScan and its
    `  supporting functions
    */
@@ -304,7 +313,7 @@ merge_aln_memwaterScan(
 );
 
 /*-------------------------------------------------------\
-| Fun10: memwaterScan
+| Fun11: memwaterScan
 |   - performs a memory efficent Smith Waterman scan
 |     (keep best alignment for each query/reference base)
 |     alignment on a pair of sequences
@@ -320,6 +329,9 @@ merge_aln_memwaterScan(
 |   - alnSTPtr:
 |     o pointer to aln_memwaterScan structure to hold the
 |       results of the alignment
+|     o if topKSL is > 0, only the topKSL best alignments
+|       scoring at least topMinScoreSL that do not overlap
+|       on the reference are kept (sorted by coordinate)
 |   - settings:
 |     o pointer to an alnSet structure with the gap open,
 |       gap extend, and scoring matrix for the alingment
@@ -339,7 +351,7 @@ memwaterScan(
 );
 
 /*-------------------------------------------------------\
-| Fun11: simple_memwaterScan
+| Fun12: simple_memwaterScan
 |   - performs a memory efficent Smith Waterman scan
 |     (keep best alignment for each query/reference base)
 |     alignment on a pair of sequences
@@ -0,0 +1,704 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' seedScan SOF: Start Of File
+'   - finds the reference windows (loci) to run
+'     memwaterScan on using exact kmer seeds that are
+'     chained with kmerChain_mapRead (seed-and-chain)
+'   o header:
+'     - included libraries
+'   o fun01: blank_seedScan
+'     - blanks (sets lengths to 0) a seedScan struct
+'   o fun02: init_seedScan
+'     - initializes (sets defaults and arrays to 0) a
+'       seedScan struct
+'   o fun03: freeStack_seedScan
+'     - frees the variables in a seedScan struct
+'   o fun04: freeHeap_seedScan
+'     - frees a seedScan struct
+'   o fun05: setRef_seedScan
+'     - makes the sorted kmer index for a reference
+'   o .c fun06: addWin_seedScan
+'     - adds a window to a seedScan struct (merges with
+'       the last window if they overlap)
+'   o .c fun07: sortWin_seedScan
+'     - sorts the windows in a seedScan struct by start
+'   o fun08: window_seedScan
+'     - finds the reference windows a query maps to
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include "seedScan.h"
+
+#include "../genLib/memTag.h"
+#include "../genBio/seqST.h"
+#include "../genBio/kmerFun.h"
+
+#include "mapRead.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden files
+!   o std #include <stdio.h>
+!   o .c  #include "../genLib/base10str.h"
+!   o .c  #include "../genLib/ulCp.h"
+!   o .c  #include "../genLib/fileFun.h"
+!   o .c  #include "../genLib/numToStr.h"
+!   o .c  #include "../genLib/charCp.h"
+!   o .c  #include "../genLib/shellSort.h"
+!   o .c  #include "../genBio/samEntry.h"
+!   o .c  #include "alnSet.h"
+!   o .c  #include "indexToCoord.h"
+!   o .c  #include "dirMatrix.h"
+!   o .c  #include "needle.h"
+!   o .c  #include "water.h"
+!   o .h  #include "../genBio/kmerBit.h"
+!   o .h  #include "../genBio/ntTo5Bit.h"
+!   o .h  #include "../genLib/genMath.h"
+!   o .h  #include "../genLib/endLine.h"
+!   o .h  #include "alnDefs.h"
+!   o .h  #include "defsMapRead.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*-------------------------------------------------------\
+| Fun01: blank_seedScan
+|   - blanks (sets lengths to 0) a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenWinSL in seedSTPtr to be 0 and blanks
+|       chainsSTPtr
+|     o reference kmers and settings are not changed
+\-------------------------------------------------------*/
+void
+blank_seedScan(
+   struct seedScan *seedSTPtr
+){
+   if(! seedSTPtr)
+      return;
+
+   seedSTPtr->lenWinSL = 0;
+   blank_chains_mapRead(seedSTPtr->chainsSTPtr);
+} /*blank_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun02: init_seedScan
+|   - initializes (sets defaults and arrays to 0) a
+|     seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in seedSTPtr to be 0 (null) and the
+|       settings to their defaults
+\-------------------------------------------------------*/
+void
+init_seedScan(
+   struct seedScan *seedSTPtr
+){
+   if(! seedSTPtr)
+      return;
+
+   seedSTPtr->kmerLenUC = def_kmerLen_seedScan;
+   seedSTPtr->minChainSI = def_minChain_seedScan;
+   seedSTPtr->padPercF = def_padPerc_seedScan;
+
+   seedSTPtr->refKmerArySI = 0;
+   seedSTPtr->refIndexArySI = 0;
+   seedSTPtr->lenRefSI = 0;
+   seedSTPtr->sizeRefSI = 0;
+   seedSTPtr->refLenSL = 0;
+   seedSTPtr->tblSTPtr = 0;
+
+   seedSTPtr->qryKmerArySI = 0;
+   seedSTPtr->sizeQrySI = 0;
+
+   seedSTPtr->chainsSTPtr = 0;
+
+   seedSTPtr->startArySL = 0;
+   seedSTPtr->endArySL = 0;
+   seedSTPtr->sizeWinSL = 0;
+
+   blank_seedScan(seedSTPtr);
+} /*init_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_seedScan
+|   - frees the variables in a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer with variables to free
+| Output:
+|   - Modifies:
+|     o frees all arrays in seedSTPtr and initializes
+\-------------------------------------------------------*/
+void
+freeStack_seedScan(
+   struct seedScan *seedSTPtr
+){
+   if(! seedSTPtr)
+      return;
+
+   /*kmer arrays are allocated by seqToKmer_kmerFun*/
+   if(seedSTPtr->refKmerArySI)
+      free(seedSTPtr->refKmerArySI);
+   if(seedSTPtr->qryKmerArySI)
+      free(seedSTPtr->qryKmerArySI);
+
+   if(seedSTPtr->refIndexArySI)
+      free_memTag(seedSTPtr->refIndexArySI);
+
+   /*allocated with malloc (same as mapRead)*/
+   if(seedSTPtr->tblSTPtr)
+      freeHeap_kmerTbl_mapRead(seedSTPtr->tblSTPtr);
+
+   if(seedSTPtr->chainsSTPtr)
+      freeHeap_chains_mapRead(seedSTPtr->chainsSTPtr);
+
+   if(seedSTPtr->startArySL)
+      free_memTag(seedSTPtr->startArySL);
+   if(seedSTPtr->endArySL)
+      free_memTag(seedSTPtr->endArySL);
+
+   init_seedScan(seedSTPtr);
+} /*freeStack_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_seedScan
+|   - frees a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to free
+| Output:
+|   - Modifies:
+|     o frees seedSTPtr; you must set the pointer to null
+\-------------------------------------------------------*/
+void
+freeHeap_seedScan(
+   struct seedScan *seedSTPtr
+){
+   if(! seedSTPtr)
+      return;
+
+   freeStack_seedScan(seedSTPtr);
+   free(seedSTPtr);
+} /*freeHeap_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun05: setRef_seedScan
+|   - makes the sorted kmer index for a reference
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to add reference kmers to
+|       (uses kmerLenUC for the kmer length)
+|   - refSTPtr:
+|     o seqST struct with the reference sequence
+|       * must be converted with seqToIndex_alnSet
+| Output:
+|   - Modifies:
+|     o refKmerArySI, refIndexArySI, lenRefSI, sizeRefSI,
+|       and refLenSL in seedSTPtr to have the reference
+|     o tblSTPtr in seedSTPtr to have the kmer lookup
+|       table for refIndexArySI (made if it is null)
+|     o chainsSTPtr in seedSTPtr is made if it is null
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_seedScan for memory errors
+\-------------------------------------------------------*/
+signed char
+setRef_seedScan(
+   struct seedScan *seedSTPtr,
+   struct seqST *refSTPtr
+){
+   signed int *tmpSIPtr = 0;
+
+   blank_seedScan(seedSTPtr);
+   seedSTPtr->refLenSL = refSTPtr->seqLenSL;
+   seedSTPtr->lenRefSI = 0;
+
+   if(! seedSTPtr->chainsSTPtr)
+   { /*If: need to make the chains struct*/
+      seedSTPtr->chainsSTPtr = mk_chains_mapRead(64, 64);
+      if(! seedSTPtr->chainsSTPtr)
+         goto memErr_fun05;
+   } /*If: need to make the chains struct*/
+
+   if(refSTPtr->seqLenSL < seedSTPtr->kmerLenUC)
+      return 0; /*no kmers in reference*/
+
+   seedSTPtr->lenRefSI =
+      seqToKmer_kmerFun(
+         refSTPtr->seqStr,
+         (signed int) refSTPtr->seqLenSL,
+         &seedSTPtr->refKmerArySI,
+         &seedSTPtr->sizeRefSI,
+         seedSTPtr->kmerLenUC
+      );
+   if(! seedSTPtr->lenRefSI)
+      goto memErr_fun05;
+
+   if(seedSTPtr->refIndexArySI)
+      tmpSIPtr =
+         realloc_memTag(
+            seedSTPtr->refIndexArySI,
+            seedSTPtr->lenRefSI * sizeof(signed int),
+            def_seedScan_memTag
+         );
+   else
+      tmpSIPtr =
+         malloc_memTag(
+            seedSTPtr->lenRefSI * sizeof(signed int),
+            def_seedScan_memTag
+         );
+   if(! tmpSIPtr)
+      goto memErr_fun05;
+   seedSTPtr->refIndexArySI = tmpSIPtr;
+
+   sortKmerIndex_mapRead(
+      seedSTPtr->refKmerArySI,
+      seedSTPtr->refIndexArySI,
+      seedSTPtr->lenRefSI
+   );
+
+   if(! seedSTPtr->tblSTPtr)
+   { /*If: need to make the kmer table*/
+      seedSTPtr->tblSTPtr =
+         malloc(sizeof(struct kmerTbl_mapRead));
+      if(! seedSTPtr->tblSTPtr)
+         goto memErr_fun05;
+      init_kmerTbl_mapRead(seedSTPtr->tblSTPtr);
+   } /*If: need to make the kmer table*/
+
+   if(
+      addRef_kmerTbl_mapRead(
+         seedSTPtr->tblSTPtr,
+         seedSTPtr->kmerLenUC,
+         seedSTPtr->refKmerArySI,
+         seedSTPtr->refIndexArySI,
+         seedSTPtr->lenRefSI
+      )
+   ) goto memErr_fun05;
+
+   return 0;
+
+   memErr_fun05:;
+      seedSTPtr->lenRefSI = 0;
+      return def_memErr_seedScan;
+} /*setRef_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun06: addWin_seedScan
+|   - adds a window to a seedScan struct (merges with the
+|     last window if they overlap)
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to add the window to
+|   - startSL:
+|     o first reference base (index 0) in the window
+|   - endSL:
+|     o last reference base (index 0) in the window
+| Output:
+|   - Modifies:
+|     o startArySL, endArySL, and lenWinSL in seedSTPtr
+|       to have the window (clamped to the reference)
+|     o sizeWinSL in seedSTPtr if arrays were resized
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_seedScan for memory errors
+\-------------------------------------------------------*/
+signed char
+addWin_seedScan(
+   struct seedScan *seedSTPtr,
+   signed long startSL,
+   signed long endSL
+){
+   signed long posSL = seedSTPtr->lenWinSL - 1;
+   signed long *tmpSLPtr = 0;
+
+   if(startSL < 0)
+      startSL = 0;
+   if(endSL >= seedSTPtr->refLenSL)
+      endSL = seedSTPtr->refLenSL - 1;
+
+   if(
+         posSL >= 0
+      && startSL <= seedSTPtr->endArySL[posSL]
+      && endSL >= seedSTPtr->startArySL[posSL]
+   ){ /*If: overlaps the last window; merge*/
+      if(startSL < seedSTPtr->startArySL[posSL])
+         seedSTPtr->startArySL[posSL] = startSL;
+      if(endSL > seedSTPtr->endArySL[posSL])
+         seedSTPtr->endArySL[posSL] = endSL;
+
+      return 0;
+   }  /*If: overlaps the last window; merge*/
+
+   if(seedSTPtr->lenWinSL >= seedSTPtr->sizeWinSL)
+   { /*If: need more memory*/
+      posSL = (seedSTPtr->sizeWinSL << 1) + 16;
+
+      if(seedSTPtr->startArySL)
+         tmpSLPtr =
+            realloc_memTag(
+               seedSTPtr->startArySL,
+               posSL * sizeof(signed long),
+               def_seedScan_memTag
+            );
+      else
+         tmpSLPtr =
+            malloc_memTag(
+               posSL * sizeof(signed long),
+               def_seedScan_memTag
+            );
+      if(! tmpSLPtr)
+         return def_memErr_seedScan;
+      seedSTPtr->startArySL = tmpSLPtr;
+
+      if(seedSTPtr->endArySL)
+         tmpSLPtr =
+            realloc_memTag(
+               seedSTPtr->endArySL,
+               posSL * sizeof(signed long),
+               def_seedScan_memTag
+            );
+      else
+         tmpSLPtr =
+            malloc_memTag(
+               posSL * sizeof(signed long),
+               def_seedScan_memTag
+            );
+      if(! tmpSLPtr)
+         return def_memErr_seedScan;
+      seedSTPtr->endArySL = tmpSLPtr;
+
+      seedSTPtr->sizeWinSL = posSL;
+   } /*If: need more memory*/
+
+   seedSTPtr->startArySL[seedSTPtr->lenWinSL] = startSL;
+   seedSTPtr->endArySL[seedSTPtr->lenWinSL] = endSL;
+   ++seedSTPtr->lenWinSL;
+
+   return 0;
+} /*addWin_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun07: sortWin_seedScan
+|   - sorts the windows in a seedScan struct by start
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer with windows to sort
+| Output:
+|   - Modifies:
+|     o startArySL and endArySL in seedSTPtr to be sorted
+|       by window start (shell sort)
+\-------------------------------------------------------*/
+void
+sortWin_seedScan(
+   struct seedScan *seedSTPtr
+){
+   signed long subSL = 1;
+   signed long posSL = 0;
+   signed long lastSL = 0;
+   signed long startSL = 0;
+   signed long endSL = 0;
+
+   /*Recursion formsia: h[0] = 1, h[n] = 3 * h[n - 1] +1*/
+   while(subSL < seedSTPtr->lenWinSL)
+      subSL = (3 * subSL) + 1;
+
+   while(subSL > 0)
+   { /*Loop: all rounds*/
+      for(
+         posSL = subSL;
+         posSL < seedSTPtr->lenWinSL;
+         ++posSL
+      ){ /*Loop: insertion sort each sub array*/
+         startSL = seedSTPtr->startArySL[posSL];
+         endSL = seedSTPtr->endArySL[posSL];
+         lastSL = posSL;
+
+         while(
+               lastSL >= subSL
+            && seedSTPtr->startArySL[lastSL - subSL]
+                > startSL
+         ){ /*Loop: move larger starts up*/
+            seedSTPtr->startArySL[lastSL] =
+               seedSTPtr->startArySL[lastSL - subSL];
+            seedSTPtr->endArySL[lastSL] =
+               seedSTPtr->endArySL[lastSL - subSL];
+            lastSL -= subSL;
+         } /*Loop: move larger starts up*/
+
+         seedSTPtr->startArySL[lastSL] = startSL;
+         seedSTPtr->endArySL[lastSL] = endSL;
+      } /*Loop: insertion sort each sub array*/
+
+      subSL = (subSL - 1) / 3; /*Move to next round*/
+   } /*Loop: all rounds*/
+} /*sortWin_seedScan*/
+
+/*-------------------------------------------------------\
+| Fun08: window_seedScan
+|   - finds the reference windows a query maps to
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer with the reference kmers
+|       (from setRef_seedScan) to find windows in
+|   - qrySTPtr:
+|     o seqST struct with the query sequence
+|       * must be converted with seqToIndex_alnSet
+| Output:
+|   - Modifies:
+|     o chainsSTPtr in seedSTPtr to have the seed chains
+|     o startArySL, endArySL, and lenWinSL in seedSTPtr
+|       to have the windows to align the query to
+|       * each window covers the query projected from a
+|         chain (plus padPercF of the query length on
+|         both ends)
+|       * overlapping windows are merged
+|       * windows are sorted by reference start
+|   - Returns:
+|     o number of windows (0 if no seeds were found)
+|     o def_memErr_seedScan for memory errors
+\-------------------------------------------------------*/
+signed long
+window_seedScan(
+   struct seedScan *seedSTPtr,
+   struct seqST *qrySTPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun08 TOC:
+   '   - finds the reference windows a query maps to
+   '   o fun08 sec01:
+   '     - variable declarations
+   '   o fun08 sec02:
+   '     - get query kmers and chain them to the reference
+   '   o fun08 sec03:
+   '     - convert chains to windows
+   '   o fun08 sec04:
+   '     - sort and merge overlapping windows
+   '   o fun08 sec05:
+   '     - return the number of windows
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun08 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed int lenQrySI = 0;   /*number of query kmers*/
+   signed int siChain = 0;
+
+   signed long padSL = 0;     /*extra bases for indels*/
+   signed long startSL = 0;   /*start of window*/
+   signed long endSL = 0;     /*end of window*/
+   signed long posSL = 0;
+
+   struct chains_mapRead *chainsSTPtr =
+      seedSTPtr->chainsSTPtr;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun08 Sec02:
+   ^   - get query kmers and chain them to the reference
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   blank_seedScan(seedSTPtr);
+
+   if(! seedSTPtr->refLenSL)
+      return 0; /*no reference*/
+
+   padSL = qrySTPtr->seqLenSL * seedSTPtr->padPercF;
+   padSL += seedSTPtr->kmerLenUC;
+
+   if(
+         qrySTPtr->seqLenSL < seedSTPtr->kmerLenUC
+      || seedSTPtr->lenRefSI <= 0
+   ){ /*If: to short to seed; align to everything*/
+      if(addWin_seedScan(seedSTPtr,0,seedSTPtr->refLenSL))
+         goto memErr_fun08_sec05;
+      goto ret_fun08_sec05;
+   }  /*If: to short to seed; align to everything*/
+
+   lenQrySI =
+      seqToKmer_kmerFun(
+         qrySTPtr->seqStr,
+         (signed int) qrySTPtr->seqLenSL,
+         &seedSTPtr->qryKmerArySI,
+         &seedSTPtr->sizeQrySI,
+         seedSTPtr->kmerLenUC
+      );
+   if(! lenQrySI)
+      goto memErr_fun08_sec05;
+
+   if(
+      kmerChain_mapRead(
+         chainsSTPtr,
+         seedSTPtr->minChainSI,
+         seedSTPtr->kmerLenUC,
+         seedSTPtr->qryKmerArySI,
+         lenQrySI,
+         seedSTPtr->refKmerArySI,
+         seedSTPtr->refIndexArySI,
+         seedSTPtr->tblSTPtr,
+         seedSTPtr->lenRefSI,
+         0
+      )
+   ) goto memErr_fun08_sec05;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun08 Sec03:
+   ^   - convert chains to windows
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(
+      siChain = 0;
+      siChain < chainsSTPtr->lenChainSI;
+      ++siChain
+   ){ /*Loop: convert chains to windows*/
+      /*project query onto the chains diagonal*/
+      startSL = chainsSTPtr->refArySI[siChain];
+      startSL -= chainsSTPtr->qryArySI[siChain];
+      endSL = startSL + qrySTPtr->seqLenSL - 1;
+
+      startSL -= padSL;
+      endSL += padSL;
+
+      if(addWin_seedScan(seedSTPtr, startSL, endSL))
+         goto memErr_fun08_sec05;
+   } /*Loop: convert chains to windows*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun08 Sec04:
+   ^   - sort and merge overlapping windows
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(seedSTPtr->lenWinSL < 2)
+      goto ret_fun08_sec05;
+
+   sortWin_seedScan(seedSTPtr);
+
+   posSL = 0; /*last kept window*/
+
+   for(
+      startSL = 1;
+      startSL < seedSTPtr->lenWinSL;
+      ++startSL
+   ){ /*Loop: merge overlapping windows*/
+      if(
+           seedSTPtr->startArySL[startSL]
+        <= seedSTPtr->endArySL[posSL]
+      ){ /*If: overlaps the last kept window*/
+         if(
+              seedSTPtr->endArySL[startSL]
+            > seedSTPtr->endArySL[posSL]
+         ) seedSTPtr->endArySL[posSL] =
+              seedSTPtr->endArySL[startSL];
+      }  /*If: overlaps the last kept window*/
+
+      else
+      { /*Else: new window*/
+         ++posSL;
+         seedSTPtr->startArySL[posSL] =
+            seedSTPtr->startArySL[startSL];
+         seedSTPtr->endArySL[posSL] =
+            seedSTPtr->endArySL[startSL];
+      } /*Else: new window*/
+   } /*Loop: merge overlapping windows*/
+
+   seedSTPtr->lenWinSL = posSL + 1;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun08 Sec05:
+   ^   - return the number of windows
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   ret_fun08_sec05:;
+      return seedSTPtr->lenWinSL;
+
+   memErr_fun08_sec05:;
+      seedSTPtr->lenWinSL = 0;
+      return def_memErr_seedScan;
+} /*window_seedScan*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2024 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -0,0 +1,279 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' seedScan SOF: Start Of File
+'   - finds the reference windows (loci) to run
+'     memwaterScan on using exact kmer seeds that are
+'     chained with kmerChain_mapRead (seed-and-chain)
+'   o header:
+'     - guards, forward declarations, defined variables
+'   o .h st01: seedScan
+'     - holds the reference kmers, query kmers, chains,
+'       and windows for a seed-and-chain scan
+'   o fun01: blank_seedScan
+'     - blanks (sets lengths to 0) a seedScan struct
+'   o fun02: init_seedScan
+'     - initializes (sets defaults and arrays to 0) a
+'       seedScan struct
+'   o fun03: freeStack_seedScan
+'     - frees the variables in a seedScan struct
+'   o fun04: freeHeap_seedScan
+'     - frees a seedScan struct
+'   o fun05: setRef_seedScan
+'     - makes the sorted kmer index for a reference
+'   o .c fun06: addWin_seedScan
+'     - adds a window to a seedScan struct (merges with
+'       the last window if they overlap)
+'   o .c fun07: sortWin_seedScan
+'     - sorts the windows in a seedScan struct by start
+'   o fun08: window_seedScan
+'     - finds the reference windows a query maps to
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards, forward declarations, defined variables
+\-------------------------------------------------------*/
+
+#ifndef SEED_SCAN_H
+#define SEED_SCAN_H
+
+struct seqST;
+struct chains_mapRead;
+struct kmerTbl_mapRead;
+
+#define def_memErr_seedScan -1
+
+#define def_kmerLen_seedScan 13  /*seed kmer length*/
+#define def_minChain_seedScan 1  /*min kmers in a chain*/
+#define def_padPerc_seedScan 0.1f
+   /*percent of the query length to add to both sides of
+   `  a window (extra for indels)
+   */
+
+/*-------------------------------------------------------\
+| ST01: seedScan
+|   - holds the reference kmers, query kmers, chains, and
+|     windows for a seed-and-chain scan
+\-------------------------------------------------------*/
+typedef struct seedScan
+{
+   /*settings*/
+   unsigned char kmerLenUC;   /*length of one seed kmer*/
+   signed int minChainSI;     /*min kmers to keep chain*/
+   float padPercF;            /*% of query to pad window*/
+
+   /*reference kmers (made by setRef_seedScan)*/
+   signed int *refKmerArySI;  /*kmer at each ref base*/
+   signed int *refIndexArySI; /*refKmerArySI sorted index*/
+   signed int lenRefSI;       /*number reference kmers*/
+   signed int sizeRefSI;      /*size of ref kmer arrays*/
+   signed long refLenSL;      /*length of the reference*/
+   struct kmerTbl_mapRead *tblSTPtr; /*O(1) kmer lookup*/
+
+   /*query kmers*/
+   signed int *qryKmerArySI;  /*kmer at each query base*/
+   signed int sizeQrySI;      /*size of qryKmerArySI*/
+
+   struct chains_mapRead *chainsSTPtr; /*seed chains*/
+
+   /*windows (index 0 reference coordinates) to align*/
+   signed long *startArySL;   /*first base in window*/
+   signed long *endArySL;     /*last base in window*/
+   signed long lenWinSL;      /*number of windows*/
+   signed long sizeWinSL;     /*size of window arrays*/
+}seedScan;
+
+/*-------------------------------------------------------\
+| Fun01: blank_seedScan
+|   - blanks (sets lengths to 0) a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenWinSL in seedSTPtr to be 0 and blanks
+|       chainsSTPtr
+|     o reference kmers and settings are not changed
+\-------------------------------------------------------*/
+void
+blank_seedScan(
+   struct seedScan *seedSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun02: init_seedScan
+|   - initializes (sets defaults and arrays to 0) a
+|     seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all arrays in seedSTPtr to be 0 (null) and the
+|       settings to their defaults
+\-------------------------------------------------------*/
+void
+init_seedScan(
+   struct seedScan *seedSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_seedScan
+|   - frees the variables in a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer with variables to free
+| Output:
+|   - Modifies:
+|     o frees all arrays in seedSTPtr and initializes
+\-------------------------------------------------------*/
+void
+freeStack_seedScan(
+   struct seedScan *seedSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_seedScan
+|   - frees a seedScan struct
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to free
+| Output:
+|   - Modifies:
+|     o frees seedSTPtr; you must set the pointer to null
+\-------------------------------------------------------*/
+void
+freeHeap_seedScan(
+   struct seedScan *seedSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun05: setRef_seedScan
+|   - makes the sorted kmer index for a reference
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer to add reference kmers to
+|       (uses kmerLenUC for the kmer length)
+|   - refSTPtr:
+|     o seqST struct with the reference sequence
+|       * must be converted with seqToIndex_alnSet
+| Output:
+|   - Modifies:
+|     o refKmerArySI, refIndexArySI, lenRefSI, sizeRefSI,
+|       and refLenSL in seedSTPtr to have the reference
+|     o tblSTPtr in seedSTPtr to have the kmer lookup
+|       table for refIndexArySI (made if it is null)
+|     o chainsSTPtr in seedSTPtr is made if it is null
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_seedScan for memory errors
+\-------------------------------------------------------*/
+signed char
+setRef_seedScan(
+   struct seedScan *seedSTPtr,
+   struct seqST *refSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun08: window_seedScan
+|   - finds the reference windows a query maps to
+| Input:
+|   - seedSTPtr:
+|     o seedScan struct pointer with the reference kmers
+|       (from setRef_seedScan) to find windows in
+|   - qrySTPtr:
+|     o seqST struct with the query sequence
+|       * must be converted with seqToIndex_alnSet
+| Output:
+|   - Modifies:
+|     o chainsSTPtr in seedSTPtr to have the seed chains
+|     o startArySL, endArySL, and lenWinSL in seedSTPtr
+|       to have the windows to align the query to
+|       * each window covers the query projected from a
+|         chain (plus padPercF of the query length on
+|         both ends)
+|       * overlapping windows are merged
+|       * windows are sorted by reference start
+|   - Returns:
+|     o number of windows (0 if no seeds were found)
+|     o def_memErr_seedScan for memory errors
+\-------------------------------------------------------*/
+signed long
+window_seedScan(
+   struct seedScan *seedSTPtr,
+   struct seqST *qrySTPtr
+);
+
+#endif
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2024 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
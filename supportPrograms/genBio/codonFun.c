@@ -24,6 +24,9 @@
 '   o fun08: revSeqToAA_codonFun
 '     - converts a reverse complement nucleotide sequence
 '       to amino acid sequence
+'   o fun09: sixFrame_codonFun
+'     - translates all six reading frames of a sequence
+'       in one pass over the sequence
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -565,6 +568,233 @@ revSeqToAA_codonFun(
       return def_incomplete_codonFun;
 } /*revSeqToAA*/
 
+/*-------------------------------------------------------\
+| Fun09: sixFrame_codonFun
+|  - translates all six reading frames of a sequence in
+|    one pass over the sequence
+| Input:
+|  - seqStr: 
+|    o c-string with the sequence to convert
+|  - startSL:
+|    o position of first base to translate
+|  - endSL:
+|    o position after the last base to translate
+|    o use 0 for all sequence (stops at '\0')
+|  - aaAryStr:
+|    o array of six c-strings to hold the amino acid
+|      sequences, each must be at least
+|      ((endSL - startSL) / 3) + 1 bytes long
+|      * 0 to 2 are forward frames 1 to 3 (start at
+|        startSL, startSL + 1, and startSL + 2)
+|      * 3 to 5 are reverse complement frames 4 to 6
+|        (start at endSL - 1, endSL - 2, and endSL - 3)
+|    o use 0 (null) for frames you do not want
+|  - lenArySL:
+|    o signed long array of six to get the length of
+|      each amino acid sequence
+| Output:
+|  - Modifies:
+|    o each c-string in aaAryStr to have the translated
+|      frame (only complete codons are translated)
+|      * codons with anonymous bases are translated with
+|        codonTbl (usually 'x'), the rest use codon64Tbl
+|    o lenArySL to have the length of each frame
+\-------------------------------------------------------*/
+void
+sixFrame_codonFun(
+   signed char *seqStr,
+   signed long startSL,
+   signed long endSL,
+   signed char *aaAryStr[],
+   signed long *lenArySL
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun09 TOC:
+   '  - translates all six reading frames of a sequence
+   '    in one pass over the sequence
+   '   o fun09 sec01:
+   '     - variable declarations
+   '   o fun09 sec02:
+   '     - find frame lengths and add null to each frame
+   '   o fun09 sec03:
+   '     - translate the sequence
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun09 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed long lenSL = 0;   /*number bases to translate*/
+   signed long posSL = 0;   /*base on in sequence*/
+   unsigned char ntUC = 0;
+   signed char aaSC = 0;
+
+   /*last three bases (three bits per base); the 3rd bit
+   `  (def_err3rdBit_ntTo2Bit) marks anonymous bases
+   */
+   unsigned int forCodonUI = 0;
+   unsigned int revCodonUI = 0;
+
+   unsigned char forFrameUC = 0; /*frame of forward codon*/
+   signed long forIndexSL = 0;   /*forward aa position*/
+   unsigned char revFrameUC = 0; /*frame of reverse codon*/
+   signed long revIndexSL = 0;   /*reverse aa position*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun09 Sec02:
+   ^   - find frame lengths and add null to each frame
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(endSL <= 0)
+   { /*If: translating to end of sequence*/
+      endSL = startSL;
+
+      while(seqStr[endSL])
+         ++endSL;
+   } /*If: translating to end of sequence*/
+
+   lenSL = endSL - startSL;
+
+   for(forFrameUC = 0; forFrameUC < 3; ++forFrameUC)
+   { /*Loop: find length of each frame*/
+      if(lenSL > forFrameUC)
+         lenArySL[forFrameUC] = (lenSL - forFrameUC) / 3;
+      else
+         lenArySL[forFrameUC] = 0;
+
+      /*reverse frames have the same number of codons*/
+      lenArySL[forFrameUC + 3] = lenArySL[forFrameUC];
+
+      if(aaAryStr[forFrameUC])
+         aaAryStr[forFrameUC][lenArySL[forFrameUC]] = '\0';
+
+      if(aaAryStr[forFrameUC + 3])
+         aaAryStr[forFrameUC + 3][lenArySL[forFrameUC]] =
+            '\0';
+   } /*Loop: find length of each frame*/
+
+   if(lenSL < 3)
+      return; /*no complete codons*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun09 Sec03:
+   ^   - translate the sequence
+   ^   o fun09 sec03 sub01:
+   ^     - add first two bases to the codons
+   ^   o fun09 sec03 sub02:
+   ^     - add next base to the codons + start loop
+   ^   o fun09 sec03 sub03:
+   ^     - translate forward codon
+   ^   o fun09 sec03 sub04:
+   ^     - translate reverse complement codon
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun09 Sec03 Sub01:
+   *   - add first two bases to the codons
+   \*****************************************************/
+
+   seqStr += startSL;
+
+   for(posSL = 0; posSL < 2; ++posSL)
+   { /*Loop: add first two bases*/
+      ntUC = (unsigned char) seqStr[posSL];
+      forCodonUI = (forCodonUI << 3) | ntTo2Bit[ntUC];
+      revCodonUI =
+         (revCodonUI >> 3) | (revNtTo2Bit[ntUC] << 6);
+   } /*Loop: add first two bases*/
+
+   /*the first codon is in forward frame 1 and is the last
+   `  codon in reverse frame ((lenSL - 3) % 3) + 4
+   */
+   forFrameUC = 0;
+   forIndexSL = 0;
+   revFrameUC = (unsigned char) ((lenSL - 3) % 3);
+   revIndexSL = (lenSL - 3) / 3;
+
+   /*****************************************************\
+   * Fun09 Sec03 Sub02:
+   *   - add next base to the codons + start loop
+   \*****************************************************/
+
+   for(posSL = 2; posSL < lenSL; ++posSL)
+   { /*Loop: translate all frames*/
+      ntUC = (unsigned char) seqStr[posSL];
+
+      forCodonUI =
+         ((forCodonUI << 3) | ntTo2Bit[ntUC]) & 0777;
+      revCodonUI =
+         (revCodonUI >> 3) | (revNtTo2Bit[ntUC] << 6);
+
+      /**************************************************\
+      * Fun09 Sec03 Sub03:
+      *   - translate forward codon
+      \**************************************************/
+
+      if(aaAryStr[forFrameUC])
+      { /*If: keeping this frame*/
+         if(forCodonUI & 0444)
+            aaSC =
+               codonTbl
+                  [forCodonUI >> 6]
+                  [(forCodonUI >> 3) & 7]
+                  [forCodonUI & 7];
+            /*anonymous base, use full table*/
+
+         else
+            aaSC =
+               codon64Tbl[
+                    ((forCodonUI >> 2) & 48)
+                  | ((forCodonUI >> 1) & 12)
+                  | (forCodonUI & 3)
+               ];
+
+         aaAryStr[forFrameUC][forIndexSL] = aaSC;
+      } /*If: keeping this frame*/
+
+      if(++forFrameUC > 2)
+      { /*If: finished codon in all forward frames*/
+         forFrameUC = 0;
+         ++forIndexSL;
+      } /*If: finished codon in all forward frames*/
+
+      /**************************************************\
+      * Fun09 Sec03 Sub04:
+      *   - translate reverse complement codon
+      \**************************************************/
+
+      if(aaAryStr[revFrameUC + 3])
+      { /*If: keeping this frame*/
+         if(revCodonUI & 0444)
+            aaSC =
+               codonTbl
+                  [revCodonUI >> 6]
+                  [(revCodonUI >> 3) & 7]
+                  [revCodonUI & 7];
+            /*anonymous base, use full table*/
+
+         else
+            aaSC =
+               codon64Tbl[
+                    ((revCodonUI >> 2) & 48)
+                  | ((revCodonUI >> 1) & 12)
+                  | (revCodonUI & 3)
+               ];
+
+         aaAryStr[revFrameUC + 3][revIndexSL] = aaSC;
+      } /*If: keeping this frame*/
+
+      /*reverse frames are filled from the end*/
+      if(revFrameUC)
+         --revFrameUC;
+      else
+      { /*Else: finished codon in all reverse frames*/
+         revFrameUC = 2;
+         --revIndexSL;
+      } /*Else: finished codon in all reverse frames*/
+   } /*Loop: translate all frames*/
+} /*sixFrame_codonFun*/
+
 /*=======================================================\
 : License:
 : 
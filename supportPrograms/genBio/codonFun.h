@@ -24,6 +24,9 @@
 '   o fun08: revSeqToAA_codonFun
 '     - converts a reverse complement nucleotide sequence
 '       to amino acid sequence
+'   o fun09: sixFrame_codonFun
+'     - translates all six reading frames of a sequence
+'       in one pass over the sequence
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -242,6 +245,47 @@ revSeqToAA_codonFun(
    signed long endSL
 );
 
+/*-------------------------------------------------------\
+| Fun09: sixFrame_codonFun
+|  - translates all six reading frames of a sequence in
+|    one pass over the sequence
+| Input:
+|  - seqStr: 
+|    o c-string with the sequence to convert
+|  - startSL:
+|    o position of first base to translate
+|  - endSL:
+|    o position after the last base to translate
+|    o use 0 for all sequence (stops at '\0')
+|  - aaAryStr:
+|    o array of six c-strings to hold the amino acid
+|      sequences, each must be at least
+|      ((endSL - startSL) / 3) + 1 bytes long
+|      * 0 to 2 are forward frames 1 to 3 (start at
+|        startSL, startSL + 1, and startSL + 2)
+|      * 3 to 5 are reverse complement frames 4 to 6
+|        (start at endSL - 1, endSL - 2, and endSL - 3)
+|    o use 0 (null) for frames you do not want
+|  - lenArySL:
+|    o signed long array of six to get the length of
+|      each amino acid sequence
+| Output:
+|  - Modifies:
+|    o each c-string in aaAryStr to have the translated
+|      frame (only complete codons are translated)
+|      * codons with anonymous bases are translated with
+|        codonTbl (usually 'x'), the rest use codon64Tbl
+|    o lenArySL to have the length of each frame
+\-------------------------------------------------------*/
+void
+sixFrame_codonFun(
+   signed char *seqStr,
+   signed long startSL,
+   signed long endSL,
+   signed char *aaAryStr[],
+   signed long *lenArySL
+);
+
 #endif
 
 /*=======================================================\
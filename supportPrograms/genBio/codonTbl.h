@@ -6,6 +6,8 @@
 '     - guards
 '   o tbl01 codonLkTbl:
 '     - Table to convert three bases to codons
+'   o tbl02 codon64Tbl:
+'     - flat 64 entry codon table (no anonymous bases)
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -69,6 +71,37 @@ static signed char codonTbl[5][5][5] =
       }, /*First element is an N*/
    }; /*codonTbl*/
 
+/*--------------------------------------------------------\
+| Tbl02 codon64Tbl:
+|  - same codons as codonTbl, but as one flat array for
+|    codons with no anonymous bases
+|  - index is (first << 4) | (second << 2) | third, with
+|    bases converted by ntTo2Bit (t = 0, c = 1, a = 2,
+|    g = 3)
+\--------------------------------------------------------*/
+static signed char codon64Tbl[64] =
+   {  /*codon64Tbl*/
+      'f', 'f', 'l', 'l', /*TT*/
+      's', 's', 's', 's', /*TC*/
+      'y', 'y', '*', '*', /*TA*/
+      'c', 'c', '*', 'w', /*TG*/
+
+      'l', 'l', 'l', 'l', /*CT*/
+      'p', 'p', 'p', 'p', /*CC*/
+      'h', 'h', 'q', 'q', /*CA*/
+      'r', 'r', 'r', 'r', /*CG*/
+
+      'i', 'i', 'i', 'm', /*AT*/
+      't', 't', 't', 't', /*AC*/
+      'n', 'n', 'k', 'k', /*AA*/
+      's', 's', 'r', 'r', /*AG*/
+
+      'v', 'v', 'v', 'v', /*GT*/
+      'a', 'a', 'a', 'a', /*GC*/
+      'd', 'd', 'e', 'e', /*GA*/
+      'g', 'g', 'g', 'g'  /*GG*/
+   }; /*codon64Tbl*/
+
 #endif
 
 /*
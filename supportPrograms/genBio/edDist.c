@@ -6,6 +6,8 @@
 '     - included libraries
 '   o .h st01: res_edDist
 '     - holds results and windows for edDist struct 
+'   o .h st02: myers_edDist
+'     - query bit masks for bit vector edit distances
 '   o fun01: blank_res_edDist
 '     - blanks (sets 0) values in a res_edDist struct
 '   o fun02: init_res_edDist
@@ -31,6 +33,18 @@
 '     - prints header for edDist output tsv
 '   o fun12: pdist_edDist
 '     - prints edit distance tsv line for edDist
+'   o fun13: init_myers_edDist
+'     - initializes a myers_edDist struct
+'   o fun14: freeStack_myers_edDist
+'     - frees heap variables in a myers_edDist struct
+'   o fun15: setup_myers_edDist
+'     - sets up a myers_edDist struct for a query
+'   o .c fun16: cntBits_edDist
+'     - counts number of set bits in an unsigned long
+'   o fun17: myersDist_edDist
+'     - finds edit distance with bit vectors (Myers)
+'   o fun18: samMyers_edDist
+'     - bit vector edit distance for a mapped read
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -58,13 +72,13 @@
 /*.h files only*/
 #include "../genLib/endLine.h"
 #include "../genLib/genMath.h" /*min .h macro only*/
+#include "ntTo5Bit.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden libraries:
 !   o .c   #include "../genLib/base10str.h"
 !   o .c   #include "../genLib/numToStr.h"
 !   o .c   #include "../genLib/fileFun.h"
-!   o .h   #include "ntTo5Bit.h"
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /*-------------------------------------------------------\
@@ -2446,6 +2460,593 @@ pdist_edDist(
    );
 } /*pdist_edDist*/
    
+/*-------------------------------------------------------\
+| Fun13: init_myers_edDist
+|   - initializes a myers_edDist struct
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to initialize
+| Output:
+|   - Modifies:
+|     o all values in myersSTPtr to be 0
+\-------------------------------------------------------*/
+void
+init_myers_edDist(
+   struct myers_edDist *myersSTPtr
+){
+   myersSTPtr->peqAryUL = 0;
+   myersSTPtr->pvAryUL = 0;
+   myersSTPtr->mvAryUL = 0;
+   myersSTPtr->scoreArySL = 0;
+
+   myersSTPtr->numBlocksUI = 0;
+   myersSTPtr->sizeBlocksUI = 0;
+   myersSTPtr->qryLenUI = 0;
+} /*init_myers_edDist*/
+
+/*-------------------------------------------------------\
+| Fun14: freeStack_myers_edDist
+|   - frees heap variables in a myers_edDist struct
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct with vars to free
+| Output:
+|   - Frees:
+|     o peqAryUL and scoreArySL, then calls
+|       init_myers_edDist (fun13)
+\-------------------------------------------------------*/
+void
+freeStack_myers_edDist(
+   struct myers_edDist *myersSTPtr
+){
+   if(! myersSTPtr)
+      return;
+
+   if(myersSTPtr->peqAryUL)
+      free(myersSTPtr->peqAryUL);
+      /*pvAryUL and mvAryUL are part of peqAryUL*/
+
+   if(myersSTPtr->scoreArySL)
+      free(myersSTPtr->scoreArySL);
+
+   init_myers_edDist(myersSTPtr);
+} /*freeStack_myers_edDist*/
+
+/*-------------------------------------------------------\
+| Fun15: setup_myers_edDist
+|   - sets up a myers_edDist struct for a query (builds
+|     the match bit masks)
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to set up
+|   - qryStr:
+|     o c-string with query sequence
+|   - qryLenUI:
+|     o number of bases in qryStr
+| Output:
+|   - Modifies:
+|     o peqAryUL in myersSTPtr to have the match masks
+|       for qryStr; bases match if they are the same (case
+|       does not matter) or one base is an N
+|     o numBlocksUI and qryLenUI in myersSTPtr to have
+|       number of words (blocks) and query length
+|     o peqAryUL, pvAryUL, mvAryUL, scoreArySL, and
+|       sizeBlocksUI are resized if need more memory
+|   - Returns:
+|     o 0 for no errors
+|     o def_noSeq_edDist if qryLenUI is 0
+|     o def_memErr_edDist for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_myers_edDist(
+   struct myers_edDist *myersSTPtr,
+   signed char *qryStr,
+   unsigned int qryLenUI
+){
+   unsigned int numBlocksUI = 0;
+   unsigned int uiBase = 0;
+   unsigned int uiBlock = 0;
+   unsigned long bitUL = 0;
+   unsigned char qryUC = 0;
+   unsigned char ntUC = 0;
+
+   if(! qryLenUI)
+      return def_noSeq_edDist;
+
+   numBlocksUI =
+        (qryLenUI + def_bitsPerUL_edDist - 1)
+      / def_bitsPerUL_edDist;
+
+   if(numBlocksUI > myersSTPtr->sizeBlocksUI)
+   { /*If: need more memory*/
+      freeStack_myers_edDist(myersSTPtr);
+
+      myersSTPtr->peqAryUL =
+         malloc(
+              numBlocksUI
+            * (def_numPeq_edDist + 2)
+            * sizeof(unsigned long)
+         ); /*+2 is for pvAryUL and mvAryUL*/
+      if(! myersSTPtr->peqAryUL)
+         goto memErr_fun15;
+
+      myersSTPtr->scoreArySL =
+         malloc(numBlocksUI * sizeof(signed long));
+      if(! myersSTPtr->scoreArySL)
+         goto memErr_fun15;
+
+      myersSTPtr->sizeBlocksUI = numBlocksUI;
+   } /*If: need more memory*/
+
+   myersSTPtr->pvAryUL =
+      myersSTPtr->peqAryUL
+    + myersSTPtr->sizeBlocksUI * def_numPeq_edDist;
+   myersSTPtr->mvAryUL =
+      myersSTPtr->pvAryUL + myersSTPtr->sizeBlocksUI;
+
+   myersSTPtr->numBlocksUI = numBlocksUI;
+   myersSTPtr->qryLenUI = qryLenUI;
+
+   for(
+      uiBase = 0;
+      uiBase < numBlocksUI * def_numPeq_edDist;
+      ++uiBase
+   ) myersSTPtr->peqAryUL[uiBase] = 0;
+
+   /*the padding bits in the last block never match, so
+   `  only add to the last blocks score; these are removed
+   `  by myersDist_edDist
+   */
+   for(uiBase = 0; uiBase < qryLenUI; ++uiBase)
+   { /*Loop: add query bases to match masks*/
+      uiBlock = uiBase / def_bitsPerUL_edDist;
+      bitUL = 1UL << (uiBase % def_bitsPerUL_edDist);
+      qryUC = ntTo5Bit[(unsigned char) qryStr[uiBase]];
+
+      if(qryUC & def_err_sixBit_ntTo5Bit)
+         continue; /*not a base; matches nothing*/
+      qryUC &= 15;
+
+      for(ntUC = 1; ntUC < def_numPeq_edDist; ++ntUC)
+      { /*Loop: find reference bases query matches*/
+         if(qryUC == ntUC || qryUC == 15 || ntUC == 15)
+            myersSTPtr->peqAryUL[
+               ntUC * numBlocksUI + uiBlock
+            ] |= bitUL;
+      } /*Loop: find reference bases query matches*/
+   } /*Loop: add query bases to match masks*/
+
+   return 0;
+
+   memErr_fun15:;
+      freeStack_myers_edDist(myersSTPtr);
+      return def_memErr_edDist;
+} /*setup_myers_edDist*/
+
+/*-------------------------------------------------------\
+| Fun16: cntBits_edDist
+|   - counts number of set bits in an unsigned long
+| Input:
+|   - bitsUL:
+|     o unsigned long to count bits in
+| Output:
+|   - Returns:
+|     o number of set bits in bitsUL
+\-------------------------------------------------------*/
+static unsigned int
+cntBits_edDist(
+   unsigned long bitsUL
+){
+   /*~0UL / 3 is 0x55..., ~0UL / 5 is 0x33...,
+   `  ~0UL / 17 is 0x0f..., and ~0UL / 255 is 0x01...
+   `  for any size of long
+   */
+   bitsUL -= (bitsUL >> 1) & (~0UL / 3);
+   bitsUL =
+        (bitsUL & (~0UL / 5))
+      + ((bitsUL >> 2) & (~0UL / 5));
+   bitsUL = (bitsUL + (bitsUL >> 4)) & (~0UL / 17);
+
+   return
+      (unsigned int)
+      (
+           (bitsUL * (~0UL / 255))
+        >> ((sizeof(unsigned long) - 1) << 3)
+      );
+} /*cntBits_edDist*/
+
+/*-------------------------------------------------------\
+| Fun17: myersDist_edDist
+|   - finds the edit distance between the query in a
+|     myers_edDist struct and a reference using the
+|     Myers/Hyyro bit vector method (one unsigned long
+|     of query bases at a time)
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct with query (call
+|       setup_myers_edDist (fun15) first)
+|   - refStr:
+|     o c-string with reference sequence
+|   - refLenUI:
+|     o number of reference bases to compare
+|   - maxDistSL:
+|     o maximum distance to find (band); blocks (words)
+|       with only distances over this are skipped
+|     o use -1 to find the full distance
+|   - globalBl:
+|     o 1: global distance; the full query and full
+|       reference (ex: read and its mapped region)
+|     o 0: best distance for the query anywhere in the
+|       reference (ends are free on the reference)
+|   - endUIPtr:
+|     o unsigned int pointer to get last reference base
+|       (index 0) in the best hit (globalBl = 0)
+|     o use 0 to ignore
+| Output:
+|   - Modifies:
+|     o pvAryUL, mvAryUL, and scoreArySL in myersSTPtr
+|     o endUIPtr to have last reference base in the hit
+|   - Returns:
+|     o edit distance (snps + indels)
+|     o def_overMax_edDist if distance is over maxDistSL
+|     o def_noSeq_edDist if the query or reference has no
+|       bases
+\-------------------------------------------------------*/
+signed long
+myersDist_edDist(
+   struct myers_edDist *myersSTPtr,
+   signed char *refStr,
+   unsigned int refLenUI,
+   signed long maxDistSL,
+   signed char globalBl,
+   unsigned int *endUIPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun17 TOC:
+   '   - finds edit distance with bit vectors
+   '   o fun17 sec01:
+   '     - variable declarations
+   '   o fun17 sec02:
+   '     - initialize blocks
+   '   o fun17 sec03:
+   '     - find distances for each reference base
+   '   o fun17 sec04:
+   '     - return the distance
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned long *peqUL = 0;   /*masks for reference base*/
+   unsigned long *pvAryUL = myersSTPtr->pvAryUL;
+   unsigned long *mvAryUL = myersSTPtr->mvAryUL;
+   signed long *scoreArySL = myersSTPtr->scoreArySL;
+   unsigned int numBlocksUI = myersSTPtr->numBlocksUI;
+
+   unsigned long pvUL = 0;    /*+1 vertical deltas*/
+   unsigned long mvUL = 0;    /*-1 vertical deltas*/
+   unsigned long eqUL = 0;    /*query bases matching*/
+   unsigned long xvUL = 0;
+   unsigned long xhUL = 0;
+   unsigned long phUL = 0;
+   unsigned long mhUL = 0;
+   unsigned long padUL = 0;   /*padding bits in last block*/
+   signed char hinSC = 0;     /*delta into block (-1 to 1)*/
+   signed char houtSC = 0;    /*delta out of block*/
+
+   unsigned int uiRef = 0;
+   unsigned int uiBlock = 0;
+   unsigned int lastBlockUI = 0; /*last block in band*/
+   unsigned char ntUC = 0;
+
+   signed long distSL = 0;
+   signed long bestSL = -1;
+   unsigned int bestEndUI = 0;
+
+   #define highBit_fun17 \
+      (1UL << (def_bitsPerUL_edDist - 1))
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec02:
+   ^   - initialize blocks
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! numBlocksUI || ! refLenUI)
+      return def_noSeq_edDist;
+
+   if(maxDistSL < 0)
+      maxDistSL =
+         (signed long) myersSTPtr->qryLenUI
+       + (signed long) refLenUI;
+
+   /*first column is deletions of the query (row is the
+   `  distance), so all vertical deltas are +1
+   */
+   lastBlockUI =
+        ((unsigned long) maxDistSL + def_bitsPerUL_edDist)
+      / def_bitsPerUL_edDist;
+      /*Ukkonen; rows past maxDistSL + 1 are over max*/
+   if(lastBlockUI > numBlocksUI)
+      lastBlockUI = numBlocksUI;
+   --lastBlockUI;
+
+   for(uiBlock = 0; uiBlock <= lastBlockUI; ++uiBlock)
+   { /*Loop: initialize blocks in band*/
+      pvAryUL[uiBlock] = ~0UL;
+      mvAryUL[uiBlock] = 0;
+      scoreArySL[uiBlock] =
+         (signed long) (uiBlock + 1) * def_bitsPerUL_edDist;
+   } /*Loop: initialize blocks in band*/
+
+   uiBlock =
+        myersSTPtr->qryLenUI
+      - (numBlocksUI - 1) * def_bitsPerUL_edDist;
+      /*number of query bases in last block*/
+   if(uiBlock < def_bitsPerUL_edDist)
+      padUL = ~0UL << uiBlock;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec03:
+   ^   - find distances for each reference base
+   ^   o fun17 sec03 sub01:
+   ^     - get match masks for reference base
+   ^   o fun17 sec03 sub02:
+   ^     - find vertical deltas for the blocks in band
+   ^   o fun17 sec03 sub03:
+   ^     - remove blocks that are out of the band
+   ^   o fun17 sec03 sub04:
+   ^     - check for new best distance
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun17 Sec03 Sub01:
+   *   - get match masks for reference base
+   \*****************************************************/
+
+   for(uiRef = 0; uiRef < refLenUI; ++uiRef)
+   { /*Loop: go through reference*/
+      ntUC = ntTo5Bit[(unsigned char) refStr[uiRef]];
+
+      if(ntUC & def_err_sixBit_ntTo5Bit)
+         ntUC = 0; /*not a base; matches nothing*/
+      else
+         ntUC &= 15;
+
+      peqUL = &myersSTPtr->peqAryUL[ntUC * numBlocksUI];
+
+      hinSC = globalBl;
+         /*first row is 0 (free start) or the reference
+         `  position (global), so delta is 0 or 1
+         */
+
+      /**************************************************\
+      * Fun17 Sec03 Sub02:
+      *   - find vertical deltas for the blocks in band
+      \**************************************************/
+
+      for(uiBlock = 0; uiBlock <= lastBlockUI; ++uiBlock)
+      { /*Loop: find deltas for one block*/
+         pvUL = pvAryUL[uiBlock];
+         mvUL = mvAryUL[uiBlock];
+         eqUL = peqUL[uiBlock];
+
+         xvUL = eqUL | mvUL;
+         if(hinSC < 0)
+            eqUL |= 1;
+         xhUL = (((eqUL & pvUL) + pvUL) ^ pvUL) | eqUL;
+
+         phUL = mvUL | ~(xhUL | pvUL);
+         mhUL = pvUL & xhUL;
+
+         if(phUL & highBit_fun17)
+            houtSC = 1;
+         else if(mhUL & highBit_fun17)
+            houtSC = -1;
+         else
+            houtSC = 0;
+
+         phUL <<= 1;
+         mhUL <<= 1;
+
+         if(hinSC < 0)
+            mhUL |= 1;
+         else if(hinSC > 0)
+            phUL |= 1;
+
+         pvAryUL[uiBlock] = mhUL | ~(xvUL | phUL);
+         mvAryUL[uiBlock] = phUL & xvUL;
+         scoreArySL[uiBlock] += houtSC;
+         hinSC = houtSC;
+
+         if(uiBlock < lastBlockUI)
+            continue;
+         else if(lastBlockUI + 1 >= numBlocksUI)
+            continue;
+         else if(scoreArySL[uiBlock] - houtSC > maxDistSL)
+            continue; /*next block was over maximum*/
+
+         /*next block may now have distances in band; the
+         `  last column for this block is assumed to be
+         `  all +1 deltas (only true cells over max differ)
+         */
+         ++lastBlockUI;
+         pvAryUL[lastBlockUI] = ~0UL;
+         mvAryUL[lastBlockUI] = 0;
+         scoreArySL[lastBlockUI] =
+              scoreArySL[uiBlock]
+            - houtSC
+            + def_bitsPerUL_edDist;
+      } /*Loop: find deltas for one block*/
+
+      /**************************************************\
+      * Fun17 Sec03 Sub03:
+      *   - remove blocks that are out of the band
+      \**************************************************/
+
+      while(
+            lastBlockUI > 0
+         &&    scoreArySL[lastBlockUI]
+            >= maxDistSL + (signed long) def_bitsPerUL_edDist
+      ) --lastBlockUI; /*every row in block is over max*/
+
+      /**************************************************\
+      * Fun17 Sec03 Sub04:
+      *   - check for new best distance
+      \**************************************************/
+
+      if(globalBl)
+         continue; /*only care about last reference base*/
+      else if(lastBlockUI + 1 < numBlocksUI)
+         continue; /*last query base is over maximum*/
+
+      distSL =
+           scoreArySL[lastBlockUI]
+         - cntBits_edDist(pvAryUL[lastBlockUI] & padUL)
+         + cntBits_edDist(mvAryUL[lastBlockUI] & padUL);
+         /*removes the padding bases*/
+
+      if(bestSL < 0 || distSL < bestSL)
+      { /*If: new best distance*/
+         bestSL = distSL;
+         bestEndUI = uiRef;
+
+         if(! bestSL)
+            break; /*can not do better*/
+      } /*If: new best distance*/
+   } /*Loop: go through reference*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun17 Sec04:
+   ^   - return the distance
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(globalBl)
+   { /*If: global distance*/
+      if(lastBlockUI + 1 < numBlocksUI)
+         return def_overMax_edDist;
+
+      bestSL =
+           scoreArySL[lastBlockUI]
+         - cntBits_edDist(pvAryUL[lastBlockUI] & padUL)
+         + cntBits_edDist(mvAryUL[lastBlockUI] & padUL);
+      bestEndUI = refLenUI - 1;
+   } /*If: global distance*/
+
+   if(bestSL < 0 || bestSL > maxDistSL)
+      return def_overMax_edDist;
+
+   if(endUIPtr)
+      *endUIPtr = bestEndUI;
+
+   return bestSL;
+} /*myersDist_edDist*/
+
+/*-------------------------------------------------------\
+| Fun18: samMyers_edDist
+|   - finds the bit vector (Myers) edit distance between
+|     a mapped read and the reference region it mapped to
+|   - this is a fast pre-filter for dist_edDist; soft
+|     masked bases are ignored, but every snp and indel is
+|     counted (no q-score or indel length filters)
+| Input:
+|   - qrySTPtr:
+|     o pointer to samEntry struct with read (query) to
+|       find the edit distance for
+|   - refSTPtr:
+|     o pointer to seqST struct with reference sequence
+|   - maxDistSL:
+|     o maximum distance to find (band)
+|     o use -1 to find the full distance
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to use (is set up
+|       with the read)
+| Output:
+|   - Modifies:
+|     o myersSTPtr to have the aligned part of the read
+|   - Returns:
+|     o edit distance between the read and the reference
+|     o def_overMax_edDist if distance is over maxDistSL
+|     o def_noMap_edDist if the read is unmapped or the
+|       mapped region is not in refSTPtr
+|     o def_noSeq_edDist if the read has no sequence
+|     o def_memErr_edDist for memory errors
+\-------------------------------------------------------*/
+signed long
+samMyers_edDist(
+   struct samEntry *qrySTPtr, /*read for edit distance*/
+   struct seqST *refSTPtr,    /*has reference sequence*/
+   signed long maxDistSL,     /*maximum distance (band)*/
+   struct myers_edDist *myersSTPtr /*for bit vectors*/
+){
+   unsigned int startUI = 0;  /*first aligned read base*/
+   unsigned int endUI = 0;    /*bases masked at end*/
+   unsigned int uiCig = 0;
+   signed char errSC = 0;
+
+   if(qrySTPtr->flagUS & 4)
+      return def_noMap_edDist;
+
+   if(
+         ! qrySTPtr->seqStr
+      || *qrySTPtr->seqStr == '*'
+      || *qrySTPtr->seqStr == '\0'
+   ) return def_noSeq_edDist;
+
+   if(
+         qrySTPtr->refEndUI < qrySTPtr->refStartUI
+      || ! qrySTPtr->alnReadLenUI
+      || (signed long) qrySTPtr->refEndUI
+         >= refSTPtr->seqLenSL
+   ) return def_noMap_edDist;
+
+   /*find soft masked bases at the start and end*/
+   while(
+         uiCig < qrySTPtr->cigLenUI
+      && qrySTPtr->cigTypeStr[uiCig] == 'H'
+   ) ++uiCig;
+
+   if(
+         uiCig < qrySTPtr->cigLenUI
+      && qrySTPtr->cigTypeStr[uiCig] == 'S'
+   ) startUI = (unsigned int) qrySTPtr->cigArySI[uiCig];
+
+   uiCig = qrySTPtr->cigLenUI;
+
+   while(
+         uiCig > 0
+      && qrySTPtr->cigTypeStr[uiCig - 1] == 'H'
+   ) --uiCig;
+
+   if(
+         uiCig > 0
+      && qrySTPtr->cigTypeStr[uiCig - 1] == 'S'
+   ) endUI = (unsigned int) qrySTPtr->cigArySI[uiCig - 1];
+
+   if(startUI + endUI >= qrySTPtr->readLenUI)
+      return def_noSeq_edDist; /*everything is masked*/
+
+   errSC =
+      setup_myers_edDist(
+         myersSTPtr,
+         &qrySTPtr->seqStr[startUI],
+         qrySTPtr->readLenUI - startUI - endUI
+      );
+
+   if(errSC)
+      return errSC; /*memory error*/
+
+   return
+      myersDist_edDist(
+         myersSTPtr,
+         &refSTPtr->seqStr[qrySTPtr->refStartUI],
+         qrySTPtr->refEndUI - qrySTPtr->refStartUI + 1,
+         maxDistSL,
+         1,  /*global; read must cover mapped region*/
+         0
+      );
+} /*samMyers_edDist*/
+
 /*=======================================================\
 : License:
 : 
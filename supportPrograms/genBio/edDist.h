@@ -6,6 +6,8 @@
 '     - included libraries
 '   o .h st01: res_edDist
 '     - holds results and windows for edDist struct 
+'   o .h st02: myers_edDist
+'     - query bit masks for bit vector edit distances
 '   o fun01: blank_res_edDist
 '     - blanks (sets 0) values in a res_edDist struct
 '   o fun02: init_res_edDist
@@ -31,6 +33,18 @@
 '     - prints header for edDist output tsv
 '   o fun12: pdist_edDist
 '     - prints edit distance tsv line for edDist
+'   o fun13: init_myers_edDist
+'     - initializes a myers_edDist struct
+'   o fun14: freeStack_myers_edDist
+'     - frees heap variables in a myers_edDist struct
+'   o fun15: setup_myers_edDist
+'     - sets up a myers_edDist struct for a query
+'   o .c fun16: cntBits_edDist
+'     - counts number of set bits in an unsigned long
+'   o fun17: myersDist_edDist
+'     - finds edit distance with bit vectors (Myers)
+'   o fun18: samMyers_edDist
+'     - bit vector edit distance for a mapped read
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -53,6 +67,10 @@ struct seqST;
 #define def_diffRef_edDist -2
 #define def_noSeq_edDist -4
 #define def_noMap_edDist -8
+#define def_overMax_edDist -64 /*over maximum distance*/
+
+#define def_bitsPerUL_edDist (sizeof(unsigned long) << 3)
+#define def_numPeq_edDist 16 /*number of 4 bit base codes*/
 
 /*-------------------------------------------------------\
 | ST01: res_edDist
@@ -83,6 +101,27 @@ typedef struct res_edDist
    signed long edDistSL;       /*edit distance*/
 }res_edDist;
 
+/*-------------------------------------------------------\
+| ST02: myers_edDist
+|   - query bit masks for bit vector edit distances
+|   - each block is one unsigned long of query bases (64
+|     bases with 64 bit longs)
+\-------------------------------------------------------*/
+typedef struct myers_edDist
+{
+   unsigned long *peqAryUL;
+      /*match masks; block uiBlock for base code ntUC
+      `  (ntTo5Bit & 15) is at ntUC * numBlocksUI + uiBlock
+      */
+   unsigned long *pvAryUL;  /*+1 vertical deltas; block*/
+   unsigned long *mvAryUL;  /*-1 vertical deltas; block*/
+   signed long *scoreArySL; /*distance at end of block*/
+
+   unsigned int numBlocksUI;  /*blocks for the query*/
+   unsigned int sizeBlocksUI; /*blocks allocated*/
+   unsigned int qryLenUI;     /*number query bases*/
+}myers_edDist;
+
 /*-------------------------------------------------------\
 | Fun01: blank_res_edDist
 |   - blanks (sets 0) values in a res_edDist struct
@@ -394,6 +433,154 @@ pdist_edDist(
    void *outFILE
 );
 
+/*-------------------------------------------------------\
+| Fun13: init_myers_edDist
+|   - initializes a myers_edDist struct
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to initialize
+| Output:
+|   - Modifies:
+|     o all values in myersSTPtr to be 0
+\-------------------------------------------------------*/
+void
+init_myers_edDist(
+   struct myers_edDist *myersSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun14: freeStack_myers_edDist
+|   - frees heap variables in a myers_edDist struct
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct with vars to free
+| Output:
+|   - Frees:
+|     o peqAryUL and scoreArySL, then calls
+|       init_myers_edDist (fun13)
+\-------------------------------------------------------*/
+void
+freeStack_myers_edDist(
+   struct myers_edDist *myersSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun15: setup_myers_edDist
+|   - sets up a myers_edDist struct for a query (builds
+|     the match bit masks)
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to set up
+|   - qryStr:
+|     o c-string with query sequence
+|   - qryLenUI:
+|     o number of bases in qryStr
+| Output:
+|   - Modifies:
+|     o peqAryUL in myersSTPtr to have the match masks
+|       for qryStr; bases match if they are the same (case
+|       does not matter) or one base is an N
+|     o numBlocksUI and qryLenUI in myersSTPtr to have
+|       number of words (blocks) and query length
+|     o peqAryUL, pvAryUL, mvAryUL, scoreArySL, and
+|       sizeBlocksUI are resized if need more memory
+|   - Returns:
+|     o 0 for no errors
+|     o def_noSeq_edDist if qryLenUI is 0
+|     o def_memErr_edDist for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_myers_edDist(
+   struct myers_edDist *myersSTPtr,
+   signed char *qryStr,
+   unsigned int qryLenUI
+);
+
+/*-------------------------------------------------------\
+| Fun17: myersDist_edDist
+|   - finds the edit distance between the query in a
+|     myers_edDist struct and a reference using the
+|     Myers/Hyyro bit vector method (one unsigned long
+|     of query bases at a time)
+| Input:
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct with query (call
+|       setup_myers_edDist (fun15) first)
+|   - refStr:
+|     o c-string with reference sequence
+|   - refLenUI:
+|     o number of reference bases to compare
+|   - maxDistSL:
+|     o maximum distance to find (band); blocks (words)
+|       with only distances over this are skipped
+|     o use -1 to find the full distance
+|   - globalBl:
+|     o 1: global distance; the full query and full
+|       reference (ex: read and its mapped region)
+|     o 0: best distance for the query anywhere in the
+|       reference (ends are free on the reference)
+|   - endUIPtr:
+|     o unsigned int pointer to get last reference base
+|       (index 0) in the best hit (globalBl = 0)
+|     o use 0 to ignore
+| Output:
+|   - Modifies:
+|     o pvAryUL, mvAryUL, and scoreArySL in myersSTPtr
+|     o endUIPtr to have last reference base in the hit
+|   - Returns:
+|     o edit distance (snps + indels)
+|     o def_overMax_edDist if distance is over maxDistSL
+|     o def_noSeq_edDist if the query or reference has no
+|       bases
+\-------------------------------------------------------*/
+signed long
+myersDist_edDist(
+   struct myers_edDist *myersSTPtr,
+   signed char *refStr,
+   unsigned int refLenUI,
+   signed long maxDistSL,
+   signed char globalBl,
+   unsigned int *endUIPtr
+);
+
+/*-------------------------------------------------------\
+| Fun18: samMyers_edDist
+|   - finds the bit vector (Myers) edit distance between
+|     a mapped read and the reference region it mapped to
+|   - this is a fast pre-filter for dist_edDist; soft
+|     masked bases are ignored, but every snp and indel is
+|     counted (no q-score or indel length filters)
+| Input:
+|   - qrySTPtr:
+|     o pointer to samEntry struct with read (query) to
+|       find the edit distance for
+|   - refSTPtr:
+|     o pointer to seqST struct with reference sequence
+|   - maxDistSL:
+|     o maximum distance to find (band)
+|     o use -1 to find the full distance
+|   - myersSTPtr:
+|     o pointer to myers_edDist struct to use (is set up
+|       with the read)
+| Output:
+|   - Modifies:
+|     o myersSTPtr to have the aligned part of the read
+|   - Returns:
+|     o edit distance between the read and the reference
+|     o def_overMax_edDist if distance is over maxDistSL
+|     o def_noMap_edDist if the read is unmapped or the
+|       mapped region is not in refSTPtr
+|     o def_noSeq_edDist if the read has no sequence
+|     o def_memErr_edDist for memory errors
+\-------------------------------------------------------*/
+signed long
+samMyers_edDist(
+   struct samEntry *qrySTPtr, /*read for edit distance*/
+   struct seqST *refSTPtr,    /*has reference sequence*/
+   signed long maxDistSL,     /*maximum distance (band)*/
+   struct myers_edDist *myersSTPtr /*for bit vectors*/
+);
+
 #endif
 
 /*=======================================================\
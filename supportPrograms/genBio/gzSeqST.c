@@ -30,6 +30,7 @@
 #include "../genLib/ulCp.h"
 #include "../genLib/fileFun.h"
 #include "../genLib/inflate.h"
+#include "../genLib/memTag.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden Libraries:
@@ -117,6 +118,7 @@ get_gzSeqST(
    signed long lenSL = 0;
    signed long bytesSL = 0;
    signed long tmpSL = 0;
+   signed long oldSizeSL = 0; /*for memTag counts*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun01 Sec02:
@@ -135,9 +137,10 @@ get_gzSeqST(
    if(! seqSTPtr->idStr)
    { /*If: need memory for read id*/
       seqSTPtr->idStr = malloc(136 * sizeof(signed char));
-      if(! seqSTPtr)
+      if(! seqSTPtr->idStr)
          goto memErr_fun01_sec06;
       seqSTPtr->idSizeSL = 128;
+      resize_memTag(def_seqST_memTag, 0, 128);
    } /*If: need memory for read id*/
 
    blank_seqST(seqSTPtr);
@@ -399,6 +402,11 @@ get_gzSeqST(
          goto memErr_fun01_sec06;
       seqSTPtr->idStr = tmpStr;
       seqSTPtr->idSizeSL += 128;
+      resize_memTag(
+         def_seqST_memTag,
+         seqSTPtr->idSizeSL - 128,
+         seqSTPtr->idSizeSL
+      );
 
       if(*typeSCPtr & def_gzType_gzSeqST)
       { /*If: is gz file*/
@@ -487,6 +495,7 @@ get_gzSeqST(
       if(! seqSTPtr->seqStr)
          goto memErr_fun01_sec06;
       seqSTPtr->seqSizeSL = 1024;
+      resize_memTag(def_seqST_memTag, 0, 1024);
    } /*If: need to get memory for sequence*/
 
 
@@ -646,6 +655,7 @@ get_gzSeqST(
             seqSTPtr->seqLenSL
          >= seqSTPtr->seqSizeSL - 128
       ){ /*If: need more memory*/
+         oldSizeSL = seqSTPtr->seqSizeSL;
          seqSTPtr->seqSizeSL +=
             (seqSTPtr->seqSizeSL >> 1);
 
@@ -658,6 +668,12 @@ get_gzSeqST(
          if(! tmpStr)
             goto memErr_fun01_sec06;
          seqSTPtr->seqStr = tmpStr;
+
+         resize_memTag(
+            def_seqST_memTag,
+            oldSizeSL,
+            seqSTPtr->seqSizeSL
+         );
       } /*If: need more memory*/
 
       /**************************************************\
@@ -730,6 +746,7 @@ get_gzSeqST(
    { /*Else If: q-score buffer is to small*/
       free(seqSTPtr->qStr);
       seqSTPtr->qStr = 0;
+      resize_memTag(def_seqST_memTag, seqSTPtr->qSizeSL, 0);
    } /*Else If: q-score buffer is to small*/
 
    if(! seqSTPtr->qStr)
@@ -739,6 +756,7 @@ get_gzSeqST(
       if(! seqSTPtr->qStr)
          goto memErr_fun01_sec06;
       seqSTPtr->qSizeSL = bytesSL;
+      resize_memTag(def_seqST_memTag, 0, bytesSL);
    } /*If: need to get memory for sequence*/
 
    /*****************************************************\
@@ -25,9 +25,9 @@
 '       kmer
 '   o fun09: addSeq_kmerCnt
 '     - adds a sequence to a kmerCnt structure
-'   o .c fun10: dualSort_kmerCnt
-'     - sorts first unsigned int array and keeps second
-'       signed int array in order with first
+'   o fun10: cntKmers_kmerCnt
+'     - counts the forward and reverse complement kmers in
+'       a sequence one unsigned long at a time
 '   o fun11: ntToKmerAry_kmerCnt
 '     - converts a nucleotide sequence to a array of kmer
 '       counts
@@ -441,38 +441,22 @@ addSeq_kmerCnt(
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    unsigned char errUC = 0;
-   signed long slNt = 0;      /*nucleotide on*/
-
-   /*for getting kmers*/
-   unsigned char ntUC = 0;   /*nucleotide to add to kmer*/
-   unsigned long maskUL = 0; /*for removing extra nt*/
-
-   unsigned long forKmerUL = 0; /*holds forward kmer*/
-   unsigned long forLenUL = 0;
-      /*number bases since last anonymous base*/
-
-   unsigned long revKmerUL = 0; /*holds reverse kmer*/
-   unsigned long revLenUL = 0;
-      /*# nt since last anonymous nt*/
-
    struct seqST *tmpSeqSTPtr = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun09 Sec02:
    ^   - initialize and add sequences to structure
    ^   o fun09 sec02 sub01:
-   ^     - set up mask and blank structure
+   ^     - blank structure
    ^   o fun09 sec02 sub02:
    ^     - copy sequence (foward and reverse)
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
    * Fun09 Sec02 Sub01:
-   *    - set up mask and blank structure
+   *    - blank structure
    \*****************************************************/
 
-   maskUL = mkKmerMask_kmerCnt(kmerCntSTPtr->lenKmerUC);
-
    if(seqSTPtr == kmerCntSTPtr->forSeqST)
    { /*If: copying sequence for forward seqST*/ 
       tmpSeqSTPtr = kmerCntSTPtr->forSeqST;
@@ -518,76 +502,22 @@ addSeq_kmerCnt(
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun09 Sec03:
    ^   - add kmers to table
-   ^   o fun09 sec03 sub01:
-   ^     - add foward nucleotide to foward kmer/start loop
-   ^   o fun09 sec03 sub02:
-   ^     - add reverse nucleotide to reverse kmer
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*****************************************************\
-   * Fun09 Sec03 Sub01:
-   *   - add foward nucleotide to foward kmer/ start loop
-   \*****************************************************/
+   /*reverse complement kmers are found from the forward
+   `  sequence, so only one pass is needed
+   */
+   kmerCntSTPtr->forKmersUI =
+      (unsigned int)
+      cntKmers_kmerCnt(
+         kmerCntSTPtr->forSeqST->seqStr,
+         kmerCntSTPtr->forSeqST->seqLenSL,
+         kmerCntSTPtr->lenKmerUC,
+         kmerCntSTPtr->forKmerArySI,
+         kmerCntSTPtr->revKmerArySI
+      );
 
-   for(
-      slNt = 0;
-      slNt < seqSTPtr->seqLenSL;
-      ++slNt
-   ){ /*Loop: build kmer table*/
-      ntUC =
-         ntTo2Bit[
-            (unsigned char)
-            kmerCntSTPtr->forSeqST->seqStr[slNt]
-         ]; /*get foward nucleotide*/
-
-      /*add nucleotide to kmer*/
-      forKmerUL <<= def_bitsPerKmer_kmerCnt;
-      forKmerUL |= ntUC;
-
-      if(ntUC != def_err3rdBit_ntTo2Bit)
-      { /*If: no anymous bases or errors*/
-         forKmerUL &= maskUL;
-         ++forLenUL;
-
-         if(forLenUL >= kmerCntSTPtr->lenKmerUC)
-         { /*If: had a forward kmer*/
-            ++(kmerCntSTPtr->forKmerArySI[forKmerUL]);
-            ++(kmerCntSTPtr->forKmersUI);
-         } /*If: had a forward kmer*/
-      } /*If: no anymous bases or errors*/
-
-      else
-         forLenUL = 0;
-
-      /**************************************************\
-      * Fun09 Sec03 Sub02:
-      *   - add reverse nucleotide to reverse kmer
-      \**************************************************/
-
-      ntUC =
-         ntTo2Bit[
-            (unsigned char)
-            kmerCntSTPtr->revSeqST->seqStr[slNt]
-         ]; /*get reverse nucleotide*/
-
-      revKmerUL <<= def_bitsPerKmer_kmerCnt;
-      revKmerUL |= ntUC;
-
-      if(ntUC != def_err3rdBit_ntTo2Bit)
-      { /*If: no anymous bases or errors*/
-         revKmerUL &= maskUL;
-         ++revLenUL;
-
-         if(revLenUL >= kmerCntSTPtr->lenKmerUC)
-         { /*If: had a reverse kmer*/
-            ++(kmerCntSTPtr->revKmerArySI[revKmerUL]);
-            ++(kmerCntSTPtr->revKmersUI);
-         } /*If: had a reverse kmer*/
-      } /*If: no anymous bases or errors*/
-
-      else
-         revLenUL = 0;
-   } /*Loop: build kmer table*/
+   kmerCntSTPtr->revKmersUI = kmerCntSTPtr->forKmersUI;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun09 Sec04:
@@ -602,39 +532,53 @@ addSeq_kmerCnt(
 } /*addSeq_kmerCnt*/
 
 /*-------------------------------------------------------\
-| Fun10: dualSort_kmerCnt
-|   - sorts first unsigned int array and keeps second
-|     array in order with first
+| Fun10: cntKmers_kmerCnt
+|   - counts the forward and reverse complement kmers in
+|     a sequence one unsigned long (32 bases on 64 bit
+|     cpus) at a time
 | Input:
-|   - uiAry:
-|     o array to sort
-|   - dualArySI:
-|     o array to be kept in oder with uiAry
-|   - startUL:
-|     o first element to start sorting at
-|   - endUL:
-|     o last element to sort (index 0)
+|   - seqStr:
+|     o c-string with sequence to count kmers for
+|   - lenSL:
+|     o number of bases in seqStr
+|   - lenKmerUC:
+|     o length of one kmer
+|   - forArySI:
+|     o signed int array to add forward kmer counts to
+|     o needs 4^lenKmerUC (1 << (2 * lenKmerUC)) items
+|   - revArySI:
+|     o signed int array to add reverse complement kmer
+|       counts to (same as forArySI for the reverse
+|       complement of seqStr)
+|     o needs 4^lenKmerUC (1 << (2 * lenKmerUC)) items
+|     o use 0 to only count forward kmers
 | Output:
 |   - Modifies:
-|     o uiAry to be sorted form least to greatest
-|     o dualArySI to keep values linked to uiAry
+|     o forArySI to have the forward kmer counts added
+|     o revArySI to have the reverse kmer counts added
+|   - Returns:
+|     o number of kmers in seqStr
 \-------------------------------------------------------*/
-void
-dualSort_kmerCnt(
-   unsigned int *uiAry,
-   signed int *dualArySI,
-   unsigned long startUL,
-   unsigned long endUL
+signed int
+cntKmers_kmerCnt(
+   signed char *seqStr,     /*sequence to count*/
+   signed long lenSL,       /*number bases in seqStr*/
+   unsigned char lenKmerUC, /*length of one kmer*/
+   signed int *forArySI,    /*gets forward kmer counts*/
+   signed int *revArySI     /*gets reverse kmer counts*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun10 TOC:
-   '   - sorts unsigned int array from least to greatest
-   '     and keeps second signed int array in sync
+   '   - counts kmers in a sequence one word at a time
    '   o fun10 sec01:
    '     - variable declerations
    '   o fun10 sec02:
-   '     - find the number of rounds to sort for
+   '     - pack bases into a word
    '   o fun10 sec03:
-   '     - sort the arrays
+   '     - add kmers for words with only full kmers
+   '   o fun10 sec04:
+   '     - add kmers for words with anonymous bases
+   '   o fun10 sec05:
+   '     - return number of kmers
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -642,88 +586,138 @@ dualSort_kmerCnt(
    ^   - variable declerations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*Number of elements to sort*/
-   unsigned long numElmUL = endUL - startUL;
+   unsigned long maskUL = mkKmerMask_kmerCnt(lenKmerUC);
+   unsigned int revShiftUI =
+      (lenKmerUC - 1) * def_bitsPerKmer_kmerCnt;
+      /*moves complement base to first base in kmer*/
+
+   unsigned long wordUL = 0;  /*2 bit bases in word*/
+   unsigned char anonUC = 0;  /*has err3rdBit if N's*/
+   unsigned char ntUC = 0;
+
+   unsigned long forKmerUL = 0; /*forward kmer*/
+   unsigned long revKmerUL = 0; /*reverse complement*/
+   unsigned long lenUL = 0;     /*bases since anonymous*/
 
-   /*Number of sorting rounds*/
-   unsigned long subUL = 0;
-   unsigned long nextUL = 0;
-   unsigned long lastUL = 0;
-   unsigned long onUL = 0;
+   signed long slNt = 0;      /*first base in word*/
+   signed long endSL = 0;     /*last base in word + 1*/
+   signed long slBase = 0;
+   unsigned int numNtUI = 0;  /*bases in word*/
+   unsigned int uiNt = 0;
 
-   /*Variables to incurment loops*/
-   unsigned long siIndex = 0;
-   unsigned long siElm = 0;
+   signed int retNumKmersSI = 0;
+
+   #define topShift_fun10 \
+      (  (sizeof(unsigned long) << 3) \
+       - def_bitsPerKmer_kmerCnt \
+      ) /*moves first base in word to bottom*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun10 Sec02:
-   ^   - find the max search value (number rounds to sort)
+   ^   - pack bases into a word
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*Recursion formsia: h[0] = 1, h[n] = 3 * h[n - 1] +1*/
-   subUL = 1; /*Initialzie first array*/
+   for(slNt = 0; slNt < lenSL; slNt = endSL)
+   { /*Loop: go though sequence one word at a time*/
+      endSL = slNt + def_ntPerUL_kmerCnt;
+
+      if(endSL > lenSL)
+         endSL = lenSL;
+
+      numNtUI = (unsigned int) (endSL - slNt);
+      wordUL = 0;
+      anonUC = 0;
+
+      for(slBase = slNt; slBase < endSL; ++slBase)
+      { /*Loop: pack bases*/
+         ntUC = ntTo2Bit[(unsigned char) seqStr[slBase]];
+         anonUC |= ntUC;
+
+         wordUL <<= def_bitsPerKmer_kmerCnt;
+         wordUL |= (ntUC & 3);
+      } /*Loop: pack bases*/
+
+      /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+      ^ Fun10 Sec03:
+      ^   - add kmers for words with only full kmers
+      \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+      if(
+            ! (anonUC & def_err3rdBit_ntTo2Bit)
+         && lenUL + 1 >= lenKmerUC
+      ){ /*If: every base in word ends a kmer*/
+         wordUL <<=
+              (def_ntPerUL_kmerCnt - numNtUI)
+            * def_bitsPerKmer_kmerCnt;
+            /*first base is at the top of the word*/
+
+         for(uiNt = 0; uiNt < numNtUI; ++uiNt)
+         { /*Loop: add kmers in word*/
+            ntUC =
+               (unsigned char) (wordUL >> topShift_fun10);
+            wordUL <<= def_bitsPerKmer_kmerCnt;
+
+            forKmerUL <<= def_bitsPerKmer_kmerCnt;
+            forKmerUL |= ntUC;
+            forKmerUL &= maskUL;
+            ++forArySI[forKmerUL];
+
+            revKmerUL >>= def_bitsPerKmer_kmerCnt;
+            revKmerUL |=
+               (unsigned long) (ntUC ^ 2) << revShiftUI;
+               /*t (0) <-> a (2), c (1) <-> g (3)*/
+
+            if(revArySI)
+               ++revArySI[revKmerUL];
+         } /*Loop: add kmers in word*/
+
+         lenUL += numNtUI;
+         retNumKmersSI += (signed int) numNtUI;
+         continue;
+      } /*If: every base in word ends a kmer*/
+
+      /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+      ^ Fun10 Sec04:
+      ^   - add kmers for words with anonymous bases
+      \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+      for(slBase = slNt; slBase < endSL; ++slBase)
+      { /*Loop: add kmers one base at a time*/
+         ntUC = ntTo2Bit[(unsigned char) seqStr[slBase]];
+
+         if(ntUC & def_err3rdBit_ntTo2Bit)
+         { /*If: anonymous base or error*/
+            lenUL = 0;
+            continue;
+         } /*If: anonymous base or error*/
+
+         forKmerUL <<= def_bitsPerKmer_kmerCnt;
+         forKmerUL |= ntUC;
+         forKmerUL &= maskUL;
 
-   while(subUL < numElmUL - 1)
-      subUL = (3 * subUL) + 1;
+         revKmerUL >>= def_bitsPerKmer_kmerCnt;
+         revKmerUL |=
+            (unsigned long) (ntUC ^ 2) << revShiftUI;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun10 Sec03:
-   ^   - sort arrays
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+         if(++lenUL < lenKmerUC)
+            continue; /*do not have a full kmer yet*/
 
-   while(subUL > 0)
-   { /*Loop: all rounds*/
-      for(
-         siIndex = 0;
-         siIndex <= subUL;
-         ++siIndex
-      ){ /*Loop: though sub array*/
-         siElm = siIndex;
-
-         for(
-            siElm = siIndex;
-            siElm + subUL <= endUL;
-            siElm += subUL
-         ){ /*Loop: swap elements in subarray*/
-            nextUL = siElm + subUL;
-
-            if(uiAry[siElm] > uiAry[nextUL])
-            { /*If I need to swap an element*/
-               uiAry[siElm] ^= uiAry[nextUL];
-               uiAry[nextUL] ^= uiAry[siElm];
-               uiAry[siElm] ^= uiAry[nextUL];
-
-               dualArySI[siElm] ^= dualArySI[nextUL];
-               dualArySI[nextUL] ^= dualArySI[siElm];
-               dualArySI[siElm] ^= dualArySI[nextUL];
-
-               lastUL = siElm;
-               onUL = siElm;
-
-               while(lastUL >= subUL)
-               { /*loop: move swapped element back*/
-                  lastUL -= subUL;
-
-                  if(uiAry[onUL] > uiAry[lastUL])
-                     break; /*Positioned the element*/
-   
-                  uiAry[onUL] ^= uiAry[lastUL];
-                  uiAry[lastUL] ^= uiAry[onUL];
-                  uiAry[onUL] ^= uiAry[lastUL];
+         ++forArySI[forKmerUL];
 
-                  dualArySI[onUL] ^= dualArySI[lastUL];
-                  dualArySI[lastUL] ^= dualArySI[onUL];
-                  dualArySI[onUL] ^= dualArySI[lastUL];
+         if(revArySI)
+            ++revArySI[revKmerUL];
 
-                  onUL = lastUL;
-               } /*Loop: move swapped element back*/
-            } /*If I need to swap elements*/
-         } /*Loop: swap elements in subarray*/
-      } /*Loop: though sub array*/
+         ++retNumKmersSI;
+      } /*Loop: add kmers one base at a time*/
+   } /*Loop: go though sequence one word at a time*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun10 Sec05:
+   ^   - return number of kmers
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-      subUL = (subUL - 1) / 3; /*Move to next round*/
-   } /*Loop: all rounds*/
-} /*dualSort_kmerCnt*/
+   return retNumKmersSI;
+} /*cntKmers_kmerCnt*/
 
 /*-------------------------------------------------------\
 | Fun11: ntToKmerAry_kmerCnt
@@ -737,16 +731,16 @@ dualSort_kmerCnt(
 |     o length of one kmer
 |   - kmerArySI:
 |     o pointer to a signed int array to add kmer so
-|     o needs to be size of ((lenKmerUC ^ 4) + 1)
+|     o needs 4^lenKmerUC + 1 items
 |   - cntArySI:
 |     o pointer to a signed int array to add kmer counts
 |       to
-|     o needs to be size of ((lenKmerUC ^ 4) + 1)
+|     o needs 4^lenKmerUC + 1 items
 | Output:
 |   - Modifies:
 |     o kmerArySI to hold kmers in seqSTPtr
 |     o cntArySI to hold number times each kmer happened
-|     o sorts kmerArySI and cntArySI by kmer
+|     o kmerArySI and cntArySI are sorted by kmer
 |       - this converts the hash table to a list of kmers
 |       - end will be marked with a -2
 |   - Returns:
@@ -765,11 +759,11 @@ ntToKmerAry_kmerCnt(
    '   o fun11 sec01:
    '     - variable declerations
    '   o fun11 sec02:
-   '     - initialize (blank) the array
+   '     - initialize (blank) the count array
    '   o fun11 sec03:
    '     - get kmer counts
    '   o fun11 sec04:
-   '     - sort and return
+   '     - convert count table to kmer list and return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -777,93 +771,73 @@ ntToKmerAry_kmerCnt(
    ^   - variable declerations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   signed long slNt = 0;      /*nucleotide on*/
    unsigned int maxKmersUI = 1;
-
-   /*for getting kmers*/
-   unsigned long maskUL = 0;    /*for removing extra nt*/
-   signed long slSeq = 0;     /*nucleotide on*/
-
-   unsigned char ntUC = 0;   /*nucleotide to add to kmer*/
-   unsigned long kmerUL = 0; /*holds forward kmer*/
-   unsigned long lenUL = 0;
-      /*# nt since last anonymous nt*/
+   unsigned int uiKmer = 0;
+   unsigned int uiUniq = 0;   /*unique kmers in array*/
 
    signed int retNumKmersSI = 0;
        /*number kmers in sequence*/
    
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun11 Sec02:
-   ^   - initialize (blank) the array
+   ^   - initialize (blank) the count array
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   maskUL = mkKmerMask_kmerCnt(lenKmerUC);
-
    for(
-      slNt = 0;
-      slNt < lenKmerUC;
-      ++slNt
+      uiKmer = 0;
+      uiKmer < lenKmerUC;
+      ++uiKmer
    ) maxKmersUI <<= 2;
 
    for(
-      slSeq  = 0;
-      slSeq <= maxKmersUI;
-      ++slSeq
-   ){ /*Loop: blank kmer array*/
-      kmerArySI[slSeq] = def_noKmer_kmerCnt;
-      cntArySI[slSeq] = 0;
-   } /*Loop: blank kmer array*/
+      uiKmer = 0;
+      uiKmer <= maxKmersUI;
+      ++uiKmer
+   ) cntArySI[uiKmer] = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun11 Sec03:
    ^   - get kmer counts
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   for(
-      slSeq  = 0;
-      slSeq < seqSTPtr->seqLenSL;
-      ++slSeq
-   ){ /*Loop: convert kmers*/
-      ntUC =
-         ntTo2Bit[
-            (unsigned char)
-            seqSTPtr->seqStr[slSeq]
-         ]; /*get foward nucleotide*/
-
-      /*add nucleotide to kmer*/
-      kmerUL <<= def_bitsPerKmer_kmerCnt;
-      kmerUL |= ntUC;
-
-      if(ntUC != def_err3rdBit_ntTo2Bit)
-      { /*If: no anymous bases or errors*/
-         kmerUL &= maskUL;
-         ++lenUL;
-
-         if(lenUL >= lenKmerUC)
-         { /*If: had a forward kmer*/
-            ++retNumKmersSI;
-            kmerArySI[kmerUL] = kmerUL; /*for sorting*/
-            ++cntArySI[kmerUL];
-         } /*If: had a forward kmer*/
-      } /*If: no anymous bases or errors*/
-
-      else
-         lenUL = 0;
-   } /*Loop: convert kmers*/
+   retNumKmersSI =
+      cntKmers_kmerCnt(
+         seqSTPtr->seqStr,
+         seqSTPtr->seqLenSL,
+         lenKmerUC,
+         cntArySI,
+         0        /*do not need reverse complement*/
+      );
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Fun11 Sec04:
-   ^   - sort and return
+   ^   - convert count table to kmer list and return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   dualSort_kmerCnt(
-       (unsigned int *) kmerArySI,
-       cntArySI,
-       0,
-       maxKmersUI
-   ); /*sort kmers by kmer id*/
-
-    return retNumKmersSI;
+   /*the count table index is the kmer, so moving kmers
+   `  with counts to the front keeps the list sorted; uiUniq
+   `  is never past uiKmer, so no counts are lost
+   */
+   for(
+      uiKmer = 0;
+      uiKmer < maxKmersUI;
+      ++uiKmer
+   ){ /*Loop: move found kmers to front of array*/
+      kmerArySI[uiUniq] = (signed int) uiKmer;
+      cntArySI[uiUniq] = cntArySI[uiKmer];
+      uiUniq += (cntArySI[uiKmer] != 0);
+   } /*Loop: move found kmers to front of array*/
+
+   kmerArySI[uiUniq] = def_endKmers_kmerCnt;
+   cntArySI[uiUniq] = 0;
+
+   while(++uiUniq <= maxKmersUI)
+   { /*Loop: blank unused part of array*/
+      kmerArySI[uiUniq] = def_noKmer_kmerCnt;
+      cntArySI[uiUniq] = 0;
+   } /*Loop: blank unused part of array*/
+
+   return retNumKmersSI;
 } /*ntToKmerAry_kmerCnt*/
 
 /*-------------------------------------------------------\
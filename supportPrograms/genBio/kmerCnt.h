@@ -22,9 +22,9 @@
 '       kmer
 '   o fun09: addSeq_kmerCnt
 '     - adds a sequence to a kmerCnt structure
-'   o .c fun10: dualSort_kmerCnt
-'     - sorts first unsigned int array and keeps second
-'       signed int array in order with first
+'   o fun10: cntKmers_kmerCnt
+'     - counts the forward and reverse complement kmers in
+'       a sequence one unsigned long at a time
 '   o fun11: ntToKmerAry_kmerCnt
 '     - converts a nucleotide sequence to a array of kmer
 '       counts
@@ -51,6 +51,8 @@ struct seqST;
 #define def_noKmer_kmerCnt -1
 #define def_endKmers_kmerCnt -2
 #define def_bitsPerKmer_kmerCnt 2 /*do not change*/
+#define def_ntPerUL_kmerCnt (sizeof(unsigned long) << 2)
+   /*bases in one unsigned long (2 bits per base)*/
 
 #define def_noMatch_kmerCnt 1
 #define def_fileErr_kmerCnt 2
@@ -235,6 +237,43 @@ addSeq_kmerCnt(
    struct seqST *seqSTPtr   /*sequence to copy*/
 );
 
+/*-------------------------------------------------------\
+| Fun10: cntKmers_kmerCnt
+|   - counts the forward and reverse complement kmers in
+|     a sequence one unsigned long (32 bases on 64 bit
+|     cpus) at a time
+| Input:
+|   - seqStr:
+|     o c-string with sequence to count kmers for
+|   - lenSL:
+|     o number of bases in seqStr
+|   - lenKmerUC:
+|     o length of one kmer
+|   - forArySI:
+|     o signed int array to add forward kmer counts to
+|     o needs 4^lenKmerUC (1 << (2 * lenKmerUC)) items
+|   - revArySI:
+|     o signed int array to add reverse complement kmer
+|       counts to (same as forArySI for the reverse
+|       complement of seqStr)
+|     o needs 4^lenKmerUC (1 << (2 * lenKmerUC)) items
+|     o use 0 to only count forward kmers
+| Output:
+|   - Modifies:
+|     o forArySI to have the forward kmer counts added
+|     o revArySI to have the reverse kmer counts added
+|   - Returns:
+|     o number of kmers in seqStr
+\-------------------------------------------------------*/
+signed int
+cntKmers_kmerCnt(
+   signed char *seqStr,     /*sequence to count*/
+   signed long lenSL,       /*number bases in seqStr*/
+   unsigned char lenKmerUC, /*length of one kmer*/
+   signed int *forArySI,    /*gets forward kmer counts*/
+   signed int *revArySI     /*gets reverse kmer counts*/
+);
+
 /*-------------------------------------------------------\
 | Fun11: ntToKmerAry_kmerCnt
 |   - converts a nucleotide sequence to a array of kmer
@@ -247,16 +286,16 @@ addSeq_kmerCnt(
 |     o length of one kmer
 |   - kmerArySI:
 |     o pointer to a signed int array to add kmer so
-|     o needs to be size of ((lenKmerUC ^ 4) + 1)
+|     o needs 4^lenKmerUC + 1 items
 |   - cntArySI:
 |     o pointer to a signed int array to add kmer counts
 |       to
-|     o needs to be size of ((lenKmerUC ^ 4) + 1)
+|     o needs 4^lenKmerUC + 1 items
 | Output:
 |   - Modifies:
 |     o kmerArySI to hold kmers in seqSTPtr
 |     o cntArySI to hold number times each kmer happened
-|     o sorts kmerArySI and cntArySI by kmer
+|     o kmerArySI and cntArySI are sorted by kmer
 |       - this converts the hash table to a list of kmers
 |       - end will be marked with a -2
 |   - Returns:
@@ -96,6 +96,7 @@ seqToKmer_kmerFun(
          malloc( (lenSeqSI + 8) * sizeof(signed int) );
       if(! *kmerArySIPtr)
          goto memErr_fun01_sec04;
+      *sizeSIPtr = lenSeqSI;
    } /*If: need to allocate memory*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -137,7 +138,13 @@ seqToKmer_kmerFun(
       } /*If: no errors/anonymous bases*/
 
       else
+      { /*Else: anonymous base; no kmer*/
          lenUL = 0;
+
+         if(siNt >= kmerLenUC)
+            (*kmerArySIPtr)[siNt - kmerLenUC] =
+                def_noKmer_kmerBit;
+      } /*Else: anonymous base; no kmer*/
    }  /*Loop: add kmers*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -7,8 +7,9 @@
 '     - system line break variables
 '   o .h st01 samEntry:
 '     - holds a single samfile entry
-'   o .h st02: refs_samEntry
-'     - holds reference length & name from sam file header
+'   o .h st02: view_samEntry
+'     - where each column is in a sam file line (no
+'       copying)
 '   o fun01 blank_samEntry:
 '     - sets all non-alloacted variables in samEntry to 0
 '   o fun02 init_samEntry:
@@ -59,6 +60,31 @@
 '   o fun21: checkCigSize_samEntry
 '     - checks to see if I need to resize cigar and if
 '       needed resizes the cigar
+'   o fun22: init_view_samEntry
+'     - initializes a view_samEntry struct
+'   o fun23: freeStack_view_samEntry
+'     - frees the cigar arrays in a view_samEntry struct
+'   o fun24: lineTo_view_samEntry
+'     - finds the columns in a sam file line without
+'       copying them
+'   o fun25: cig_view_samEntry
+'     - decodes the cigar entry in a view_samEntry struct
+'   o fun26: qStats_view_samEntry
+'     - finds the mean and median q-scores of the read in
+'       a view_samEntry struct
+'   o fun27: toSam_view_samEntry
+'     - copies the line in a view_samEntry struct into a
+'       samEntry struct
+'   o fun28: get_view_samEntry
+'     - reads a line from a sam file and views it
+'   o fun29: pbinHead_samEntry
+'     - prints the header for a binary sam file
+'   o fun30: getBinHead_samEntry
+'     - reads and checks the header of a binary sam file
+'   o fun31: pbin_samEntry
+'     - prints a samEntry struct as a binary sam record
+'   o fun32: getBin_samEntry
+'     - reads a binary sam record into a samEntry struct
 '   o .h note01:
 '      - Notes about the sam file format from the sam file
 '        pdf
@@ -2968,7 +2994,12 @@ p_samEntry(
    fwrite(buffStr, char_fun15, lenSI, samFILE);
 
    /*sequence print*/
-   if(samSTPtr->seqStr[0])
+   if(
+         samSTPtr->seqStr[0] == '*'
+      && samSTPtr->seqStr[1] == '\0'
+   ) fputc('*', (FILE *) samFILE);
+     /*readLenUI may be from the cigar*/
+   else if(samSTPtr->seqStr[0])
       fwrite(
          samSTPtr->seqStr,
          char_fun15,
@@ -3868,6 +3899,1495 @@ checkCigSize_samEntry(
       return 1;
 }  /*checkCigSize_samEntry*/
 
+/*-------------------------------------------------------\
+| Fun22: init_view_samEntry
+|   - initializes a view_samEntry struct (call once
+|     before using the struct)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to initialize
+| Output:
+|   - Modifies:
+|     o all variables in viewSTPtr to be 0 or null
+\-------------------------------------------------------*/
+void
+init_view_samEntry(
+   struct view_samEntry *viewSTPtr
+){
+   unsigned int uiCol = 0;
+
+   viewSTPtr->lineStr = 0;
+
+   for(uiCol = 0; uiCol < def_numCol_samEntry; ++uiCol)
+   { /*Loop: blank columns*/
+      viewSTPtr->startAryUI[uiCol] = 0;
+      viewSTPtr->lenAryUI[uiCol] = 0;
+   } /*Loop: blank columns*/
+
+   viewSTPtr->flagUS = 0;
+   viewSTPtr->mapqUC = 0;
+   viewSTPtr->refStartUI = 0;
+
+   viewSTPtr->cigBl = 0;
+   viewSTPtr->cigTypeStr = 0;
+   viewSTPtr->cigArySI = 0;
+   viewSTPtr->cigLenUI = 0;
+   viewSTPtr->cigSizeUI = 0;
+
+   viewSTPtr->refEndUI = 0;
+   viewSTPtr->readLenUI = 0;
+   viewSTPtr->alnReadLenUI = 0;
+
+   viewSTPtr->matchCntUI = 0;
+   viewSTPtr->snpCntUI = 0;
+   viewSTPtr->insCntUI = 0;
+   viewSTPtr->delCntUI = 0;
+   viewSTPtr->maskCntUI = 0;
+
+   viewSTPtr->qBl = 0;
+   viewSTPtr->medianQF = 0;
+   viewSTPtr->meanQF = 0;
+} /*init_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun23: freeStack_view_samEntry
+|   - frees the cigar arrays in a view_samEntry struct
+|     (the line is not freed, it is owned by the caller)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with memory to
+|       free
+| Output:
+|   - Frees:
+|     o cigTypeStr and cigArySI in viewSTPtr
+|   - Modifies:
+|     o all variables in viewSTPtr to be 0 or null
+\-------------------------------------------------------*/
+void
+freeStack_view_samEntry(
+   struct view_samEntry *viewSTPtr
+){
+   if(! viewSTPtr)
+      return;
+
+   if(viewSTPtr->cigTypeStr)
+      free(viewSTPtr->cigTypeStr);
+   if(viewSTPtr->cigArySI)
+      free(viewSTPtr->cigArySI);
+
+   init_view_samEntry(viewSTPtr);
+} /*freeStack_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun24: lineTo_view_samEntry
+|   - finds the columns in a sam file line without
+|     copying them
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to set up
+|   - lineStr:
+|     o c-string with sam file line to view
+|     o must not be changed or freed while viewSTPtr is
+|       used
+| Output:
+|   - Modifies:
+|     o lineStr in viewSTPtr to point to lineStr
+|     o startAryUI and lenAryUI in viewSTPtr to have the
+|       start and length of each column
+|       * headers (@) are put in the extra column
+|     o flagUS, mapqUC, and refStartUI (index 0) in
+|       viewSTPtr to have the line's values
+|     o cigBl and qBl in viewSTPtr to be 0 (not found)
+|   - Returns:
+|     o 0 for success
+|     o def_fileErr_samEntry if the line has less than
+|       11 tab separated columns
+\-------------------------------------------------------*/
+signed char
+lineTo_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   signed char *lineStr
+){
+   unsigned int uiCol = 0;
+   unsigned int posUI = 0;
+   unsigned int lenUI = 0;
+
+   viewSTPtr->lineStr = lineStr;
+   viewSTPtr->cigBl = 0;
+   viewSTPtr->qBl = 0;
+
+   viewSTPtr->flagUS = 0;
+   viewSTPtr->mapqUC = 0;
+   viewSTPtr->refStartUI = 0;
+
+   for(uiCol = 0; uiCol < def_numCol_samEntry; ++uiCol)
+   { /*Loop: blank columns*/
+      viewSTPtr->startAryUI[uiCol] = 0;
+      viewSTPtr->lenAryUI[uiCol] = 0;
+   } /*Loop: blank columns*/
+
+   if(lineStr[0] == '@')
+   { /*If: header or comment*/
+      uiCol = def_extraCol_samEntry;
+      goto extraCol_fun24;
+   } /*If: header or comment*/
+
+   for(uiCol = 0; uiCol < def_extraCol_samEntry; ++uiCol)
+   { /*Loop: find the mandatory columns*/
+      lenUI =
+         lenStrNull_ulCp(
+            &lineStr[posUI],
+            def_tab_ulCp,
+            '\t'
+         );
+
+      viewSTPtr->startAryUI[uiCol] = posUI;
+      viewSTPtr->lenAryUI[uiCol] = lenUI;
+      posUI += lenUI;
+
+      if(lineStr[posUI] != '\t')
+         break; /*end of line*/
+      ++posUI; /*get off tab*/
+   } /*Loop: find the mandatory columns*/
+
+   if(uiCol < def_qCol_samEntry)
+      return def_fileErr_samEntry; /*missing columns*/
+
+   extraCol_fun24:;
+      if(uiCol == def_extraCol_samEntry)
+      { /*If: have extra entries or a header*/
+         viewSTPtr->startAryUI[uiCol] = posUI;
+         viewSTPtr->lenAryUI[uiCol] =
+            endStr_ulCp(&lineStr[posUI]);
+      } /*If: have extra entries or a header*/
+
+   while(viewSTPtr->lenAryUI[uiCol])
+   { /*Loop: remove line break from last column*/
+      lenUI =
+           viewSTPtr->startAryUI[uiCol]
+         + viewSTPtr->lenAryUI[uiCol]
+         - 1;
+
+      if(lineStr[lenUI] > 32)
+         break;
+
+      --viewSTPtr->lenAryUI[uiCol];
+   } /*Loop: remove line break from last column*/
+
+   if(lineStr[0] == '@')
+      return 0; /*headers have no numbers to get*/
+
+   strToUS_base10str(
+      col_view_samEntry(viewSTPtr, def_flagCol_samEntry),
+      &viewSTPtr->flagUS
+   );
+
+   strToUI_base10str(
+      col_view_samEntry(viewSTPtr, def_posCol_samEntry),
+      &viewSTPtr->refStartUI
+   );
+   viewSTPtr->refStartUI -= (viewSTPtr->refStartUI > 0);
+      /*convert to index 0*/
+
+   strToUC_base10str(
+      col_view_samEntry(viewSTPtr, def_mapqCol_samEntry),
+      &viewSTPtr->mapqUC
+   );
+
+   return 0;
+} /*lineTo_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun25: cig_view_samEntry
+|   - decodes the cigar entry in a view_samEntry struct
+|     (does nothing if the cigar was already decoded)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with cigar to
+|       decode (lineTo_view_samEntry was called)
+| Output:
+|   - Modifies:
+|     o cigTypeStr, cigArySI, and cigLenUI in viewSTPtr to
+|       have the cigar (resized if needed)
+|     o refEndUI, readLenUI, alnReadLenUI, matchCntUI,
+|       snpCntUI, insCntUI, delCntUI, and maskCntUI in
+|       viewSTPtr to have the values from the cigar
+|     o cigBl in viewSTPtr to be 1
+|   - Returns:
+|     o 0 for success
+|     o def_memErr_samEntry for memory errors
+\-------------------------------------------------------*/
+signed char
+cig_view_samEntry(
+   struct view_samEntry *viewSTPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun25 TOC:
+   '   - decodes the cigar entry in a view_samEntry struct
+   '   o fun25 sec01:
+   '     - variable declarations and check if decoded
+   '   o fun25 sec02:
+   '     - make sure have enough memory for the cigar
+   '   o fun25 sec03:
+   '     - decode the cigar
+   '   o fun25 sec04:
+   '     - get read lengths and return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun25 Sec01:
+   ^   - variable declarations and check if decoded
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *cigStr =
+      col_view_samEntry(viewSTPtr, def_cigCol_samEntry);
+   unsigned int lenCigUI =
+      colLen_view_samEntry(viewSTPtr, def_cigCol_samEntry);
+   unsigned int uiCig = 0;
+   unsigned int sizeUI = 0;
+   signed char *tmpStr = 0;
+
+   if(viewSTPtr->cigBl)
+      return 0;
+
+   viewSTPtr->cigLenUI = 0;
+   viewSTPtr->matchCntUI = 0;
+   viewSTPtr->snpCntUI = 0;
+   viewSTPtr->insCntUI = 0;
+   viewSTPtr->delCntUI = 0;
+   viewSTPtr->maskCntUI = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun25 Sec02:
+   ^   - make sure have enough memory for the cigar
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*cigar has at most (column length / 2) entries, so
+   `  one check covers the whole cigar
+   */
+   sizeUI = (lenCigUI >> 1) + 2;
+
+   if(sizeUI > viewSTPtr->cigSizeUI)
+   { /*If: need more memory*/
+      if(sizeUI < 16)
+         sizeUI = 16;
+
+      tmpStr =
+         realloc(
+            viewSTPtr->cigTypeStr,
+            sizeUI * sizeof(signed char)
+         );
+      if(! tmpStr)
+         goto memErr_fun25_sec04;
+      viewSTPtr->cigTypeStr = tmpStr;
+
+      tmpStr =
+         (signed char *)
+         realloc(
+            viewSTPtr->cigArySI,
+            sizeUI * sizeof(signed int)
+         );
+      if(! tmpStr)
+         goto memErr_fun25_sec04;
+      viewSTPtr->cigArySI = (signed int *) tmpStr;
+
+      viewSTPtr->cigSizeUI = sizeUI;
+   } /*If: need more memory*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun25 Sec03:
+   ^   - decode the cigar
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! lenCigUI || cigStr[0] == '*')
+   { /*If: no cigar entry*/
+      viewSTPtr->cigTypeStr[0] = '*';
+      viewSTPtr->cigArySI[0] = 0;
+      viewSTPtr->cigLenUI = 1;
+      goto noCig_fun25_sec04;
+   } /*If: no cigar entry*/
+
+   while(uiCig < lenCigUI)
+   { /*Loop: decode cigar entries*/
+      uiCig +=
+         strToSI_base10str(
+            &cigStr[uiCig],
+            &viewSTPtr->cigArySI[viewSTPtr->cigLenUI]
+         );
+
+      viewSTPtr->cigTypeStr[viewSTPtr->cigLenUI] =
+         cigStr[uiCig];
+
+      switch(cigStr[uiCig])
+      { /*Switch: count the cigar entry type*/
+         case '=':
+         case 'M':
+            viewSTPtr->matchCntUI +=
+               viewSTPtr->cigArySI[viewSTPtr->cigLenUI];
+            break;
+
+         case 'X':
+            viewSTPtr->snpCntUI +=
+               viewSTPtr->cigArySI[viewSTPtr->cigLenUI];
+            break;
+
+         case 'I':
+            viewSTPtr->insCntUI +=
+               viewSTPtr->cigArySI[viewSTPtr->cigLenUI];
+            break;
+
+         case 'D':
+            viewSTPtr->delCntUI +=
+               viewSTPtr->cigArySI[viewSTPtr->cigLenUI];
+            break;
+
+         case 'S':
+            viewSTPtr->maskCntUI +=
+               viewSTPtr->cigArySI[viewSTPtr->cigLenUI];
+            break;
+      } /*Switch: count the cigar entry type*/
+
+      ++uiCig;
+      ++viewSTPtr->cigLenUI;
+   } /*Loop: decode cigar entries*/
+
+   viewSTPtr->cigArySI[viewSTPtr->cigLenUI] = 0;
+   viewSTPtr->cigTypeStr[viewSTPtr->cigLenUI] = '\0';
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun25 Sec04:
+   ^   - get read lengths and return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   noCig_fun25_sec04:;
+
+   viewSTPtr->readLenUI =
+        viewSTPtr->matchCntUI
+      + viewSTPtr->snpCntUI
+      + viewSTPtr->insCntUI
+      + viewSTPtr->maskCntUI;
+
+   if(
+         ! viewSTPtr->readLenUI
+      && *col_view_samEntry(viewSTPtr, def_seqCol_samEntry)
+         != '*'
+   ) viewSTPtr->readLenUI =
+        colLen_view_samEntry(viewSTPtr,def_seqCol_samEntry);
+     /*same as lineTo_samEntry for no cigar*/
+
+   viewSTPtr->alnReadLenUI =
+        viewSTPtr->matchCntUI
+      + viewSTPtr->snpCntUI
+      + viewSTPtr->delCntUI;
+
+   viewSTPtr->refEndUI = viewSTPtr->refStartUI;
+   viewSTPtr->refEndUI += viewSTPtr->alnReadLenUI;
+   viewSTPtr->refEndUI -= (viewSTPtr->alnReadLenUI > 0);
+      /*-1 from (alnReadLen > 0) converts to index 0*/
+
+   viewSTPtr->cigBl = 1;
+   return 0;
+
+   memErr_fun25_sec04:;
+      return def_memErr_samEntry;
+} /*cig_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun26: qStats_view_samEntry
+|   - finds the mean and median q-scores of the read in a
+|     view_samEntry struct (does nothing if already found)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to find q-scores
+|       for (lineTo_view_samEntry was called)
+| Output:
+|   - Modifies:
+|     o meanQF and medianQF in viewSTPtr to have the mean
+|       and median q-scores (0 if no q-score entry)
+|     o qBl in viewSTPtr to be 1
+\-------------------------------------------------------*/
+void
+qStats_view_samEntry(
+   struct view_samEntry *viewSTPtr
+){
+   signed char *qStr =
+      col_view_samEntry(viewSTPtr, def_qCol_samEntry);
+   unsigned int lenQUI =
+      colLen_view_samEntry(viewSTPtr, def_qCol_samEntry);
+   unsigned int qHistUI[def_maxQ_samEntry + 8];
+   unsigned long sumQUL = 0;
+   unsigned int uiQ = 0;
+   unsigned int numBasesUI = 0;
+   unsigned int midPointUI = 0;
+   unsigned int qScoreUI = 0;
+
+   if(viewSTPtr->qBl)
+      return;
+
+   viewSTPtr->qBl = 1;
+   viewSTPtr->meanQF = 0;
+   viewSTPtr->medianQF = 0;
+
+   if(! lenQUI || (lenQUI == 1 && qStr[0] == '*'))
+      return; /*no q-score entry*/
+
+   for(uiQ = 0; uiQ < def_maxQ_samEntry + 8; ++uiQ)
+      qHistUI[uiQ] = 0;
+
+   for(uiQ = 0; uiQ < lenQUI; ++uiQ)
+   { /*Loop: build q-score histogram*/
+      qScoreUI =
+         (unsigned int)
+         ((unsigned char) qStr[uiQ] - def_adjQ_samEntry);
+
+      if(qScoreUI > def_maxQ_samEntry)
+         qScoreUI = def_maxQ_samEntry;
+
+      ++qHistUI[qScoreUI];
+      sumQUL += qScoreUI;
+   } /*Loop: build q-score histogram*/
+
+   viewSTPtr->meanQF = (float) sumQUL / (float) lenQUI;
+
+   /*same method as qhistToMed_samEntry (fun07)*/
+   midPointUI = lenQUI >> 1;
+
+   for(uiQ = 0; uiQ < def_maxQ_samEntry; ++uiQ)
+   { /*Loop: find the median*/
+      numBasesUI += qHistUI[uiQ];
+
+      if(numBasesUI >= midPointUI)
+      { /*If: found the midpoint*/
+         if(numBasesUI > midPointUI || numBasesUI & 1)
+            viewSTPtr->medianQF = (float) uiQ;
+
+         else
+         { /*Else: even; two q-scores at midpoint*/
+            numBasesUI = uiQ;
+            ++uiQ;
+
+            while(qHistUI[uiQ++] == 0) ;
+            --uiQ;
+
+            viewSTPtr->medianQF =
+               (numBasesUI + uiQ) / ((float) 2);
+         } /*Else: even; two q-scores at midpoint*/
+
+         break;
+      } /*If: found the midpoint*/
+   } /*Loop: find the median*/
+} /*qStats_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun27: toSam_view_samEntry
+|   - copies the line in a view_samEntry struct into a
+|     samEntry struct (for functions that need samEntry)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with line to copy
+|   - samSTPtr:
+|     o pointer to samEntry struct to copy line to
+| Output:
+|   - Modifies:
+|     o samSTPtr to have the line (see lineTo_samEntry)
+|   - Returns:
+|     o 0 for success
+|     o def_memErr_samEntry for memory errors
+\-------------------------------------------------------*/
+signed char
+toSam_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   struct samEntry *samSTPtr
+){
+   return lineTo_samEntry(samSTPtr, viewSTPtr->lineStr);
+} /*toSam_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun28: get_view_samEntry
+|   - reads a line from a sam file and views it
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to view line with
+|   - buffStrPtr:
+|     o pointer to c-string to read the line into; resized
+|       if needed (use 0 for a new buffer)
+|     o the view points into this buffer, so it is only
+|       good until the next call
+|   - sizeBuffSLPtr:
+|     o pointer to signed long with size of buffStrPtr
+|   - samFILE:
+|     o sam file to read the line from
+| Output:
+|   - Modifies:
+|     o viewSTPtr to view the next line
+|     o buffStrPtr and sizeBuffSLPtr if buffStrPtr is
+|       resized
+|     o samFILE to be on the next line
+|   - Returns:
+|     o 0 for success
+|     o def_EOF_samEntry for EOF (End Of File)
+|     o def_memErr_samEntry for memory errors
+|     o def_fileErr_samEntry for file errors
+\-------------------------------------------------------*/
+signed char
+get_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   signed char **buffStrPtr,
+   signed long *sizeBuffSLPtr,
+   void *samFILE
+){
+   signed long lenSL = 0;
+   signed long bytesSL = 0;
+
+   do{ /*Loop: get past blank lines*/
+      lenSL =
+         getFullLine_fileFun(
+            samFILE,
+            buffStrPtr,
+            sizeBuffSLPtr,
+            &bytesSL,
+            0
+         );
+
+      if(! lenSL)
+         return def_EOF_samEntry;
+      else if(lenSL < 0)
+         return def_memErr_samEntry;
+   } while(
+         (*buffStrPtr)[0] == '\n'
+      || (*buffStrPtr)[0] == '\r'
+   ); /*Loop: get past blank lines*/
+
+   return lineTo_view_samEntry(viewSTPtr, *buffStrPtr);
+} /*get_view_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun29: pbinHead_samEntry
+|   - prints the header (magic number and version) for a
+|     binary sam file (pbin_samEntry)
+| Input:
+|   - outFILE:
+|     o FILE pointer to print header to
+| Output:
+|   - Prints:
+|     o "SAMB", def_binVersion_samEntry, and three null
+|       bytes to outFILE (def_binHeadLen_samEntry bytes)
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_samEntry if could not write header
+\-------------------------------------------------------*/
+signed char
+pbinHead_samEntry(
+   void *outFILE
+){
+   unsigned char headAryUC[def_binHeadLen_samEntry];
+
+   headAryUC[0] = 'S';
+   headAryUC[1] = 'A';
+   headAryUC[2] = 'M';
+   headAryUC[3] = 'B';
+   headAryUC[4] = def_binVersion_samEntry;
+   headAryUC[5] = 0;
+   headAryUC[6] = 0;
+   headAryUC[7] = 0;
+
+   if(
+      fwrite(
+         headAryUC,
+         sizeof(unsigned char),
+         def_binHeadLen_samEntry,
+         (FILE *) outFILE
+      ) != def_binHeadLen_samEntry
+   ) return def_fileErr_samEntry;
+
+   return 0;
+} /*pbinHead_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun30: getBinHead_samEntry
+|   - reads and checks the header of a binary sam file
+| Input:
+|   - inFILE:
+|     o FILE pointer to binary sam file (at start)
+| Output:
+|   - Modifies:
+|     o inFILE to be on the first record
+|   - Returns:
+|     o 0 for no errors
+|     o def_EOF_samEntry if the file is empty
+|     o def_fileErr_samEntry if not a binary sam file or
+|       is a newer version
+\-------------------------------------------------------*/
+signed char
+getBinHead_samEntry(
+   void *inFILE
+){
+   unsigned char headAryUC[def_binHeadLen_samEntry];
+   unsigned long lenUL = 0;
+
+   lenUL =
+      fread(
+         headAryUC,
+         sizeof(unsigned char),
+         def_binHeadLen_samEntry,
+         (FILE *) inFILE
+      );
+
+   if(! lenUL)
+      return def_EOF_samEntry;
+   else if(lenUL != def_binHeadLen_samEntry)
+      return def_fileErr_samEntry;
+
+   if(
+         headAryUC[0] != 'S'
+      || headAryUC[1] != 'A'
+      || headAryUC[2] != 'M'
+      || headAryUC[3] != 'B'
+   ) return def_fileErr_samEntry;
+
+   if(headAryUC[4] > def_binVersion_samEntry)
+      return def_fileErr_samEntry;
+
+   return 0;
+} /*getBinHead_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun31: pbin_samEntry
+|   - prints a samEntry struct as a binary sam record
+| Input:
+|   - samSTPtr:
+|     o pointer to samEntry struct to print
+|   - outFILE:
+|     o FILE pointer to print record to
+| Output:
+|   - Prints:
+|     o samSTPtr as a binary record to outFILE; numbers
+|       are little endian (same on every machine)
+|       * 0: record length (unsigned int; bytes after
+|            this entry)
+|       * 4: record type (unsigned char)
+|            - def_binHead_samEntry: header/comment, the
+|              rest of the record is the line
+|            - def_binAln_samEntry: alignment
+|       * 5: query id length (unsigned char)
+|       * 6: reference id length (unsigned char)
+|       * 7: RNEXT length (unsigned char)
+|       * 8: flag (unsigned short)
+|       * 10: mapq (unsigned char)
+|       * 11: def_binSeq_samEntry | def_binQ_samEntry if
+|             have a sequence and q-scores
+|       * 12: reference start (unsigned int; index 0)
+|       * 16: PNEXT (signed int; as in samEntry)
+|       * 20: TLEN (signed int)
+|       * 24: number of cigar entries (unsigned int)
+|       * 28: sequence length (unsigned int)
+|       * 32: extra entry length (unsigned int)
+|       * 36: query id, reference id, and RNEXT
+|       * cigar entries (unsigned int; number << 4 | op)
+|         with op being the index in "MIDNSHP=X"
+|       * sequence; 4 bits per base (first base in high
+|         bits), index in "=ACMGRSVTWYHKDBN" (lower case
+|         bases are upper case and non-bases are N)
+|       * q-scores (as in the sam file)
+|       * extra entry
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_samEntry if could not write the
+|       record, the cigar has an unkown entry, or the
+|       record is over def_binMaxRec_samEntry bytes
+\-------------------------------------------------------*/
+signed char
+pbin_samEntry(
+   struct samEntry *samSTPtr,
+   void *outFILE
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun31 TOC:
+   '   - prints a samEntry struct as a binary sam record
+   '   o fun31 sec01:
+   '     - variable declarations
+   '   o fun31 sec02:
+   '     - print headers/comments
+   '   o fun31 sec03:
+   '     - find lengths and print fixed length entries
+   '   o fun31 sec04:
+   '     - print ids and cigar
+   '   o fun31 sec05:
+   '     - print sequence, q-scores, and extra entry
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun31 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   #define size_fun31 256
+   unsigned char buffAryUC[size_fun31];
+   signed char *cigOpStr = (signed char *) "MIDNSHP=X";
+   unsigned int lenUI = 0;    /*bytes in buffAryUC*/
+   unsigned int recLenUI = 0; /*bytes in record*/
+   unsigned int cigLenUI = 0;
+   unsigned int seqLenUI = 0;
+   unsigned int extraLenUI = 0;
+   unsigned int uiPos = 0;
+   unsigned int valUI = 0;
+   unsigned char seqFlagUC = 0;
+   unsigned char opUC = 0;
+   FILE *binFILE = (FILE *) outFILE;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun31 Sec02:
+   ^   - print headers/comments
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(
+         samSTPtr->extraStr[0] == '@'
+      && samSTPtr->qryIdStr[0] == '\0'
+   ){ /*If: header (same check as p_samEntry)*/
+      extraLenUI = endStr_ulCp(samSTPtr->extraStr);
+      recLenUI = extraLenUI + 1;
+
+      if(recLenUI > def_binMaxRec_samEntry)
+         goto fileErr_fun31; /*getBin can not read*/
+
+      buffAryUC[0] = (unsigned char) recLenUI;
+      buffAryUC[1] = (unsigned char) (recLenUI >> 8);
+      buffAryUC[2] = (unsigned char) (recLenUI >> 16);
+      buffAryUC[3] = (unsigned char) (recLenUI >> 24);
+      buffAryUC[4] = def_binHead_samEntry;
+
+      if(fwrite(buffAryUC, 1, 5, binFILE) != 5)
+         goto fileErr_fun31;
+
+      if(
+         fwrite(samSTPtr->extraStr,1,extraLenUI,binFILE)
+         != extraLenUI
+      ) goto fileErr_fun31;
+
+      return 0;
+   } /*If: header (same check as p_samEntry)*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun31 Sec03:
+   ^   - find lengths and print fixed length entries
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(
+         samSTPtr->cigTypeStr[0] != '\0'
+      && samSTPtr->cigTypeStr[0] != '*'
+   ) cigLenUI = samSTPtr->cigLenUI;
+
+   if(
+         samSTPtr->seqStr[0] != '\0'
+      && ! (
+               samSTPtr->seqStr[0] == '*'
+            && samSTPtr->seqStr[1] == '\0'
+          )
+   ){ /*If: have a sequence*/
+      seqFlagUC = def_binSeq_samEntry;
+      seqLenUI = samSTPtr->readLenUI;
+
+      if(
+            samSTPtr->qStr[0] != '\0'
+         && ! (
+                  samSTPtr->qStr[0] == '*'
+               && samSTPtr->qStr[1] == '\0'
+             )
+      ) seqFlagUC |= def_binQ_samEntry;
+   } /*If: have a sequence*/
+
+   if(samSTPtr->extraStr[0] != '\0')
+      extraLenUI = samSTPtr->extraLenUI;
+
+   if(cigLenUI > (def_binMaxRec_samEntry >> 2))
+      goto fileErr_fun31; /*getBin can not read*/
+   else if(seqLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun31;
+   else if(extraLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun31;
+
+   recLenUI = def_binFixLen_samEntry - 4;
+   recLenUI += samSTPtr->qryIdLenUC;
+   recLenUI += samSTPtr->refIdLenUC;
+   recLenUI += samSTPtr->rnextLenUC;
+   recLenUI += cigLenUI << 2;
+   recLenUI += (seqLenUI + 1) >> 1;
+   if(seqFlagUC & def_binQ_samEntry)
+      recLenUI += seqLenUI; /*q-scores*/
+   recLenUI += extraLenUI;
+
+   if(recLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun31;
+
+   buffAryUC[0] = (unsigned char) recLenUI;
+   buffAryUC[1] = (unsigned char) (recLenUI >> 8);
+   buffAryUC[2] = (unsigned char) (recLenUI >> 16);
+   buffAryUC[3] = (unsigned char) (recLenUI >> 24);
+   buffAryUC[4] = def_binAln_samEntry;
+   buffAryUC[5] = samSTPtr->qryIdLenUC;
+   buffAryUC[6] = samSTPtr->refIdLenUC;
+   buffAryUC[7] = samSTPtr->rnextLenUC;
+   buffAryUC[8] = (unsigned char) samSTPtr->flagUS;
+   buffAryUC[9] = (unsigned char) (samSTPtr->flagUS >> 8);
+   buffAryUC[10] = samSTPtr->mapqUC;
+   buffAryUC[11] = seqFlagUC;
+
+   for(uiPos = 0; uiPos < 6; ++uiPos)
+   { /*Loop: add the unsigned int entries*/
+      if(uiPos == 0)
+         valUI = samSTPtr->refStartUI;
+      else if(uiPos == 1)
+         valUI = (unsigned int) samSTPtr->pNextSI;
+      else if(uiPos == 2)
+         valUI = (unsigned int) samSTPtr->tLenSI;
+      else if(uiPos == 3)
+         valUI = cigLenUI;
+      else if(uiPos == 4)
+         valUI = seqLenUI;
+      else
+         valUI = extraLenUI;
+
+      lenUI = 12 + (uiPos << 2);
+      buffAryUC[lenUI] = (unsigned char) valUI;
+      buffAryUC[lenUI + 1] = (unsigned char) (valUI >> 8);
+      buffAryUC[lenUI + 2] = (unsigned char) (valUI >> 16);
+      buffAryUC[lenUI + 3] = (unsigned char) (valUI >> 24);
+   } /*Loop: add the unsigned int entries*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun31 Sec04:
+   ^   - print ids and cigar
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   lenUI = def_binFixLen_samEntry;
+
+   cpLen_ulCp(
+      (signed char *) &buffAryUC[lenUI],
+      samSTPtr->qryIdStr,
+      samSTPtr->qryIdLenUC
+   );
+   lenUI += samSTPtr->qryIdLenUC;
+
+   cpLen_ulCp(
+      (signed char *) &buffAryUC[lenUI],
+      samSTPtr->refIdStr,
+      samSTPtr->refIdLenUC
+   );
+   lenUI += samSTPtr->refIdLenUC;
+
+   if(fwrite(buffAryUC, 1, lenUI, binFILE) != lenUI)
+      goto fileErr_fun31;
+
+   if(
+      fwrite(
+         samSTPtr->rNextStr,
+         1,
+         samSTPtr->rnextLenUC,
+         binFILE
+      ) != samSTPtr->rnextLenUC
+   ) goto fileErr_fun31;
+
+   lenUI = 0;
+
+   for(uiPos = 0; uiPos < cigLenUI; ++uiPos)
+   { /*Loop: add cigar entries*/
+      for(opUC = 0; cigOpStr[opUC]; ++opUC)
+      { /*Loop: find cigar entry type*/
+         if(cigOpStr[opUC] == samSTPtr->cigTypeStr[uiPos])
+            break;
+      } /*Loop: find cigar entry type*/
+
+      if(! cigOpStr[opUC])
+         goto fileErr_fun31; /*unkown cigar entry*/
+
+      valUI = (unsigned int) samSTPtr->cigArySI[uiPos];
+      valUI = (valUI << 4) | opUC;
+
+      buffAryUC[lenUI++] = (unsigned char) valUI;
+      buffAryUC[lenUI++] = (unsigned char) (valUI >> 8);
+      buffAryUC[lenUI++] = (unsigned char) (valUI >> 16);
+      buffAryUC[lenUI++] = (unsigned char) (valUI >> 24);
+
+      if(lenUI >= size_fun31)
+      { /*If: buffer is full*/
+         if(fwrite(buffAryUC, 1, lenUI, binFILE) != lenUI)
+            goto fileErr_fun31;
+         lenUI = 0;
+      } /*If: buffer is full*/
+   } /*Loop: add cigar entries*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun31 Sec05:
+   ^   - print sequence, q-scores, and extra entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(uiPos = 0; uiPos < seqLenUI; uiPos += 2)
+   { /*Loop: pack sequence into four bit entries*/
+      opUC =
+         ntTo5Bit[(unsigned char) samSTPtr->seqStr[uiPos]];
+      if(opUC & def_err_sixBit_ntTo5Bit)
+         opUC = 15; /*not a base, so N*/
+      buffAryUC[lenUI] = (unsigned char) ((opUC & 15) << 4);
+
+      if(uiPos + 1 < seqLenUI)
+      { /*If: have a second base*/
+         opUC =
+            ntTo5Bit[
+               (unsigned char) samSTPtr->seqStr[uiPos + 1]
+            ];
+         if(opUC & def_err_sixBit_ntTo5Bit)
+            opUC = 15;
+         buffAryUC[lenUI] |= (unsigned char) (opUC & 15);
+      } /*If: have a second base*/
+
+      if(++lenUI >= size_fun31)
+      { /*If: buffer is full*/
+         if(fwrite(buffAryUC, 1, lenUI, binFILE) != lenUI)
+            goto fileErr_fun31;
+         lenUI = 0;
+      } /*If: buffer is full*/
+   } /*Loop: pack sequence into four bit entries*/
+
+   if(
+         lenUI
+      && fwrite(buffAryUC, 1, lenUI, binFILE) != lenUI
+   ) goto fileErr_fun31;
+
+   if(seqFlagUC & def_binQ_samEntry)
+   { /*If: have q-scores*/
+      if(
+         fwrite(samSTPtr->qStr, 1, seqLenUI, binFILE)
+         != seqLenUI
+      ) goto fileErr_fun31;
+   } /*If: have q-scores*/
+
+   if(
+      fwrite(samSTPtr->extraStr, 1, extraLenUI, binFILE)
+      != extraLenUI
+   ) goto fileErr_fun31;
+
+   return 0;
+
+   fileErr_fun31:;
+      return def_fileErr_samEntry;
+} /*pbin_samEntry*/
+
+/*-------------------------------------------------------\
+| Fun32: getBin_samEntry
+|   - reads a binary sam record (from pbin_samEntry) into
+|     a samEntry struct
+| Input:
+|   - samSTPtr:
+|     o pointer to samEntry struct to add record to
+|   - inFILE:
+|     o FILE pointer to binary sam file (call
+|       getBinHead_samEntry first)
+| Output:
+|   - Modifies:
+|     o samSTPtr to have the next record; stats are set
+|       the same as get_samEntry
+|     o inFILE to be on the next record
+|   - Returns:
+|     o 0 for no errors
+|     o def_EOF_samEntry if at end of file
+|     o def_memErr_samEntry for memory errors
+|     o def_fileErr_samEntry for file errors or corrupt
+|       records (lengths over def_binMaxRec_samEntry or
+|       q-scores not in '!' (33) to '~' (126))
+\-------------------------------------------------------*/
+signed char
+getBin_samEntry(
+   struct samEntry *samSTPtr,
+   void *inFILE
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun32 TOC:
+   '   - reads a binary sam record into a samEntry struct
+   '   o fun32 sec01:
+   '     - variable declarations
+   '   o fun32 sec02:
+   '     - get record length and headers/comments
+   '   o fun32 sec03:
+   '     - get fixed length entries and ids
+   '   o fun32 sec04:
+   '     - get cigar and find cigar stats
+   '   o fun32 sec05:
+   '     - get sequence and q-score entries
+   '   o fun32 sec06:
+   '     - get extra entry
+   '   o fun32 sec07:
+   '     - return result
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   #define size_fun32 256
+   unsigned char buffAryUC[size_fun32];
+   signed char *cigOpStr = (signed char *) "MIDNSHP=X";
+   signed char *baseStr = (signed char *)"=ACMGRSVTWYHKDBN";
+   unsigned int recLenUI = 0;  /*bytes in record*/
+   unsigned int needLenUI = 0; /*bytes entries use*/
+   unsigned int cigLenUI = 0;
+   unsigned int seqLenUI = 0;
+   unsigned int extraLenUI = 0;
+   unsigned int lenUI = 0;
+   unsigned int uiPos = 0;
+   unsigned int uiBuff = 0;
+   unsigned int valUI = 0;
+   unsigned char seqFlagUC = 0;
+   signed char *swapStr = 0;
+   FILE *binFILE = (FILE *) inFILE;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec02:
+   ^   - get record length and headers/comments
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! samSTPtr->cigTypeStr)
+   { /*If: samSTPtr has no memory added*/
+      if( setup_samEntry(samSTPtr) )
+         goto memErr_fun32_sec07;
+   } /*If: samSTPtr has no memory added*/
+
+   else
+      blank_samEntry(samSTPtr);
+
+   lenUI = fread(buffAryUC, 1, 5, binFILE);
+
+   if(! lenUI)
+      goto eof_fun32_sec07;
+   else if(lenUI != 5)
+      goto fileErr_fun32_sec07;
+
+   recLenUI = buffAryUC[0];
+   recLenUI |= (unsigned int) buffAryUC[1] << 8;
+   recLenUI |= (unsigned int) buffAryUC[2] << 16;
+   recLenUI |= (unsigned int) buffAryUC[3] << 24;
+
+   if(! recLenUI)
+      goto fileErr_fun32_sec07;
+   else if(recLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun32_sec07; /*corrupt length*/
+   --recLenUI; /*record type was read*/
+
+   if(buffAryUC[4] == def_binHead_samEntry)
+   { /*If: header/comment*/
+      extraLenUI = recLenUI;
+      recLenUI = 0;
+      goto extraEntry_fun32_sec06;
+   } /*If: header/comment*/
+
+   else if(buffAryUC[4] != def_binAln_samEntry)
+      goto fileErr_fun32_sec07;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec03:
+   ^   - get fixed length entries and ids
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   lenUI = def_binFixLen_samEntry - 5;
+   if(recLenUI < lenUI)
+      goto fileErr_fun32_sec07;
+
+   if(fread(&buffAryUC[5], 1, lenUI, binFILE) != lenUI)
+      goto fileErr_fun32_sec07;
+
+   samSTPtr->qryIdLenUC = buffAryUC[5];
+   samSTPtr->refIdLenUC = buffAryUC[6];
+   samSTPtr->rnextLenUC = buffAryUC[7];
+
+   if(samSTPtr->qryIdLenUC > 127)
+      goto fileErr_fun32_sec07;
+   else if(samSTPtr->refIdLenUC > 127)
+      goto fileErr_fun32_sec07;
+   else if(samSTPtr->rnextLenUC > 127)
+      goto fileErr_fun32_sec07;
+
+   samSTPtr->flagUS = buffAryUC[8];
+   samSTPtr->flagUS |=
+      (unsigned short) (buffAryUC[9] << 8);
+   samSTPtr->mapqUC = buffAryUC[10];
+   seqFlagUC = buffAryUC[11];
+
+   for(uiPos = 0; uiPos < 6; ++uiPos)
+   { /*Loop: get the unsigned int entries*/
+      lenUI = 12 + (uiPos << 2);
+      valUI = buffAryUC[lenUI];
+      valUI |= (unsigned int) buffAryUC[lenUI + 1] << 8;
+      valUI |= (unsigned int) buffAryUC[lenUI + 2] << 16;
+      valUI |= (unsigned int) buffAryUC[lenUI + 3] << 24;
+
+      if(uiPos == 0)
+         samSTPtr->refStartUI = valUI;
+      else if(uiPos == 1)
+         samSTPtr->pNextSI = (signed int) valUI;
+      else if(uiPos == 2)
+         samSTPtr->tLenSI = (signed int) valUI;
+      else if(uiPos == 3)
+         cigLenUI = valUI;
+      else if(uiPos == 4)
+         seqLenUI = valUI;
+      else
+         extraLenUI = valUI;
+   } /*Loop: get the unsigned int entries*/
+
+   if(! (seqFlagUC & def_binSeq_samEntry) && seqLenUI)
+      goto fileErr_fun32_sec07;
+
+   /*lengths past the record limit are corrupt; this also
+   `  keeps needLenUI from overflowing
+   */
+   if(cigLenUI > (def_binMaxRec_samEntry >> 2))
+      goto fileErr_fun32_sec07;
+   else if(seqLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun32_sec07;
+   else if(extraLenUI > def_binMaxRec_samEntry)
+      goto fileErr_fun32_sec07;
+
+   needLenUI = def_binFixLen_samEntry - 5;
+   needLenUI += samSTPtr->qryIdLenUC;
+   needLenUI += samSTPtr->refIdLenUC;
+   needLenUI += samSTPtr->rnextLenUC;
+   needLenUI += cigLenUI << 2;
+   needLenUI += (seqLenUI + 1) >> 1;
+   if(seqFlagUC & def_binQ_samEntry)
+      needLenUI += seqLenUI; /*q-scores*/
+   needLenUI += extraLenUI;
+
+   if(recLenUI < needLenUI)
+      goto fileErr_fun32_sec07;
+   recLenUI -= needLenUI;
+      /*bytes left over are for newer versions*/
+
+   if(
+      fread(
+         samSTPtr->qryIdStr,
+         1,
+         samSTPtr->qryIdLenUC,
+         binFILE
+      ) != samSTPtr->qryIdLenUC
+   ) goto fileErr_fun32_sec07;
+   samSTPtr->qryIdStr[samSTPtr->qryIdLenUC] = '\0';
+
+   if(
+      fread(
+         samSTPtr->refIdStr,
+         1,
+         samSTPtr->refIdLenUC,
+         binFILE
+      ) != samSTPtr->refIdLenUC
+   ) goto fileErr_fun32_sec07;
+   samSTPtr->refIdStr[samSTPtr->refIdLenUC] = '\0';
+
+   if(
+      fread(
+         samSTPtr->rNextStr,
+         1,
+         samSTPtr->rnextLenUC,
+         binFILE
+      ) != samSTPtr->rnextLenUC
+   ) goto fileErr_fun32_sec07;
+   samSTPtr->rNextStr[samSTPtr->rnextLenUC] = '\0';
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec04:
+   ^   - get cigar and find cigar stats
+   ^   o fun32 sec04 sub01:
+   ^     - no cigar case and memory allocation
+   ^   o fun32 sec04 sub02:
+   ^     - read in cigar and find stats
+   ^   o fun32 sec04 sub03:
+   ^     - get read lengths from the cigar entries
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun32 Sec04 Sub01:
+   *   - no cigar case and memory allocation
+   \*****************************************************/
+
+   if(! cigLenUI)
+   { /*If: the cigar entry was not present*/
+      samSTPtr->cigTypeStr[0] = '*';
+      samSTPtr->cigArySI[0] = 0;
+      samSTPtr->cigTypeStr[1] = 0;
+      samSTPtr->cigLenUI = 1;
+      goto seqEntry_fun32_sec05_sub01;
+   } /*If: the cigar entry was not present*/
+
+   if(cigLenUI >= samSTPtr->cigSizeUI)
+   { /*If: need more cigar memory*/
+      samSTPtr->cigSizeUI = cigLenUI + 8;
+
+      swapStr =
+         realloc(
+            samSTPtr->cigTypeStr,
+            samSTPtr->cigSizeUI * sizeof(signed char)
+         );
+      if(! swapStr)
+         goto memErr_fun32_sec07;
+      samSTPtr->cigTypeStr = swapStr;
+
+      swapStr =
+         (signed char *)
+         realloc(
+            samSTPtr->cigArySI,
+            samSTPtr->cigSizeUI * sizeof(signed int)
+         );
+      if(! swapStr)
+         goto memErr_fun32_sec07;
+      samSTPtr->cigArySI = (signed int *) swapStr;
+   } /*If: need more cigar memory*/
+
+   /*****************************************************\
+   * Fun32 Sec04 Sub02:
+   *   - read in cigar and find stats
+   \*****************************************************/
+
+   uiBuff = 0;
+   lenUI = 0;
+
+   for(uiPos = 0; uiPos < cigLenUI; ++uiPos)
+   { /*Loop: get cigar entries*/
+      if(uiBuff >= lenUI)
+      { /*If: need more cigar entries*/
+         lenUI = (cigLenUI - uiPos) << 2;
+         if(lenUI > size_fun32)
+            lenUI = size_fun32;
+
+         if(fread(buffAryUC, 1, lenUI, binFILE) != lenUI)
+            goto fileErr_fun32_sec07;
+         uiBuff = 0;
+      } /*If: need more cigar entries*/
+
+      valUI = buffAryUC[uiBuff++];
+      valUI |= (unsigned int) buffAryUC[uiBuff++] << 8;
+      valUI |= (unsigned int) buffAryUC[uiBuff++] << 16;
+      valUI |= (unsigned int) buffAryUC[uiBuff++] << 24;
+
+      if((valUI & 15) > 8)
+         goto fileErr_fun32_sec07; /*unkown cigar entry*/
+
+      samSTPtr->cigTypeStr[uiPos] = cigOpStr[valUI & 15];
+      samSTPtr->cigArySI[uiPos] = (signed int) (valUI >> 4);
+
+      switch(samSTPtr->cigTypeStr[uiPos])
+      { /*Switch: Check the cigar entry type*/
+         case '=':
+         case 'M':
+            samSTPtr->matchCntUI += valUI >> 4;
+            break;
+         case 'X':
+            samSTPtr->snpCntUI += valUI >> 4;
+            break;
+         case 'I':
+            samSTPtr->insCntUI += valUI >> 4;
+            break;
+         case 'D':
+            samSTPtr->delCntUI += valUI >> 4;
+            break;
+         case 'S':
+            samSTPtr->maskCntUI += valUI >> 4;
+            break;
+      } /*Switch: Check the cigar entry type*/
+   } /*Loop: get cigar entries*/
+
+   /*****************************************************\
+   * Fun32 Sec04 Sub03:
+   *   - get read lengths from the cigar entries
+   \*****************************************************/
+
+   samSTPtr->cigLenUI = cigLenUI;
+   samSTPtr->cigArySI[cigLenUI] = 0;
+   samSTPtr->cigTypeStr[cigLenUI] = '\0';
+
+   samSTPtr->readLenUI =
+        samSTPtr->matchCntUI
+      + samSTPtr->snpCntUI
+      + samSTPtr->insCntUI
+      + samSTPtr->maskCntUI;
+
+   samSTPtr->alnReadLenUI =
+        samSTPtr->matchCntUI
+      + samSTPtr->snpCntUI
+      + samSTPtr->delCntUI;
+
+   samSTPtr->refEndUI = samSTPtr->refStartUI;
+   samSTPtr->refEndUI += samSTPtr->alnReadLenUI;
+   samSTPtr->refEndUI -= (samSTPtr->alnReadLenUI > 0);
+      /*-1 from (alnReadLen > 0) converts to index 0*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec05:
+   ^   - get sequence and q-score entries
+   ^   o fun32 sec05 sub01:
+   ^     - no sequence case and memory allocation
+   ^   o fun32 sec05 sub02:
+   ^     - unpack sequence
+   ^   o fun32 sec05 sub03:
+   ^     - get q-score entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun32 Sec05 Sub01:
+   *   - no sequence case and memory allocation
+   \*****************************************************/
+
+   seqEntry_fun32_sec05_sub01:;
+
+   if(! (seqFlagUC & def_binSeq_samEntry))
+   { /*If: no sequence in file*/
+      samSTPtr->seqStr[0] = '*';
+      samSTPtr->seqStr[1] = '\0';
+      samSTPtr->qStr[0] = '*';
+      samSTPtr->qStr[1] = '\0';
+         /*readLenUI is from the cigar (as lineTo)*/
+      goto extraEntry_fun32_sec06;
+   } /*If: no sequence in file*/
+
+   samSTPtr->readLenUI = seqLenUI;
+
+   if(samSTPtr->seqSizeUI < seqLenUI)
+   { /*If: need more buffer*/
+      free(samSTPtr->seqStr);
+      samSTPtr->seqStr =
+         malloc((seqLenUI + 8) * sizeof(signed char));
+      if(! samSTPtr->seqStr)
+         goto memErr_fun32_sec07;
+      samSTPtr->seqSizeUI = seqLenUI;
+   } /*If: need more buffer*/
+
+   /*****************************************************\
+   * Fun32 Sec05 Sub02:
+   *   - unpack sequence
+   \*****************************************************/
+
+   uiBuff = 0;
+   lenUI = 0;
+
+   for(uiPos = 0; uiPos < seqLenUI; uiPos += 2)
+   { /*Loop: unpack four bit bases*/
+      if(uiBuff >= lenUI)
+      { /*If: need more bases*/
+         lenUI = ((seqLenUI - uiPos) + 1) >> 1;
+         if(lenUI > size_fun32)
+            lenUI = size_fun32;
+
+         if(fread(buffAryUC, 1, lenUI, binFILE) != lenUI)
+            goto fileErr_fun32_sec07;
+         uiBuff = 0;
+      } /*If: need more bases*/
+
+      samSTPtr->seqStr[uiPos] =
+         baseStr[buffAryUC[uiBuff] >> 4];
+      samSTPtr->seqStr[uiPos + 1] =
+         baseStr[buffAryUC[uiBuff] & 15];
+         /*seqStr has 8 extra bytes, so an odd length
+         `  read is overwritten by the null below
+         */
+      ++uiBuff;
+   } /*Loop: unpack four bit bases*/
+
+   samSTPtr->seqStr[seqLenUI] = '\0';
+
+   /*****************************************************\
+   * Fun32 Sec05 Sub03:
+   *   - get q-score entry
+   \*****************************************************/
+
+   if(! (seqFlagUC & def_binQ_samEntry))
+   { /*If: no q-score entry*/
+      samSTPtr->qStr[0] = '*';
+      samSTPtr->qStr[1] = '\0';
+      goto extraEntry_fun32_sec06;
+   } /*If: no q-score entry*/
+
+   if(samSTPtr->qSizeUI < seqLenUI)
+   { /*If: need more buffer*/
+      free(samSTPtr->qStr);
+      samSTPtr->qStr =
+         malloc((seqLenUI + 8) * sizeof(signed char));
+      if(! samSTPtr->qStr)
+         goto memErr_fun32_sec07;
+      samSTPtr->qSizeUI = seqLenUI;
+   } /*If: need more buffer*/
+
+   if(
+      fread(samSTPtr->qStr, 1, seqLenUI, binFILE)
+      != seqLenUI
+   ) goto fileErr_fun32_sec07;
+   samSTPtr->qStr[seqLenUI] = '\0';
+
+   for(uiPos = 0; uiPos < seqLenUI; ++uiPos)
+   { /*Loop: check q-scores are in histogram range*/
+      if(
+            (unsigned char) samSTPtr->qStr[uiPos]
+         < def_adjQ_samEntry
+      ) goto fileErr_fun32_sec07;
+
+      else if(
+            (unsigned char) samSTPtr->qStr[uiPos]
+         >= def_adjQ_samEntry + def_maxQ_samEntry
+      ) goto fileErr_fun32_sec07;
+   } /*Loop: check q-scores are in histogram range*/
+
+   findQScores_samEntry(samSTPtr);
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec06:
+   ^   - get extra entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   extraEntry_fun32_sec06:;
+
+   if(extraLenUI >= samSTPtr->extraSizeUI)
+   { /*If: need more buffer*/
+      free(samSTPtr->extraStr);
+      samSTPtr->extraStr = 0;
+      samSTPtr->extraSizeUI = extraLenUI;
+      samSTPtr->extraSizeUI += (extraLenUI >> 1);
+      samSTPtr->extraStr =
+         malloc(
+            (samSTPtr->extraSizeUI + 8)
+               * sizeof(signed char)
+         );
+      if(! samSTPtr->extraStr)
+         goto memErr_fun32_sec07;
+   } /*If: need more buffer*/
+
+   if(
+      fread(samSTPtr->extraStr, 1, extraLenUI, binFILE)
+      != extraLenUI
+   ) goto fileErr_fun32_sec07;
+
+   samSTPtr->extraLenUI = extraLenUI;
+   samSTPtr->extraStr[extraLenUI] = '\0';
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun32 Sec07:
+   ^   - return result
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   while(recLenUI)
+   { /*Loop: skip entries from newer versions*/
+      lenUI = recLenUI;
+      if(lenUI > size_fun32)
+         lenUI = size_fun32;
+
+      if(fread(buffAryUC, 1, lenUI, binFILE) != lenUI)
+         goto fileErr_fun32_sec07;
+      recLenUI -= lenUI;
+   } /*Loop: skip entries from newer versions*/
+
+   return 0;
+
+   eof_fun32_sec07:;
+      return def_EOF_samEntry;
+   memErr_fun32_sec07:;
+      return def_memErr_samEntry;
+   fileErr_fun32_sec07:;
+      return def_fileErr_samEntry;
+} /*getBin_samEntry*/
+
 /*=======================================================\
 : License:
 : 
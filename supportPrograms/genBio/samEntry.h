@@ -5,6 +5,9 @@
 '     - header guards and definitions
 '   o .h st01 samEntry:
 '     - Holds a single samfile entry
+'   o .h st02 view_samEntry:
+'     - where each column is in a sam file line (no
+'       copying)
 '   o fun01 blank_samEntry:
 '     - Sets all non-alloacted variables in samEntry to 0
 '   o fun02 init_samEntry:
@@ -55,6 +58,31 @@
 '   o fun21: checkCigSize_samEntry
 '     - checks to see if I need to resize cigar and if
 '     needed resizes the cigar
+'   o fun22: init_view_samEntry
+'     - initializes a view_samEntry struct
+'   o fun23: freeStack_view_samEntry
+'     - frees the cigar arrays in a view_samEntry struct
+'   o fun24: lineTo_view_samEntry
+'     - finds the columns in a sam file line without
+'       copying them
+'   o fun25: cig_view_samEntry
+'     - decodes the cigar entry in a view_samEntry struct
+'   o fun26: qStats_view_samEntry
+'     - finds the mean and median q-scores of the read in
+'       a view_samEntry struct
+'   o fun27: toSam_view_samEntry
+'     - copies the line in a view_samEntry struct into a
+'       samEntry struct
+'   o fun28: get_view_samEntry
+'     - reads a line from a sam file and views it
+'   o fun29: pbinHead_samEntry
+'     - prints the header for a binary sam file
+'   o fun30: getBinHead_samEntry
+'     - reads and checks the header of a binary sam file
+'   o fun31: pbin_samEntry
+'     - prints a samEntry struct as a binary sam record
+'   o fun32: getBin_samEntry
+'     - reads a binary sam record into a samEntry struct
 '   o .h note01:
 '      - Notes about the sam file format from the sam file
 '        pdf
@@ -78,6 +106,21 @@
 #define def_fileErr_samEntry 4
 #define def_expand_samEntry 8  /*expanded an array*/
 
+/*binary sam records (pbin_samEntry/getBin_samEntry)*/
+#define def_binVersion_samEntry 1
+#define def_binHeadLen_samEntry 8  /*"SAMB" + version + 0's*/
+#define def_binFixLen_samEntry 36
+   /*bytes in record before the ids (see pbin_samEntry)*/
+#define def_binAln_samEntry 0      /*alignment record*/
+#define def_binHead_samEntry 1     /*header/comment record*/
+#define def_binSeq_samEntry 1      /*record has sequence*/
+#define def_binQ_samEntry 2        /*record has q-scores*/
+#define def_binMaxRec_samEntry (1 << 28)
+   /*largest record, cigar, sequence, or extra entry
+   `  (256 Mb); getBin_samEntry treats larger lengths as
+   `  a corrupt file
+   */
+
 /*-------------------------------------------------------\
 | ST01: samEntry
 |  - Holds a single samfile entry
@@ -140,6 +183,79 @@ typedef struct samEntry
     unsigned long sumQUL;             /*Total for mean Q*/
 }samEntry;
 
+/*column indexes in view_samEntry (st02)*/
+#define def_qryCol_samEntry 0   /*query id*/
+#define def_flagCol_samEntry 1  /*flag*/
+#define def_refCol_samEntry 2   /*reference id*/
+#define def_posCol_samEntry 3   /*reference position*/
+#define def_mapqCol_samEntry 4  /*mapping quality*/
+#define def_cigCol_samEntry 5   /*cigar*/
+#define def_rNextCol_samEntry 6 /*RNEXT*/
+#define def_pNextCol_samEntry 7 /*PNEXT*/
+#define def_tLenCol_samEntry 8  /*TLEN*/
+#define def_seqCol_samEntry 9   /*sequence*/
+#define def_qCol_samEntry 10    /*q-score entry*/
+#define def_extraCol_samEntry 11/*extra entries (12-end)*/
+#define def_numCol_samEntry 12  /*number of columns*/
+
+/*-------------------------------------------------------\
+| ST02: view_samEntry
+|  - holds where each column is in a sam file line, so
+|    the line can be used without copying it
+|  - the cigar and q-score stats are only found when
+|    asked for (cig_view_samEntry, qStats_view_samEntry)
+\-------------------------------------------------------*/
+typedef struct view_samEntry
+{ /*view_samEntry*/
+   signed char *lineStr;   /*sam line (not owned/copied)*/
+
+   /*column starts and lengths in lineStr (use
+   `  col_view_samEntry and colLen_view_samEntry)
+   */
+   unsigned int startAryUI[def_numCol_samEntry];
+   unsigned int lenAryUI[def_numCol_samEntry];
+
+   /*found with every line (cheap to get)*/
+   unsigned short flagUS;   /*Holds the flag*/
+   unsigned char mapqUC;    /*Holds mapping quality*/
+   unsigned int refStartUI; /*First reference base*/
+
+   /*cigar (only set after cig_view_samEntry)*/
+   signed char cigBl;       /*1: cigar was decoded*/
+   signed char *cigTypeStr; /*Holds cigar type entry*/
+   signed int *cigArySI;    /*Holds the cigar number*/
+   unsigned int cigLenUI;   /*Length of cigar entry*/
+   unsigned int cigSizeUI;  /*# bytes malloc to cigStr*/
+
+   unsigned int refEndUI;    /*Last reference base*/
+   unsigned int readLenUI;   /*Holds read length*/
+   unsigned int alnReadLenUI;/*Number ref bases aligned*/
+
+   unsigned int matchCntUI;/*Holds number of matches*/
+   unsigned int snpCntUI;  /*Holds number of mismatches*/
+   unsigned int insCntUI;  /*Holds number of insertions*/
+   unsigned int delCntUI;  /*number of deletions*/
+   unsigned int maskCntUI; /*number soft masked bases*/
+
+   /*q-scores (only set after qStats_view_samEntry)*/
+   signed char qBl;        /*1: q-scores were found*/
+   float medianQF;         /*holds median read q-score*/
+   float meanQF;           /*holds mean read q-score*/
+}view_samEntry;
+
+/*start of a column (def_qryCol_samEntry, ...) in a
+`  view_samEntry; columns are not null terminated
+*/
+#define col_view_samEntry(viewSTPtr, colMac) \
+   ( \
+        (viewSTPtr)->lineStr \
+      + (viewSTPtr)->startAryUI[(colMac)] \
+   )
+
+/*number of characters in a view_samEntry column*/
+#define colLen_view_samEntry(viewSTPtr, colMac) \
+   ( (viewSTPtr)->lenAryUI[(colMac)] )
+
 /*-------------------------------------------------------\
 | Fun01: blank_samEntry
 |   - Sets all values to 0, or for c-strings to '\0'
@@ -584,6 +700,293 @@ checkCigSize_samEntry(
    unsigned int cigPosUI      /*positon at in cigar*/
 );
 
+/*-------------------------------------------------------\
+| Fun22: init_view_samEntry
+|   - initializes a view_samEntry struct (call once
+|     before using the struct)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to initialize
+| Output:
+|   - Modifies:
+|     o all variables in viewSTPtr to be 0 or null
+\-------------------------------------------------------*/
+void
+init_view_samEntry(
+   struct view_samEntry *viewSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun23: freeStack_view_samEntry
+|   - frees the cigar arrays in a view_samEntry struct
+|     (the line is not freed, it is owned by the caller)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with memory to
+|       free
+| Output:
+|   - Frees:
+|     o cigTypeStr and cigArySI in viewSTPtr
+|   - Modifies:
+|     o all variables in viewSTPtr to be 0 or null
+\-------------------------------------------------------*/
+void
+freeStack_view_samEntry(
+   struct view_samEntry *viewSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun24: lineTo_view_samEntry
+|   - finds the columns in a sam file line without
+|     copying them
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to set up
+|   - lineStr:
+|     o c-string with sam file line to view
+|     o must not be changed or freed while viewSTPtr is
+|       used
+| Output:
+|   - Modifies:
+|     o lineStr in viewSTPtr to point to lineStr
+|     o startAryUI and lenAryUI in viewSTPtr to have the
+|       start and length of each column
+|       * headers (@) are put in the extra column
+|     o flagUS, mapqUC, and refStartUI (index 0) in
+|       viewSTPtr to have the line's values
+|     o cigBl and qBl in viewSTPtr to be 0 (not found)
+|   - Returns:
+|     o 0 for success
+|     o def_fileErr_samEntry if the line has less than
+|       11 tab separated columns
+\-------------------------------------------------------*/
+signed char
+lineTo_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   signed char *lineStr
+);
+
+/*-------------------------------------------------------\
+| Fun25: cig_view_samEntry
+|   - decodes the cigar entry in a view_samEntry struct
+|     (does nothing if the cigar was already decoded)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with cigar to
+|       decode (lineTo_view_samEntry was called)
+| Output:
+|   - Modifies:
+|     o cigTypeStr, cigArySI, and cigLenUI in viewSTPtr to
+|       have the cigar (resized if needed)
+|     o refEndUI, readLenUI, alnReadLenUI, matchCntUI,
+|       snpCntUI, insCntUI, delCntUI, and maskCntUI in
+|       viewSTPtr to have the values from the cigar
+|     o cigBl in viewSTPtr to be 1
+|   - Returns:
+|     o 0 for success
+|     o def_memErr_samEntry for memory errors
+\-------------------------------------------------------*/
+signed char
+cig_view_samEntry(
+   struct view_samEntry *viewSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun26: qStats_view_samEntry
+|   - finds the mean and median q-scores of the read in a
+|     view_samEntry struct (does nothing if already found)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to find q-scores
+|       for (lineTo_view_samEntry was called)
+| Output:
+|   - Modifies:
+|     o meanQF and medianQF in viewSTPtr to have the mean
+|       and median q-scores (0 if no q-score entry)
+|     o qBl in viewSTPtr to be 1
+\-------------------------------------------------------*/
+void
+qStats_view_samEntry(
+   struct view_samEntry *viewSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun27: toSam_view_samEntry
+|   - copies the line in a view_samEntry struct into a
+|     samEntry struct (for functions that need samEntry)
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct with line to copy
+|   - samSTPtr:
+|     o pointer to samEntry struct to copy line to
+| Output:
+|   - Modifies:
+|     o samSTPtr to have the line (see lineTo_samEntry)
+|   - Returns:
+|     o 0 for success
+|     o def_memErr_samEntry for memory errors
+\-------------------------------------------------------*/
+signed char
+toSam_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   struct samEntry *samSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun28: get_view_samEntry
+|   - reads a line from a sam file and views it
+| Input:
+|   - viewSTPtr:
+|     o pointer to view_samEntry struct to view line with
+|   - buffStrPtr:
+|     o pointer to c-string to read the line into; resized
+|       if needed (use 0 for a new buffer)
+|     o the view points into this buffer, so it is only
+|       good until the next call
+|   - sizeBuffSLPtr:
+|     o pointer to signed long with size of buffStrPtr
+|   - samFILE:
+|     o sam file to read the line from
+| Output:
+|   - Modifies:
+|     o viewSTPtr to view the next line
+|     o buffStrPtr and sizeBuffSLPtr if buffStrPtr is
+|       resized
+|     o samFILE to be on the next line
+|   - Returns:
+|     o 0 for success
+|     o def_EOF_samEntry for EOF (End Of File)
+|     o def_memErr_samEntry for memory errors
+|     o def_fileErr_samEntry for file errors
+\-------------------------------------------------------*/
+signed char
+get_view_samEntry(
+   struct view_samEntry *viewSTPtr,
+   signed char **buffStrPtr,
+   signed long *sizeBuffSLPtr,
+   void *samFILE
+);
+
+/*-------------------------------------------------------\
+| Fun29: pbinHead_samEntry
+|   - prints the header (magic number and version) for a
+|     binary sam file (pbin_samEntry)
+| Input:
+|   - outFILE:
+|     o FILE pointer to print header to
+| Output:
+|   - Prints:
+|     o "SAMB", def_binVersion_samEntry, and three null
+|       bytes to outFILE (def_binHeadLen_samEntry bytes)
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_samEntry if could not write header
+\-------------------------------------------------------*/
+signed char
+pbinHead_samEntry(
+   void *outFILE
+);
+
+/*-------------------------------------------------------\
+| Fun30: getBinHead_samEntry
+|   - reads and checks the header of a binary sam file
+| Input:
+|   - inFILE:
+|     o FILE pointer to binary sam file (at start)
+| Output:
+|   - Modifies:
+|     o inFILE to be on the first record
+|   - Returns:
+|     o 0 for no errors
+|     o def_EOF_samEntry if the file is empty
+|     o def_fileErr_samEntry if not a binary sam file or
+|       is a newer version
+\-------------------------------------------------------*/
+signed char
+getBinHead_samEntry(
+   void *inFILE
+);
+
+/*-------------------------------------------------------\
+| Fun31: pbin_samEntry
+|   - prints a samEntry struct as a binary sam record
+| Input:
+|   - samSTPtr:
+|     o pointer to samEntry struct to print
+|   - outFILE:
+|     o FILE pointer to print record to
+| Output:
+|   - Prints:
+|     o samSTPtr as a binary record to outFILE; numbers
+|       are little endian (same on every machine)
+|       * 0: record length (unsigned int; bytes after
+|            this entry)
+|       * 4: record type (unsigned char)
+|            - def_binHead_samEntry: header/comment, the
+|              rest of the record is the line
+|            - def_binAln_samEntry: alignment
+|       * 5: query id length (unsigned char)
+|       * 6: reference id length (unsigned char)
+|       * 7: RNEXT length (unsigned char)
+|       * 8: flag (unsigned short)
+|       * 10: mapq (unsigned char)
+|       * 11: def_binSeq_samEntry | def_binQ_samEntry if
+|             have a sequence and q-scores
+|       * 12: reference start (unsigned int; index 0)
+|       * 16: PNEXT (signed int; as in samEntry)
+|       * 20: TLEN (signed int)
+|       * 24: number of cigar entries (unsigned int)
+|       * 28: sequence length (unsigned int)
+|       * 32: extra entry length (unsigned int)
+|       * 36: query id, reference id, and RNEXT
+|       * cigar entries (unsigned int; number << 4 | op)
+|         with op being the index in "MIDNSHP=X"
+|       * sequence; 4 bits per base (first base in high
+|         bits), index in "=ACMGRSVTWYHKDBN" (lower case
+|         bases are upper case and non-bases are N)
+|       * q-scores (as in the sam file)
+|       * extra entry
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_samEntry if could not write the
+|       record, the cigar has an unkown entry, or the
+|       record is over def_binMaxRec_samEntry bytes
+\-------------------------------------------------------*/
+signed char
+pbin_samEntry(
+   struct samEntry *samSTPtr,
+   void *outFILE
+);
+
+/*-------------------------------------------------------\
+| Fun32: getBin_samEntry
+|   - reads a binary sam record (from pbin_samEntry) into
+|     a samEntry struct
+| Input:
+|   - samSTPtr:
+|     o pointer to samEntry struct to add record to
+|   - inFILE:
+|     o FILE pointer to binary sam file (call
+|       getBinHead_samEntry first)
+| Output:
+|   - Modifies:
+|     o samSTPtr to have the next record; stats are set
+|       the same as get_samEntry
+|     o inFILE to be on the next record
+|   - Returns:
+|     o 0 for no errors
+|     o def_EOF_samEntry if at end of file
+|     o def_memErr_samEntry for memory errors
+|     o def_fileErr_samEntry for file errors or corrupt
+|       records (lengths over def_binMaxRec_samEntry or
+|       q-scores not in '!' (33) to '~' (126))
+\-------------------------------------------------------*/
+signed char
+getBin_samEntry(
+   struct samEntry *samSTPtr,
+   void *inFILE
+);
+
 #endif
 
 /*-------------------------------------------------------\
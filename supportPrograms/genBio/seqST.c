@@ -10,6 +10,8 @@
 '     - reads a fastq sequence from a fastq file
 '   o fun03 getFa_seqST:
 '     - grabs the next read in the fasta file
+'   o .c tbl01: cmpNt_seqST
+'     - table to complement a base (IUPAC, any case)
 '   o fun05 revComp_seqST:
 '     - reverse complement a sequence
 '   o fun06 blank_seqST:
@@ -40,6 +42,8 @@
 '     - add more memory to a seqST struct array
 '   o fun18: readFaFile_seqST
 '     - get all sequences from a fasta file
+'   o fun19: revCmpStr_seqST
+'     - reverse complement a c-string sequence in place
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -60,12 +64,41 @@
 #include "seqST.h"
 #include "../genLib/ulCp.h"
 #include "../genLib/fileFun.h"
+#include "../genLib/memTag.h"
 
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden Libraries:
 !   - .h  #include "../genLib/endLine.h"
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
+/*-------------------------------------------------------\
+| Tbl01: cmpNt_seqST
+|  - table to complement a base (IUPAC, any case)
+|    o output is always upper case
+|    o non-IUPAC characters become 0 ('\0')
+|    o entries past 127 are 0
+\-------------------------------------------------------*/
+static
+signed char cmpNt_seqST[256] =
+{  /*cmpNt_seqST*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*0-7*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*8-15*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*16-23*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*24-31*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*32-39*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*40-47*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*48-55*/
+   0, 0, 0, 0, 0, 0, 0, 0,/*56-63*/
+   0, 'T', 'V', 'G', 'H', 0, 0, 'C',/*64-71 @ A-G*/
+   'D', 0, 0, 'M', 0, 'K', 'N', 0,/*72-79 H-O*/
+   0, 0, 'Y', 'S', 'A', 'A', 'B', 'W',/*80-87 P-W*/
+   0, 'R', 0, 0, 0, 0, 0, 0,/*88-95 X-Z ... _*/
+   0, 'T', 'V', 'G', 'H', 0, 0, 'C',/*96-103 ` a-g*/
+   'D', 0, 0, 'M', 0, 'K', 'N', 0,/*104-111 h-o*/
+   0, 0, 'Y', 'S', 'A', 'A', 'B', 'W',/*112-119 p-w*/
+   0, 'R', 0, 0, 0, 0, 0, 0 /*120-127 x-z ... del*/
+}; /*cmpNt_seqST*/
+
 /*-------------------------------------------------------\
 | Fun02: getFq_seqST
 |  - grabs next read in a fastq file
@@ -115,6 +148,7 @@ getFq_seqST(
     signed long lenSL = 0;
     signed long tmpSL = 0;
     signed long bytesSL = 0;
+    signed long oldSizeSL = 0; /*for memTag counts*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\
     ^ Fun02 Sec02:
@@ -131,9 +165,11 @@ getFq_seqST(
        if(! seqSTPtr->idStr)
           goto memErr_fun02_sec05;
        seqSTPtr->idSizeSL = 128;
+       resize_memTag(def_seqST_memTag, 0, 128);
     } /*If: need memory*/
 
     seqSTPtr->idLenSL = 0;
+    oldSizeSL = seqSTPtr->idSizeSL;
 
     lenSL =
         getFullLine_fileFun(
@@ -143,6 +179,11 @@ getFq_seqST(
             &tmpSL,
             0
         ); /*get fastq header*/
+    resize_memTag(
+       def_seqST_memTag,
+       oldSizeSL,
+       seqSTPtr->idSizeSL
+    );
     if(lenSL < 0)
        goto memErr_fun02_sec05;
     if(! lenSL)
@@ -182,6 +223,7 @@ getFq_seqST(
        if(! seqSTPtr->seqStr)
           goto memErr_fun02_sec05;
        seqSTPtr->seqSizeSL = 1024;
+       resize_memTag(def_seqST_memTag, 0, 1024);
 
        seqSTPtr->seqStr[1024] = 0;
        seqSTPtr->seqStr[1025] = 0;
@@ -202,6 +244,7 @@ getFq_seqST(
     do{ /*Loop: get sequence entry*/
        seqSTPtr->seqLenSL += lenSL;
        bytesSL += tmpSL;
+       oldSizeSL = seqSTPtr->seqSizeSL;
 
        lenSL =
            getFullLine_fileFun(
@@ -211,6 +254,11 @@ getFq_seqST(
                &tmpSL,
                (signed long) seqSTPtr->seqLenSL
            ); /*get fastq header*/
+       resize_memTag(
+          def_seqST_memTag,
+          oldSizeSL,
+          seqSTPtr->seqSizeSL
+       );
 
        if(lenSL < 0)
           goto memErr_fun02_sec05;
@@ -238,7 +286,15 @@ getFq_seqST(
     if(seqSTPtr->qSizeSL < seqSTPtr->seqLenSL)
     { /*If: need more memory*/
        if(seqSTPtr->qStr)
-           free(seqSTPtr->qStr);
+       { /*If: have old buffer to free*/
+          free(seqSTPtr->qStr);
+          resize_memTag(
+             def_seqST_memTag,
+             seqSTPtr->qSizeSL,
+             0
+          );
+       } /*If: have old buffer to free*/
+
        seqSTPtr->qStr = 0;
        seqSTPtr->qSizeSL = 0;
     } /*If: need more memory*/
@@ -252,6 +308,11 @@ getFq_seqST(
        if(! seqSTPtr->qStr)
           goto memErr_fun02_sec05;
        seqSTPtr->qSizeSL = seqSTPtr->seqLenSL;
+       resize_memTag(
+          def_seqST_memTag,
+          0,
+          seqSTPtr->qSizeSL
+       );
 
        /*this is to aviod valgrind complates about
        `  unitialized values
@@ -363,6 +424,7 @@ getFa_seqST(
     unsigned char errSC = 0;
     signed long lenSL = 0;
     signed long tmpSL = 0;
+    signed long oldSizeSL = 0; /*for memTag counts*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\
     ^ Fun03 Sec02:
@@ -379,6 +441,7 @@ getFa_seqST(
        if(! seqSTPtr->idStr)
           goto memErr_fun03_sec04;
        seqSTPtr->idSizeSL = 128;
+       resize_memTag(def_seqST_memTag, 0, 128);
     } /*If: need memory*/
 
     seqSTPtr->idLenSL = 0;
@@ -386,6 +449,8 @@ getFa_seqST(
 
     while(seqSTPtr->idStr[0] != '>')
     { /*Loop: find first header*/
+       oldSizeSL = seqSTPtr->idSizeSL;
+
        lenSL =
            getFullLine_fileFun(
                faFILE,
@@ -394,6 +459,11 @@ getFa_seqST(
                &tmpSL,
                0
            ); /*get fastq header*/
+       resize_memTag(
+          def_seqST_memTag,
+          oldSizeSL,
+          seqSTPtr->idSizeSL
+       );
 
        if(! lenSL)
           goto eof_fun03_sec04;
@@ -444,6 +514,7 @@ getFa_seqST(
        if(! seqSTPtr->seqStr)
           goto memErr_fun03_sec04;
        seqSTPtr->seqSizeSL = 1024;
+       resize_memTag(def_seqST_memTag, 0, 1024);
     } /*If: need memory*/
 
     seqSTPtr->seqLenSL = 0;
@@ -451,6 +522,8 @@ getFa_seqST(
     tmpSL = 0;
 
     do{ /*Loop: get sequence entry*/
+       oldSizeSL = seqSTPtr->seqSizeSL;
+
        lenSL =
            getFullLine_fileFun(
                faFILE,
@@ -459,6 +532,11 @@ getFa_seqST(
                &tmpSL,
                (signed long) seqSTPtr->seqLenSL
            ); /*get fastq header*/
+       resize_memTag(
+          def_seqST_memTag,
+          oldSizeSL,
+          seqSTPtr->seqSizeSL
+       );
 
        if(lenSL < 0)
           goto memErr_fun03_sec04;
@@ -554,161 +632,17 @@ getFa_seqST(
 void
 revComp_seqST(
   struct seqST *seqSTPtr  /*sequence to reverse comp*/
-){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' SOF: Start Of File
-    '   o fun05 sec01:
-    '     - variable declarations
-    '   o fun05 sec02:
-    '     - check if have q-score entry
-    '   o fun05 sec03:
-    '     - reverse complement sequence
-    '   o fun05 sec04:
-    '     - reverse complement final base and return
-    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun05 Sec01:
-    ^   - variable declarations
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    signed char *seqStr = seqSTPtr->seqStr;
-
-    signed char *endStr =
-       seqSTPtr->seqStr + seqSTPtr->seqLenSL - 1;
-
-    signed char *qStr = 0;
-    signed char *qEndStr = 0;
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun05 Sec02:
-    ^   - check if have q-score entry
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    if(seqSTPtr->qStr != 0 && *seqSTPtr->qStr != '\0')
-    { /*If have a Q-score entry*/
-       qStr = seqSTPtr->qStr;
-       qEndStr = seqSTPtr->qStr + seqSTPtr->qLenSL - 1;
-    } /*If have a Q-score entry*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun05 Sec03:
-    ^   - reverse complement sequence
-    ^   o fun05 sec03 sub01:
-    ^     - reverse complement start base + start loop
-    ^   o fun05 sec03 sub02:
-    ^     - reverse complement end base
-    ^   o fun05 sec03 sub03:
-    ^     - swap start and end bases
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+){
+   signed char *qStr = 0;
 
-    /****************************************************\
-    * Fun05 Sec03 Sub01:
-    *   - reverse complement start base + start loop
-    \****************************************************/
-
-    while(endStr > seqStr)
-    { /*While I have bases to reverse complement*/
-       switch(*seqStr & (~32)) /*Make sure upper case*/
-       { /*switch, reverse complement*/
-           case 'A': *seqStr = 'T'; break;
-           case 'C': *seqStr = 'G'; break;
-           case 'G': *seqStr = 'C'; break;
-           case 'T': *seqStr = 'A'; break;
-           case 'U': *seqStr = 'A'; break;
-           case 'W': *seqStr = 'W'; break;
-           case 'S': *seqStr = 'S'; break;
-           case 'M': *seqStr = 'K'; break;  /*A/C->T/G*/
-           case 'K': *seqStr = 'M'; break;  /*T/G->A/C*/
-           case 'R': *seqStr = 'Y'; break;  /*A/G->T/C*/
-           case 'Y': *seqStr = 'R'; break;  /*T/C->A/G*/
-           case 'B': *seqStr = 'V'; break;/*C/G/T->G/C/A*/
-           case 'D': *seqStr = 'H'; break;/*G/T/A->C/A/T*/
-           case 'H': *seqStr = 'D'; break;/*C/A/T->G/T/A*/
-           case 'V': *seqStr = 'B'; break;/*A/C/G->T/G/C*/
-           case 'N': *seqStr = 'N'; break;/*A/C/G/T*/
-           default: *seqStr = 0;
-       } /*switch, reverse complement*/
-
-       /*************************************************\
-       * Fun05 Sec03 Sub02:
-       *   - reverse complement end base
-       \*************************************************/
-
-       switch(*endStr & (~32)) /*Make sure upper case*/
-       { /*switch, reverse complement*/
-           case 'A': *endStr = 'T'; break;
-           case 'C': *endStr = 'G'; break;
-           case 'G': *endStr = 'C'; break;
-           case 'T': *endStr = 'A'; break;
-           case 'U': *endStr = 'A'; break;
-           case 'W': *endStr = 'W'; break;
-           case 'S': *endStr = 'S'; break;
-           case 'M': *endStr = 'K'; break;  /*A/C->T/G*/
-           case 'K': *endStr = 'M'; break;  /*T/G->A/C*/
-           case 'R': *endStr = 'Y'; break;  /*A/G->T/C*/
-           case 'Y': *endStr = 'R'; break;  /*T/C->A/G*/
-           case 'B': *endStr = 'V'; break;/*C/G/T->G/C/A*/
-           case 'D': *endStr = 'H'; break;/*G/T/A->C/A/T*/
-           case 'H': *endStr = 'D'; break;/*C/A/T->G/T/A*/
-           case 'V': *endStr = 'B'; break;/*A/C/G->T/G/C*/
-           case 'N': *endStr = 'N'; break;/*A/C/G/T*/
-           default: *endStr = 0;
-       } /*switch, reverse complement*/
-
-       /*************************************************\
-       * Fun05 Sec03 Sub03:
-       *   - swap start and end bases
-       \*************************************************/
-
-       *seqStr ^= *endStr;
-       *endStr ^= *seqStr;
-       *seqStr ^= *endStr;
-       
-       if(qStr)
-       { /*If I also need to swap Q-scores*/
-         *qStr ^= *qEndStr;
-         *qEndStr ^= *qStr;
-         *qStr ^= *qEndStr;
-
-         ++qStr;
-         --qEndStr;
-       } /*If I also need to swap Q-scores*/
-       
-       ++seqStr;
-       --endStr;
-    } /*While I have bases to reverse complement*/
+   if(seqSTPtr->qStr != 0 && *seqSTPtr->qStr != '\0')
+      qStr = seqSTPtr->qStr;
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun05 Sec04:
-    ^   - reverse complement final base and return
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    /*Check if ended on same base; if so complement base*/
-    if(endStr == seqStr)
-    { /*If: ending on same base (not swaped)*/
-       switch(*seqStr & (~32)) /*Make sure upper case*/
-       { /*switch, reverse complement*/
-           case 'A': *seqStr = 'T'; break;
-           case 'C': *seqStr = 'G'; break;
-           case 'G': *seqStr = 'C'; break;
-           case 'T': *seqStr = 'A'; break;
-           case 'U': *seqStr = 'A'; break;
-           case 'W': *seqStr = 'W'; break;
-           case 'S': *seqStr = 'S'; break;
-           case 'M': *seqStr = 'K'; break;  /*A/C->T/G*/
-           case 'K': *seqStr = 'M'; break;  /*T/G->A/C*/
-           case 'R': *seqStr = 'Y'; break;  /*A/G->T/C*/
-           case 'Y': *seqStr = 'R'; break;  /*T/C->A/G*/
-           case 'B': *seqStr = 'V'; break;/*C/G/T->G/C/A*/
-           case 'D': *seqStr = 'H'; break;/*G/T/A->C/A/T*/
-           case 'H': *seqStr = 'D'; break;/*C/A/T->G/T/A*/
-           case 'V': *seqStr = 'B'; break;/*A/C/G->T/G/C*/
-           case 'N': *seqStr = 'N'; break;/*A/C/G/T*/
-           default: *seqStr = 0;
-       } /*switch, reverse complement*/
-    } /*If: ending on same base (not swaped)*/
-
-    return;
+   revCmpStr_seqST(
+      seqSTPtr->seqStr,
+      qStr,
+      seqSTPtr->seqLenSL
+   );
 } /*revComp_seqST*/
 
 /*-------------------------------------------------------\
@@ -791,12 +725,30 @@ freeStack_seqST(
 ){
    if(seqSTPtr)
    { /*If: I have something to free*/
+      if(seqSTPtr->idStr)
+         resize_memTag(
+            def_seqST_memTag,
+            seqSTPtr->idSizeSL,
+            0
+         );
       free(seqSTPtr->idStr);
       seqSTPtr->idStr = 0;
 
+      if(seqSTPtr->seqStr)
+         resize_memTag(
+            def_seqST_memTag,
+            seqSTPtr->seqSizeSL,
+            0
+         );
       free(seqSTPtr->seqStr);
       seqSTPtr->seqStr = 0;
 
+      if(seqSTPtr->qStr)
+         resize_memTag(
+            def_seqST_memTag,
+            seqSTPtr->qSizeSL,
+            0
+         );
       free(seqSTPtr->qStr);
       seqSTPtr->qStr = 0;
 
@@ -973,6 +925,11 @@ cp_seqST(
          if(dupSeqST->qStr)
          { /*If: need to resize buffer*/
             free(dupSeqST->qStr);
+            resize_memTag(
+               def_seqST_memTag,
+               dupSeqST->qSizeSL,
+               0
+            );
             dupSeqST->qStr = 0;
          } /*If: need to resize buffer*/
 
@@ -984,8 +941,14 @@ cp_seqST(
                * sizeof(signed char)
             );
 
-         if(! dupSeqST)
+         if(! dupSeqST->qStr)
             goto memErr_fun12;
+
+         resize_memTag(
+            def_seqST_memTag,
+            0,
+            dupSeqST->qSizeSL
+         );
       } /*If: have to resize buffer*/
       
       dupSeqST->qLenSL = cpSeqST->qLenSL;
@@ -1010,6 +973,11 @@ cp_seqST(
       if(dupSeqST->seqStr)
       { /*If: need to resize buffer*/
          free(dupSeqST->seqStr);
+         resize_memTag(
+            def_seqST_memTag,
+            dupSeqST->seqSizeSL,
+            0
+         );
          dupSeqST->seqStr = 0;
       } /*If: need to resize buffer*/
 
@@ -1021,8 +989,14 @@ cp_seqST(
             * sizeof(signed char)
          );
 
-      if(! dupSeqST)
+      if(! dupSeqST->seqStr)
          goto memErr_fun12;
+
+      resize_memTag(
+         def_seqST_memTag,
+         0,
+         dupSeqST->seqSizeSL
+      );
    } /*If: have to resize buffer*/
 
    dupSeqST->seqLenSL = cpSeqST->seqLenSL;
@@ -1046,6 +1020,11 @@ cp_seqST(
       if(dupSeqST->idStr)
       { /*If: need to resize buffer*/
          free(dupSeqST->idStr);
+         resize_memTag(
+            def_seqST_memTag,
+            dupSeqST->idSizeSL,
+            0
+         );
          dupSeqST->idStr = 0;
       } /*If: need to resize buffer*/
 
@@ -1057,8 +1036,14 @@ cp_seqST(
             * sizeof(signed char)
          );
 
-      if(! dupSeqST)
+      if(! dupSeqST->idStr)
          goto memErr_fun12;
+
+      resize_memTag(
+         def_seqST_memTag,
+         0,
+         dupSeqST->idSizeSL
+      );
    } /*If: have to resize buffer*/
    
    dupSeqST->idLenSL = cpSeqST->idLenSL;
@@ -1552,6 +1537,60 @@ readFaFile_seqST(
       return retHeapAryST;
 } /*readFaFile_seqST*/
 
+/*-------------------------------------------------------\
+| Fun19: revCmpStr_seqST
+|  - reverse complement a c-string sequence in place
+| Input:
+|  - seqStr:
+|    o c-string with sequence to reverse complement
+|  - qStr:
+|    o c-string with q-scores to reverse (length must be
+|      lenSL) or 0 (null) for no q-scores
+|  - lenSL:
+|    o number of bases in seqStr
+| Output:
+|  - Modifies:
+|    o seqStr to be reverse complemented (upper case)
+|      * non-IUPAC bases are set to '\0'
+|    o qStr to be reversed (if not 0)
+\-------------------------------------------------------*/
+void
+revCmpStr_seqST(
+   signed char *seqStr,
+   signed char *qStr,
+   signed long lenSL
+){
+   signed char *endStr = seqStr + lenSL - 1;
+   signed char tmpSC = 0;
+
+   /*the complement is a table look up, so the loop has
+   `  no branches (besides the loop) for the compiler to
+   `  trip on
+   */
+   while(seqStr < endStr)
+   { /*Loop: reverse complement the sequence*/
+      tmpSC = cmpNt_seqST[(unsigned char) *seqStr];
+      *seqStr++ = cmpNt_seqST[(unsigned char) *endStr];
+      *endStr-- = tmpSC;
+   } /*Loop: reverse complement the sequence*/
+
+   if(seqStr == endStr)
+      *seqStr = cmpNt_seqST[(unsigned char) *seqStr];
+      /*odd length, middle base is only complemented*/
+
+   if(! qStr)
+      return;
+
+   endStr = qStr + lenSL - 1;
+
+   while(qStr < endStr)
+   { /*Loop: reverse the q-score entry*/
+      tmpSC = *qStr;
+      *qStr++ = *endStr;
+      *endStr-- = tmpSC;
+   } /*Loop: reverse the q-score entry*/
+} /*revCmpStr_seqST*/
+
 /*=======================================================\
 : License:
 : 
@@ -40,6 +40,8 @@
 '     - add more memory to a seqST struct array
 '   o fun18: readFaFile_seqST
 '     - get all sequences from a fasta file
+'   o fun19: revCmpStr_seqST
+'     - reverse complement a c-string sequence in place
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -427,6 +429,30 @@ readFaFile_seqST(
    signed char *errSCPtr   /*holds error values*/
 );
 
+/*-------------------------------------------------------\
+| Fun19: revCmpStr_seqST
+|  - reverse complement a c-string sequence in place
+| Input:
+|  - seqStr:
+|    o c-string with sequence to reverse complement
+|  - qStr:
+|    o c-string with q-scores to reverse (length must be
+|      lenSL) or 0 (null) for no q-scores
+|  - lenSL:
+|    o number of bases in seqStr
+| Output:
+|  - Modifies:
+|    o seqStr to be reverse complemented (upper case)
+|      * non-IUPAC bases are set to '\0'
+|    o qStr to be reversed (if not 0)
+\-------------------------------------------------------*/
+void
+revCmpStr_seqST(
+   signed char *seqStr,
+   signed char *qStr,
+   signed long lenSL
+);
+
 #endif
 
 /*=======================================================\
@@ -1,53 +1,68 @@
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' tbCon SOF: Start Of File
 '  - holds functions to make a quick consensus, more like
-'    ivar. this is a bit memory intensive,
-'    (40 + # insertions * (17) + bases in insertions)
-'    bytes 
+'    ivar. the pileup is a struct of arrays, so it is
+'    (36 + 16 * # insertions) bytes per base plus the
+'    unique insertion sequences (interned)
 '   o header:
 '     - Included libraries
-'   o .h st01: insBase
-'     - structure to hold an list of insetions for a
-'       single position
-'   o .h st02: conNt_tbCon
-'     - structure to hold an single base in a sequence
-'   o .h st03: set_tbCon
+'   o .h st01: ins_tbCon
+'     - counts reads supporting one insertion at a single
+'       position (in an insArena_tbCon struct)
+'   o .h st02: insArena_tbCon
+'     - holds the insertions and the interned insertion
+'       sequences for a set of pileup blocks
+'   o .h st03: pile_tbCon
+'     - pileup (struct of arrays) for a reference
+'   o .h st04: set_tbCon
 '     - holds the settings for tbCon
-'   o fun01: initInsBase
-'     - initializes an initBase structure
-'   o fun02: mkIns_tbCon
-'     - makes and initializes an ins_tbCon structure
-'   o fun03: freeHeap_ins_tbCon
-'     - Frees an heap allocated insBase structure
-'   o fun04: blank_conNt_tbCon
-'     - sets all variables in conNt_tbCon structure to 0
-'   o fun05: init_conNt_tbCon
-'     - initializes a conNt_tbCon structure
-'   o fun06: mk_conNt_tbCon
-'     - Makes an initialized, heap allocated conNt_tbCon
-'       structure
-'   o fun07: freeStack_conNt_tbCon
-'     - frees heap allocated variables in a conNt_tbCon
-'       structure (also initializes structure)
-'   o fun08: freeHeap_conNt_tbCon
-'     - frees a conNt_tbCon structure
-'   o fun09: freeHeapAry_conNt_tbCon
-'     - frees array of heap allocated conNt_tbCon structs
+'   o fun01: init_insArena_tbCon
+'     - initializes an insArena_tbCon struct
+'   o fun02: freeStack_insArena_tbCon
+'     - frees variables in an insArena_tbCon struct
+'   o .c fun03: addIns_insArena_tbCon
+'     - adds an insertion from a read to the insertion
+'       list of one reference base
+'   o fun04: blank_pile_tbCon
+'     - sets all counts in a pile_tbCon struct to 0 and
+'       removes all insertions
+'   o fun05: init_pile_tbCon
+'     - initializes a pile_tbCon struct
+'   o fun06: setup_pile_tbCon
+'     - allocates the insertion arenas for a pile_tbCon
+'       struct
+'   o fun07: freeStack_pile_tbCon
+'     - frees variables in a pile_tbCon struct
+'   o fun08: freeHeap_pile_tbCon
+'     - frees a pile_tbCon struct
+'   o fun09: freeHeapAry_pile_tbCon
+'     - frees an array of pile_tbCon structs
 '   o fun10: init_set_tbCon
 '     - initialize a set_tbCon struct to default settings
 '   o fun11: freeStack_set_tbCon
 '     - frees variables inside a set_tbCon struct
 '   o fun12: addRead_tbCon
-'     - adds read to a conNt_tbCon array
+'     - adds read to a pile_tbCon struct
 '   o fun13: collapse_tbCon
-'     - Collapses a conNt_tbCon array into an array of
+'     - Collapses a pile_tbCon struct into an array of
 '       samEntry structures
 '   o fun14: noFragCollapse_tbCon
-'     - collapses a conNt_tbCon struct array into a single
+'     - collapses a pile_tbCon struct into a single
 '       samEntry struct (low read depth is masked)
 '   o fun15: pvar_tbCon
-'     - print entries in a conNt_tbCon structure array
-'       that are above the minimum read depth
+'     - print entries in a pile_tbCon struct that are
+'       above the minimum read depth
+'   o fun16: chkRead_tbCon
+'     - checks if a read can be added to a consensus
+'   o fun17: realloc_pile_tbCon
+'     - makes sure a pile_tbCon struct covers a reference
+'       position (allocates or resizes)
+'   o fun18: addReadWin_tbCon
+'     - adds the part of a read that is in a reference
+'       window to a pile_tbCon struct
+'   o fun19: bestIns_tbCon
+'     - finds the insertion with the most support at a
+'       reference base
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -85,225 +100,655 @@
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /*-------------------------------------------------------\
-| Fun01: initInsBase
-|   - Initializes an initBase structure
+| Fun01: init_insArena_tbCon
+|   - initializes an insArena_tbCon struct
 | Input:
-|   - insSTPtr:
-|     o A Pointer to an insBase structure to initialize
+|   - arenaSTPtr:
+|     o pointer to an insArena_tbCon struct to initialize
 | Output:
 |   - Modifies:
-|     o All values in insBase to be 0
+|     o all values (including pointers) in arenaSTPtr to
+|       be 0
 \-------------------------------------------------------*/
 void
-init_insBase_tbCon(
-   struct ins_tbCon *insSTPtr
+init_insArena_tbCon(
+   struct insArena_tbCon *arenaSTPtr
 ){
-   insSTPtr->insStr = 0;
-   insSTPtr->lenInsSI = 0;
-   insSTPtr->numHitsSI = 0;
-   insSTPtr->nextIns = 0;
-} /*initInsBase*/
+   arenaSTPtr->insAryST = 0;
+   arenaSTPtr->lenInsSI = 0;
+   arenaSTPtr->sizeInsSI = 0;
+
+   arenaSTPtr->seqStr = 0;
+   arenaSTPtr->lenSeqUI = 0;
+   arenaSTPtr->sizeSeqUI = 0;
+
+   arenaSTPtr->hashAryUI = 0;
+   arenaSTPtr->numSeqSI = 0;
+   arenaSTPtr->sizeHashSI = 0;
+} /*init_insArena_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun02: mkIns_tbCon
-|   - makes and initializes an ins_tbCon structure
+| Fun02: freeStack_insArena_tbCon
+|   - frees heap allocated variables in an insArena_tbCon
+|     struct (also initializes struct)
 | Input:
+|   - arenaSTPtr:
+|     o pointer to insArena_tbCon struct to free variables
 | Output:
-|   - Returns:
-|     o pointer to initialized ins_tbCon structure
-|     o 0 for memory errors
+|   - Frees:
+|     o insAryST, seqStr, and hashAryUI in arenaSTPtr
+|   - Sets:
+|     o all values in arenaSTPtr to 0
 \-------------------------------------------------------*/
-struct ins_tbCon *
-mkIns_tbCon(
-   void
+void
+freeStack_insArena_tbCon(
+   struct insArena_tbCon *arenaSTPtr
 ){
-   struct ins_tbCon *retMacST =
-      malloc(sizeof(struct ins_tbCon));
+   if(! arenaSTPtr)
+      return;
 
-   if(retMacST)
-      init_insBase_tbCon(retMacST);
+   if(arenaSTPtr->insAryST)
+      free(arenaSTPtr->insAryST);
 
-   return retMacST;
-} /*mkIns_tbCon*/
+   if(arenaSTPtr->seqStr)
+      free(arenaSTPtr->seqStr);
+
+   if(arenaSTPtr->hashAryUI)
+      free(arenaSTPtr->hashAryUI);
+
+   init_insArena_tbCon(arenaSTPtr);
+} /*freeStack_insArena_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun03: freeHeap_ins_tbCon
-|   - frees heap allocated insBase structure
+| Fun03: addIns_insArena_tbCon
+|   - adds an insertion from a read to the insertion list
+|     of one reference base in an insArena_tbCon struct
 | Input:
-|   - insSTPtr:
-|     o pointer to insBase structure to free
+|   - arenaSTPtr:
+|     o pointer to insArena_tbCon struct the reference
+|       base uses
+|   - firstInsSIPtr:
+|     o pointer to the index of the first insertion at
+|       the reference base (insArySI in pile_tbCon)
+|     o -1 if the base has no insertions
+|   - samSTPtr:
+|     o pointer to samEntry struct with the insertion
+|   - startUI:
+|     o index of first base of the insertion in the read
+|   - lenInsSI:
+|     o number of bases in the insertion
+|   - settings:
+|     o pointer to set_tbCon struct with settings
+|       (minInsQSI)
 | Output:
-|   - Frees:
-|     o insSTPtr
+|   - Modifies:
+|     o seqStr, lenSeqUI, hashAryUI, and numSeqSI in
+|       arenaSTPtr to have the insertion (if the insertion
+|       sequence is new)
+|     o insAryST and lenInsSI in arenaSTPtr to have a new
+|       insertion or numHitsSI to be incremented for an
+|       insertion already in the list
+|     o firstInsSIPtr to have the new insertion if the
+|       base had no insertions
+|     o nothing if all bases are under minInsQSI
 |   - Returns:
-|     o next insBase structure (nextIns) in insBase list
+|     o 0 for no errors
+|     o def_memErr_tbConDefs for memory errors
 \-------------------------------------------------------*/
-struct ins_tbCon *
-freeHeap_ins_tbCon(
-   struct ins_tbCon *insSTPtr
-){
-   struct ins_tbCon *nextIns = 0;
- 
-   if(insSTPtr)
-   { /*If: have structure to free*/
-      nextIns = insSTPtr->nextIns;
- 
-      if(insSTPtr->insStr)
-         free(insSTPtr->insStr);
- 
-      free(insSTPtr);
-   } /*If: have structure to free*/
- 
-   return nextIns;
-} /*freeHeap_ins_tbCon*/
+signed char
+addIns_insArena_tbCon(
+   struct insArena_tbCon *arenaSTPtr,
+   signed int *firstInsSIPtr, /*first insertion at base*/
+   struct samEntry *samSTPtr, /*read with insertion*/
+   unsigned int startUI,      /*start of insertion*/
+   signed int lenInsSI,       /*length of insertion*/
+   struct set_tbCon *settings
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun03 TOC:
+   '   - adds an insertion to an insArena_tbCon struct
+   '   o fun03 sec01:
+   '     - variable declarations
+   '   o fun03 sec02:
+   '     - copy insertion bases with min q-score to the
+   '       end of the sequence arena
+   '   o fun03 sec03:
+   '     - find or add (intern) the insertion sequence
+   '   o fun03 sec04:
+   '     - find or add the insertion for this base
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char *insStr = 0;   /*insertion at end of arena*/
+   signed char *tmpStr = 0;   /*for reallocs*/
+   signed int siIns = 0;      /*position at in insertion*/
+   unsigned int uiBase = 0;   /*position at in read*/
+   unsigned int seqUI = 0;    /*insertion start in arena*/
+   unsigned int *oldHashAryUI = 0;
+   signed int oldSizeSI = 0;
+
+   unsigned long hashUL = 0;  /*hash of insertion*/
+   signed int siSlot = 0;     /*slot in hash table*/
+   signed int siOld = 0;      /*for rehashing*/
+
+   signed int siCur = 0;      /*insertion on*/
+   signed int siLast = -1;    /*last insertion in list*/
+   struct ins_tbCon *insSTPtr = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec02:
+   ^   - copy insertion bases with min q-score to the end
+   ^     of the sequence arena
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! arenaSTPtr->lenSeqUI)
+      arenaSTPtr->lenSeqUI = 1;
+      /*0 marks an empty slot in the hash table, so no
+      `  sequence can start at 0
+      */
+
+   if(
+         arenaSTPtr->lenSeqUI + (unsigned int) lenInsSI + 1
+      >= arenaSTPtr->sizeSeqUI
+   ){ /*If: need more memory for the sequence*/
+      oldSizeSI = (signed int) arenaSTPtr->sizeSeqUI;
+
+      if(! arenaSTPtr->sizeSeqUI)
+         arenaSTPtr->sizeSeqUI = 1024;
+
+      while(
+              arenaSTPtr->lenSeqUI
+            + (unsigned int) lenInsSI
+            + 1
+         >= arenaSTPtr->sizeSeqUI
+      ) arenaSTPtr->sizeSeqUI <<= 1;
+
+      tmpStr =
+         realloc(
+            arenaSTPtr->seqStr,
+            arenaSTPtr->sizeSeqUI * sizeof(signed char)
+         );
+
+      if(! tmpStr)
+      { /*If: memory error*/
+         arenaSTPtr->sizeSeqUI = (unsigned int) oldSizeSI;
+         return def_memErr_tbConDefs;
+      } /*If: memory error*/
+
+      arenaSTPtr->seqStr = tmpStr;
+      arenaSTPtr->seqStr[0] = '\0';
+   } /*If: need more memory for the sequence*/
+
+   insStr = &arenaSTPtr->seqStr[arenaSTPtr->lenSeqUI];
+   siIns = 0;
+
+   for(
+      uiBase = startUI;
+      uiBase < startUI + (unsigned int) lenInsSI;
+      ++uiBase
+   ){ /*Loop: copy the insertion*/
+      if(
+            samSTPtr->qStr[0] != '*'
+         && samSTPtr->qStr[1] != '\0'
+      ){ /*If: have q-score entry*/
+         if(
+              samSTPtr->qStr[uiBase] - def_adjQ_samEntry
+            < settings->minInsQSI
+         ) continue; /*This insertion is low quality*/
+      } /*If: have q-score entry*/
+
+      insStr[siIns] = samSTPtr->seqStr[uiBase];
+      hashUL = hashUL * 31 + (unsigned char) insStr[siIns];
+      ++siIns;
+   } /*Loop: copy the insertion*/
+
+   if(siIns == 0)
+      return 0; /*discarded the insertion*/
+
+   insStr[siIns] = '\0';
+   lenInsSI = siIns;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec03:
+   ^   - find or add (intern) the insertion sequence
+   ^   o fun03 sec03 sub01:
+   ^     - resize hash table (if needed)
+   ^   o fun03 sec03 sub02:
+   ^     - find the insertion sequence
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun03 Sec03 Sub01:
+   *   - resize hash table (if needed)
+   \*****************************************************/
+
+   if(
+        (arenaSTPtr->numSeqSI + 1) << 1
+      > arenaSTPtr->sizeHashSI
+   )
+   { /*If: hash table is over half full*/
+      oldHashAryUI = arenaSTPtr->hashAryUI;
+      oldSizeSI = arenaSTPtr->sizeHashSI;
+
+      if(! arenaSTPtr->sizeHashSI)
+         arenaSTPtr->sizeHashSI = 256;
+      else
+         arenaSTPtr->sizeHashSI <<= 1;
+
+      arenaSTPtr->hashAryUI =
+         calloc(
+            (unsigned long) arenaSTPtr->sizeHashSI,
+            sizeof(unsigned int)
+         );
+
+      if(! arenaSTPtr->hashAryUI)
+      { /*If: memory error*/
+         arenaSTPtr->hashAryUI = oldHashAryUI;
+         arenaSTPtr->sizeHashSI = oldSizeSI;
+         return def_memErr_tbConDefs;
+      } /*If: memory error*/
+
+      for(siOld = 0; siOld < oldSizeSI; ++siOld)
+      { /*Loop: rehash old sequences*/
+         if(! oldHashAryUI[siOld])
+            continue;
+
+         tmpStr = &arenaSTPtr->seqStr[oldHashAryUI[siOld]];
+         hashUL = 0;
+
+         for(
+            seqUI = 0;
+            tmpStr[seqUI] != '\0';
+            ++seqUI
+         ) hashUL =
+              hashUL * 31
+            + (unsigned char) tmpStr[seqUI];
+
+         siSlot =
+            (signed int)
+            (
+                 hashUL
+               & (unsigned long)
+                 (arenaSTPtr->sizeHashSI - 1)
+            );
+
+         while(arenaSTPtr->hashAryUI[siSlot])
+            siSlot =
+               (siSlot + 1) & (arenaSTPtr->sizeHashSI - 1);
+
+         arenaSTPtr->hashAryUI[siSlot] =
+            oldHashAryUI[siOld];
+      } /*Loop: rehash old sequences*/
+
+      if(oldHashAryUI)
+         free(oldHashAryUI);
+      oldHashAryUI = 0;
+
+      hashUL = 0;
+
+      for(siIns = 0; siIns < lenInsSI; ++siIns)
+         hashUL =
+            hashUL * 31 + (unsigned char) insStr[siIns];
+   } /*If: hash table is over half full*/
+
+   /*****************************************************\
+   * Fun03 Sec03 Sub02:
+   *   - find the insertion sequence
+   \*****************************************************/
+
+   siSlot =
+      (signed int)
+      (
+           hashUL
+         & (unsigned long) (arenaSTPtr->sizeHashSI - 1)
+      );
+
+   while(arenaSTPtr->hashAryUI[siSlot])
+   { /*Loop: find the insertion sequence*/
+      tmpStr =
+         &arenaSTPtr->seqStr[arenaSTPtr->hashAryUI[siSlot]];
+
+      for(
+         siIns = 0;
+         insStr[siIns] == tmpStr[siIns];
+         ++siIns
+      ) if(insStr[siIns] == '\0') break;
+
+      if(insStr[siIns] == tmpStr[siIns])
+         break; /*found the insertion*/
+
+      siSlot = (siSlot + 1) & (arenaSTPtr->sizeHashSI - 1);
+   } /*Loop: find the insertion sequence*/
+
+   if(arenaSTPtr->hashAryUI[siSlot])
+      seqUI = arenaSTPtr->hashAryUI[siSlot];
+
+   else
+   { /*Else: new insertion sequence; keep it*/
+      seqUI = arenaSTPtr->lenSeqUI;
+      arenaSTPtr->hashAryUI[siSlot] = seqUI;
+      arenaSTPtr->lenSeqUI += (unsigned int) lenInsSI + 1;
+      ++arenaSTPtr->numSeqSI;
+   } /*Else: new insertion sequence; keep it*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec04:
+   ^   - find or add the insertion for this base
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   for(
+      siCur = *firstInsSIPtr;
+      siCur >= 0;
+      siCur = arenaSTPtr->insAryST[siCur].nextSI
+   ){ /*Loop: check if base already has insertion*/
+      if(arenaSTPtr->insAryST[siCur].seqUI == seqUI)
+      { /*If: found the insertion*/
+         ++arenaSTPtr->insAryST[siCur].numHitsSI;
+         return 0;
+      } /*If: found the insertion*/
+
+      siLast = siCur;
+   } /*Loop: check if base already has insertion*/
+
+   if(arenaSTPtr->lenInsSI >= arenaSTPtr->sizeInsSI)
+   { /*If: need more memory for insertions*/
+      oldSizeSI = arenaSTPtr->sizeInsSI;
+
+      if(! arenaSTPtr->sizeInsSI)
+         arenaSTPtr->sizeInsSI = 256;
+      else
+         arenaSTPtr->sizeInsSI <<= 1;
+
+      insSTPtr =
+         realloc(
+            arenaSTPtr->insAryST,
+              (unsigned long) arenaSTPtr->sizeInsSI
+            * sizeof(struct ins_tbCon)
+         );
+
+      if(! insSTPtr)
+      { /*If: memory error*/
+         arenaSTPtr->sizeInsSI = oldSizeSI;
+         return def_memErr_tbConDefs;
+      } /*If: memory error*/
+
+      arenaSTPtr->insAryST = insSTPtr;
+   } /*If: need more memory for insertions*/
+
+   siCur = arenaSTPtr->lenInsSI;
+   ++arenaSTPtr->lenInsSI;
+
+   insSTPtr = &arenaSTPtr->insAryST[siCur];
+   insSTPtr->seqUI = seqUI;
+   insSTPtr->lenInsSI = lenInsSI;
+   insSTPtr->numHitsSI = 1;
+   insSTPtr->nextSI = -1;
+
+   /*new insertions go at the end of the list, so the
+   `  first insertion in a tie is always the first seen
+   */
+   if(siLast >= 0)
+      arenaSTPtr->insAryST[siLast].nextSI = siCur;
+   else
+      *firstInsSIPtr = siCur;
+
+   return 0;
+} /*addIns_insArena_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun04: blank_conNt_tbCon
-|   - sets all variables in conNt_tbCon structure to 0
+| Fun04: blank_pile_tbCon
+|   - sets all counts in a pile_tbCon struct to 0 and
+|     removes all insertions (memory is kept)
 | Input:
-|   - conNtSTPtr:
-|     o pointer to conNt_tbCon structure to blank
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to blank
 | Output:
 |   - Modifies:
-|     o all non-pointer values in conNtSTPtr to be 0
+|     o all counts in pileSTPtr to be 0
+|     o insArySI in pileSTPtr to be -1 (no insertions)
+|     o lengths in arenaAryST to be 0 and clears the hash
+|       tables
 \-------------------------------------------------------*/
 void
-blank_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+blank_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 ){
-   conNtSTPtr->numASI = 0;
-   conNtSTPtr->numTSI = 0;
-   conNtSTPtr->numGSI = 0;
-   conNtSTPtr->numCSI = 0;
-   conNtSTPtr->numDelSI = 0;
-   
-   conNtSTPtr->numInsSI = 0;
+   unsigned int uiBase = 0;
+   signed int siArena = 0;
+   signed int siSlot = 0;
+   struct insArena_tbCon *arenaSTPtr = 0;
+
+   if(pileSTPtr->numAArySI)
+   { /*If: have counts to blank*/
+      for(uiBase = 0; uiBase < pileSTPtr->lenUI; ++uiBase)
+      { /*Loop: blank counts*/
+         pileSTPtr->numAArySI[uiBase] = 0;
+         pileSTPtr->numTArySI[uiBase] = 0;
+         pileSTPtr->numCArySI[uiBase] = 0;
+         pileSTPtr->numGArySI[uiBase] = 0;
+         pileSTPtr->numDelArySI[uiBase] = 0;
+         pileSTPtr->numInsArySI[uiBase] = 0;
+         pileSTPtr->insArySI[uiBase] = -1;
+         pileSTPtr->totalNtArySI[uiBase] = 0;
+         pileSTPtr->ntKeptArySI[uiBase] = 0;
+      } /*Loop: blank counts*/
+   } /*If: have counts to blank*/
+
+   for(
+      siArena = 0;
+      siArena < pileSTPtr->numArenaSI;
+      ++siArena
+   ){ /*Loop: blank insertion arenas*/
+      arenaSTPtr = &pileSTPtr->arenaAryST[siArena];
+
+      arenaSTPtr->lenInsSI = 0;
+      arenaSTPtr->lenSeqUI = 0;
+      arenaSTPtr->numSeqSI = 0;
 
-   conNtSTPtr->totalNtSI = 0;
-   conNtSTPtr->ntKeptSI = 0;
-} /*blank_conNt_tbCon*/
+      for(
+         siSlot = 0;
+         siSlot < arenaSTPtr->sizeHashSI;
+         ++siSlot
+      ) arenaSTPtr->hashAryUI[siSlot] = 0;
+   } /*Loop: blank insertion arenas*/
+} /*blank_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun05: init_conNt_tbCon
-|   - initializes a conNt_tbCon structure
+| Fun05: init_pile_tbCon
+|   - initializes a pile_tbCon struct
 | Input:
-|   - conNtSTPtr:
-|     o pointer to an conNt_tbCon structure to initialize
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to initialize
 | Output:
 |   - Modifies:
-|     o all values (including pointers) in conNtSTPtr to
+|     o all values (including pointers) in pileSTPtr to
 |       be 0
 \-------------------------------------------------------*/
 void
-init_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+init_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 ){
-   blank_conNt_tbCon(conNtSTPtr);
-   conNtSTPtr->insList = 0;
-} /*init_conNt_tbCon*/
+   pileSTPtr->numAArySI = 0;
+   pileSTPtr->numTArySI = 0;
+   pileSTPtr->numCArySI = 0;
+   pileSTPtr->numGArySI = 0;
+   pileSTPtr->numDelArySI = 0;
+   pileSTPtr->numInsArySI = 0;
+   pileSTPtr->insArySI = 0;
+   pileSTPtr->totalNtArySI = 0;
+   pileSTPtr->ntKeptArySI = 0;
+   pileSTPtr->lenUI = 0;
+
+   pileSTPtr->arenaAryST = 0;
+   pileSTPtr->numArenaSI = 0;
+} /*init_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun06: mk_conNt_tbCon
-|   - makes initialized, heap allocated conNt_tbCon struct
+| Fun06: setup_pile_tbCon
+|   - allocates the insertion arenas for a pile_tbCon
+|     struct
 | Input:
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to set up
+|   - numArenaSI:
+|     o number of insertion arenas to use; use the number
+|       of threads that add reads at the same time
+|     o block (position / def_blockLen_tbCon) uses arena
+|       block % numArenaSI
 | Output:
+|   - Modifies:
+|     o arenaAryST and numArenaSI in pileSTPtr to have
+|       numArenaSI initialized arenas
 |   - Returns:
-|     o pointer to an initialized conNt_tbCon structure
-|     o 0 for memory errors
+|     o 0 for no errors
+|     o def_memErr_tbConDefs for memory errors
 \-------------------------------------------------------*/
-struct conNt_tbCon *
-mk_conNt_tbCon(
-   void
+signed char
+setup_pile_tbCon(
+   struct pile_tbCon *pileSTPtr,
+   signed int numArenaSI
 ){
-   struct conNt_tbCon *retST =
-      malloc(sizeof(struct conNt_tbCon));
-   
-   if(retST)
-      init_conNt_tbCon(retST);
-   
-   return retST;
-} /*mk_conNt_tbCon*/
+   signed int siArena = 0;
+
+   for(
+      siArena = 0;
+      siArena < pileSTPtr->numArenaSI;
+      ++siArena
+   ) freeStack_insArena_tbCon(
+        &pileSTPtr->arenaAryST[siArena]
+     );
+
+   if(pileSTPtr->arenaAryST)
+      free(pileSTPtr->arenaAryST);
+   pileSTPtr->arenaAryST = 0;
+   pileSTPtr->numArenaSI = 0;
+
+   if(numArenaSI < 1)
+      numArenaSI = 1;
+
+   pileSTPtr->arenaAryST =
+      malloc(numArenaSI * sizeof(struct insArena_tbCon));
+
+   if(! pileSTPtr->arenaAryST)
+      return def_memErr_tbConDefs;
+
+   pileSTPtr->numArenaSI = numArenaSI;
+
+   for(siArena = 0; siArena < numArenaSI; ++siArena)
+      init_insArena_tbCon(&pileSTPtr->arenaAryST[siArena]);
+
+   return 0;
+} /*setup_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun07: freeStack_conNt_tbCon
-|   - frees heap allocated variables in a conNt_tbCon
-|     structure (also initializes structure)
+| Fun07: freeStack_pile_tbCon
+|   - frees heap allocated variables in a pile_tbCon
+|     struct (also initializes struct)
 | Input:
-|   - conNtSTPtr:
-|     o pointer to conNt_tbCon struct to free variables
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to free variables
 | Output:
 |   - Frees:
-|     o frees the conNt_tbConST->insList 
+|     o count arrays and insertion arenas in pileSTPtr
 |   - Sets:
-|     o all values in conNt_tbConSTPTr to 0
+|     o all values in pileSTPtr to 0
 \-------------------------------------------------------*/
 void
-freeStack_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+freeStack_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 ){
-  if(conNtSTPtr)
-  { /*If: have structure to free*/
-     while(conNtSTPtr->insList)
-     { /*Loop: Free insertions*/
-        conNtSTPtr->insList =
-            freeHeap_ins_tbCon(conNtSTPtr->insList);
-     } /*Loop: Free insertions*/
-     
-     blank_conNt_tbCon(conNtSTPtr);
-  } /*If: have structure to free*/
-} /*freeStack_conNt_tbCon*/
+   signed int siArena = 0;
+
+   if(! pileSTPtr)
+      return;
+
+   if(pileSTPtr->numAArySI)
+      free(pileSTPtr->numAArySI);
+   if(pileSTPtr->numTArySI)
+      free(pileSTPtr->numTArySI);
+   if(pileSTPtr->numCArySI)
+      free(pileSTPtr->numCArySI);
+   if(pileSTPtr->numGArySI)
+      free(pileSTPtr->numGArySI);
+   if(pileSTPtr->numDelArySI)
+      free(pileSTPtr->numDelArySI);
+   if(pileSTPtr->numInsArySI)
+      free(pileSTPtr->numInsArySI);
+   if(pileSTPtr->insArySI)
+      free(pileSTPtr->insArySI);
+   if(pileSTPtr->totalNtArySI)
+      free(pileSTPtr->totalNtArySI);
+   if(pileSTPtr->ntKeptArySI)
+      free(pileSTPtr->ntKeptArySI);
+
+   for(
+      siArena = 0;
+      siArena < pileSTPtr->numArenaSI;
+      ++siArena
+   ) freeStack_insArena_tbCon(
+        &pileSTPtr->arenaAryST[siArena]
+     );
+
+   if(pileSTPtr->arenaAryST)
+      free(pileSTPtr->arenaAryST);
+
+   init_pile_tbCon(pileSTPtr);
+} /*freeStack_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun08: freeHeap_conNt_tbCon
-|   - frees a conNt_tbCon structure
+| Fun08: freeHeap_pile_tbCon
+|   - frees a pile_tbCon struct
 | Input:
-|   - conNtSTPtr:
-|     o pointer toa conNt_tbCon structure to free
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to free
 | Output:
 |   - Frees:
-|     o frees conNt_tbConST
+|     o pileSTPtr (you must set to 0/null)
 \-------------------------------------------------------*/
 void
-freeHeap_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+freeHeap_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 ){
-  if(conNtSTPtr)
+  if(pileSTPtr)
   { /*If: have structure to free*/
-     freeStack_conNt_tbCon(conNtSTPtr);
-     free(conNtSTPtr);
+     freeStack_pile_tbCon(pileSTPtr);
+     free(pileSTPtr);
   } /*If: have structure to free*/
-} /*freeHeap_conNt_tbCon*/
+} /*freeHeap_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun09: freeHeapAry_conNt_tbCon
-|   - frees array of heap allocated conNt_tbCon structs
+| Fun09: freeHeapAry_pile_tbCon
+|   - frees an array of pile_tbCon structs
 | Input:
-|   - conNtAryST:
-|     o pointer conNt_tbCon struct array to free
+|   - pileAryST:
+|     o pointer to pile_tbCon struct array to free
 |   - lenArySI:
-|     o number of conNt_tbCon structurs in array
+|     o number of pile_tbCon structs in the array
 | Output:
 |   - Frees:
-|     o array in conNtSTPtr
+|     o pileAryST (you must set to 0/null)
 \-------------------------------------------------------*/
 void
-freeHeapAry_conNt_tbCon(
-   struct conNt_tbCon *conNtAryST,
+freeHeapAry_pile_tbCon(
+   struct pile_tbCon *pileAryST,
    signed int lenArySI
 ){
-  int siIndex = 0;
+  signed int siIndex = 0;
 
-  if(conNtAryST)
+  if(pileAryST)
   { /*If: have structures to free*/
     for(
        siIndex = 0;
        siIndex < lenArySI;
        ++siIndex
-    ) freeStack_conNt_tbCon(&conNtAryST[siIndex]);
-    
-    free(conNtAryST);
+    ) freeStack_pile_tbCon(&pileAryST[siIndex]);
+
+    free(pileAryST);
   } /*If: have structures to free*/
-} /*freeHeap_conNt_tbCon*/
+} /*freeHeapAry_pile_tbCon*/
 
 /*-------------------------------------------------------\
 | Fun10: init_set_tbCon
@@ -365,23 +810,22 @@ freeStack_set_tbCon(
 
 /*-------------------------------------------------------\
 | Fun12: addRead_tbCon
-|   - adds read to a conNt_tbCon array
+|   - adds read to a pile_tbCon struct
 | Input:
 |   - sameEntrySTPtr:
 |     o pointer to a samEntry struct with read to add
-|   - conNtAryST:
-|     o pointer to conNt_tbCon struct array to add read to
-|     o the array is resize if to small
-|   - lenRefUI:
-|     o length of the reference sequence; use 0 for unkown
-|     o is updated as conNt_tbConSTAry expands
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to add read to
+|     o the pileup is resized if to small
+|     o set lenUI to the reference length before the
+|       first read (0 for unkown)
 |   - settings:
 |     o pointer to set_tbCon struct with settings
 | Output:
 |   - Modifies:
-|     o conNtAryST to have new read
-|     o lenRefUI to have new conNtAryST size if conNtAryST
-|       is resized
+|     o pileSTPtr to have new read
+|     o lenUI in pileSTPtr to have new pileup length if
+|       the pileup is resized
 |   - Returns:
 |     o for no errors
 |     o def_header_tbConDefs for sam file header entry
@@ -393,1291 +837,771 @@ freeStack_set_tbCon(
 signed char
 addRead_tbCon(
    struct samEntry *samSTPtr, /*read to add to consensus*/
-   struct conNt_tbCon *conNtAryST[], /*consensus array*/
-   unsigned int *lenRefUI,       /*length of reference*/
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
    struct set_tbCon *settings
+){
+   signed char errSC = chkRead_tbCon(samSTPtr, settings);
+
+   if(errSC)
+      return errSC;
+
+   if(realloc_pile_tbCon(pileSTPtr, samSTPtr->refEndUI))
+      return def_memErr_tbConDefs;
+
+   return
+      addReadWin_tbCon(
+         samSTPtr,
+         pileSTPtr,
+         0,
+         pileSTPtr->lenUI,
+         settings
+      ); /*window is the whole reference*/
+}/*addRead_tbCon*/
+
+/*-------------------------------------------------------\
+| Fun13: collapse_tbCon
+|   - collapses a pile_tbCon struct into an array of
+|     samEntry structs
+| Input:
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to collapse
+|   - lenSamArySI:
+|     o pointer to integer to have number of samEntry
+|       structures made
+|   - refIdStr:
+|     o c-string with referernce sequence name
+|   - settings:
+|     o pointer to set_tbCon struct with consensus
+|       building settings
+|   - errSC:
+|     o pointer to character to hold error type
+| Output:
+|   - Modifies:
+|     o lenSamST to hold the returned samEntry arrray
+|       length
+|     o errSC:
+|       - 0 for no errors
+|       - def_noSeq_tbConDefs if could not build consensus
+|       - def_memErr_tbConDefs if had memory error
+|   - Returns:
+|     o array of sam entry structures with consensus 
+|       fragments.
+|       - idealy this would be one structure, but for
+|         amplicons it will be an array
+|     o 0 for memory erors
+\-------------------------------------------------------*/
+struct samEntry *
+collapse_tbCon(
+   struct pile_tbCon *pileSTPtr, /*to collapse*/
+   signed int *lenSamArySI,    /*set to out array length*/
+   signed char *refIdStr,      /*name of reference seq*/
+   struct set_tbCon *settings, /*settings for collapsing*/
+   signed char *errSC          /*error reports*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun12 TOC: addRead_tbCon
-   '   - Adds the read into a conNt_tbCon array
-   '   o fun12 sec01:
+   ' Fun13 TOC: collapse_tbCon
+   '   - collapses a pile_tbCon struct into an array of
+   '     samEntry structs
+   '   o fun13 sec01:
    '     - variable declerations
-   '   o fun12 sec02:
-   '     - check read and allocate/reallocate memory
-   '   o fun12 sec03:
-   '     - Add bases to the consensus
+   '   o fun13 sec02:
+   '     - count the number of fragments I have
+   '   o fun13 sec03:
+   '     - allocate memory for each fragment
+   '   o fun13 sec04:
+   '     - collapse each fragment into a samEntry struct
+   '   o fun13 sec05:
+   '     - collapse the consensus fragment
+   '   o fun13 sec06:
+   '     - clean up and return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun12 Sec01:
+   ^ Fun13 Sec01:
    ^   - variable declerations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   signed char errSC = 0;        /*err reporting at end*/
+   signed int siFrag = 0;
+   unsigned int uiRef = 0;   /*ref base on*/
+   unsigned int uiEndRef = 0;/*last base amplicon/fragment*/
+   unsigned int lenFragUI = 0;/*length fragment/amplicon*/
+   unsigned int uiBase = 0; /*fragment position; base on*/
 
-   /*For loops*/
-   unsigned int uiCig = 0;    /*iterating throug cigars*/
-   unsigned int uiBase = 0;   /*iterating through bases*/
-   unsigned int uiRef = 0;    /*position at in reference*/
-   unsigned int endCigUI = 0; /*end of cigar entry*/
+   unsigned int uiCig = 0;     /*cigar entry on*/
+   unsigned int cigLenUI = 0;
+   signed char lastCigSC = '0';
+   unsigned int extraInsUI = 0;
+      /*max extra bases from ins's*/
 
-   /*For adding insertions to the consensus*/
-   signed int siIns = 0;      /*position at in insertion*/
-   signed int lenInsSI = 0;   /*length of found ins*/
-   signed char *insHeapStr  = 0;/*memory to hold ins*/
+   /*General support*/
+   float snpPerSupF = 0;
+   float insPerSupF = 0;
+   float delPerSupF = 0;
 
-   /*for adding insertions or looking for insertions*/
-   struct ins_tbCon *insST = 0;
-   struct ins_tbCon *lastInsST = 0;
+   /*Support for a particler snp/match*/
+   unsigned int nonMaskBaseUI = 0;
+      /*number of non-anonymous bases*/
+   float aPercSupF = 0;
+   float tPercSupF = 0;
+   float cPercSupF = 0;
+   float gPercSupF = 0;
+
+   /*Find the most supported insertion*/
+   signed int keptReadsSI = 0;
+   struct ins_tbCon *bestInsST = 0;
 
-   struct conNt_tbCon *baseST = 0; /*for reallocs*/
+   struct samEntry *retSamST = 0;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun12 Sec02:
-   ^   - check read and allocate/reallocate memory
-   ^   o fun12 sec02 sub01:
-   ^     - check if read can be added to consensus
-   ^   o fun12 sec02 sub02:
-   ^     - set up consnesus array (first time only)
-   ^   o fun12 sec02 sub03:
-   ^     - increase consnesus array size (if needed)
+   ^ Fun13 Sec02:
+   ^   - count number of fragments I have
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*****************************************************\
-   * Fun12 Sec02 Sub01:
-   *   - check if read can be added to consensus
-   \*****************************************************/
-
-   if(samSTPtr->extraStr[0] =='\0')
-      goto headerErr_fun12_sec04_sub03;
+   *lenSamArySI = 0;
+   *errSC = 0;
+   uiRef = 0;
 
-   if(samSTPtr->flagUS & 4)
-      goto noMapErr_fun12_sec04_sub04;
+   while(uiRef < pileSTPtr->lenUI)
+   { /*Loop: Find the number of fragments*/
 
-   if(samSTPtr->seqStr == 0)
-      goto noSeqErr_fun12_sec04_sub05;
+      /*Find the starting position for this fragment*/
+      while(
+           pileSTPtr->ntKeptArySI[uiRef]
+         < settings->minDepthSI
+      ){ /*Loop: Find the first base with enough depth*/
+         ++uiRef;
 
-   if(samSTPtr->seqStr[0] == '*')
-      goto noSeqErr_fun12_sec04_sub05;
+         if(uiRef >= pileSTPtr->lenUI)
+            goto collapse_fun13_sec03;
+      } /*Loop: Find the first base with enough depth*/
 
-   if(samSTPtr->mapqUC < settings->minMapqUC)
-      goto lowMapErr_fun12_sec04_sub06;
+      /*Find the length of this fragment*/
 
-   /*****************************************************\
-   * Fun12 Sec02 Sub02:
-   *   - set up consnesus array (first time only)
-   \*****************************************************/
+      for(
+         uiEndRef = uiRef;
+         uiEndRef < pileSTPtr->lenUI;
+         ++uiEndRef
+      ){ /*Loop: Find the memory for the fragment*/
+         if(
+               pileSTPtr->ntKeptArySI[uiEndRef]
+            < settings->minDepthSI
+         ) break;
+      } /*Loop: Find the memory for the fragment*/
 
-   /*First time*/
-   if(! *conNtAryST)
-   { /*If: First round*/
-      if(*lenRefUI < samSTPtr->refEndUI)
-         *lenRefUI = samSTPtr->refEndUI + 128;
+      /*Find the length*/
+      lenFragUI = uiRef - uiEndRef;
 
-      *conNtAryST =
-         malloc(*lenRefUI * sizeof(struct conNt_tbCon));
+      if(lenFragUI < (unsigned int) settings->minLenSI)
+      { /*If: This is beneath the min length to keep*/
+         uiRef = uiEndRef;
+         continue;
+      } /*If: This is beneath the min length to keep*/
 
-      if(! *conNtAryST)
-         goto memErr_fun12_sec04_sub02;
+      ++(*lenSamArySI);
 
-      /*Initialize all the strutures*/
-      for(
-         uiBase = 0;
-         uiBase < *lenRefUI;
-         ++uiBase
-      ) init_conNt_tbCon(&(*conNtAryST)[uiBase]);
-   } /*If: First round*/
+      uiRef = uiEndRef;
+   } /*Loop: Find the number of fragments*/
 
-   /*****************************************************\
-   * Fun12 Sec02 Sub03:
-   *   - increase consnesus array size (if needed)
-   \*****************************************************/
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun13 Sec03:
+   ^   - allocate memory for each fragment
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   else if(*lenRefUI < samSTPtr->refEndUI)
-   { /*If: need to add more bases*/
-      uiBase = *lenRefUI;
+   collapse_fun13_sec03:;
 
-      /*add some extra memory to reduce future reallocs*/
-      *lenRefUI = samSTPtr->refEndUI + 128;
+   if(*lenSamArySI == 0)
+      goto noConErr_fun13_sec06_sub03;
+      /*could not build the consensus*/
 
-      /*TODO: having issue here for repeated consensuses*/
-      baseST =
-         realloc(
-           *conNtAryST,
-           *lenRefUI * sizeof(struct conNt_tbCon)
-         ); /*Add more memory for the bases*/
+   retSamST =
+      malloc(*lenSamArySI * sizeof(struct samEntry));
 
-      if(! baseST)
-         goto memErr_fun12_sec04_sub02;
+   if(!retSamST)
+   { /*If: failed to allocate memory*/
+      *lenSamArySI = 0;
+      goto memErr_fun13_sec06_sub02;
+   } /*If: failed to allocate memory*/
 
-      *conNtAryST = baseST; 
+   /*Initialize the structures*/
+   for(
+      siFrag = 0;
+      siFrag < *lenSamArySI;
+      ++siFrag
+   ) init_samEntry(&retSamST[siFrag]);
 
-      while(uiBase < *lenRefUI)
-      { /*Loop: Initialize the new structures*/
-          init_conNt_tbCon(&(*conNtAryST)[uiBase]);
-          ++uiBase;
-      } /*Loop: Initialize the new structures*/
-   } /*If: need to add more bases*/
+   /*set up memory*/
+   for(
+      siFrag = 0;
+      siFrag < *lenSamArySI;
+      ++siFrag
+   ){ /*Loop: set up (allocate memory) to samEntry*/
+      if(setup_samEntry(&retSamST[siFrag]))
+         goto memErr_fun13_sec06_sub02;
+   } /*Loop: set up (allocate memory) to samEntry*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun12 Sec03:
-   ^   - add bases to consensus
-   ^   o fun12 sec03 sub01:
-   ^     - setup and start loop
-   ^   o fun12 sec03 sub02:
-   ^     - check matches and snp cases
-   ^   o fun12 sec03 sub03:
-   ^     - check deletion cases
-   ^   o fun12 sec03 sub04:
-   ^     - check the insertion cases
-   ^   o fun12 sec03 sub05:
-   ^     - handle softmasking
+   ^ Fun13 Sec04:
+   ^   - collapse each fragment into a samEntry struct
+   ^   o fun13 sec01 sub01:
+   ^     - get length & check if fragment meets min length
+   ^   o fun13 sec01 sub02:
+   ^     - find the length and memory I need to allocate
+   ^   o fun13 sec01 sub03:
+   ^     - set up the sam entry
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun12 Sec03 Sub01:
-   *   - setup and start loop
+   * Fun13 Sec01 Sub01:
+   *   - get length & check if fragment meets min length
    \*****************************************************/
 
-   uiBase = 0;
-   uiRef = samSTPtr->refStartUI;
-
-   for(uiCig = 0; uiCig < samSTPtr->cigLenUI; ++uiCig)
-   { /*Loop: add bases to the consensus*/
-
-      switch(samSTPtr->cigTypeStr[uiCig])
-      { /*Switch: Check the cigar entry type*/
-
-         /***********************************************\
-         * Fun12 Sec03 Sub02:
-         *   - check matches and snp cases
-         *   o fun12 sec03 sub02 cat01:
-         *     - add snps/matches to total & check q-score
-         *   o fun12 sec03 sub02 cat02:
-         *     - passed qc; add to nucleotide count
-         *   o fun12 sec03 sub02 cat03:
-         *     - move to next base in match/snp
-         \***********************************************/
+   uiRef = 0;
+   siFrag = 0;
 
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun12 Sec03 Sub02 Cat01:
-         +   - add snps/matches to total and check q-score
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
+   while(uiRef < pileSTPtr->lenUI)
+   { /*Loop: Find the number of fragments*/
 
-         case 'M':
-         case 'X':
-         case '=':
-         /*Case: match or snp*/
+      /*Find the starting position for this fragment*/
+      while(
+           pileSTPtr->ntKeptArySI[uiRef]
+         < settings->minDepthSI
+      ){ /*Loop: Find the first base with enough depth*/
+         ++uiRef;
 
-            endCigUI = uiBase + samSTPtr->cigArySI[uiCig];
+         if(uiRef >= pileSTPtr->lenUI)
+            goto noErr_fun13_sec06_sub01;
+            /*at end of consensusq*/
+      } /*Loop: Find the first base with enough depth*/
 
-            while(uiBase < endCigUI)
-            { /*Loop: add matchs/snps to consensus*/
-               ++(*conNtAryST)[uiRef].totalNtSI;
+      /**************************************************\
+      * Fun13 Sec01 Sub02:
+      *   - find the length and memory I need to allocate
+      *   o fun13 sec04 sub02 cat01:
+      *     - find the length/start memory count loop
+      *   o fun13 sec04 sub02 cat02:
+      *     - find the percent support for each option
+      *   o fun13 sec04 sub02 cat03:
+      *     - check if have ins (if so get extra bases)
+      *   o fun13 sec04 sub02 cat04:
+      *     - check if an snp/match, del, or mask will
+      *       be choosen
+      *   o fun13 sec04 sub02 cat05:
+      *     - find fragement length/check if long enough
+      \**************************************************/
 
-               if(
-                     samSTPtr->qStr[0] != '*'
-                  && samSTPtr->qStr[1] != '\0'
-               ){ /*If: I have a q-score entry*/
-                  if(
-                       samSTPtr->qStr[uiBase]
-                         - def_adjQ_samEntry
-                     < settings->minQSI
-                  ){ /*If: base is beneath min q*/
-                     ++uiBase;
-                     ++uiRef;
-                     continue;
-                  } /*If: base is beneath min q*/
-               } /*If: I have a q-score entry*/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub02 Cat01:
+      +   - find the length/start memory count loop
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-               /*++++++++++++++++++++++++++++++++++++++++\
-               + Fun12 Sec03 Sub02 Cat02:
-               +   - passed qc; add to nucleotide count
-               \++++++++++++++++++++++++++++++++++++++++*/
+      extraInsUI = 0;
 
-               /*Incurmenting total base count here so
-               `  masked positions are still kept
-               */
-               ++(*conNtAryST)[uiRef].ntKeptSI;
+      for(
+         uiEndRef = uiRef;
+         uiEndRef < pileSTPtr->lenUI;
+         ++uiEndRef
+      ){ /*Loop: Find the memory for the fragment*/
+         if(
+               pileSTPtr->ntKeptArySI[uiEndRef]
+            < settings->minDepthSI
+         ) break;
 
-               switch(samSTPtr->seqStr[uiBase] & ~32)
-               { /*Switch: Check the base type*/
-                  case 'A':
-                     ++(*conNtAryST)[uiRef].numASI;
-                     break;
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun13 Sec04 Sub02 Cat02:
+         +   - find the percent support for each option
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-                  case 'T':
-                     ++(*conNtAryST)[uiRef].numTSI;
-                     break;
+         /*The insertion is inbetween bases, which makes
+         ` it hard to gauge. So, I am taking the worst
+         ` case
+         */
+         keptReadsSI =
+           max_genMath(
+             pileSTPtr->ntKeptArySI[uiEndRef],
+             pileSTPtr->ntKeptArySI[
+                uiEndRef - (uiEndRef > 0)
+             ]
+           );
+            /*uiEndRef - (uiEndRef > 0) turns into
+            `  uiEndRef - 1, when uiEndRef is > 0; else is
+            `  uiEndRef
+            */
 
-                  case 'C':
-                     ++(*conNtAryST)[uiRef].numCSI;
-                     break;
+         if(keptReadsSI > 0)
+            insPerSupF =
+                 (float) pileSTPtr->numInsArySI[uiEndRef]
+               / (float) keptReadsSI;
+         else
+            insPerSupF = 0;
 
-                  case 'G':
-                     ++(*conNtAryST)[uiRef].numGSI;
-                     break;
-               } /*Switch: Check the base type*/
+         if(pileSTPtr->ntKeptArySI[uiEndRef] > 0)
+            delPerSupF =
+                 (float) pileSTPtr->numDelArySI[uiEndRef]
+               / (float) pileSTPtr->ntKeptArySI[uiEndRef];
+         else
+            delPerSupF = 0;
 
-               /*++++++++++++++++++++++++++++++++++++++++\
-               + Fun12 Sec03 Sub02 Cat03:
-               +   - move to next base in match/snp
-               \++++++++++++++++++++++++++++++++++++++++*/
+         nonMaskBaseUI = pileSTPtr->numAArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numTArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numGArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numCArySI[uiRef];
 
-               ++uiBase;
-               ++uiRef;
-            } /*Loop: Add matchs/snps to consensus*/
+         snpPerSupF = nonMaskBaseUI;
+         nonMaskBaseUI += pileSTPtr->numDelArySI[uiRef];
 
-            break;
-         /*Case: match or snp*/
 
-         /***********************************************\
-         * Fun12 Sec03 Sub03:
-         *   - check deletion cases
-         \***********************************************/
+         if(nonMaskBaseUI > 0)
+            snpPerSupF /= (float) nonMaskBaseUI;
+         else
+            snpPerSupF = 0;
 
-         case 'D':
-         /*Case: Deletion*/ 
-            endCigUI = uiRef + samSTPtr->cigArySI[uiCig];
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun13 Sec04 Sub02 Cat03:
+         +   - check if have ins (if so get extra bases)
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-            while(uiRef < endCigUI)
-            { /*Loop: add in deletions*/
-               ++(*conNtAryST)[uiRef].totalNtSI;
-               ++(*conNtAryST)[uiRef].ntKeptSI;
-               ++(*conNtAryST)[uiRef].numDelSI;
-               ++uiRef;
-            } /*Loop: add in deletions*/
+         if(insPerSupF >= settings->minPercInsF)
+         { /*If: I have an insertion*/
+            cigLenUI += (lastCigSC != 'I');
+            lastCigSC = 'I';
 
-            break;
-         /*Case: Deletion*/ 
+            bestInsST = bestIns_tbCon(pileSTPtr, uiEndRef);
 
-         /***********************************************\
-         * Fun12 Sec03 Sub04:
-         *   - check insertion cases
-         *   o fun12 sec02 sub04 cat01:
-         *     - set up and allocate memory for ins
-         *   o fun12 sec02 sub04 cat02:
-         *     - copy insertion bases with min q-score
-         *   o fun12 sec02 sub04 cat03:
-         *     - check if kept any insertion bases
-         *   o fun12 sec02 sub04 cat04:
-         *     - see if insertion sequence already added
-         *   o fun12 sec02 sub04 cat05:
-         *     - insertion is new; add to insertion list
-         \***********************************************/
+            /*How many bases the insertions could add*/
+            extraInsUI += bestInsST->lenInsSI;
+         } /*If: I have an insertion*/
 
          /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun12 Sec02 Sub04 Cat01:
-         +   - set up and allocate memory for ins
+         + Fun13 Sec04 Sub02 Cat04:
+         +   - check if an snp/match, del, or mask will
+         +     be choosen
          \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-         case 'I':
-         /*Case: Insertions*/
-            lenInsSI = samSTPtr->cigArySI[uiCig];
-
-            endCigUI =
-               uiBase + samSTPtr->cigArySI[uiCig];
-
-            insHeapStr =
-               malloc((lenInsSI + 1) * sizeof(char));
+         if(snpPerSupF >= settings->minPercSnpF)
+         { /*If: I am keeping an mathc/snp*/
+            cigLenUI += (lastCigSC != 'M');
+            lastCigSC = 'M';
+         } /*If: I am keeping an mathc/snp*/
 
-            if(! insHeapStr)
-               goto memErr_fun12_sec04_sub02;
+         else if(delPerSupF >= settings->minPercDelF)
+         { /*Else If: I am keeping an deletion*/
+            cigLenUI += (lastCigSC != 'D');
+            lastCigSC = 'D';
+         } /*Else If: I am keeping an deletion*/
 
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun12 Sec02 Sub04 Cat02:
-            +   - copy insertion bases with min q-score
-            \+++++++++++++++++++++++++++++++++++++++++++*/
+         /*For the cigar a mask is same as an snp/match*/
+         else
+         { /*Else: I am masking (snp/match case)*/
+            cigLenUI += (lastCigSC != 'M');
+            lastCigSC = 'M';
+         } /*Else: I am masking (snp/match case)*/
+      } /*Loop: Find the memory for the fragment*/
 
-            siIns = 0;
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub02 Cat05:
+      +   - find the fragement length/check if long enough
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-            /*Get the total Q-score for the insertion*/
-            while(uiBase < endCigUI)
-            { /*Loop: Copy the insertion*/
+      /*Find the length*/
+      lenFragUI = uiEndRef - uiRef;
+      ++lenFragUI; /*convert to index 1*/
 
-              if(
-                     samSTPtr->qStr[0] != '*'
-                  && samSTPtr->qStr[1] != '\0'
-              ){ /*If: have q-score entry*/
+      if(lenFragUI < (unsigned int) settings->minLenSI)
+      { /*If: This is beneath the min length to keep*/
+         uiRef = uiEndRef;
+         continue;
+      } /*If: This is beneath the min length to keep*/
 
-                 if(
-                      samSTPtr->qStr[uiBase]
-                         - def_adjQ_samEntry
-                    < settings->minInsQSI
-                 ){ /*If: This insertion is low quality*/
-                    ++uiBase;
-                    continue;
-                 } /*If: This insertion is low quality*/
-              } /*If: have q-score entry*/
-
-              insHeapStr[siIns] =
-                 samSTPtr->seqStr[uiBase];
-
-              ++uiBase;
-              ++siIns;
-            } /*Loop: Copy the insertion*/
- 
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun12 Sec02 Sub04 Cat03:
-            +   - check if kept any insertion bases
-            \+++++++++++++++++++++++++++++++++++++++++++*/
+      /**************************************************\
+      * Fun13 Sec04 Sub03:
+      *   - set up the sam entry
+      *   o fun13 sec04 sub03 cat01:
+      *     - make the query id
+      *   o fun13 sec04 sub03 cat02:
+      *     - make the reference id
+      *   o fun13 sec04 sub03 cat03:
+      *     - set up the RNEXT entry
+      *   o fun13 sec04 sub03 cat04:
+      *     - set up reference positions/alinged length
+      *   o fun13 sec04 sub03 cat05:
+      *     - allocate memory for the sequence
+      *   o fun13 sec04 sub03 cat06:
+      *     - set up the Q-score entry
+      *   o fun13 sec04 sub03 cat07:
+      *     - allocate memory for the cigar types buffer
+      \**************************************************/
 
-            if(siIns == 0)
-            { /*If: I discarded the insertion*/
-               free(insHeapStr);
-               insHeapStr = 0;
-               break;
-            } /*If: I discarded the insertion*/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat01:
+      +   - make the query id
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun12 Sec02 Sub04 Cat04:
-            +   - see if insertion sequence already added
-            \+++++++++++++++++++++++++++++++++++++++++++*/
+      retSamST[siFrag].qryIdLenUC =
+         cpStr_ulCp(
+             retSamST[siFrag].qryIdStr,
+             refIdStr
+         );
 
-            lenInsSI = siIns;
-            insHeapStr[lenInsSI] = '\0';
+      retSamST[siFrag].qryIdStr[
+         retSamST[siFrag].qryIdLenUC
+      ] = '_';
 
-            insST = (*conNtAryST)[uiRef].insList;
-            lastInsST = insST;
+      ++retSamST[siFrag].qryIdLenUC;
 
-            while(insST)
-            { /*Loop: check if already have insertion*/
-               if(lenInsSI != insST->lenInsSI)
-               { /*If: lengths are differnt (not match)*/
-                  lastInsST = insST;
-                  insST = insST->nextIns;
-                  continue;
-               } /*If: lengths are differnt (not match)*/
- 
-               /*Check if I have an match*/
-               for(
-                  siIns = 0;
-                  insHeapStr[siIns]
-                    == insST->insStr[siIns];
-                  ++siIns
-               ) if(insHeapStr[siIns] =='\0') break;
+      retSamST[siFrag].qryIdLenUC +=
+         numToStr(
+            &retSamST[siFrag].qryIdStr[
+               retSamST[siFrag].qryIdLenUC
+            ],
+         uiRef
+      );
 
-               if(
-                  insHeapStr[siIns] ==insST->insStr[siIns]
-               ){ /*If: I found a match*/
-                  free(insHeapStr);
-                  insHeapStr = 0;
-                  ++insST->numHitsSI;
-                  break;
-               } /*If: I found a match*/
-
-               lastInsST = insST;
-               insST = insST->nextIns;
-            } /*Loop: check if already have insertion*/
- 
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun12 Sec02 Sub04 Cat05:
-            +   - insertion is new; add to insertion list
-            \+++++++++++++++++++++++++++++++++++++++++++*/
+      retSamST[siFrag].qryIdStr[
+         retSamST[siFrag].qryIdLenUC
+      ] = '-';
 
-            if(! insST)
-            { /*If: I did not find a match*/
+      ++retSamST[siFrag].qryIdLenUC;
 
-               if(lastInsST)
-               { /*If: there are previous insertions*/
-                  lastInsST->nextIns = mkIns_tbCon();
+      retSamST[siFrag].qryIdLenUC +=
+         (unsigned char)
+         numToStr(
+            &retSamST[siFrag].qryIdStr[
+               retSamST[siFrag].qryIdLenUC
+            ],
+            uiEndRef
+         ); /*Copy the ending position*/
 
-                  if(! lastInsST->nextIns)
-                     goto memErr_fun12_sec04_sub02;
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat02:
+      +   - make the reference id
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-                  lastInsST = lastInsST->nextIns;
-               } /*If: there are previous insertions*/
+      /*Copy the reference id*/
+      retSamST[siFrag].refIdLenUC =
+         cpDelim_ulCp(
+            retSamST[siFrag].refIdStr,
+            refIdStr,
+            0,    /*'\0' = 0*/
+            '\0'
+         ); /*Copy the reference name*/
 
-               else
-               { /*Else: is first insertion*/
-                  (*conNtAryST)[uiRef].insList =
-                     mkIns_tbCon();
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat03:
+      +   - set up the RNEXT entry
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-                  if(! (*conNtAryST)[uiRef].insList)
-                     goto memErr_fun12_sec04_sub02;
+      retSamST[siFrag].rNextStr[0] = '*';
+      retSamST[siFrag].rNextStr[1] = '\0';
+      retSamST[siFrag].rnextLenUC = 1;
 
-                  lastInsST= (*conNtAryST)[uiRef].insList;
-               } /*Else: is first insertion*/
- 
-               lastInsST->insStr = insHeapStr;
-               lastInsST->lenInsSI = lenInsSI;
-               lastInsST->numHitsSI = 1;
+      /*The flag is already set up*/
+      /*Not sure what to put for mapping quality, so using
+      ` 0 (default)
+      */
 
-               insHeapStr = 0;
-               lenInsSI = 0;
-            } /*If: I did not find a match*/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat04:
+      +   - set up the reference positions/alinged length
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-            break;
-         /*Case: Insertions*/
+      /*Get the reference lengths*/
+      retSamST[siFrag].refStartUI = uiRef;
+      retSamST[siFrag].alnReadLenUI = lenFragUI;
+      retSamST[siFrag].refEndUI = uiEndRef;
 
-         /***********************************************\
-         * Fun12 Sec03 Sub05:
-         *   - Handle softmasking
-         \***********************************************/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat05:
+      +   - allocate memory for the sequence
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-         case 'S':
-         /*Case: soft masking*/
-            endCigUI = uiBase + samSTPtr->cigArySI[uiCig];
+      lenFragUI += extraInsUI;
 
-            while(uiBase < endCigUI)
-               ++uiBase;
+      /*Make the sequence buffer*/
+      if(retSamST[siFrag].seqSizeUI < lenFragUI + 1)
+      { /*If: I need to expand memory*/
+         free(retSamST[siFrag].seqStr);
 
-            break;
-         /*Case: soft masking*/
+         retSamST[siFrag].seqStr =
+            malloc(
+               (lenFragUI + 9) * (sizeof(signed char))
+            );
 
-         /*Other cases invovle hard masking*/
-      } /*Switch: Check the cigar entry type*/
-   } /*Loop: Add bases to the consensus*/
+         if(! retSamST[siFrag].seqStr)
+            goto memErr_fun13_sec06_sub02;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun12 Sec04:
-   ^   - clean up and return
-   ^   o fun12 sec04 sub01:
-   ^     - no error clean up
-   ^   o fun12 sec04 sub02:
-   ^     - memory error clean up
-   ^   o fun12 sec04 sub03:
-   ^     - header error clean up
-   ^   o fun12 sec04 sub04:
-   ^     - no map error clean up
-   ^   o fun12 sec04 sub05:
-   ^     - no sequence error clean up
-   ^   o fun12 sec04 sub06:
-   ^     - low mapq error clean up
-   ^   o fun12 sec04 sub07:
-   ^     - general clean up (both no error or error)
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+         retSamST[siFrag].seqSizeUI = lenFragUI;
+      } /*If: I need to expand memory*/
 
-   /*****************************************************\
-   * fun12 sec04 sub01:
-   *   - no error clean up
-   \*****************************************************/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat06:
+      +   - set up the Q-score entry
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-   errSC = 0;
-   goto cleanUp_fun12_sec04_sub07;
+      /*initSamEntry allocates over 2 bytes, so I am
+      ` safe here
+      */
+      retSamST[siFrag].qStr[0] = '*';
+      retSamST[siFrag].qStr[1] = '\0';
+      retSamST[siFrag].qSizeUI = 2;
 
-   /*****************************************************\
-   * fun12 sec04 sub02:
-   *   - memory error clean up
-   \*****************************************************/
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun13 Sec04 Sub03 Cat07:
+      +   - allocate memory for the cigar types buffer
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-   memErr_fun12_sec04_sub02:;
-   errSC = def_memErr_tbConDefs;
-   goto cleanUp_fun12_sec04_sub07;
+      if(retSamST[siFrag].cigSizeUI < cigLenUI + 1)
+      { /*If: I need to allocate memory for cigar buff*/
+          if(retSamST->cigTypeStr)
+             free(retSamST->cigTypeStr);
+          retSamST->cigTypeStr = 0;
 
-   /*****************************************************\
-   * fun12 sec04 sub03:
-   *   - header error clean up
-   \*****************************************************/
+          /*Make the cigar types buffer*/
+          retSamST[siFrag].cigTypeStr =
+             malloc(
+                (cigLenUI + 9) * sizeof(signed char)
+             );
 
-   headerErr_fun12_sec04_sub03:;
-   errSC = def_header_tbConDefs;
-   goto cleanUp_fun12_sec04_sub07;
+          if(!retSamST[siFrag].cigTypeStr)
+             goto memErr_fun13_sec06_sub02;
 
-   /*****************************************************\
-   * fun12 sec04 sub04:
-   *   - no map error clean up
-   \*****************************************************/
+          retSamST[siFrag].cigSizeUI = cigLenUI;
 
-   noMapErr_fun12_sec04_sub04:;
-   errSC = def_noMap_tbConDefs;
-   goto cleanUp_fun12_sec04_sub07;
 
-   /*****************************************************\
-   * fun12 sec04 sub05:
-   *   - no sequence error clean up
-   \*****************************************************/
+          if(retSamST->cigArySI)
+             free(retSamST->cigArySI);
+          retSamST->cigArySI = 0;
 
-   noSeqErr_fun12_sec04_sub05:;
-   errSC = def_noSeq_tbConDefs;
-   goto cleanUp_fun12_sec04_sub07;
+          retSamST[siFrag].cigArySI =
+             malloc((cigLenUI + 9) * sizeof(signed int));
 
-   /*****************************************************\
-   * fun12 sec04 sub06:
-   *   - low mapq error clean up
-   \*****************************************************/
+          if(!retSamST[siFrag].cigArySI)
+             goto memErr_fun13_sec06_sub02;
+      } /*If: I need to allocate memory for cigar buff*/
+      
+      /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+      ^ Fun13 Sec05:
+      ^   - Collapse the consensus fragment
+      ^   o fun13 sec05 sub01:
+      ^     - get the amount of support for each position
+      ^   o fun13 sec05 sub02:
+      ^     - check if I have an insertion. 
+      ^     - insertion is always one base behind
+      ^   o fun13 sec05 sub03:
+      ^     - check if I have support for an snp/match
+      ^   o fun13 sec05 sub04:
+      ^     - check if this was a deletion instead of snp
+      ^   o fun13 sec05 sub05:
+      ^     - handle not enough support cases; likely
+      ^       mixed infections
+      ^   o fun13 sec05 sub06:
+      ^     - check if I need to resize sequence buffer
+      ^   o fun13 sec05 sub07:
+      ^     - check if I need to resize the cigar buffer
+      \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   lowMapErr_fun12_sec04_sub06:;
-   errSC = def_lowMapq_tbConDefs;
-   goto cleanUp_fun12_sec04_sub07;
+      /**************************************************\
+      * Fun13 Sec05 Sub01:
+      *   - get the amount of support for each position
+      \**************************************************/
 
-   /*****************************************************\
-   * fun12 sec04 sub07:
-   *   - general clean up (both no error or error)
-   \*****************************************************/
+      uiBase = 0;
+      uiCig = 0;
 
-   cleanUp_fun12_sec04_sub07:;
+      retSamST[siFrag].cigTypeStr[uiCig] = '\0';
 
-   if(insHeapStr)
-      free(insHeapStr);
+      while(uiRef < uiEndRef)
+      { /*Loop: Collapse the fragment*/
 
-   insHeapStr = 0;
+         /*The insertion is inbetween bases, which makes
+         ` it hard to gauge. So, I am taking the worst
+         ` case. Here I want all positoins
+         */
+         keptReadsSI =
+           max_genMath(
+             pileSTPtr->ntKeptArySI[uiRef],
+             pileSTPtr->ntKeptArySI[uiRef -(uiRef > 0)]
+           );
+            /*uiRef - (uiRef > 0) turns into
+            `  uiRef - 1, when uiRef is > 0; else is
+            `  uiRef
+            */
 
-   return errSC;
-}/*addRead_tbCon*/
+         if(keptReadsSI > 0)
+            insPerSupF =
+                 (float) pileSTPtr->numInsArySI[uiRef]
+               / (float) keptReadsSI;
+         else
+            insPerSupF = 0;
 
-/*-------------------------------------------------------\
-| Fun13: collapse_tbCon
-|   - collapses a conNt_tbCon strrucvt array into an array
-|     of samEntry structs
-| Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon struct array to collapse
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
-|   - lenSamArySI:
-|     o pointer to integer to have number of samEntry
-|       structures made
-|   - refIdStr:
-|     o c-string with referernce sequence name
-|   - settings:
-|     o pointer to set_tbCon struct with consensus
-|       building settings
-|   - errSC:
-|     o pointer to character to hold error type
-| Output:
-|   - Modifies:
-|     o lenSamST to hold the returned samEntry arrray
-|       length
-|     o errSC:
-|       - 0 for no errors
-|       - def_noSeq_tbConDefs if could not build consensus
-|       - def_memErr_tbConDefs if had memory error
-|   - Returns:
-|     o array of sam entry structures with consensus 
-|       fragments.
-|       - idealy this would be one structure, but for
-|         amplicons it will be an array
-|     o 0 for memory erors
-\-------------------------------------------------------*/
-struct samEntry *
-collapse_tbCon(
-   struct conNt_tbCon conNtAryST[], /*to collapse*/
-   unsigned int lenConAryUI,   /*length of consensus*/
-   signed int *lenSamArySI,    /*set to out array length*/
-   signed char *refIdStr,      /*name of reference seq*/
-   struct set_tbCon *settings, /*settings for collapsing*/
-   signed char *errSC          /*error reports*/
-){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun13 TOC: collapse_tbCon
-   '   - collapses a conNt_tbCon strrucvt array into an
-   '     array of samEntry structs
-   '   o fun13 sec01:
-   '     - variable declerations
-   '   o fun13 sec02:
-   '     - count the number of fragments I have
-   '   o fun13 sec03:
-   '     - allocate memory for each fragment
-   '   o fun13 sec04:
-   '     - collapse each fragment into a samEntry struct
-   '   o fun13 sec05:
-   '     - collapse the consensus fragment
-   '   o fun13 sec06:
-   '     - clean up and return
-   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+         /*For deletions an masked base is equivlent to no
+         `   support
+         */
+         if(pileSTPtr->numDelArySI[uiRef] > 0)
+            delPerSupF =
+                 (float) pileSTPtr->numDelArySI[uiRef]
+               / (float) pileSTPtr->ntKeptArySI[uiRef];
+         else
+            delPerSupF = 0;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun13 Sec01:
-   ^   - variable declerations
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+         /*Find the number of non-anonymous bases
+         `   For tbCon all anonymous bases are N's (masked)
+         */
+         nonMaskBaseUI = pileSTPtr->numAArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numTArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numGArySI[uiRef];
+         nonMaskBaseUI += pileSTPtr->numCArySI[uiRef];
 
-   signed int siFrag = 0;
-   unsigned int uiRef = 0;   /*ref base on*/
-   unsigned int uiEndRef = 0;/*last base amplicon/fragment*/
-   unsigned int lenFragUI = 0;/*length fragment/amplicon*/
-   unsigned int uiBase = 0; /*fragment position; base on*/
+         snpPerSupF = nonMaskBaseUI;
+         nonMaskBaseUI += pileSTPtr->numDelArySI[uiRef];
 
-   unsigned int uiCig = 0;     /*cigar entry on*/
-   unsigned int cigLenUI = 0;
-   signed char lastCigSC = '0';
-   unsigned int extraInsUI = 0;
-      /*max extra bases from ins's*/
 
-   /*General support*/
-   float snpPerSupF = 0;
-   float insPerSupF = 0;
-   float delPerSupF = 0;
+         if(nonMaskBaseUI > 0)
+            snpPerSupF /= (float) nonMaskBaseUI;
+         else
+            snpPerSupF = 0;
 
-   /*Support for a particler snp/match*/
-   unsigned int nonMaskBaseUI = 0;
-      /*number of non-anonymous bases*/
-   float aPercSupF = 0;
-   float tPercSupF = 0;
-   float cPercSupF = 0;
-   float gPercSupF = 0;
+         /***********************************************\
+         * Fun13 Sec05 Sub02:
+         *   - check if I have an insertion.
+         *   - insertion is always one base behind
+         *   o fun13 sec05 sub02 cat01:
+         *     - check if need new cigar entry + find
+         *       insertion with the most support
+         *   o fun13 sec05 sub02 cat01:
+         *     - check if keeping inse / copy insertion
+         \***********************************************/
 
-   /*Find the most supported insertion*/
-   signed int keptReadsSI = 0;
-   struct ins_tbCon *curInsST = 0;
-   struct ins_tbCon *bestInsST = 0;
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun13 Sec05 Sub02 Cat01:
+         +   - check if need new cigar entry + find
+         +     insertion with the most support
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-   struct samEntry *retSamST = 0;
+         if(insPerSupF >= settings->minPercInsF)
+         { /*If: An insertions is supported here*/
+            if(retSamST[siFrag].cigTypeStr[uiCig] != 'I')
+            { /*If: This is a new cigar entry*/
+               ++uiCig;
+               retSamST[siFrag].cigTypeStr[uiCig] = 'I';
+               retSamST[siFrag].cigArySI[uiCig] = 0;
+            } /*If: This is a new cigar entry*/
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun13 Sec02:
-   ^   - count number of fragments I have
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+            bestInsST = bestIns_tbCon(pileSTPtr, uiRef);
 
-   *lenSamArySI = 0;
-   *errSC = 0;
-   uiRef = 0;
 
-   while(uiRef < lenConAryUI)
-   { /*Loop: Find the number of fragments*/
+            /*+++++++++++++++++++++++++++++++++++++++++++\
+            + Fun13 Sec05 Sub02 Cat02:
+            +   - check if keeping ins / copy insertion
+            \+++++++++++++++++++++++++++++++++++++++++++*/
 
-      /*Find the starting position for this fragment*/
-      while(
-           conNtAryST[uiRef].ntKeptSI
-         < settings->minDepthSI
-      ){ /*Loop: Find the first base with enough depth*/
-         ++uiRef;
+            insPerSupF =
+                 (float) bestInsST->numHitsSI
+               / (float) keptReadsSI;
 
-         if(uiRef >= lenConAryUI)
-            goto collapse_fun13_sec03;
-      } /*Loop: Find the first base with enough depth*/
+            if(insPerSupF >= settings->minPercInsF)
+            { /*If: keeping insertion*/
+               cpLen_ulCp(
+                  &retSamST[siFrag].seqStr[uiBase],
+                  insStr_pile_tbCon(
+                     pileSTPtr,
+                     uiRef,
+                     bestInsST
+                  ),
+                  bestInsST->lenInsSI
+               );
 
-      /*Find the length of this fragment*/
+               uiBase += bestInsST->lenInsSI;
 
-      for(
-         uiEndRef = uiRef;
-         uiEndRef < lenConAryUI;
-         ++uiEndRef
-      ){ /*Loop: Find the memory for the fragment*/
-         if(
-               conNtAryST[uiEndRef].ntKeptSI
-            < settings->minDepthSI
-         ) break;
-      } /*Loop: Find the memory for the fragment*/
+               retSamST[siFrag].cigArySI[uiCig] +=
+                  bestInsST->lenInsSI;
 
-      /*Find the length*/
-      lenFragUI = uiRef - uiEndRef;
+               retSamST[siFrag].insCntUI +=
+                  bestInsST->lenInsSI;
+            } /*If: keeping insertion*/
+         } /*If: an Insertion is supported here*/
 
-      if(lenFragUI < (unsigned int) settings->minLenSI)
-      { /*If: This is beneath the min length to keep*/
-         uiRef = uiEndRef;
-         continue;
-      } /*If: This is beneath the min length to keep*/
+         /***********************************************\
+         * Fun13 Sec05 Sub03:
+         *   - check if I have support for an snp/match
+         *   o fun13 sec05 sub03 cat01:
+         *     - check if need new cigar entry + find
+         *       support for each base type
+         *   o fun13 sec05 sub03 cat01:
+         *     - find the base with the most support and
+         *       see if it had enough support to keep
+         \***********************************************/
 
-      ++(*lenSamArySI);
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun13 Sec05 Sub03 Cat01:
+         +   - check if need new cigar entry + find
+         +     support for each base type
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-      uiRef = uiEndRef;
-   } /*Loop: Find the number of fragments*/
+         if(
+              nonMaskBaseUI
+            < (unsigned int) settings->minDepthSI
+         ) goto maskPos_fun13_sec05_sub05;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun13 Sec03:
-   ^   - allocate memory for each fragment
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+         else if(snpPerSupF >= settings->minPercSnpF)
+         { /*If: snps were the best choice*/
 
-   collapse_fun13_sec03:;
+            if(retSamST[siFrag].cigTypeStr[uiCig] != 'M')
+            { /*If: This is a new cigar entry*/
+               uiCig +=
+                  (
+                       retSamST[siFrag].cigTypeStr[uiCig]
+                    != '\0'
+                  );
 
-   if(*lenSamArySI == 0)
-      goto noConErr_fun13_sec06_sub03;
-      /*could not build the consensus*/
+               retSamST[siFrag].cigTypeStr[uiCig] = 'M';
+               retSamST[siFrag].cigArySI[uiCig] = 0;
+            } /*If: This is a new cigar entry*/
 
-   retSamST =
-      malloc(*lenSamArySI * sizeof(struct samEntry));
+             aPercSupF =
+                (float) pileSTPtr->numAArySI[uiRef];
+             aPercSupF /= (float) nonMaskBaseUI;
 
-   if(!retSamST)
-   { /*If: failed to allocate memory*/
-      *lenSamArySI = 0;
-      goto memErr_fun13_sec06_sub02;
-   } /*If: failed to allocate memory*/
+             tPercSupF =
+                (float) pileSTPtr->numTArySI[uiRef];
+             tPercSupF /= (float) nonMaskBaseUI;
 
-   /*Initialize the structures*/
-   for(
-      siFrag = 0;
-      siFrag < *lenSamArySI;
-      ++siFrag
-   ) init_samEntry(&retSamST[siFrag]);
+             gPercSupF =
+                (float) pileSTPtr->numGArySI[uiRef];
+             gPercSupF /= (float) nonMaskBaseUI;
 
-   /*set up memory*/
-   for(
-      siFrag = 0;
-      siFrag < *lenSamArySI;
-      ++siFrag
-   ){ /*Loop: set up (allocate memory) to samEntry*/
-      if(setup_samEntry(&retSamST[siFrag]))
-         goto memErr_fun13_sec06_sub02;
-   } /*Loop: set up (allocate memory) to samEntry*/
+             cPercSupF =
+                (float) pileSTPtr->numCArySI[uiRef];
+             cPercSupF /= (float) nonMaskBaseUI;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun13 Sec04:
-   ^   - collapse each fragment into a samEntry struct
-   ^   o fun13 sec01 sub01:
-   ^     - get length & check if fragment meets min length
-   ^   o fun13 sec01 sub02:
-   ^     - find the length and memory I need to allocate
-   ^   o fun13 sec01 sub03:
-   ^     - set up the sam entry
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+            /*+++++++++++++++++++++++++++++++++++++++++++\
+            + Fun13 Sec05 Sub03 Cat02:
+            +   - find the base with the most support and
+            +     see if it had enough support to keep
+            \+++++++++++++++++++++++++++++++++++++++++++*/
 
-   /*****************************************************\
-   * Fun13 Sec01 Sub01:
-   *   - get length & check if fragment meets min length
-   \*****************************************************/
+            if(   aPercSupF > tPercSupF
+               && aPercSupF > cPercSupF
+               && aPercSupF > gPercSupF
+            ) { /*If: A has the most support*/
 
-   uiRef = 0;
-   siFrag = 0;
+               if(aPercSupF >= settings->minPercSnpF)
+               { /*If: this was an A*/
+                  retSamST[siFrag].seqStr[uiBase] = 'A';
+                  ++retSamST[siFrag].matchCntUI;
+               } /*If: this was an A*/
 
-   while(uiRef < lenConAryUI)
-   { /*Loop: Find the number of fragments*/
+               else
+               { /*Else: not enough support to call*/
+                  retSamST[siFrag].seqStr[uiBase] =
+                     settings->maskSC;
 
-      /*Find the starting position for this fragment*/
-      while(
-           conNtAryST[uiRef].ntKeptSI
-         < settings->minDepthSI
-      ){ /*Loop: Find the first base with enough depth*/
-         ++uiRef;
+                  ++retSamST[siFrag].maskCntUI;
+               } /*Else: not enough support to call*/
+            } /*If: A has the most support*/
 
-         if(uiRef >= lenConAryUI)
-            goto noErr_fun13_sec06_sub01;
-            /*at end of consensusq*/
-      } /*Loop: Find the first base with enough depth*/
-
-      /**************************************************\
-      * Fun13 Sec01 Sub02:
-      *   - find the length and memory I need to allocate
-      *   o fun13 sec04 sub02 cat01:
-      *     - find the length/start memory count loop
-      *   o fun13 sec04 sub02 cat02:
-      *     - find the percent support for each option
-      *   o fun13 sec04 sub02 cat03:
-      *     - check if have ins (if so get extra bases)
-      *   o fun13 sec04 sub02 cat04:
-      *     - check if an snp/match, del, or mask will
-      *       be choosen
-      *   o fun13 sec04 sub02 cat05:
-      *     - find fragement length/check if long enough
-      \**************************************************/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub02 Cat01:
-      +   - find the length/start memory count loop
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      extraInsUI = 0;
-
-      for(
-         uiEndRef = uiRef;
-         uiEndRef < lenConAryUI;
-         ++uiEndRef
-      ){ /*Loop: Find the memory for the fragment*/
-         if(
-               conNtAryST[uiEndRef].ntKeptSI
-            < settings->minDepthSI
-         ) break;
-
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun13 Sec04 Sub02 Cat02:
-         +   - find the percent support for each option
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
-
-         /*The insertion is inbetween bases, which makes
-         ` it hard to gauge. So, I am taking the worst
-         ` case
-         */
-         keptReadsSI =
-           max_genMath(
-             conNtAryST[uiEndRef].ntKeptSI,
-             conNtAryST[
-                uiEndRef - (uiEndRef > 0)
-             ].ntKeptSI
-           );
-            /*uiEndRef - (uiEndRef > 0) turns into
-            `  uiEndRef - 1, when uiEndRef is > 0; else is
-            `  uiEndRef
-            */
-
-         if(keptReadsSI > 0)
-            insPerSupF =
-                 (float) conNtAryST[uiEndRef].numInsSI
-               / (float) keptReadsSI;
-         else
-            insPerSupF = 0;
-
-         if(conNtAryST[uiEndRef].ntKeptSI > 0)
-            delPerSupF =
-                 (float) conNtAryST[uiEndRef].numDelSI
-               / (float) conNtAryST[uiEndRef].ntKeptSI;
-         else
-            delPerSupF = 0;
-
-         nonMaskBaseUI = conNtAryST[uiRef].numASI;
-         nonMaskBaseUI += conNtAryST[uiRef].numTSI;
-         nonMaskBaseUI += conNtAryST[uiRef].numGSI;
-         nonMaskBaseUI += conNtAryST[uiRef].numCSI;
-
-         snpPerSupF = nonMaskBaseUI;
-         nonMaskBaseUI += conNtAryST[uiRef].numDelSI;
-
-
-         if(nonMaskBaseUI > 0)
-            snpPerSupF /= (float) nonMaskBaseUI;
-         else
-            snpPerSupF = 0;
-
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun13 Sec04 Sub02 Cat03:
-         +   - check if have ins (if so get extra bases)
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
-
-         if(insPerSupF >= settings->minPercInsF)
-         { /*If: I have an insertion*/
-            cigLenUI += (lastCigSC != 'I');
-            lastCigSC = 'I';
-
-            bestInsST = conNtAryST[uiEndRef].insList;
-            curInsST = bestInsST;
-
-            while(curInsST)
-            { /*Loop: Find the most supported insertion*/
-              if(
-                   bestInsST->numHitsSI
-                 < curInsST->numHitsSI
-              ) bestInsST = curInsST;
-
-              curInsST = curInsST->nextIns;
-            } /*Loop: Find the most supported insertion*/
-
-            /*How many bases the insertions could add*/
-            extraInsUI += bestInsST->lenInsSI;
-         } /*If: I have an insertion*/
-
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun13 Sec04 Sub02 Cat04:
-         +   - check if an snp/match, del, or mask will
-         +     be choosen
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
-
-         if(snpPerSupF >= settings->minPercSnpF)
-         { /*If: I am keeping an mathc/snp*/
-            cigLenUI += (lastCigSC != 'M');
-            lastCigSC = 'M';
-         } /*If: I am keeping an mathc/snp*/
-
-         else if(delPerSupF >= settings->minPercDelF)
-         { /*Else If: I am keeping an deletion*/
-            cigLenUI += (lastCigSC != 'D');
-            lastCigSC = 'D';
-         } /*Else If: I am keeping an deletion*/
-
-         /*For the cigar a mask is same as an snp/match*/
-         else
-         { /*Else: I am masking (snp/match case)*/
-            cigLenUI += (lastCigSC != 'M');
-            lastCigSC = 'M';
-         } /*Else: I am masking (snp/match case)*/
-      } /*Loop: Find the memory for the fragment*/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub02 Cat05:
-      +   - find the fragement length/check if long enough
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      /*Find the length*/
-      lenFragUI = uiEndRef - uiRef;
-      ++lenFragUI; /*convert to index 1*/
-
-      if(lenFragUI < (unsigned int) settings->minLenSI)
-      { /*If: This is beneath the min length to keep*/
-         uiRef = uiEndRef;
-         continue;
-      } /*If: This is beneath the min length to keep*/
-
-      /**************************************************\
-      * Fun13 Sec04 Sub03:
-      *   - set up the sam entry
-      *   o fun13 sec04 sub03 cat01:
-      *     - make the query id
-      *   o fun13 sec04 sub03 cat02:
-      *     - make the reference id
-      *   o fun13 sec04 sub03 cat03:
-      *     - set up the RNEXT entry
-      *   o fun13 sec04 sub03 cat04:
-      *     - set up reference positions/alinged length
-      *   o fun13 sec04 sub03 cat05:
-      *     - allocate memory for the sequence
-      *   o fun13 sec04 sub03 cat06:
-      *     - set up the Q-score entry
-      *   o fun13 sec04 sub03 cat07:
-      *     - allocate memory for the cigar types buffer
-      \**************************************************/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat01:
-      +   - make the query id
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      retSamST[siFrag].qryIdLenUC =
-         cpStr_ulCp(
-             retSamST[siFrag].qryIdStr,
-             refIdStr
-         );
-
-      retSamST[siFrag].qryIdStr[
-         retSamST[siFrag].qryIdLenUC
-      ] = '_';
-
-      ++retSamST[siFrag].qryIdLenUC;
-
-      retSamST[siFrag].qryIdLenUC +=
-         numToStr(
-            &retSamST[siFrag].qryIdStr[
-               retSamST[siFrag].qryIdLenUC
-            ],
-         uiRef
-      );
-
-      retSamST[siFrag].qryIdStr[
-         retSamST[siFrag].qryIdLenUC
-      ] = '-';
-
-      ++retSamST[siFrag].qryIdLenUC;
-
-      retSamST[siFrag].qryIdLenUC +=
-         (unsigned char)
-         numToStr(
-            &retSamST[siFrag].qryIdStr[
-               retSamST[siFrag].qryIdLenUC
-            ],
-            uiEndRef
-         ); /*Copy the ending position*/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat02:
-      +   - make the reference id
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      /*Copy the reference id*/
-      retSamST[siFrag].refIdLenUC =
-         cpDelim_ulCp(
-            retSamST[siFrag].refIdStr,
-            refIdStr,
-            0,    /*'\0' = 0*/
-            '\0'
-         ); /*Copy the reference name*/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat03:
-      +   - set up the RNEXT entry
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      retSamST[siFrag].rNextStr[0] = '*';
-      retSamST[siFrag].rNextStr[1] = '\0';
-      retSamST[siFrag].rnextLenUC = 1;
-
-      /*The flag is already set up*/
-      /*Not sure what to put for mapping quality, so using
-      ` 0 (default)
-      */
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat04:
-      +   - set up the reference positions/alinged length
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      /*Get the reference lengths*/
-      retSamST[siFrag].refStartUI = uiRef;
-      retSamST[siFrag].alnReadLenUI = lenFragUI;
-      retSamST[siFrag].refEndUI = uiEndRef;
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat05:
-      +   - allocate memory for the sequence
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      lenFragUI += extraInsUI;
-
-      /*Make the sequence buffer*/
-      if(retSamST[siFrag].seqSizeUI < lenFragUI + 1)
-      { /*If: I need to expand memory*/
-         free(retSamST[siFrag].seqStr);
-
-         retSamST[siFrag].seqStr =
-            malloc(
-               (lenFragUI + 9) * (sizeof(signed char))
-            );
-
-         if(! retSamST[siFrag].seqStr)
-            goto memErr_fun13_sec06_sub02;
-
-         retSamST[siFrag].seqSizeUI = lenFragUI;
-      } /*If: I need to expand memory*/
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat06:
-      +   - set up the Q-score entry
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      /*initSamEntry allocates over 2 bytes, so I am
-      ` safe here
-      */
-      retSamST[siFrag].qStr[0] = '*';
-      retSamST[siFrag].qStr[1] = '\0';
-      retSamST[siFrag].qSizeUI = 2;
-
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun13 Sec04 Sub03 Cat07:
-      +   - allocate memory for the cigar types buffer
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
-
-      if(retSamST[siFrag].cigSizeUI < cigLenUI + 1)
-      { /*If: I need to allocate memory for cigar buff*/
-          if(retSamST->cigTypeStr)
-             free(retSamST->cigTypeStr);
-          retSamST->cigTypeStr = 0;
-
-          /*Make the cigar types buffer*/
-          retSamST[siFrag].cigTypeStr =
-             malloc(
-                (cigLenUI + 9) * sizeof(signed char)
-             );
-
-          if(!retSamST[siFrag].cigTypeStr)
-             goto memErr_fun13_sec06_sub02;
-
-          retSamST[siFrag].cigSizeUI = cigLenUI;
-
-
-          if(retSamST->cigArySI)
-             free(retSamST->cigArySI);
-          retSamST->cigArySI = 0;
-
-          retSamST[siFrag].cigArySI =
-             malloc((cigLenUI + 9) * sizeof(signed int));
-
-          if(!retSamST[siFrag].cigArySI)
-             goto memErr_fun13_sec06_sub02;
-      } /*If: I need to allocate memory for cigar buff*/
-      
-      /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-      ^ Fun13 Sec05:
-      ^   - Collapse the consensus fragment
-      ^   o fun13 sec05 sub01:
-      ^     - get the amount of support for each position
-      ^   o fun13 sec05 sub02:
-      ^     - check if I have an insertion. 
-      ^     - insertion is always one base behind
-      ^   o fun13 sec05 sub03:
-      ^     - check if I have support for an snp/match
-      ^   o fun13 sec05 sub04:
-      ^     - check if this was a deletion instead of snp
-      ^   o fun13 sec05 sub05:
-      ^     - handle not enough support cases; likely
-      ^       mixed infections
-      ^   o fun13 sec05 sub06:
-      ^     - check if I need to resize sequence buffer
-      ^   o fun13 sec05 sub07:
-      ^     - check if I need to resize the cigar buffer
-      \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-      /**************************************************\
-      * Fun13 Sec05 Sub01:
-      *   - get the amount of support for each position
-      \**************************************************/
-
-      uiBase = 0;
-      uiCig = 0;
-
-      retSamST[siFrag].cigTypeStr[uiCig] = '\0';
-
-      while(uiRef < uiEndRef)
-      { /*Loop: Collapse the fragment*/
-
-         /*The insertion is inbetween bases, which makes
-         ` it hard to gauge. So, I am taking the worst
-         ` case. Here I want all positoins
-         */
-         keptReadsSI =
-           max_genMath(
-             conNtAryST[uiRef].ntKeptSI,
-             conNtAryST[uiRef -(uiRef > 0)].ntKeptSI
-           );
-            /*uiRef - (uiRef > 0) turns into
-            `  uiRef - 1, when uiRef is > 0; else is
-            `  uiRef
-            */
-
-         if(keptReadsSI > 0)
-            insPerSupF =
-                 (float) conNtAryST[uiRef].numInsSI
-               / (float) keptReadsSI;
-         else
-            insPerSupF = 0;
-
-         /*For deletions an masked base is equivlent to no
-         `   support
-         */
-         if(conNtAryST[uiRef].numDelSI > 0)
-            delPerSupF =
-                 (float) conNtAryST[uiRef].numDelSI
-               / (float) conNtAryST[uiRef].ntKeptSI;
-         else
-            delPerSupF = 0;
-
-         /*Find the number of non-anonymous bases
-         `   For tbCon all anonymous bases are N's (masked)
-         */
-         nonMaskBaseUI = conNtAryST[uiRef].numASI;
-         nonMaskBaseUI += conNtAryST[uiRef].numTSI;
-         nonMaskBaseUI += conNtAryST[uiRef].numGSI;
-         nonMaskBaseUI += conNtAryST[uiRef].numCSI;
-
-         snpPerSupF = nonMaskBaseUI;
-         nonMaskBaseUI += conNtAryST[uiRef].numDelSI;
-
-
-         if(nonMaskBaseUI > 0)
-            snpPerSupF /= (float) nonMaskBaseUI;
-         else
-            snpPerSupF = 0;
-
-         /***********************************************\
-         * Fun13 Sec05 Sub02:
-         *   - check if I have an insertion.
-         *   - insertion is always one base behind
-         *   o fun13 sec05 sub02 cat01:
-         *     - check if need new cigar entry + find
-         *       insertion with the most support
-         *   o fun13 sec05 sub02 cat01:
-         *     - check if keeping inse / copy insertion
-         \***********************************************/
-
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun13 Sec05 Sub02 Cat01:
-         +   - check if need new cigar entry + find
-         +     insertion with the most support
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
-
-         if(insPerSupF >= settings->minPercInsF)
-         { /*If: An insertions is supported here*/
-            if(retSamST[siFrag].cigTypeStr[uiCig] != 'I')
-            { /*If: This is a new cigar entry*/
-               ++uiCig;
-               retSamST[siFrag].cigTypeStr[uiCig] = 'I';
-               retSamST[siFrag].cigArySI[uiCig] = 0;
-            } /*If: This is a new cigar entry*/
-
-            bestInsST = conNtAryST[uiRef].insList;
-            curInsST = bestInsST;
-
-            while(curInsST)
-            { /*Loop: Find the most supported insertion*/
-              if(
-                   bestInsST->numHitsSI
-                 < curInsST->numHitsSI
-              ) bestInsST = curInsST;
-
-              curInsST = curInsST->nextIns;
-            } /*Loop: Find the most supported insertion*/
-
-            keptReadsSI = curInsST->numHitsSI;
-
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun13 Sec05 Sub02 Cat02:
-            +   - check if keeping ins / copy insertion
-            \+++++++++++++++++++++++++++++++++++++++++++*/
-
-            insPerSupF =
-                 (float) bestInsST->numHitsSI
-               / (float) keptReadsSI;
-
-            if(insPerSupF >= settings->minPercInsF)
-            { /*If: keeping insertion*/
-               cpLen_ulCp(
-                  &retSamST[siFrag].seqStr[uiBase],
-                  bestInsST->insStr,
-                  bestInsST->lenInsSI
-               );
-
-               uiBase += bestInsST->lenInsSI;
-
-               retSamST[siFrag].cigArySI[uiCig] +=
-                  bestInsST->lenInsSI;
-
-               retSamST[siFrag].insCntUI +=
-                  bestInsST->lenInsSI;
-            } /*If: keeping insertion*/
-         } /*If: an Insertion is supported here*/
-
-         /***********************************************\
-         * Fun13 Sec05 Sub03:
-         *   - check if I have support for an snp/match
-         *   o fun13 sec05 sub03 cat01:
-         *     - check if need new cigar entry + find
-         *       support for each base type
-         *   o fun13 sec05 sub03 cat01:
-         *     - find the base with the most support and
-         *       see if it had enough support to keep
-         \***********************************************/
-
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun13 Sec05 Sub03 Cat01:
-         +   - check if need new cigar entry + find
-         +     support for each base type
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
-
-         if(
-              nonMaskBaseUI
-            < (unsigned int) settings->minDepthSI
-         ) goto maskPos_fun13_sec05_sub05;
-
-         else if(snpPerSupF >= settings->minPercSnpF)
-         { /*If: snps were the best choice*/
-
-            if(retSamST[siFrag].cigTypeStr[uiCig] != 'M')
-            { /*If: This is a new cigar entry*/
-               uiCig +=
-                  (
-                       retSamST[siFrag].cigTypeStr[uiCig]
-                    != '\0'
-                  );
-
-               retSamST[siFrag].cigTypeStr[uiCig] = 'M';
-               retSamST[siFrag].cigArySI[uiCig] = 0;
-            } /*If: This is a new cigar entry*/
-
-             aPercSupF = (float) conNtAryST[uiRef].numASI;
-             aPercSupF /= (float) nonMaskBaseUI;
-
-             tPercSupF = (float) conNtAryST[uiRef].numTSI;
-             tPercSupF /= (float) nonMaskBaseUI;
-
-             gPercSupF = (float) conNtAryST[uiRef].numGSI;
-             gPercSupF /= (float) nonMaskBaseUI;
-
-             cPercSupF = (float) conNtAryST[uiRef].numCSI;
-             cPercSupF /= (float) nonMaskBaseUI;
-
-            /*+++++++++++++++++++++++++++++++++++++++++++\
-            + Fun13 Sec05 Sub03 Cat02:
-            +   - find the base with the most support and
-            +     see if it had enough support to keep
-            \+++++++++++++++++++++++++++++++++++++++++++*/
-
-            if(   aPercSupF > tPercSupF
-               && aPercSupF > cPercSupF
-               && aPercSupF > gPercSupF
-            ) { /*If: A has the most support*/
-
-               if(aPercSupF >= settings->minPercSnpF)
-               { /*If: this was an A*/
-                  retSamST[siFrag].seqStr[uiBase] = 'A';
-                  ++retSamST[siFrag].matchCntUI;
-               } /*If: this was an A*/
-
-               else
-               { /*Else: not enough support to call*/
-                  retSamST[siFrag].seqStr[uiBase] =
-                     settings->maskSC;
-
-                  ++retSamST[siFrag].maskCntUI;
-               } /*Else: not enough support to call*/
-            } /*If: A has the most support*/
-
-            else if(
-                  tPercSupF > cPercSupF
-               && tPercSupF > gPercSupF
-            ) { /*Else If: T has the most support*/
+            else if(
+                  tPercSupF > cPercSupF
+               && tPercSupF > gPercSupF
+            ) { /*Else If: T has the most support*/
 
                if(tPercSupF >= settings->minPercSnpF)
                { /*If: this was an T*/
@@ -1872,13 +1796,11 @@ collapse_tbCon(
 
 /*-------------------------------------------------------\
 | Fun14: noFragCollapse_tbCon
-|   - collapses a conNt_tbCon struct array into a single
+|   - collapses a pile_tbCon struct into a single
 |     samEntry struct (low read depth is masked)
 | Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon struct array to collapse
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to collapse
 |   - refIdStr:
 |     o c-string with referernce sequence name
 |   - maskCntUIPtr:
@@ -1907,16 +1829,15 @@ collapse_tbCon(
 \-------------------------------------------------------*/
 struct samEntry *
 noFragCollapse_tbCon(
-   struct conNt_tbCon conNtAryST[], /*to collapse*/
-   unsigned int lenConAryUI,   /*length of consensus*/
+   struct pile_tbCon *pileSTPtr, /*to collapse*/
    signed char *refIdStr,      /*name of reference seq*/
    unsigned int *maskCntUIPtr, /*# bases masked*/
    struct set_tbCon *settings, /*settings for collapsing*/
    signed char *errSC          /*error reports*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    ' Fun14 TOC: collapse_tbCon
-   '   - collapses a conNt_tbCon struct array into a
-   '     single samEntry struct (low read depth is masked)
+   '   - collapses a pile_tbCon struct into a single
+   '     samEntry struct (low read depth is masked)
    '   o fun14 sec01:
    '     - variable declerations
    '   o fun14 sec02:
@@ -1961,7 +1882,6 @@ noFragCollapse_tbCon(
 
    /*Find the most supported insertion*/
    signed int keptReadsSI = 0;
-   struct ins_tbCon *curInsST = 0;
    struct ins_tbCon *bestInsST = 0;
 
    struct samEntry *retSamST = 0;
@@ -2011,14 +1931,14 @@ noFragCollapse_tbCon(
 
    for(
       uiRef = 0;
-      uiRef < lenConAryUI;
+      uiRef < pileSTPtr->lenUI;
       ++uiRef
    ){ /*Loop: find memory usage*/
 
       if(startSI < 0)
       { /*If: have not found the start yet*/
          if(
-              conNtAryST[uiRef].ntKeptSI
+              pileSTPtr->ntKeptArySI[uiRef]
             < settings->minDepthSI
          ) continue;
 
@@ -2027,7 +1947,7 @@ noFragCollapse_tbCon(
       } /*If: have not found the start yet*/
 
       if(
-           conNtAryST[uiRef].ntKeptSI
+           pileSTPtr->ntKeptArySI[uiRef]
          >= settings->minDepthSI
       ) endSI = (signed int) uiRef; /*find last base*/
 
@@ -2048,10 +1968,10 @@ noFragCollapse_tbCon(
       */
       keptReadsSI =
         max_genMath(
-          conNtAryST[uiRef].ntKeptSI,
-          conNtAryST[
+          pileSTPtr->ntKeptArySI[uiRef],
+          pileSTPtr->ntKeptArySI[
              uiRef - (uiRef > 0)
-          ].ntKeptSI
+          ]
         );
          /*uiRef - (uiRef > 0) turns into
          `  uiRef - 1, when uiRef is > 0; else is
@@ -2060,25 +1980,25 @@ noFragCollapse_tbCon(
 
       if(keptReadsSI > 0)
          insPerSupF =
-              (float) conNtAryST[uiRef].numInsSI
+              (float) pileSTPtr->numInsArySI[uiRef]
             / (float) keptReadsSI;
       else
          insPerSupF = 0;
 
-      if(conNtAryST[uiRef].ntKeptSI > 0)
+      if(pileSTPtr->ntKeptArySI[uiRef] > 0)
          delPerSupF =
-              (float) conNtAryST[uiRef].numDelSI
-            / (float) conNtAryST[uiRef].ntKeptSI;
+              (float) pileSTPtr->numDelArySI[uiRef]
+            / (float) pileSTPtr->ntKeptArySI[uiRef];
       else
          delPerSupF = 0;
 
-      nonMaskBaseUI = conNtAryST[uiRef].numASI;
-      nonMaskBaseUI += conNtAryST[uiRef].numTSI;
-      nonMaskBaseUI += conNtAryST[uiRef].numGSI;
-      nonMaskBaseUI += conNtAryST[uiRef].numCSI;
+      nonMaskBaseUI = pileSTPtr->numAArySI[uiRef];
+      nonMaskBaseUI += pileSTPtr->numTArySI[uiRef];
+      nonMaskBaseUI += pileSTPtr->numGArySI[uiRef];
+      nonMaskBaseUI += pileSTPtr->numCArySI[uiRef];
 
       snpPerSupF = nonMaskBaseUI;
-      nonMaskBaseUI += conNtAryST[uiRef].numDelSI;
+      nonMaskBaseUI += pileSTPtr->numDelArySI[uiRef];
 
 
       if(nonMaskBaseUI > 0)
@@ -2096,18 +2016,7 @@ noFragCollapse_tbCon(
          cigLenUI += (lastCigSC != 'I');
          lastCigSC = 'I';
 
-         bestInsST = conNtAryST[uiRef].insList;
-         curInsST = bestInsST;
-
-         while(curInsST)
-         { /*Loop: Find the most supported insertion*/
-           if(
-                bestInsST->numHitsSI
-              < curInsST->numHitsSI
-           ) bestInsST = curInsST;
-
-           curInsST = curInsST->nextIns;
-         } /*Loop: Find the most supported insertion*/
+         bestInsST = bestIns_tbCon(pileSTPtr, uiRef);
 
          /*How many bases the insertions could add*/
          extraInsUI += bestInsST->lenInsSI;
@@ -2194,173 +2103,468 @@ noFragCollapse_tbCon(
          (unsigned int) startSI
       ); /*add starting coordinate*/
 
-   retSamST->qryIdStr[retSamST->qryIdLenUC] = '-';
-   ++retSamST->qryIdLenUC;
+   retSamST->qryIdStr[retSamST->qryIdLenUC] = '-';
+   ++retSamST->qryIdLenUC;
+
+   retSamST->qryIdLenUC +=
+      (unsigned char)
+      numToStr(
+         &retSamST->qryIdStr[retSamST->qryIdLenUC],
+         (unsigned int) endSI
+      ); /*Copy the ending position*/
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat02:
+   +   - make the reference id
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   /*Copy the reference id*/
+   retSamST->refIdLenUC =
+      cpDelim_ulCp(
+         retSamST->refIdStr,
+         refIdStr,
+         0,    /*'\0' = 0*/
+         '\0'
+      ); /*Copy the reference name*/
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat03:
+   +   - set up the RNEXT entry
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   retSamST->rNextStr[0] = '*';
+   retSamST->rNextStr[1] = '\0';
+   retSamST->rnextLenUC = 1;
+
+   /*The flag is already set up*/
+   /*Not sure what to put for mapping quality, so using
+   ` 0 (default)
+   */
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat04:
+   +   - set up the reference positions/alinged length
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   /*Get the reference lengths*/
+   retSamST->refStartUI = startSI;
+   retSamST->alnReadLenUI = endSI - startSI;
+   retSamST->refEndUI = endSI;
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat05:
+   +   - allocate memory for the sequence
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   lenFragUI += extraInsUI;
+
+   /*Make the sequence buffer*/
+   if(retSamST->seqSizeUI < lenFragUI + 1)
+   { /*If: I need to expand memory*/
+      free(retSamST->seqStr);
+
+      retSamST->seqStr =
+         malloc(
+            (lenFragUI + 9) * (sizeof(signed char))
+         );
+
+      if(! retSamST->seqStr)
+         goto memErr_fun14_sec06_sub02;
+
+      retSamST->seqSizeUI = lenFragUI;
+   } /*If: I need to expand memory*/
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat06:
+   +   - set up the q-score entry
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   /*initSamEntry allocates over 2 bytes, so I am
+   ` safe here
+   */
+   retSamST->qStr[0] = '*';
+   retSamST->qStr[1] = '\0';
+   retSamST->qSizeUI = 2;
+
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
+   + Fun14 Sec04 Sub02 Cat07:
+   +   - allocate memory for the cigar types buffer
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   if(retSamST->cigSizeUI < cigLenUI + 1)
+   { /*If: I need to allocate memory for cigar buff*/
+       if(retSamST->cigTypeStr)
+          free(retSamST->cigTypeStr);
+       retSamST->cigTypeStr = 0;
+
+       /*Make the cigar types buffer*/
+       retSamST->cigTypeStr =
+          malloc(
+             (cigLenUI + 9) * sizeof(signed char)
+          );
+
+       if(!retSamST->cigTypeStr)
+          goto memErr_fun14_sec06_sub02;
+
+       retSamST->cigSizeUI = cigLenUI;
+
+
+       if(retSamST->cigArySI)
+          free(retSamST->cigArySI);
+       retSamST->cigArySI = 0;
+
+       retSamST->cigArySI =
+          malloc((cigLenUI + 9) * sizeof(signed int));
+
+       if(!retSamST->cigArySI)
+          goto memErr_fun14_sec06_sub02;
+   } /*If: I need to allocate memory for cigar buff*/
+   
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun14 Sec05:
+   ^   - collapse consensus
+   ^   o fun14 sec05 sub01:
+   ^     - check read depth + start loop
+   ^   o fun14 sec05 sub02:
+   ^     - get the amount of support for each position
+   ^   o fun14 sec05 sub03:
+   ^     - check if I have an insertion. 
+   ^     - insertion is always one base behind
+   ^   o fun14 sec05 sub04:
+   ^     - check if I have support for an snp/match
+   ^   o fun14 sec05 sub05:
+   ^     - check if this was a deletion instead of snp
+   ^   o fun14 sec05 sub06:
+   ^     - handle not enough support cases; likely
+   ^       mixed infections
+   ^   o fun14 sec05 sub07:
+   ^     - check if I need to resize sequence buffer
+   ^   o fun14 sec05 sub08:
+   ^     - check if I need to resize the cigar buffer
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+
+   /*****************************************************\
+   * Fun14 Sec05 Sub01:
+   *   - check read depth + start loop
+   \*****************************************************/
+
+   uiBase = 0;
+   uiCig = 0;
+
+   retSamST->cigTypeStr[uiCig] = '\0';
+
+   while(startSI <= endSI)
+   { /*Loop: collapse consensus*/
+
+      if(
+           pileSTPtr->ntKeptArySI[startSI]
+         < settings->minDepthSI
+      ){ /*If: low read depth*/
+
+         retSamST->seqStr[uiBase] = settings->maskSC;
+         ++(*maskCntUIPtr);
+
+         ++uiBase;
+         ++startSI;
+
+         if(retSamST->cigTypeStr[uiCig] != 'M')
+         { /*If: need to add a new cigar entry*/
+            uiCig +=
+               (
+                    retSamST->cigTypeStr[uiCig]
+                 != '\0'
+               );
+
+            retSamST->cigTypeStr[uiCig] = 'M';
+            retSamST->cigArySI[uiCig] = 0;
+         } /*If: need to add a new cigar entry*/
+
+         ++retSamST->cigArySI[uiCig];
+         ++retSamST->maskCntUI;
+
+         continue;
+      } /*If: low read depth*/
+
+      /**************************************************\
+      * Fun14 Sec05 Sub02:
+      *   - get the amount of support for each position
+      \**************************************************/
+
+      /*The insertion is inbetween bases, which makes
+      ` it hard to gauge. So, I am taking the worst
+      ` case. Here I want all positoins
+      */
+      keptReadsSI =
+        max_genMath(
+          pileSTPtr->ntKeptArySI[startSI],
+          pileSTPtr->ntKeptArySI[startSI -(startSI > 0)]
+        );
+         /*startSI - (startSI > 0) turns into
+         `  startSI - 1, when startSI is > 0; else is
+         `  startSI
+         */
+
+      if(keptReadsSI > 0)
+         insPerSupF =
+              (float) pileSTPtr->numInsArySI[startSI]
+            / (float) keptReadsSI;
+      else
+         insPerSupF = 0;
+
+      /*For deletions an masked base is equivlent to no
+      `   support
+      */
+      if(pileSTPtr->ntKeptArySI[startSI] > 0)
+         delPerSupF =
+              (float) pileSTPtr->numDelArySI[startSI]
+            / (float) pileSTPtr->ntKeptArySI[startSI];
+      else
+         delPerSupF = 0;
+
+      /*Find the number of non-anonymous bases
+      `   For tbCon all anonymous bases are N's (masked)
+      */
+      nonMaskBaseUI = pileSTPtr->numAArySI[startSI];
+      nonMaskBaseUI += pileSTPtr->numTArySI[startSI];
+      nonMaskBaseUI += pileSTPtr->numGArySI[startSI];
+      nonMaskBaseUI += pileSTPtr->numCArySI[startSI];
+
+      snpPerSupF = nonMaskBaseUI;
+      nonMaskBaseUI += pileSTPtr->numDelArySI[startSI];
+
+      if(nonMaskBaseUI > 0)
+         snpPerSupF /= (float) nonMaskBaseUI;
+      else
+         snpPerSupF = 0;
+
+      /**************************************************\
+      * Fun14 Sec05 Sub03:
+      *   - check if I have an insertion.
+      *   - insertion is always one base behind
+      *   o fun14 sec05 sub03 cat01:
+      *     - check if need new cigar entry + find
+      *       insertion with the most support
+      *   o fun14 sec05 sub03 cat01:
+      *     - check if keeping inse / copy insertion
+      \**************************************************/
+
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun14 Sec05 Sub03 Cat01:
+      +   - check if need new cigar entry + find
+      +     insertion with the most support
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+      if(insPerSupF >= settings->minPercInsF)
+      { /*If: An insertions is supported here*/
+         if(retSamST->cigTypeStr[uiCig] != 'I')
+         { /*If: This is a new cigar entry*/
+            ++uiCig;
+            retSamST->cigTypeStr[uiCig] = 'I';
+            retSamST->cigArySI[uiCig] = 0;
+         } /*If: This is a new cigar entry*/
+
+         bestInsST = bestIns_tbCon(pileSTPtr, startSI);
+
+
+         /*+++++++++++++++++++++++++++++++++++++++++++\
+         + Fun14 Sec05 Sub03 Cat02:
+         +   - check if keeping ins / copy insertion
+         \+++++++++++++++++++++++++++++++++++++++++++*/
+
+         insPerSupF =
+              (float) bestInsST->numHitsSI
+            / (float) keptReadsSI;
 
-   retSamST->qryIdLenUC +=
-      (unsigned char)
-      numToStr(
-         &retSamST->qryIdStr[retSamST->qryIdLenUC],
-         (unsigned int) endSI
-      ); /*Copy the ending position*/
+         if(insPerSupF >= settings->minPercInsF)
+         { /*If: keeping insertion*/
+            cpLen_ulCp(
+               &retSamST->seqStr[uiBase],
+               insStr_pile_tbCon(
+                  pileSTPtr,
+                  (unsigned int) startSI,
+                  bestInsST
+               ),
+               bestInsST->lenInsSI
+            );
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat02:
-   +   - make the reference id
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+            uiBase += bestInsST->lenInsSI;
 
-   /*Copy the reference id*/
-   retSamST->refIdLenUC =
-      cpDelim_ulCp(
-         retSamST->refIdStr,
-         refIdStr,
-         0,    /*'\0' = 0*/
-         '\0'
-      ); /*Copy the reference name*/
+            retSamST->cigArySI[uiCig] +=
+               bestInsST->lenInsSI;
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat03:
-   +   - set up the RNEXT entry
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+            retSamST->insCntUI +=
+               bestInsST->lenInsSI;
+         } /*If: keeping insertion*/
+      } /*If: an Insertion is supported here*/
 
-   retSamST->rNextStr[0] = '*';
-   retSamST->rNextStr[1] = '\0';
-   retSamST->rnextLenUC = 1;
+      /**************************************************\
+      * Fun14 Sec05 Sub04:
+      *   - check if I have support for an snp/match
+      *   o fun14 sec05 sub04 cat01:
+      *     - check if need new cigar entry + find
+      *       support for each base type
+      *   o fun14 sec05 sub04 cat01:
+      *     - find the base with the most support and
+      *       see if it had enough support to keep
+      \**************************************************/
 
-   /*The flag is already set up*/
-   /*Not sure what to put for mapping quality, so using
-   ` 0 (default)
-   */
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun14 Sec05 Sub04 Cat01:
+      +   - check if need new cigar entry + find
+      +     support for each base type
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat04:
-   +   - set up the reference positions/alinged length
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+      if(
+           nonMaskBaseUI
+         < (unsigned int) settings->minDepthSI
+      ) goto maskPos_fun14_sec05_sub05;
 
-   /*Get the reference lengths*/
-   retSamST->refStartUI = startSI;
-   retSamST->alnReadLenUI = endSI - startSI;
-   retSamST->refEndUI = endSI;
+      else if(snpPerSupF >= settings->minPercSnpF)
+      { /*If: snps were the best choice*/
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat05:
-   +   - allocate memory for the sequence
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+         if(retSamST->cigTypeStr[uiCig] != 'M')
+         { /*If: This is a new cigar entry*/
+            uiCig +=
+               (
+                    retSamST->cigTypeStr[uiCig]
+                 != '\0'
+               );
 
-   lenFragUI += extraInsUI;
+            retSamST->cigTypeStr[uiCig] = 'M';
+            retSamST->cigArySI[uiCig] = 0;
+         } /*If: This is a new cigar entry*/
 
-   /*Make the sequence buffer*/
-   if(retSamST->seqSizeUI < lenFragUI + 1)
-   { /*If: I need to expand memory*/
-      free(retSamST->seqStr);
+          aPercSupF = (float) pileSTPtr->numAArySI[startSI];
+          aPercSupF /= (float) nonMaskBaseUI;
 
-      retSamST->seqStr =
-         malloc(
-            (lenFragUI + 9) * (sizeof(signed char))
-         );
+          tPercSupF = (float) pileSTPtr->numTArySI[startSI];
+          tPercSupF /= (float) nonMaskBaseUI;
 
-      if(! retSamST->seqStr)
-         goto memErr_fun14_sec06_sub02;
+          gPercSupF = (float) pileSTPtr->numGArySI[startSI];
+          gPercSupF /= (float) nonMaskBaseUI;
 
-      retSamST->seqSizeUI = lenFragUI;
-   } /*If: I need to expand memory*/
+          cPercSupF = (float) pileSTPtr->numCArySI[startSI];
+          cPercSupF /= (float) nonMaskBaseUI;
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat06:
-   +   - set up the q-score entry
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun14 Sec05 Sub04 Cat02:
+         +   - find the base with the most support and
+         +     see if it had enough support to keep
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-   /*initSamEntry allocates over 2 bytes, so I am
-   ` safe here
-   */
-   retSamST->qStr[0] = '*';
-   retSamST->qStr[1] = '\0';
-   retSamST->qSizeUI = 2;
+         if(   aPercSupF > tPercSupF
+            && aPercSupF > cPercSupF
+            && aPercSupF > gPercSupF
+         ) { /*If: A has the most support*/
 
-   /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
-   + Fun14 Sec04 Sub02 Cat07:
-   +   - allocate memory for the cigar types buffer
-   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+            if(aPercSupF >= settings->minPercSnpF)
+            { /*If: this was an A*/
+               retSamST->seqStr[uiBase] = 'A';
+               ++retSamST->matchCntUI;
+            } /*If: this was an A*/
 
-   if(retSamST->cigSizeUI < cigLenUI + 1)
-   { /*If: I need to allocate memory for cigar buff*/
-       if(retSamST->cigTypeStr)
-          free(retSamST->cigTypeStr);
-       retSamST->cigTypeStr = 0;
+            else
+            { /*Else: not enough support to call*/
+               retSamST->seqStr[uiBase] =settings->maskSC;
+               ++(*maskCntUIPtr);
+               ++retSamST->maskCntUI;
+            } /*Else: not enough support to call*/
+         } /*If: A has the most support*/
 
-       /*Make the cigar types buffer*/
-       retSamST->cigTypeStr =
-          malloc(
-             (cigLenUI + 9) * sizeof(signed char)
-          );
+         else if(
+               tPercSupF > cPercSupF
+            && tPercSupF > gPercSupF
+         ) { /*Else If: T has the most support*/
 
-       if(!retSamST->cigTypeStr)
-          goto memErr_fun14_sec06_sub02;
+            if(tPercSupF >= settings->minPercSnpF)
+            { /*If: this was an T*/
+               retSamST->seqStr[uiBase] = 'T';
+               ++retSamST->matchCntUI;
+            } /*If: this was an T*/
 
-       retSamST->cigSizeUI = cigLenUI;
+            else
+            { /*Else: not enough support to call*/
+               retSamST->seqStr[uiBase] =settings->maskSC;
+               ++(*maskCntUIPtr);
+               ++retSamST->maskCntUI;
+            } /*Else: not enough support to call*/
+         } /*Else If: T has the most support*/
 
+         else if(cPercSupF > gPercSupF)
+         { /*Else If: C has the most support*/
 
-       if(retSamST->cigArySI)
-          free(retSamST->cigArySI);
-       retSamST->cigArySI = 0;
+            if(cPercSupF >= settings->minPercSnpF)
+            { /*If: this was an C*/
+               retSamST->seqStr[uiBase] = 'C';
+               ++retSamST->matchCntUI;
+            } /*If: this was an C*/
 
-       retSamST->cigArySI =
-          malloc((cigLenUI + 9) * sizeof(signed int));
+            else
+            { /*Else: not enough support to call*/
+               retSamST->seqStr[uiBase] =settings->maskSC;
+               ++(*maskCntUIPtr);
+               ++retSamST->maskCntUI;
+            } /*Else: not enough support to call*/
+         } /*Else If: C has the most support*/
 
-       if(!retSamST->cigArySI)
-          goto memErr_fun14_sec06_sub02;
-   } /*If: I need to allocate memory for cigar buff*/
-   
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun14 Sec05:
-   ^   - collapse consensus
-   ^   o fun14 sec05 sub01:
-   ^     - check read depth + start loop
-   ^   o fun14 sec05 sub02:
-   ^     - get the amount of support for each position
-   ^   o fun14 sec05 sub03:
-   ^     - check if I have an insertion. 
-   ^     - insertion is always one base behind
-   ^   o fun14 sec05 sub04:
-   ^     - check if I have support for an snp/match
-   ^   o fun14 sec05 sub05:
-   ^     - check if this was a deletion instead of snp
-   ^   o fun14 sec05 sub06:
-   ^     - handle not enough support cases; likely
-   ^       mixed infections
-   ^   o fun14 sec05 sub07:
-   ^     - check if I need to resize sequence buffer
-   ^   o fun14 sec05 sub08:
-   ^     - check if I need to resize the cigar buffer
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+         else
+         { /*Else If: G has the most support*/
+
+            if(gPercSupF >= settings->minPercSnpF)
+            { /*If: this was an G*/
+               retSamST->seqStr[uiBase] = 'G';
+               ++retSamST->matchCntUI;
+            } /*If: this was an G*/
 
+            else
+            { /*Else: not enough support to call*/
+               retSamST->seqStr[uiBase] =settings->maskSC;
+               ++(*maskCntUIPtr);
+               ++retSamST->maskCntUI;
+            } /*Else: not enough support to call*/
+         } /*Else If: G has the most support*/
 
-   /*****************************************************\
-   * Fun14 Sec05 Sub01:
-   *   - check read depth + start loop
-   \*****************************************************/
+         ++uiBase;
+         ++retSamST->cigArySI[uiCig];
+      } /*If: snps were the best choice*/
 
-   uiBase = 0;
-   uiCig = 0;
+      /***********************************************\
+      * Fun14 Sec05 Sub05:
+      *   - check if this was a deletion instead of snp
+      \***********************************************/
 
-   retSamST->cigTypeStr[uiCig] = '\0';
+      /*Do nothing if deletion was selected*/
+      else if(delPerSupF >= settings->minPercDelF)
+      { /*Else if: there was a deletion*/
+         if(retSamST->cigTypeStr[uiCig] != 'D')
+         { /*If: This is a new cigar entry*/
+            uiCig +=
+               (
+                    retSamST->cigTypeStr[uiCig]
+                 != '\0'
+               );
 
-   while(startSI <= endSI)
-   { /*Loop: collapse consensus*/
+            retSamST->cigTypeStr[uiCig] = 'D';
+            retSamST->cigArySI[uiCig] = 0;
+         } /*If: This is a new cigar entry*/
 
-      if(
-           conNtAryST[startSI].ntKeptSI
-         < settings->minDepthSI
-      ){ /*If: low read depth*/
+         ++(retSamST->cigArySI[uiCig]);
+         ++retSamST->delCntUI;
+      } /*Else if: there was a deletion*/
 
-         retSamST->seqStr[uiBase] = settings->maskSC;
-         ++(*maskCntUIPtr);
+      /***********************************************\
+      * Fun14 Sec05 Sub06:
+      *   - handle not enough support cases; likely
+      *     mixed infections
+      \***********************************************/
 
-         ++uiBase;
-         ++startSI;
+      else
+      { /*Else: I have no support, assume mask snp*/
+         maskPos_fun14_sec05_sub05:;
 
          if(retSamST->cigTypeStr[uiCig] != 'M')
-         { /*If: need to add a new cigar entry*/
+         { /*If: new cigar entry*/
             uiCig +=
                (
                     retSamST->cigTypeStr[uiCig]
@@ -2369,736 +2573,975 @@ noFragCollapse_tbCon(
 
             retSamST->cigTypeStr[uiCig] = 'M';
             retSamST->cigArySI[uiCig] = 0;
-         } /*If: need to add a new cigar entry*/
+         } /*If: new cigar entry*/
 
+         retSamST->seqStr[uiBase] = settings->maskSC;
+         ++(*maskCntUIPtr);
+
+         ++uiBase;
          ++retSamST->cigArySI[uiCig];
          ++retSamST->maskCntUI;
+      } /*Else: I have no support, assume mask snp*/
 
-         continue;
-      } /*If: low read depth*/
+      ++startSI;
+   } /*Loop: Collapse the fragment*/
 
-      /**************************************************\
-      * Fun14 Sec05 Sub02:
-      *   - get the amount of support for each position
-      \**************************************************/
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun14 Sec06:
+   ^   - clean up and return
+   ^   o fun14 sec07 sub01:
+   ^     - no error clean up
+   ^   o fun14 sec07 sub01:
+   ^     - memory error clean up
+   ^   o fun14 sec07 sub0x:
+   ^     - clean up after an error (acutal clean up)
+   ^   o fun14 sec07 sub0y:
+   ^     - return the result
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-      /*The insertion is inbetween bases, which makes
-      ` it hard to gauge. So, I am taking the worst
-      ` case. Here I want all positoins
-      */
-      keptReadsSI =
-        max_genMath(
-          conNtAryST[startSI].ntKeptSI,
-          conNtAryST[startSI -(startSI > 0)].ntKeptSI
-        );
-         /*startSI - (startSI > 0) turns into
-         `  startSI - 1, when startSI is > 0; else is
-         `  startSI
-         */
+   /*****************************************************\
+   * Fun14 Sec07 Sub01:
+   *   - no error clean up
+   \*****************************************************/
 
-      if(keptReadsSI > 0)
-         insPerSupF =
-              (float) conNtAryST[startSI].numInsSI
-            / (float) keptReadsSI;
-      else
-         insPerSupF = 0;
+   retSamST->seqStr[uiBase] = 0;
+   retSamST->readLenUI = uiBase;
+   retSamST->cigLenUI = uiCig + 1;
+   *errSC = 0;
+   goto ret_fun14_sec06_sub06;
 
-      /*For deletions an masked base is equivlent to no
-      `   support
-      */
-      if(conNtAryST[startSI].ntKeptSI > 0)
-         delPerSupF =
-              (float) conNtAryST[startSI].numDelSI
-            / (float) conNtAryST[startSI].ntKeptSI;
-      else
-         delPerSupF = 0;
+   /*****************************************************\
+   * Fun14 Sec07 Sub02:
+   *   - memory error clean up
+   \*****************************************************/
 
-      /*Find the number of non-anonymous bases
-      `   For tbCon all anonymous bases are N's (masked)
-      */
-      nonMaskBaseUI = conNtAryST[startSI].numASI;
-      nonMaskBaseUI += conNtAryST[startSI].numTSI;
-      nonMaskBaseUI += conNtAryST[startSI].numGSI;
-      nonMaskBaseUI += conNtAryST[startSI].numCSI;
+   memErr_fun14_sec06_sub02:
+   *errSC = def_memErr_tbConDefs;
+   goto errCleanUp_fun14_sec06_sub0x;
 
-      snpPerSupF = nonMaskBaseUI;
-      nonMaskBaseUI += conNtAryST[startSI].numDelSI;
+   /*****************************************************\
+   * Fun14 Sec07 Sub03:
+   *   - no consensus error clean up
+   \*****************************************************/
 
-      if(nonMaskBaseUI > 0)
-         snpPerSupF /= (float) nonMaskBaseUI;
-      else
-         snpPerSupF = 0;
+   noConErr_fun14_sec06_sub03:;
+   *errSC = def_noSeq_tbConDefs;
+   goto errCleanUp_fun14_sec06_sub0x;
 
-      /**************************************************\
-      * Fun14 Sec05 Sub03:
-      *   - check if I have an insertion.
-      *   - insertion is always one base behind
-      *   o fun14 sec05 sub03 cat01:
-      *     - check if need new cigar entry + find
-      *       insertion with the most support
-      *   o fun14 sec05 sub03 cat01:
-      *     - check if keeping inse / copy insertion
-      \**************************************************/
+   /*****************************************************\
+   * Fun14 Sec07 Sub0x:
+   *   - clean up after an error (actual clean up)
+   \*****************************************************/
 
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun14 Sec05 Sub03 Cat01:
-      +   - check if need new cigar entry + find
-      +     insertion with the most support
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
+   errCleanUp_fun14_sec06_sub0x:;
+   freeHeap_samEntry(retSamST);
+   retSamST = 0;
+   goto ret_fun14_sec06_sub06;
 
-      if(insPerSupF >= settings->minPercInsF)
-      { /*If: An insertions is supported here*/
-         if(retSamST->cigTypeStr[uiCig] != 'I')
-         { /*If: This is a new cigar entry*/
-            ++uiCig;
-            retSamST->cigTypeStr[uiCig] = 'I';
-            retSamST->cigArySI[uiCig] = 0;
-         } /*If: This is a new cigar entry*/
+   /*****************************************************\
+   * Fun14 Sec07 Sub0y:
+   *   - return the result
+   \*****************************************************/
+
+   ret_fun14_sec06_sub06:;
+   return retSamST;
+} /*noFragcollapse_tbCon*/
+
+/*-------------------------------------------------------\
+| Fun15: pvar_tbCon
+|   - print entries in a pile_tbCon struct that are above
+|     the minimum read depth
+| Input:
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to print
+|   - minDepthSI:
+|     o minimum read depth to print out a position
+|   - refIdStr:
+|     o c-string with referernce sequence name
+|   - outFILE:
+|     o c-string with name of file to print everything to
+| Output:
+|   - Prints:
+|     o entries in pileSTPtr to outFILE
+|   - Returns:
+|     o 0 for success
+|     o def_fileErr_tbConDefs for file errors
+|     o def_noMap_tbConDefs if pileSTPtr has no reads
+\-------------------------------------------------------*/
+char
+pvar_tbCon(
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
+   signed char *refIdStr,        /*name of reference seq*/
+   struct set_tbCon *settings,   /*settings for printing*/
+   signed char *outStr           /*file to print to*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun15 TOC: pvar_tbCon
+   '   o fun15 sec01:
+   '     - Variable declerations
+   '   o fun15 sec02:
+   '     - Print out the header
+   '   o fun15 sec03:
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun15 Sec01:
+   ^   - Variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-         bestInsST = conNtAryST[startSI].insList;
-         curInsST = bestInsST;
+   signed char errSC = 0; /*for error reporting*/
+   unsigned int uiBase = 0;
+   struct insArena_tbCon *arenaSTPtr = 0;
+   struct ins_tbCon *insST = 0;
+   signed int siIns = 0;      /*insertion on*/
 
-         while(curInsST)
-         { /*Loop: Find the most supported insertion*/
-           if(
-                bestInsST->numHitsSI
-              < curInsST->numHitsSI
-           ) bestInsST = curInsST;
+   unsigned int nonMaskBaseUI = 0;
+      /*number of non-anonymous bases*/
+   unsigned int maskedBasesUI = 0; /*number masked bases*/
+   float percSupF = 0;
 
-           curInsST = curInsST->nextIns;
-         } /*Loop: Find the most supported insertion*/
+   signed int leastSupInsSI = 0;
+   signed int insTotalSI = 0;
 
-         keptReadsSI = curInsST->numHitsSI;
+   FILE *outFILE = 0;
 
-         /*+++++++++++++++++++++++++++++++++++++++++++\
-         + Fun14 Sec05 Sub03 Cat02:
-         +   - check if keeping ins / copy insertion
-         \+++++++++++++++++++++++++++++++++++++++++++*/
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun15 Sec02:
+   ^   - Print out the header
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(! outStr)
+      outFILE = stdout;
+   else if(*outStr == '*')
+      outFILE = stdout;
+   else
+   { /*Else: I need to open a file*/
+      outFILE =
+         fopen(
+            (char *) outStr,
+            "w"
+         );
+
+      if(! outFILE)
+         goto fileErr_fun15_sec04;
+   } /*Else: I need to open a file*/
+
+   /*Print the header*/
+   fprintf(
+      outFILE,
+      "refId\tposition\ttype\tsequence\tsupport"
+   );
+
+   fprintf(
+       outFILE,
+       "\tpercSupport\tmasked\tkeptBases\ttotalBases%s",
+       str_endLine
+   );
+
+   if(! pileSTPtr->numAArySI)
+      goto noFile_fun15_sec04;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun15 Sec03:
+   ^   - Print out each base
+   ^   o fun15 sec03 sub01:
+   ^     - Start loop and print insertion entries
+   ^   o fun15 sec03 sub02:
+   ^     - Print out the snp/match entry for A
+   ^   o fun15 sec03 sub03:
+   ^     - Print out the snp/match entry for T
+   ^   o fun15 sec03 sub04:
+   ^     - Print out the snp/match entry for C
+   ^   o fun15 sec03 sub05:
+   ^     - Print out the snp/match entry for G
+   ^   o fun15 sec03 sub06:
+   ^     - Print out the deletion entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun15 Sec03 Sub01:
+   *   - Start loop and print insertion entries
+   \*****************************************************/
+
+   for(uiBase = 0; uiBase < pileSTPtr->lenUI; ++uiBase)
+   { /*Loop: Print out the consensus*/
+
+      if(!uiBase)
+         goto firstBaseNoIns;
+
+      arenaSTPtr = arena_pile_tbCon(pileSTPtr, uiBase);
+      siIns = pileSTPtr->insArySI[uiBase];
+
+      leastSupInsSI =
+        max_genMath(
+           pileSTPtr->ntKeptArySI[uiBase],
+           pileSTPtr->ntKeptArySI[uiBase - 1]
+        );
 
-         insPerSupF =
-              (float) bestInsST->numHitsSI
-            / (float) keptReadsSI;
+     insTotalSI =
+        max_genMath(
+           pileSTPtr->totalNtArySI[uiBase],
+           pileSTPtr->totalNtArySI[uiBase - 1]
+        );
 
-         if(insPerSupF >= settings->minPercInsF)
-         { /*If: keeping insertion*/
-            cpLen_ulCp(
-               &retSamST->seqStr[uiBase],
-               bestInsST->insStr,
-               bestInsST->lenInsSI
-            );
+      while(siIns >= 0)
+      { /*Loop: Check insertions*/
+         insST = &arenaSTPtr->insAryST[siIns];
+         siIns = insST->nextSI;
 
-            uiBase += bestInsST->lenInsSI;
+         if(insST->numHitsSI < settings->minPrintDepthSI)
+            continue; /*There is not enough read depth*/
 
-            retSamST->cigArySI[uiCig] +=
-               bestInsST->lenInsSI;
+         percSupF =
+           (float) insST->numHitsSI/(float) leastSupInsSI;
 
-            retSamST->insCntUI +=
-               bestInsST->lenInsSI;
-         } /*If: keeping insertion*/
-      } /*If: an Insertion is supported here*/
+         if(percSupF < settings->printMinSupInsF)
+            continue; /*I am not printing this ins*/
+
+         fprintf(
+            outFILE,
+            "%s\t%i\tins\t%s\t%i\t%f\tNA\t%i\t%i%s",
+            refIdStr,
+            uiBase,
+            insStr_pile_tbCon(pileSTPtr, uiBase, insST),
+            insST->numHitsSI,
+            percSupF,
+            leastSupInsSI,
+            insTotalSI,
+            str_endLine
+         );
+      } /*Loop: Check insertions*/
 
       /**************************************************\
-      * Fun14 Sec05 Sub04:
-      *   - check if I have support for an snp/match
-      *   o fun14 sec05 sub04 cat01:
-      *     - check if need new cigar entry + find
-      *       support for each base type
-      *   o fun14 sec05 sub04 cat01:
-      *     - find the base with the most support and
-      *       see if it had enough support to keep
+      * Fun15 Sec03 Sub02:
+      *   - Print out the snp/match entry for A
       \**************************************************/
 
-      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
-      + Fun14 Sec05 Sub04 Cat01:
-      +   - check if need new cigar entry + find
-      +     support for each base type
-      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
+      firstBaseNoIns:;
 
       if(
-           nonMaskBaseUI
-         < (unsigned int) settings->minDepthSI
-      ) goto maskPos_fun14_sec05_sub05;
-
-      else if(snpPerSupF >= settings->minPercSnpF)
-      { /*If: snps were the best choice*/
-
-         if(retSamST->cigTypeStr[uiCig] != 'M')
-         { /*If: This is a new cigar entry*/
-            uiCig +=
-               (
-                    retSamST->cigTypeStr[uiCig]
-                 != '\0'
-               );
+           pileSTPtr->ntKeptArySI[uiBase]
+         < settings->minPrintDepthSI
+      ) continue; /*Not enough support to print out*/
 
-            retSamST->cigTypeStr[uiCig] = 'M';
-            retSamST->cigArySI[uiCig] = 0;
-         } /*If: This is a new cigar entry*/
+      nonMaskBaseUI = pileSTPtr->numAArySI[uiBase];
+      nonMaskBaseUI += pileSTPtr->numTArySI[uiBase];
+      nonMaskBaseUI += pileSTPtr->numGArySI[uiBase];
+      nonMaskBaseUI += pileSTPtr->numCArySI[uiBase];
+      nonMaskBaseUI += pileSTPtr->numDelArySI[uiBase];
 
-          aPercSupF = (float) conNtAryST[startSI].numASI;
-          aPercSupF /= (float) nonMaskBaseUI;
+      maskedBasesUI = pileSTPtr->ntKeptArySI[uiBase];
+      maskedBasesUI -= nonMaskBaseUI;
 
-          tPercSupF = (float) conNtAryST[startSI].numTSI;
-          tPercSupF /= (float) nonMaskBaseUI;
+      percSupF = (float) pileSTPtr->numAArySI[uiBase];
+      percSupF /= (float) nonMaskBaseUI;
 
-          gPercSupF = (float) conNtAryST[startSI].numGSI;
-          gPercSupF /= (float) nonMaskBaseUI;
+      if(
+           pileSTPtr->numAArySI[uiBase]
+         < settings->minPrintDepthSI
+      ) ;
 
-          cPercSupF = (float) conNtAryST[startSI].numCSI;
-          cPercSupF /= (float) nonMaskBaseUI;
+      else if(percSupF >= settings->printMinSupSnpF)
+      { /*If: I had enough support to print out A*/
+         fprintf(
+            outFILE,
+            "%s\t%i\tbase\tA\t%i\t%f\t%u\t%i\t%i%s",
+            refIdStr,
+            uiBase + 1,
+            pileSTPtr->numAArySI[uiBase],
+            percSupF,
+            maskedBasesUI,
+            pileSTPtr->ntKeptArySI[uiBase],
+            pileSTPtr->totalNtArySI[uiBase],
+            str_endLine
+         );
+      } /*If: I had enough support to print out A*/
 
-         /*++++++++++++++++++++++++++++++++++++++++++++++\
-         + Fun14 Sec05 Sub04 Cat02:
-         +   - find the base with the most support and
-         +     see if it had enough support to keep
-         \++++++++++++++++++++++++++++++++++++++++++++++*/
+      /**************************************************\
+      * Fun15 Sec03 Sub03:
+      *   - Print out the snp/match entry for T
+      \**************************************************/
 
-         if(   aPercSupF > tPercSupF
-            && aPercSupF > cPercSupF
-            && aPercSupF > gPercSupF
-         ) { /*If: A has the most support*/
+      percSupF = (float) pileSTPtr->numTArySI[uiBase];
+      percSupF /= (float) nonMaskBaseUI;
 
-            if(aPercSupF >= settings->minPercSnpF)
-            { /*If: this was an A*/
-               retSamST->seqStr[uiBase] = 'A';
-               ++retSamST->matchCntUI;
-            } /*If: this was an A*/
+      if(
+           pileSTPtr->numTArySI[uiBase]
+         < settings->minPrintDepthSI
+      ) ;
 
-            else
-            { /*Else: not enough support to call*/
-               retSamST->seqStr[uiBase] =settings->maskSC;
-               ++(*maskCntUIPtr);
-               ++retSamST->maskCntUI;
-            } /*Else: not enough support to call*/
-         } /*If: A has the most support*/
+      else if(percSupF >= settings->printMinSupSnpF)
+      { /*If: I had enough support to print an T*/
+         fprintf(
+            outFILE,
+            "%s\t%i\tbase\tT\t%i\t%f\t%u\t%i\t%i%s",
+            refIdStr,
+            uiBase + 1,
+            pileSTPtr->numTArySI[uiBase],
+            percSupF,
+            maskedBasesUI,
+            pileSTPtr->ntKeptArySI[uiBase],
+            pileSTPtr->totalNtArySI[uiBase],
+            str_endLine
+         );
+      } /*If: I had enough support to print an T*/
 
-         else if(
-               tPercSupF > cPercSupF
-            && tPercSupF > gPercSupF
-         ) { /*Else If: T has the most support*/
+      /**************************************************\
+      * Fun15 Sec03 Sub04:
+      *   - Print out the snp/match entry for C
+      \**************************************************/
 
-            if(tPercSupF >= settings->minPercSnpF)
-            { /*If: this was an T*/
-               retSamST->seqStr[uiBase] = 'T';
-               ++retSamST->matchCntUI;
-            } /*If: this was an T*/
+      percSupF = (float) pileSTPtr->numCArySI[uiBase];
+      percSupF /= (float) nonMaskBaseUI;
 
-            else
-            { /*Else: not enough support to call*/
-               retSamST->seqStr[uiBase] =settings->maskSC;
-               ++(*maskCntUIPtr);
-               ++retSamST->maskCntUI;
-            } /*Else: not enough support to call*/
-         } /*Else If: T has the most support*/
+      if(
+           pileSTPtr->numCArySI[uiBase]
+         < settings->minPrintDepthSI
+      ) ;
 
-         else if(cPercSupF > gPercSupF)
-         { /*Else If: C has the most support*/
+      else if(percSupF >= settings->printMinSupSnpF)
+      { /*If: I had enough support to print an C*/
+         fprintf(
+            outFILE,
+            "%s\t%i\tbase\tC\t%i\t%f\t%u\t%i\t%u%s",
+            refIdStr,
+            uiBase + 1,
+            pileSTPtr->numCArySI[uiBase],
+            percSupF,
+            maskedBasesUI,
+            pileSTPtr->ntKeptArySI[uiBase],
+            pileSTPtr->totalNtArySI[uiBase],
+            str_endLine
+         );
+      } /*If: I had enough support to print an C*/
 
-            if(cPercSupF >= settings->minPercSnpF)
-            { /*If: this was an C*/
-               retSamST->seqStr[uiBase] = 'C';
-               ++retSamST->matchCntUI;
-            } /*If: this was an C*/
+      /**************************************************\
+      * Fun15 Sec03 Sub05:
+      *   - Print out the snp/match entry for G
+      \**************************************************/
 
-            else
-            { /*Else: not enough support to call*/
-               retSamST->seqStr[uiBase] =settings->maskSC;
-               ++(*maskCntUIPtr);
-               ++retSamST->maskCntUI;
-            } /*Else: not enough support to call*/
-         } /*Else If: C has the most support*/
+      percSupF = (float) pileSTPtr->numGArySI[uiBase];
+      percSupF /= (float) nonMaskBaseUI;
 
-         else
-         { /*Else If: G has the most support*/
+      if(
+           pileSTPtr->numGArySI[uiBase]
+         < settings->minPrintDepthSI
+      ) ;
 
-            if(gPercSupF >= settings->minPercSnpF)
-            { /*If: this was an G*/
-               retSamST->seqStr[uiBase] = 'G';
-               ++retSamST->matchCntUI;
-            } /*If: this was an G*/
+      else if(percSupF >= settings->printMinSupSnpF)
+      { /*If: I had enough support to print an G*/
+         fprintf(
+            outFILE,
+            "%s\t%i\tbase\tG\t%i\t%f\t%u\t%i\t%u%s",
+            refIdStr,
+            uiBase + 1,
+            pileSTPtr->numGArySI[uiBase],
+            percSupF,
+            maskedBasesUI,
+            pileSTPtr->ntKeptArySI[uiBase],
+            pileSTPtr->totalNtArySI[uiBase],
+            str_endLine
+         );
+      } /*If: I had enough support to print an G*/
 
-            else
-            { /*Else: not enough support to call*/
-               retSamST->seqStr[uiBase] =settings->maskSC;
-               ++(*maskCntUIPtr);
-               ++retSamST->maskCntUI;
-            } /*Else: not enough support to call*/
-         } /*Else If: G has the most support*/
+      /**************************************************\
+      * Fun15 Sec03 Sub06:
+      *   - Print out the deletion entry
+      \**************************************************/
 
-         ++uiBase;
-         ++retSamST->cigArySI[uiCig];
-      } /*If: snps were the best choice*/
+      if(
+           pileSTPtr->numDelArySI[uiBase]
+         > settings->minPrintDepthSI
+      ){ /*If: The a base has enough depth*/
+         percSupF = (float) pileSTPtr->numDelArySI[uiBase];
 
-      /***********************************************\
-      * Fun14 Sec05 Sub05:
-      *   - check if this was a deletion instead of snp
-      \***********************************************/
+         percSupF /=
+            (float) pileSTPtr->ntKeptArySI[uiBase];
 
-      /*Do nothing if deletion was selected*/
-      else if(delPerSupF >= settings->minPercDelF)
-      { /*Else if: there was a deletion*/
-         if(retSamST->cigTypeStr[uiCig] != 'D')
-         { /*If: This is a new cigar entry*/
-            uiCig +=
-               (
-                    retSamST->cigTypeStr[uiCig]
-                 != '\0'
-               );
+         if(percSupF >= settings->printMinSupDelF)
+            fprintf(
+               outFILE,
+               "%s\t%i\tdel\tdel\t%i\t%f\t%u\t%i\t%u%s",
+               refIdStr,
+               uiBase + 1,
+               pileSTPtr->numDelArySI[uiBase],
+               percSupF,
+               maskedBasesUI,
+               pileSTPtr->ntKeptArySI[uiBase],
+               pileSTPtr->totalNtArySI[uiBase],
+               str_endLine
+            );
+      } /*If: The a base has enough depth*/
+   } /*Loop: Print out the consensus*/
 
-            retSamST->cigTypeStr[uiCig] = 'D';
-            retSamST->cigArySI[uiCig] = 0;
-         } /*If: This is a new cigar entry*/
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun15 Sec04:
+   ^   - clean up and return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-         ++(retSamST->cigArySI[uiCig]);
-         ++retSamST->delCntUI;
-      } /*Else if: there was a deletion*/
+   errSC = 0;
+   goto cleanUp_fun15_sec04;
 
-      /***********************************************\
-      * Fun14 Sec05 Sub06:
-      *   - handle not enough support cases; likely
-      *     mixed infections
-      \***********************************************/
+   noFile_fun15_sec04:;
+      errSC = def_noMap_tbConDefs;
+      goto cleanUp_fun15_sec04;
 
-      else
-      { /*Else: I have no support, assume mask snp*/
-         maskPos_fun14_sec05_sub05:;
+   fileErr_fun15_sec04:;
+      errSC = def_fileErr_tbConDefs;
+      goto cleanUp_fun15_sec04;
 
-         if(retSamST->cigTypeStr[uiCig] != 'M')
-         { /*If: new cigar entry*/
-            uiCig +=
-               (
-                    retSamST->cigTypeStr[uiCig]
-                 != '\0'
-               );
+   cleanUp_fun15_sec04:;
+      if(outFILE != stdout)
+         fclose(outFILE);
+      outFILE = 0;
 
-            retSamST->cigTypeStr[uiCig] = 'M';
-            retSamST->cigArySI[uiCig] = 0;
-         } /*If: new cigar entry*/
+      return errSC;
+} /*pConBasAry*/
 
-         retSamST->seqStr[uiBase] = settings->maskSC;
-         ++(*maskCntUIPtr);
+/*-------------------------------------------------------\
+| Fun16: chkRead_tbCon
+|   - checks if a read can be added to a consensus
+| Input:
+|   - samSTPtr:
+|     o pointer to a samEntry struct with read to check
+|   - settings:
+|     o pointer to set_tbCon struct with settings
+| Output:
+|   - Returns:
+|     o 0 if the read can be added
+|     o def_header_tbConDefs for sam file header entry
+|     o def_noMap_tbConDefs for an unmapped read
+|     o def_noSeq_tbConDefs for a read missing a sequence
+|     o def_lowMapq_tbConDefs for low mapping qualities
+\-------------------------------------------------------*/
+signed char
+chkRead_tbCon(
+   struct samEntry *samSTPtr,
+   struct set_tbCon *settings
+){
+   if(
+         samSTPtr->extraStr[0] == '@'
+      && samSTPtr->qryIdStr[0] == '\0'
+   ) return def_header_tbConDefs;
+     /*reads with no extra entries (tags) are kept*/
 
-         ++uiBase;
-         ++retSamST->cigArySI[uiCig];
-         ++retSamST->maskCntUI;
-      } /*Else: I have no support, assume mask snp*/
+   if(samSTPtr->flagUS & 4)
+      return def_noMap_tbConDefs;
 
-      ++startSI;
-   } /*Loop: Collapse the fragment*/
+   if(samSTPtr->seqStr == 0)
+      return def_noSeq_tbConDefs;
 
-   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun14 Sec06:
-   ^   - clean up and return
-   ^   o fun14 sec07 sub01:
-   ^     - no error clean up
-   ^   o fun14 sec07 sub01:
-   ^     - memory error clean up
-   ^   o fun14 sec07 sub0x:
-   ^     - clean up after an error (acutal clean up)
-   ^   o fun14 sec07 sub0y:
-   ^     - return the result
-   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+   if(samSTPtr->seqStr[0] == '*')
+      return def_noSeq_tbConDefs;
 
-   /*****************************************************\
-   * Fun14 Sec07 Sub01:
-   *   - no error clean up
-   \*****************************************************/
+   if(samSTPtr->mapqUC < settings->minMapqUC)
+      return def_lowMapq_tbConDefs;
 
-   retSamST->readLenUI = uiBase;
-   retSamST->cigLenUI = uiCig + 1;
-   *errSC = 0;
-   goto ret_fun14_sec06_sub06;
+   return 0;
+} /*chkRead_tbCon*/
 
-   /*****************************************************\
-   * Fun14 Sec07 Sub02:
-   *   - memory error clean up
-   \*****************************************************/
+/*-------------------------------------------------------\
+| Fun17: realloc_pile_tbCon
+|   - makes sure a pile_tbCon struct covers a reference
+|     position (allocates or resizes)
+| Input:
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to resize
+|     o lenUI is the length of the reference for new
+|       pileups; use 0 for unkown
+|   - endUI:
+|     o last reference position (index 0) the pileup must
+|       have (ex: refEndUI in a samEntry struct)
+| Output:
+|   - Modifies:
+|     o count arrays in pileSTPtr to have at least
+|       endUI + 1 bases; new bases are set to 0 (no
+|       insertions)
+|     o lenUI in pileSTPtr to have the new length if the
+|       arrays are resized
+|     o arenaAryST in pileSTPtr to have one arena if
+|       setup_pile_tbCon was not called
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_tbConDefs for memory errors
+\-------------------------------------------------------*/
+signed char
+realloc_pile_tbCon(
+   struct pile_tbCon *pileSTPtr, /*pileup to resize*/
+   unsigned int endUI             /*last base to hold*/
+){
+   unsigned int uiBase = 0;
+   unsigned int lenUI = 0;
+   signed int *tmpSIPtr = 0;
 
-   memErr_fun14_sec06_sub02:
-   *errSC = def_memErr_tbConDefs;
-   goto errCleanUp_fun14_sec06_sub0x;
+   if(! pileSTPtr->numArenaSI)
+   { /*If: no insertion arenas; make one*/
+      if(setup_pile_tbCon(pileSTPtr, 1))
+         return def_memErr_tbConDefs;
+   } /*If: no insertion arenas; make one*/
 
-   /*****************************************************\
-   * Fun14 Sec07 Sub03:
-   *   - no consensus error clean up
-   \*****************************************************/
+   if(pileSTPtr->numAArySI)
+   { /*If: already have counts*/
+      if(pileSTPtr->lenUI > endUI)
+         return 0; /*pileup already has endUI*/
 
-   noConErr_fun14_sec06_sub03:;
-   *errSC = def_noSeq_tbConDefs;
-   goto errCleanUp_fun14_sec06_sub0x;
+      uiBase = pileSTPtr->lenUI;
+      lenUI = endUI + 128;
+         /*add some extra memory to reduce future reallocs*/
+   } /*If: already have counts*/
 
-   /*****************************************************\
-   * Fun14 Sec07 Sub0x:
-   *   - clean up after an error (actual clean up)
-   \*****************************************************/
+   else
+   { /*Else: first round*/
+      uiBase = 0;
+      lenUI = pileSTPtr->lenUI;
 
-   errCleanUp_fun14_sec06_sub0x:;
-   freeHeap_samEntry(retSamST);
-   retSamST = 0;
-   goto ret_fun14_sec06_sub06;
+      if(lenUI <= endUI)
+         lenUI = endUI + 128;
+   } /*Else: first round*/
 
-   /*****************************************************\
-   * Fun14 Sec07 Sub0y:
-   *   - return the result
-   \*****************************************************/
+   /*the length is only updated after every array has
+   `  been resized, so a memory error leaves lenUI as the
+   `  length all arrays have
+   */
 
-   ret_fun14_sec06_sub06:;
-   return retSamST;
-} /*noFragcollapse_tbCon*/
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numAArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numAArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numTArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numTArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numCArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numCArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numGArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numGArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numDelArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numDelArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->numInsArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->numInsArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->insArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->insArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->totalNtArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->totalNtArySI = tmpSIPtr;
+
+   tmpSIPtr =
+      realloc(
+         pileSTPtr->ntKeptArySI,
+         lenUI * sizeof(signed int)
+      );
+   if(! tmpSIPtr)
+      goto memErr_fun17;
+   pileSTPtr->ntKeptArySI = tmpSIPtr;
+
+   while(uiBase < lenUI)
+   { /*Loop: initialize the new bases*/
+      pileSTPtr->numAArySI[uiBase] = 0;
+      pileSTPtr->numTArySI[uiBase] = 0;
+      pileSTPtr->numCArySI[uiBase] = 0;
+      pileSTPtr->numGArySI[uiBase] = 0;
+      pileSTPtr->numDelArySI[uiBase] = 0;
+      pileSTPtr->numInsArySI[uiBase] = 0;
+      pileSTPtr->insArySI[uiBase] = -1;
+      pileSTPtr->totalNtArySI[uiBase] = 0;
+      pileSTPtr->ntKeptArySI[uiBase] = 0;
+      ++uiBase;
+   } /*Loop: initialize the new bases*/
+
+   pileSTPtr->lenUI = lenUI;
+   return 0;
+
+   memErr_fun17:;
+      return def_memErr_tbConDefs;
+} /*realloc_pile_tbCon*/
 
 /*-------------------------------------------------------\
-| Fun15: pvar_tbCon
-|   - print entries in a conNt_tbCon structure array that
-|     are above the minimum read depth
+| Fun18: addReadWin_tbCon
+|   - adds the part of a read that is in a reference
+|     window to a pile_tbCon struct
+|   - windows can be added to the same pileup at the same
+|     time (one thread per window) if they do not overlap
+|     and use different insertion arenas (blocks of
+|     def_blockLen_tbCon bases; arena_pile_tbCon)
 | Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon structure array to print
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
-|   - minDepthSI:
-|     o minimum read depth to print out a position
-|   - refIdStr:
-|     o c-string with referernce sequence name
-|   - outFILE:
-|     o c-string with name of file to print everything to
+|   - samSTPtr:
+|     o pointer to a samEntry struct with read to add
+|   - pileSTPtr:
+|     o pile_tbCon struct to add read to
+|     o must already cover the read (realloc_pile_tbCon)
+|   - startUI:
+|     o first reference position (index 0) in window
+|   - endUI:
+|     o first reference position after the window
+|   - settings:
+|     o pointer to set_tbCon struct with settings
 | Output:
-|   - Prints:
-|     o entries in conNtAryST to outFILE
+|   - Modifies:
+|     o pileSTPtr to have the read bases, deletions, and
+|       insertions that are in [startUI, endUI)
+|       * insertions belong to the reference base after
+|         the insertion
 |   - Returns:
-|     o 0 for success
-|     o def_fileErr_tbConDefs for file errors
-|     o def_noMap_tbConDefs if conNtAryST is null or 0
+|     o for no errors
+|     o def_header_tbConDefs for sam file header entry
+|     o def_noMap_tbConDefs for an unmapped read
+|     o def_noSeq_tbConDefs for a read missing a sequence
+|     o def_lowMapq_tbConDefs for low mapping qualities
+|     o def_memErr_tbConDefs for memory errors
 \-------------------------------------------------------*/
-char
-pvar_tbCon(
-   struct conNt_tbCon conNtAryST[], /*consensus array*/
-   unsigned int lenConAryUI,     /*length of conNtAryST*/
-   signed char *refIdStr,        /*name of reference seq*/
-   struct set_tbCon *settings,   /*settings for printing*/
-   signed char *outStr           /*file to print to*/
+signed char
+addReadWin_tbCon(
+   struct samEntry *samSTPtr, /*read to add to consensus*/
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
+   unsigned int startUI,      /*first base in window*/
+   unsigned int endUI,        /*first base after window*/
+   struct set_tbCon *settings
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-   ' Fun15 TOC: pvar_tbCon
-   '   o fun15 sec01:
-   '     - Variable declerations
-   '   o fun15 sec02:
-   '     - Print out the header
-   '   o fun15 sec03:
+   ' Fun18 TOC: addReadWin_tbCon
+   '   - adds the part of a read in a window to a pileup
+   '   o fun18 sec01:
+   '     - variable declerations
+   '   o fun18 sec02:
+   '     - check read
+   '   o fun18 sec03:
+   '     - add bases in the window to the consensus
+   '   o fun18 sec04:
+   '     - clean up and return
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun15 Sec01:
-   ^   - Variable declerations
+   ^ Fun18 Sec01:
+   ^   - variable declerations
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   signed char errSC = 0; /*for error reporting*/
-   unsigned int uiBase = 0;
-   struct ins_tbCon *insST = 0;
-
-   unsigned int nonMaskBaseUI = 0;
-      /*number of non-anonymous bases*/
-   unsigned int maskedBasesUI = 0; /*number masked bases*/
-   float percSupF = 0;
+   signed char errSC = 0;        /*err reporting at end*/
 
-   signed int leastSupInsSI = 0;
-   signed int insTotalSI = 0;
+   /*For loops*/
+   unsigned int uiCig = 0;    /*iterating throug cigars*/
+   unsigned int uiBase = 0;   /*iterating through bases*/
+   unsigned int uiRef = 0;    /*position at in reference*/
+   unsigned int endCigUI = 0; /*end of cigar entry*/
 
-   FILE *outFILE = 0;
+   /*For adding insertions to the consensus*/
+   signed int lenInsSI = 0;   /*length of found ins*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun15 Sec02:
-   ^   - Print out the header
+   ^ Fun18 Sec02:
+   ^   - check read
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   if(! outStr)
-      outFILE = stdout;
-   else if(*outStr == '*')
-      outFILE = stdout;
-   else
-   { /*Else: I need to open a file*/
-      outFILE =
-         fopen(
-            (char *) outStr,
-            "w"
-         );
-
-      if(! outFILE)
-         goto fileErr_fun15_sec04;
-   } /*Else: I need to open a file*/
-
-   /*Print the header*/
-   fprintf(
-      outFILE,
-      "refId\tposition\ttype\tsequence\tsupport"
-   );
+   errSC = chkRead_tbCon(samSTPtr, settings);
 
-   fprintf(
-       outFILE,
-       "\tpercSupport\tmasked\tkeptBases\ttotalBases%s",
-       str_endLine
-   );
+   if(errSC)
+      return errSC;
 
-   if(! conNtAryST)
-      goto noFile_fun15_sec04;
+   if(samSTPtr->refEndUI < startUI)
+      return 0; /*read ends before the window*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun15 Sec03:
-   ^   - Print out each base
-   ^   o fun15 sec03 sub01:
-   ^     - Start loop and print insertion entries
-   ^   o fun15 sec03 sub02:
-   ^     - Print out the snp/match entry for A
-   ^   o fun15 sec03 sub03:
-   ^     - Print out the snp/match entry for T
-   ^   o fun15 sec03 sub04:
-   ^     - Print out the snp/match entry for C
-   ^   o fun15 sec03 sub05:
-   ^     - Print out the snp/match entry for G
-   ^   o fun15 sec03 sub06:
-   ^     - Print out the deletion entry
+   ^ Fun18 Sec03:
+   ^   - add bases to consensus
+   ^   o fun18 sec03 sub01:
+   ^     - setup and start loop
+   ^   o fun18 sec03 sub02:
+   ^     - check matches and snp cases
+   ^   o fun18 sec03 sub03:
+   ^     - check deletion cases
+   ^   o fun18 sec03 sub04:
+   ^     - check the insertion cases
+   ^   o fun18 sec03 sub05:
+   ^     - handle softmasking
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    /*****************************************************\
-   * Fun15 Sec03 Sub01:
-   *   - Start loop and print insertion entries
+   * Fun18 Sec03 Sub01:
+   *   - setup and start loop
    \*****************************************************/
 
-   for(uiBase = 0; uiBase < lenConAryUI; ++uiBase)
-   { /*Loop: Print out the consensus*/
-
-      if(!uiBase)
-         goto firstBaseNoIns;
-
-      insST = conNtAryST[uiBase].insList;
+   uiBase = 0;
+   uiRef = samSTPtr->refStartUI;
 
-      leastSupInsSI =
-        max_genMath(
-           conNtAryST[uiBase].ntKeptSI,
-           conNtAryST[uiBase - 1].ntKeptSI
-        );
+   for(uiCig = 0; uiCig < samSTPtr->cigLenUI; ++uiCig)
+   { /*Loop: add bases to the consensus*/
+      if(uiRef >= endUI)
+         break; /*rest of read is after the window*/
 
-     insTotalSI =
-        max_genMath(
-           conNtAryST[uiBase].totalNtSI,
-           conNtAryST[uiBase - 1].totalNtSI
-        );
+      switch(samSTPtr->cigTypeStr[uiCig])
+      { /*Switch: Check the cigar entry type*/
 
-      while(insST)
-      { /*Loop: Check insertions*/
-         if(insST->numHitsSI < settings->minPrintDepthSI)
-         { /*If: There is not enough read depth*/
-            insST = insST->nextIns;
-            continue;
-         } /*If: There is not enough read depth*/
+         /***********************************************\
+         * Fun18 Sec03 Sub02:
+         *   - check matches and snp cases
+         *   o fun18 sec03 sub02 cat01:
+         *     - add snps/matches to total & check q-score
+         *   o fun18 sec03 sub02 cat02:
+         *     - passed qc; add to nucleotide count
+         *   o fun18 sec03 sub02 cat03:
+         *     - move to next base in match/snp
+         \***********************************************/
 
-         percSupF =
-           (float) insST->numHitsSI/(float) leastSupInsSI;
+         /*++++++++++++++++++++++++++++++++++++++++++++++\
+         + Fun18 Sec03 Sub02 Cat01:
+         +   - add snps/matches to total and check q-score
+         \++++++++++++++++++++++++++++++++++++++++++++++*/
 
-         if(percSupF < settings->printMinSupInsF)
-         { /*If: I am not printing this ins*/
-            insST = insST->nextIns;
-            continue;
-         } /*If: I am not printing this ins*/
+         case 'M':
+         case 'X':
+         case '=':
+         /*Case: match or snp*/
 
-         fprintf(
-            outFILE,
-            "%s\t%i\tins\t%s\t%i\t%f\tNA\t%i\t%i%s",
-            refIdStr,
-            uiBase,
-            insST->insStr,
-            insST->numHitsSI,
-            percSupF,
-            leastSupInsSI,
-            insTotalSI,
-            str_endLine
-         );
+            endCigUI = uiBase + samSTPtr->cigArySI[uiCig];
 
-         insST = insST->nextIns;
-      } /*Loop: Check insertions*/
+            while(uiBase < endCigUI)
+            { /*Loop: add matchs/snps to consensus*/
+               if(uiRef < startUI || uiRef >= endUI)
+               { /*If: base is outside the window*/
+                  ++uiBase;
+                  ++uiRef;
+                  continue;
+               } /*If: base is outside the window*/
 
-      /**************************************************\
-      * Fun15 Sec03 Sub02:
-      *   - Print out the snp/match entry for A
-      \**************************************************/
+               ++pileSTPtr->totalNtArySI[uiRef];
 
-      firstBaseNoIns:;
+               if(
+                     samSTPtr->qStr[0] != '*'
+                  && samSTPtr->qStr[1] != '\0'
+               ){ /*If: I have a q-score entry*/
+                  if(
+                       samSTPtr->qStr[uiBase]
+                         - def_adjQ_samEntry
+                     < settings->minQSI
+                  ){ /*If: base is beneath min q*/
+                     ++uiBase;
+                     ++uiRef;
+                     continue;
+                  } /*If: base is beneath min q*/
+               } /*If: I have a q-score entry*/
 
-      if(
-           conNtAryST[uiBase].ntKeptSI
-         < settings->minPrintDepthSI
-      ) continue; /*Not enough support to print out*/
+               /*++++++++++++++++++++++++++++++++++++++++\
+               + Fun18 Sec03 Sub02 Cat02:
+               +   - passed qc; add to nucleotide count
+               \++++++++++++++++++++++++++++++++++++++++*/
 
-      nonMaskBaseUI = conNtAryST[uiBase].numASI;
-      nonMaskBaseUI += conNtAryST[uiBase].numTSI;
-      nonMaskBaseUI += conNtAryST[uiBase].numGSI;
-      nonMaskBaseUI += conNtAryST[uiBase].numCSI;
-      nonMaskBaseUI += conNtAryST[uiBase].numDelSI;
+               /*Incurmenting total base count here so
+               `  masked positions are still kept
+               */
+               ++pileSTPtr->ntKeptArySI[uiRef];
 
-      maskedBasesUI = conNtAryST[uiBase].ntKeptSI;
-      maskedBasesUI -= nonMaskBaseUI;
+               switch(samSTPtr->seqStr[uiBase] & ~32)
+               { /*Switch: Check the base type*/
+                  case 'A':
+                     ++pileSTPtr->numAArySI[uiRef];
+                     break;
 
-      percSupF = (float) conNtAryST[uiBase].numASI;
-      percSupF /= (float) nonMaskBaseUI;
+                  case 'T':
+                     ++pileSTPtr->numTArySI[uiRef];
+                     break;
 
-      if(
-           conNtAryST[uiBase].numASI
-         < settings->minPrintDepthSI
-      ) ;
+                  case 'C':
+                     ++pileSTPtr->numCArySI[uiRef];
+                     break;
 
-      else if(percSupF >= settings->printMinSupSnpF)
-      { /*If: I had enough support to print out A*/
-         fprintf(
-            outFILE,
-            "%s\t%i\tbase\tA\t%i\t%f\t%u\t%i\t%i%s",
-            refIdStr,
-            uiBase + 1,
-            conNtAryST[uiBase].numASI,
-            percSupF,
-            maskedBasesUI,
-            conNtAryST[uiBase].ntKeptSI,
-            conNtAryST[uiBase].totalNtSI,
-            str_endLine
-         );
-      } /*If: I had enough support to print out A*/
+                  case 'G':
+                     ++pileSTPtr->numGArySI[uiRef];
+                     break;
+               } /*Switch: Check the base type*/
 
-      /**************************************************\
-      * Fun15 Sec03 Sub03:
-      *   - Print out the snp/match entry for T
-      \**************************************************/
+               /*++++++++++++++++++++++++++++++++++++++++\
+               + Fun18 Sec03 Sub02 Cat03:
+               +   - move to next base in match/snp
+               \++++++++++++++++++++++++++++++++++++++++*/
 
-      percSupF = (float) conNtAryST[uiBase].numTSI;
-      percSupF /= (float) nonMaskBaseUI;
+               ++uiBase;
+               ++uiRef;
+            } /*Loop: Add matchs/snps to consensus*/
 
-      if(
-           conNtAryST[uiBase].numTSI
-         < settings->minPrintDepthSI
-      ) ;
+            break;
+         /*Case: match or snp*/
 
-      else if(percSupF >= settings->printMinSupSnpF)
-      { /*If: I had enough support to print an T*/
-         fprintf(
-            outFILE,
-            "%s\t%i\tbase\tT\t%i\t%f\t%u\t%i\t%i%s",
-            refIdStr,
-            uiBase + 1,
-            conNtAryST[uiBase].numTSI,
-            percSupF,
-            maskedBasesUI,
-            conNtAryST[uiBase].ntKeptSI,
-            conNtAryST[uiBase].totalNtSI,
-            str_endLine
-         );
-      } /*If: I had enough support to print an T*/
+         /***********************************************\
+         * Fun18 Sec03 Sub03:
+         *   - check deletion cases
+         \***********************************************/
 
-      /**************************************************\
-      * Fun15 Sec03 Sub04:
-      *   - Print out the snp/match entry for C
-      \**************************************************/
+         case 'D':
+         /*Case: Deletion*/ 
+            endCigUI = uiRef + samSTPtr->cigArySI[uiCig];
 
-      percSupF = (float) conNtAryST[uiBase].numCSI;
-      percSupF /= (float) nonMaskBaseUI;
+            while(uiRef < endCigUI)
+            { /*Loop: add in deletions*/
+               if(uiRef >= startUI && uiRef < endUI)
+               { /*If: deletion is in the window*/
+                  ++pileSTPtr->totalNtArySI[uiRef];
+                  ++pileSTPtr->ntKeptArySI[uiRef];
+                  ++pileSTPtr->numDelArySI[uiRef];
+               } /*If: deletion is in the window*/
 
-      if(
-           conNtAryST[uiBase].numCSI
-         < settings->minPrintDepthSI
-      ) ;
+               ++uiRef;
+            } /*Loop: add in deletions*/
 
-      else if(percSupF >= settings->printMinSupSnpF)
-      { /*If: I had enough support to print an C*/
-         fprintf(
-            outFILE,
-            "%s\t%i\tbase\tC\t%i\t%f\t%u\t%i\t%u%s",
-            refIdStr,
-            uiBase + 1,
-            conNtAryST[uiBase].numCSI,
-            percSupF,
-            maskedBasesUI,
-            conNtAryST[uiBase].ntKeptSI,
-            conNtAryST[uiBase].totalNtSI,
-            str_endLine
-         );
-      } /*If: I had enough support to print an C*/
+            break;
+         /*Case: Deletion*/ 
 
-      /**************************************************\
-      * Fun15 Sec03 Sub05:
-      *   - Print out the snp/match entry for G
-      \**************************************************/
+         /***********************************************\
+         * Fun18 Sec03 Sub04:
+         *   - check insertion cases
+         *   o insertion is interned in the arena for the
+         *     reference base after it
+         \***********************************************/
 
-      percSupF = (float) conNtAryST[uiBase].numGSI;
-      percSupF /= (float) nonMaskBaseUI;
+         case 'I':
+         /*Case: Insertions*/
+            lenInsSI = samSTPtr->cigArySI[uiCig];
 
-      if(
-           conNtAryST[uiBase].numGSI
-         < settings->minPrintDepthSI
-      ) ;
+            endCigUI =
+               uiBase + samSTPtr->cigArySI[uiCig];
 
-      else if(percSupF >= settings->printMinSupSnpF)
-      { /*If: I had enough support to print an G*/
-         fprintf(
-            outFILE,
-            "%s\t%i\tbase\tG\t%i\t%f\t%u\t%i\t%u%s",
-            refIdStr,
-            uiBase + 1,
-            conNtAryST[uiBase].numGSI,
-            percSupF,
-            maskedBasesUI,
-            conNtAryST[uiBase].ntKeptSI,
-            conNtAryST[uiBase].totalNtSI,
-            str_endLine
-         );
-      } /*If: I had enough support to print an G*/
+            if(uiRef < startUI)
+            { /*If: insertion is before the window*/
+               uiBase = endCigUI;
+               break;
+            } /*If: insertion is before the window*/
+
+            if(
+               addIns_insArena_tbCon(
+                  arena_pile_tbCon(pileSTPtr, uiRef),
+                  &pileSTPtr->insArySI[uiRef],
+                  samSTPtr,
+                  uiBase,
+                  lenInsSI,
+                  settings
+               )
+            ) goto memErr_fun18_sec04;
+
+            uiBase = endCigUI;
+            break;
+         /*Case: Insertions*/
 
-      /**************************************************\
-      * Fun15 Sec03 Sub06:
-      *   - Print out the deletion entry
-      \**************************************************/
+         /***********************************************\
+         * Fun18 Sec03 Sub05:
+         *   - Handle softmasking
+         \***********************************************/
 
-      if(
-           conNtAryST[uiBase].numDelSI
-         > settings->minPrintDepthSI
-      ){ /*If: The a base has enough depth*/
-         percSupF = (float) conNtAryST[uiBase].numDelSI;
+         case 'S':
+         /*Case: soft masking*/
+            endCigUI = uiBase + samSTPtr->cigArySI[uiCig];
 
-         percSupF /=
-            (float) conNtAryST[uiBase].ntKeptSI;
+            while(uiBase < endCigUI)
+               ++uiBase;
 
-         if(percSupF >= settings->printMinSupDelF)
-            fprintf(
-               outFILE,
-               "%s\t%i\tdel\tdel\t%i\t%f\t%u\t%i\t%u%s",
-               refIdStr,
-               uiBase + 1,
-               conNtAryST[uiBase].numDelSI,
-               percSupF,
-               maskedBasesUI,
-               conNtAryST[uiBase].ntKeptSI,
-               conNtAryST[uiBase].totalNtSI,
-               str_endLine
-            );
-      } /*If: The a base has enough depth*/
-   } /*Loop: Print out the consensus*/
+            break;
+         /*Case: soft masking*/
+
+         /*Other cases invovle hard masking*/
+      } /*Switch: Check the cigar entry type*/
+   } /*Loop: Add bases to the consensus*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun15 Sec04:
+   ^ Fun18 Sec04:
    ^   - clean up and return
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    errSC = 0;
-   goto cleanUp_fun15_sec04;
+   goto cleanUp_fun18_sec04;
 
-   noFile_fun15_sec04:;
-      errSC = def_noMap_tbConDefs;
-      goto cleanUp_fun15_sec04;
+   memErr_fun18_sec04:;
+   errSC = def_memErr_tbConDefs;
+   goto cleanUp_fun18_sec04;
 
-   fileErr_fun15_sec04:;
-      errSC = def_fileErr_tbConDefs;
-      goto cleanUp_fun15_sec04;
+   cleanUp_fun18_sec04:;
+   return errSC;
+}/*addReadWin_tbCon*/
 
-   cleanUp_fun15_sec04:;
-      if(outFILE != stdout)
-         fclose(outFILE);
-      outFILE = 0;
+/*-------------------------------------------------------\
+| Fun19: bestIns_tbCon
+|   - finds the insertion with the most support at a
+|     reference base
+| Input:
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct with the insertions
+|   - posUI:
+|     o reference base (index 0) to get insertion for
+| Output:
+|   - Returns:
+|     o pointer to the ins_tbCon struct with the most
+|       support (first seen insertion for ties)
+|       * use insStr_pile_tbCon to get the sequence
+|     o 0 if the base has no insertions
+\-------------------------------------------------------*/
+struct ins_tbCon *
+bestIns_tbCon(
+   struct pile_tbCon *pileSTPtr,
+   unsigned int posUI
+){
+   struct insArena_tbCon *arenaSTPtr =
+      arena_pile_tbCon(pileSTPtr, posUI);
+   struct ins_tbCon *bestInsST = 0;
+   signed int siIns = pileSTPtr->insArySI[posUI];
 
-      return errSC;
-} /*pConBasAry*/
+   while(siIns >= 0)
+   { /*Loop: Find the most supported insertion*/
+      if(
+            ! bestInsST
+         ||   bestInsST->numHitsSI
+            < arenaSTPtr->insAryST[siIns].numHitsSI
+      ) bestInsST = &arenaSTPtr->insAryST[siIns];
+
+      siIns = arenaSTPtr->insAryST[siIns].nextSI;
+   } /*Loop: Find the most supported insertion*/
+
+   return bestInsST;
+} /*bestIns_tbCon*/
 
 /*=======================================================\
 : License:
@@ -1,53 +1,68 @@
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' tbCon SOF: Start Of File
 '  - holds functions to make a quick consensus, more like
-'    ivar. this is a bit memory intensive,
-'    (40 + # insertions * (17) + bases in insertions)
-'    bytes 
+'    ivar. the pileup is a struct of arrays, so it is
+'    (36 + 16 * # insertions) bytes per base plus the
+'    unique insertion sequences (interned)
 '   o header:
 '     - Included libraries
-'   o .h st01: insBase
-'     - structure to hold an list of insetions for a
-'       single position
-'   o .h st02: conNt_tbCon
-'     - structure to hold an single base in a sequence
-'   o .h st03: set_tbCon
+'   o .h st01: ins_tbCon
+'     - counts reads supporting one insertion at a single
+'       position (in an insArena_tbCon struct)
+'   o .h st02: insArena_tbCon
+'     - holds the insertions and the interned insertion
+'       sequences for a set of pileup blocks
+'   o .h st03: pile_tbCon
+'     - pileup (struct of arrays) for a reference
+'   o .h st04: set_tbCon
 '     - holds the settings for tbCon
-'   o fun01: initInsBase
-'     - initializes an initBase structure
-'   o fun02: mkIns_tbCon
-'     - makes and initializes an ins_tbCon structure
-'   o fun03: freeHeap_ins_tbCon
-'     - Frees an heap allocated insBase structure
-'   o fun04: blank_conNt_tbCon
-'     - sets all variables in conNt_tbCon structure to 0
-'   o fun05: init_conNt_tbCon
-'     - initializes a conNt_tbCon structure
-'   o fun06: mk_conNt_tbCon
-'     - Makes an initialized, heap allocated conNt_tbCon
-'       structure
-'   o fun07: freeStack_conNt_tbCon
-'     - frees heap allocated variables in a conNt_tbCon
-'       structure (also initializes structure)
-'   o fun08: freeHeap_conNt_tbCon
-'     - frees a conNt_tbCon structure
-'   o fun09: freeHeapAry_conNt_tbCon
-'     - frees array of heap allocated conNt_tbCon structs
+'   o fun01: init_insArena_tbCon
+'     - initializes an insArena_tbCon struct
+'   o fun02: freeStack_insArena_tbCon
+'     - frees variables in an insArena_tbCon struct
+'   o .c fun03: addIns_insArena_tbCon
+'     - adds an insertion from a read to the insertion
+'       list of one reference base
+'   o fun04: blank_pile_tbCon
+'     - sets all counts in a pile_tbCon struct to 0 and
+'       removes all insertions
+'   o fun05: init_pile_tbCon
+'     - initializes a pile_tbCon struct
+'   o fun06: setup_pile_tbCon
+'     - allocates the insertion arenas for a pile_tbCon
+'       struct
+'   o fun07: freeStack_pile_tbCon
+'     - frees variables in a pile_tbCon struct
+'   o fun08: freeHeap_pile_tbCon
+'     - frees a pile_tbCon struct
+'   o fun09: freeHeapAry_pile_tbCon
+'     - frees an array of pile_tbCon structs
 '   o fun10: init_set_tbCon
 '     - initialize a set_tbCon struct to default settings
 '   o fun11: freeStack_set_tbCon
 '     - frees variables inside a set_tbCon struct
 '   o fun12: addRead_tbCon
-'     - adds read to a conNt_tbCon array
+'     - adds read to a pile_tbCon struct
 '   o fun13: collapse_tbCon
-'     - Collapses a conNt_tbCon array into an array of
+'     - Collapses a pile_tbCon struct into an array of
 '       samEntry structures
 '   o fun14: noFragCollapse_tbCon
-'     - collapses a conNt_tbCon struct array into a single
+'     - collapses a pile_tbCon struct into a single
 '       samEntry struct (low read depth is masked)
 '   o fun15: pvar_tbCon
-'     - print entries in a conNt_tbCon structure array
-'       that are above the minimum read depth
+'     - print entries in a pile_tbCon struct that are
+'       above the minimum read depth
+'   o fun16: chkRead_tbCon
+'     - checks if a read can be added to a consensus
+'   o fun17: realloc_pile_tbCon
+'     - makes sure a pile_tbCon struct covers a reference
+'       position (allocates or resizes)
+'   o fun18: addReadWin_tbCon
+'     - adds the part of a read that is in a reference
+'       window to a pile_tbCon struct
+'   o fun19: bestIns_tbCon
+'     - finds the insertion with the most support at a
+'       reference base
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -64,39 +79,91 @@ struct samEntry;
 
 /*Settings for consensus buildiing*/
 
+#define def_blockLen_tbCon 4096
+   /*bases in one pileup block; insertions in a block
+   `  are in arena block % numArenaSI (one arena for each
+   `  thread adding reads)
+   */
+
 /*-------------------------------------------------------\
 | ST01: ins_tbCon
-|   - Structure to hold an list of insetions for a single
-|     position
+|   - counts reads supporting one insertion at a single
+|     position (in an insArena_tbCon struct)
 \-------------------------------------------------------*/
 typedef struct ins_tbCon{
-   signed char *insStr;  /*c-string with insertion*/
+   unsigned int seqUI;   /*insertion start in arena seqStr*/
    signed int lenInsSI;  /*length of insertion*/
    signed int numHitsSI; /*number reads supporting a ins*/
-
-   struct ins_tbCon *nextIns; /*Next insertion*/
+   signed int nextSI;    /*next insertion at position*/
+      /*index in insAryST; -1 for last insertion*/
 }ins_tbCon;
 
 /*-------------------------------------------------------\
-| ST02: conNt_tbCon
-|   - Structure to hold an single base in a sequence
+| ST02: insArena_tbCon
+|   - holds the insertions and the interned insertion
+|     sequences for a set of pileup blocks
 \-------------------------------------------------------*/
-typedef struct conNt_tbCon{
-   signed int numASI;     /*number reads supporting a*/
-   signed int numTSI;     /*number reads supporting t*/
-   signed int numCSI;     /*number reads supporting c*/
-   signed int numGSI;     /*number reads supporting g*/
-   signed int numDelSI;   /*number reads supporting del*/
+typedef struct insArena_tbCon{
+   struct ins_tbCon *insAryST; /*insertions (all bases)*/
+   signed int lenInsSI;        /*insertions in insAryST*/
+   signed int sizeInsSI;       /*size of insAryST*/
 
-   signed int numInsSI;   /*number reads supporting ins*/
-   struct ins_tbCon *insList; /*List of insertions*/
+   /*unique insertion sequences (each ends with '\0')*/
+   signed char *seqStr;        /*insertion sequences*/
+   unsigned int lenSeqUI;      /*bytes used in seqStr*/
+   unsigned int sizeSeqUI;     /*size of seqStr*/
 
-   signed int totalNtSI;  /*reads supporting position*/
-   signed int ntKeptSI;   /*reads above min q-score*/
-}conNt_tbCon;
+   /*hash table (open addressing) for interning; has the
+   `  start of a sequence in seqStr (0 is an empty slot)
+   */
+   unsigned int *hashAryUI;
+   signed int numSeqSI;        /*sequences in hashAryUI*/
+   signed int sizeHashSI;      /*size of hashAryUI (2^n)*/
+}insArena_tbCon;
 
 /*-------------------------------------------------------\
-| ST03: set_tbCon
+| ST03: pile_tbCon
+|   - pileup (struct of arrays) for a reference; index
+|     is the reference position
+\-------------------------------------------------------*/
+typedef struct pile_tbCon{
+   signed int *numAArySI;     /*number reads supporting a*/
+   signed int *numTArySI;     /*number reads supporting t*/
+   signed int *numCArySI;     /*number reads supporting c*/
+   signed int *numGArySI;     /*number reads supporting g*/
+   signed int *numDelArySI;   /*number reads support del*/
+
+   signed int *numInsArySI;   /*number reads support ins*/
+   signed int *insArySI;      /*first insertion at base*/
+      /*index in arena insAryST; -1 for no insertions*/
+
+   signed int *totalNtArySI;  /*reads supporting position*/
+   signed int *ntKeptArySI;   /*reads above min q-score*/
+
+   unsigned int lenUI;        /*number bases in pileup*/
+
+   struct insArena_tbCon *arenaAryST; /*insertions*/
+   signed int numArenaSI;     /*number of arenas*/
+}pile_tbCon;
+
+/*insertion arena a reference base is in*/
+#define arena_pile_tbCon(pileSTPtr, posUI) \
+   ( \
+      &(pileSTPtr)->arenaAryST[ \
+           ((posUI) / def_blockLen_tbCon) \
+         % (unsigned int) (pileSTPtr)->numArenaSI \
+      ] \
+   )
+
+/*sequence of an insertion at a reference base*/
+#define insStr_pile_tbCon(pileSTPtr, posUI, insSTPtr) \
+   ( \
+        arena_pile_tbCon((pileSTPtr), (posUI))->seqStr \
+      + (insSTPtr)->seqUI \
+   )
+
+/*-------------------------------------------------------\
+| ST04: set_tbCon
 |   - Structure to hold settings for tbCon
 \-------------------------------------------------------*/
 typedef struct set_tbCon{
@@ -122,129 +189,148 @@ typedef struct set_tbCon{
 }set_tbCon;
 
 /*-------------------------------------------------------\
-| Fun02: mkIns_tbCon
-|   - makes and initializes an ins_tbCon structure
+| Fun01: init_insArena_tbCon
+|   - initializes an insArena_tbCon struct
 | Input:
+|   - arenaSTPtr:
+|     o pointer to an insArena_tbCon struct to initialize
 | Output:
-|   - Returns:
-|     o pointer to initialized ins_tbCon structure
-|     o 0 for memory errors
+|   - Modifies:
+|     o all values (including pointers) in arenaSTPtr to
+|       be 0
 \-------------------------------------------------------*/
-struct ins_tbCon *
-mkIns_tbCon(
-   void
+void
+init_insArena_tbCon(
+   struct insArena_tbCon *arenaSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun03: freeHeap_ins_tbCon
-|   - frees heap allocated insBase structure
+| Fun02: freeStack_insArena_tbCon
+|   - frees heap allocated variables in an insArena_tbCon
+|     struct (also initializes struct)
 | Input:
-|   - insSTPtr:
-|     o pointer to insBase structure to free
+|   - arenaSTPtr:
+|     o pointer to insArena_tbCon struct to free variables
 | Output:
 |   - Frees:
-|     o insSTPtr
-|   - Returns:
-|     o next insBase structure (nextIns) in insBase list
+|     o insAryST, seqStr, and hashAryUI in arenaSTPtr
+|   - Sets:
+|     o all values in arenaSTPtr to 0
 \-------------------------------------------------------*/
-struct ins_tbCon *
-freeHeap_ins_tbCon(
-   struct ins_tbCon *insSTPtr
+void
+freeStack_insArena_tbCon(
+   struct insArena_tbCon *arenaSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun04: blank_conNt_tbCon
-|   - sets all variables in conNt_tbCon structure to 0
+| Fun04: blank_pile_tbCon
+|   - sets all counts in a pile_tbCon struct to 0 and
+|     removes all insertions (memory is kept)
 | Input:
-|   - conNtSTPtr:
-|     o pointer to conNt_tbCon structure to blank
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to blank
 | Output:
 |   - Modifies:
-|     o all non-pointer values in conNtSTPtr to be 0
+|     o all counts in pileSTPtr to be 0
+|     o insArySI in pileSTPtr to be -1 (no insertions)
+|     o lengths in arenaAryST to be 0 and clears the hash
+|       tables
 \-------------------------------------------------------*/
 void
-blank_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+blank_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun05: init_conNt_tbCon
-|   - initializes a conNt_tbCon structure
+| Fun05: init_pile_tbCon
+|   - initializes a pile_tbCon struct
 | Input:
-|   - conNtSTPtr:
-|     o pointer to an conNt_tbCon structure to initialize
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to initialize
 | Output:
 |   - Modifies:
-|     o all values (including pointers) in conNtSTPtr to
+|     o all values (including pointers) in pileSTPtr to
 |       be 0
 \-------------------------------------------------------*/
 void
-init_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+init_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun06: mk_conNt_tbCon
-|   - makes initialized, heap allocated conNt_tbCon struct
+| Fun06: setup_pile_tbCon
+|   - allocates the insertion arenas for a pile_tbCon
+|     struct
 | Input:
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to set up
+|   - numArenaSI:
+|     o number of insertion arenas to use; use the number
+|       of threads that add reads at the same time
+|     o block (position / def_blockLen_tbCon) uses arena
+|       block % numArenaSI
 | Output:
+|   - Modifies:
+|     o arenaAryST and numArenaSI in pileSTPtr to have
+|       numArenaSI initialized arenas
 |   - Returns:
-|     o pointer to an initialized conNt_tbCon structure
-|     o 0 for memory errors
+|     o 0 for no errors
+|     o def_memErr_tbConDefs for memory errors
 \-------------------------------------------------------*/
-struct conNt_tbCon *
-mk_conNt_tbCon(
-   void
+signed char
+setup_pile_tbCon(
+   struct pile_tbCon *pileSTPtr,
+   signed int numArenaSI
 );
 
 /*-------------------------------------------------------\
-| Fun07: freeStack_conNt_tbCon
-|   - frees heap allocated variables in a conNt_tbCon
-|     structure (also initializes structure)
+| Fun07: freeStack_pile_tbCon
+|   - frees heap allocated variables in a pile_tbCon
+|     struct (also initializes struct)
 | Input:
-|   - conNtSTPtr:
-|     o pointer to conNt_tbCon struct to free variables
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to free variables
 | Output:
 |   - Frees:
-|     o frees the conNt_tbConST->insList 
+|     o count arrays and insertion arenas in pileSTPtr
 |   - Sets:
-|     o all values in conNt_tbConSTPTr to 0
+|     o all values in pileSTPtr to 0
 \-------------------------------------------------------*/
 void
-freeStack_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+freeStack_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun08: freeHeap_conNt_tbCon
-|   - Frees a conNt_tbCon structure
+| Fun08: freeHeap_pile_tbCon
+|   - frees a pile_tbCon struct
 | Input:
-|   - conNtSTPtr:
-|     o pointer toa conNt_tbCon structure to free
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to free
 | Output:
 |   - Frees:
-|     o frees conNt_tbConST
+|     o pileSTPtr (you must set to 0/null)
 \-------------------------------------------------------*/
 void
-freeHeap_conNt_tbCon(
-   struct conNt_tbCon *conNtSTPtr
+freeHeap_pile_tbCon(
+   struct pile_tbCon *pileSTPtr
 );
 
 /*-------------------------------------------------------\
-| Fun09: freeHeapAry_conNt_tbCon
-|   - frees array of heap allocated conNt_tbCon structs
+| Fun09: freeHeapAry_pile_tbCon
+|   - frees an array of pile_tbCon structs
 | Input:
-|   - conNtAryST:
-|     o pointer conNt_tbCon struct array to free
+|   - pileAryST:
+|     o pointer to pile_tbCon struct array to free
 |   - lenArySI:
-|     o number of conNt_tbCon structurs in array
+|     o number of pile_tbCon structs in the array
 | Output:
 |   - Frees:
-|     o array in conNtSTPtr
+|     o pileAryST (you must set to 0/null)
 \-------------------------------------------------------*/
 void
-freeHeapAry_conNt_tbCon(
-   struct conNt_tbCon *conNtAryST,
+freeHeapAry_pile_tbCon(
+   struct pile_tbCon *pileAryST,
    signed int lenArySI
 );
 
@@ -281,47 +367,44 @@ freeStack_set_tbCon(
 
 /*-------------------------------------------------------\
 | Fun12: addRead_tbCon
-|   - adds read to a conNt_tbCon array
+|   - adds read to a pile_tbCon struct
 | Input:
 |   - sameEntrySTPtr:
 |     o pointer to a samEntry struct with read to add
-|   - conNtAryST:
-|     o pointer to conNt_tbCon struct array to add read to
-|     o the array is resize if to small
-|   - lenRefUI:
-|     o length of the reference sequence; use 0 for unkown
-|     o is updated as conNt_tbConSTAry expands
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to add read to
+|     o the pileup is resized if to small
+|     o set lenUI to the reference length before the
+|       first read (0 for unkown)
 |   - settings:
 |     o pointer to set_tbCon struct with settings
 | Output:
 |   - Modifies:
-|     o conNtAryST to have new read
-|     o lenRefUI to have new conNtAryST size if conNtAryST
-|       is resized
+|     o pileSTPtr to have new read
+|     o lenUI in pileSTPtr to have new pileup length if
+|       the pileup is resized
 |   - Returns:
 |     o for no errors
 |     o def_header_tbConDefs for sam file header entry
 |     o def_noMap_tbConDefs for an unmapped read
 |     o def_noSeq_tbConDefs for a read missing a sequence
+|     o def_lowMapq_tbConDefs for low mapping qualities
 |     o def_memErr_tbConDefs for memory errors
 \-------------------------------------------------------*/
 signed char
 addRead_tbCon(
    struct samEntry *samSTPtr, /*read to add to consensus*/
-   struct conNt_tbCon *conNtAryST[], /*Consensus array*/
-   unsigned int *lenRefUI,       /*Length of reference*/
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
    struct set_tbCon *settings
 );
 
 /*-------------------------------------------------------\
 | Fun13: collapse_tbCon
-|   - collapses a conNt_tbCon strrucvt array into an array
-|     of samEntry structs
+|   - collapses a pile_tbCon struct into an array of
+|     samEntry structs
 | Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon struct array to collapse
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to collapse
 |   - lenSamArySI:
 |     o pointer to integer to have number of samEntry
 |       structures made
@@ -349,8 +432,7 @@ addRead_tbCon(
 \-------------------------------------------------------*/
 struct samEntry *
 collapse_tbCon(
-   struct conNt_tbCon conNtAryST[], /*to collapse*/
-   unsigned int lenConAryUI,   /*length of consensus*/
+   struct pile_tbCon *pileSTPtr, /*to collapse*/
    signed int *lenSamArySI,    /*set to out array length*/
    signed char *refIdStr,      /*name of reference seq*/
    struct set_tbCon *settings, /*settings for collapsing*/
@@ -359,16 +441,14 @@ collapse_tbCon(
 
 /*-------------------------------------------------------\
 | Fun14: noFragCollapse_tbCon
-|   - collapses a conNt_tbCon struct array into a single
+|   - collapses a pile_tbCon struct into a single
 |     samEntry struct (low read depth is masked)
 | Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon struct array to collapse
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to collapse
 |   - refIdStr:
 |     o c-string with referernce sequence name
-|   - numMaskUIPtr:
+|   - maskCntUIPtr:
 |     o pointer to unsigned int to have number of bases
 |       masked in consensus
 |   - settings:
@@ -380,7 +460,7 @@ collapse_tbCon(
 |   - Modifies:
 |     o lenSamST to hold the returned samEntry arrray
 |       length
-|     o numMaskUIPtr to have number of masked bases
+|     o maskCntUIPtr to have number of masked bases
 |     o errSC:
 |       - 0 for no errors
 |       - def_noSeq_tbConDefs if could not build consensus
@@ -394,23 +474,20 @@ collapse_tbCon(
 \-------------------------------------------------------*/
 struct samEntry *
 noFragCollapse_tbCon(
-   struct conNt_tbCon conNtAryST[], /*to collapse*/
-   unsigned int lenConAryUI,   /*length of consensus*/
+   struct pile_tbCon *pileSTPtr, /*to collapse*/
    signed char *refIdStr,      /*name of reference seq*/
-   unsigned int *numMaskUIPtr, /*# bases masked*/
+   unsigned int *maskCntUIPtr, /*# bases masked*/
    struct set_tbCon *settings, /*settings for collapsing*/
    signed char *errSC          /*error reports*/
 );
 
 /*-------------------------------------------------------\
 | Fun15: pvar_tbCon
-|   - Print entries in a conNt_tbCon structure array that
-|     are above the minimum read depth
+|   - print entries in a pile_tbCon struct that are above
+|     the minimum read depth
 | Input:
-|   - conNtAryST:
-|     o pointer to a conNt_tbCon structure array to print
-|   - lenConAryUI:
-|     o length of the conNt_tbCon array
+|   - pileSTPtr:
+|     o pointer to a pile_tbCon struct to print
 |   - minDepthSI:
 |     o minimum read depth to print out a position
 |   - refIdStr:
@@ -419,20 +496,138 @@ noFragCollapse_tbCon(
 |     o c-string with name of file to print everything to
 | Output:
 |   - Prints:
-|     o entries in conNtAryST to outFILE
+|     o entries in pileSTPtr to outFILE
 |   - Returns:
 |     o 0 for success
 |     o def_fileErr_tbConDefs for file errors
+|     o def_noMap_tbConDefs if pileSTPtr has no reads
 \-------------------------------------------------------*/
 char
 pvar_tbCon(
-   struct conNt_tbCon conNtAryST[], /*consensus array*/
-   unsigned int lenConAryUI,     /*length of conNtAryST*/
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
    signed char *refIdStr,        /*name of reference seq*/
    struct set_tbCon *settings,   /*settings for printing*/
    signed char *outStr           /*file to print to*/
 );
 
+/*-------------------------------------------------------\
+| Fun16: chkRead_tbCon
+|   - checks if a read can be added to a consensus
+| Input:
+|   - samSTPtr:
+|     o pointer to a samEntry struct with read to check
+|   - settings:
+|     o pointer to set_tbCon struct with settings
+| Output:
+|   - Returns:
+|     o 0 if the read can be added
+|     o def_header_tbConDefs for sam file header entry
+|     o def_noMap_tbConDefs for an unmapped read
+|     o def_noSeq_tbConDefs for a read missing a sequence
+|     o def_lowMapq_tbConDefs for low mapping qualities
+\-------------------------------------------------------*/
+signed char
+chkRead_tbCon(
+   struct samEntry *samSTPtr,
+   struct set_tbCon *settings
+);
+
+/*-------------------------------------------------------\
+| Fun17: realloc_pile_tbCon
+|   - makes sure a pile_tbCon struct covers a reference
+|     position (allocates or resizes)
+| Input:
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct to resize
+|     o lenUI is the length of the reference for new
+|       pileups; use 0 for unkown
+|   - endUI:
+|     o last reference position (index 0) the pileup must
+|       have (ex: refEndUI in a samEntry struct)
+| Output:
+|   - Modifies:
+|     o count arrays in pileSTPtr to have at least
+|       endUI + 1 bases; new bases are set to 0 (no
+|       insertions)
+|     o lenUI in pileSTPtr to have the new length if the
+|       arrays are resized
+|     o arenaAryST in pileSTPtr to have one arena if
+|       setup_pile_tbCon was not called
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_tbConDefs for memory errors
+\-------------------------------------------------------*/
+signed char
+realloc_pile_tbCon(
+   struct pile_tbCon *pileSTPtr, /*pileup to resize*/
+   unsigned int endUI             /*last base to hold*/
+);
+
+/*-------------------------------------------------------\
+| Fun18: addReadWin_tbCon
+|   - adds the part of a read that is in a reference
+|     window to a pile_tbCon struct
+|   - windows can be added to the same pileup at the same
+|     time (one thread per window) if they do not overlap
+|     and use different insertion arenas (blocks of
+|     def_blockLen_tbCon bases; arena_pile_tbCon)
+| Input:
+|   - samSTPtr:
+|     o pointer to a samEntry struct with read to add
+|   - pileSTPtr:
+|     o pile_tbCon struct to add read to
+|     o must already cover the read (realloc_pile_tbCon)
+|   - startUI:
+|     o first reference position (index 0) in window
+|   - endUI:
+|     o first reference position after the window
+|   - settings:
+|     o pointer to set_tbCon struct with settings
+| Output:
+|   - Modifies:
+|     o pileSTPtr to have the read bases, deletions, and
+|       insertions that are in [startUI, endUI)
+|       * insertions belong to the reference base after
+|         the insertion
+|   - Returns:
+|     o for no errors
+|     o def_header_tbConDefs for sam file header entry
+|     o def_noMap_tbConDefs for an unmapped read
+|     o def_noSeq_tbConDefs for a read missing a sequence
+|     o def_lowMapq_tbConDefs for low mapping qualities
+|     o def_memErr_tbConDefs for memory errors
+\-------------------------------------------------------*/
+signed char
+addReadWin_tbCon(
+   struct samEntry *samSTPtr, /*read to add to consensus*/
+   struct pile_tbCon *pileSTPtr, /*consensus pileup*/
+   unsigned int startUI,      /*first base in window*/
+   unsigned int endUI,        /*first base after window*/
+   struct set_tbCon *settings
+);
+
+/*-------------------------------------------------------\
+| Fun19: bestIns_tbCon
+|   - finds the insertion with the most support at a
+|     reference base
+| Input:
+|   - pileSTPtr:
+|     o pointer to pile_tbCon struct with the insertions
+|   - posUI:
+|     o reference base (index 0) to get insertion for
+| Output:
+|   - Returns:
+|     o pointer to the ins_tbCon struct with the most
+|       support (first seen insertion for ties)
+|       * use insStr_pile_tbCon to get the sequence
+|     o 0 if the base has no insertions
+\-------------------------------------------------------*/
+struct ins_tbCon *
+bestIns_tbCon(
+   struct pile_tbCon *pileSTPtr,
+   unsigned int posUI
+);
+
 #endif
 
 /*=======================================================\
@@ -0,0 +1,432 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' memTag SOF: Start Of File
+'   - optional tagged malloc wrappers that count the bytes
+'     each subsystem (tag) has allocated
+'   o header:
+'     - included libraries and the counters
+'   o .c st01: head_memTag
+'     - header put before each block to hold its size
+'   o .c fun01: add_memTag
+'     - adds (or removes) bytes from a tags count
+'   o fun02: malloc_memTag
+'     - allocates memory and counts it to a tag
+'   o fun03: calloc_memTag
+'     - allocates zeroed memory and counts it to a tag
+'   o fun04: realloc_memTag
+'     - resizes memory from a memTag function
+'   o fun05: free_memTag
+'     - frees memory from a memTag function
+'   o fun06: resize_memTag
+'     - counts a buffer changing size (no allocation)
+'   o fun07: pReport_memTag
+'     - prints the peak bytes for each tag
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries and the counters
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "memTag.h"
+
+/*the counters are globals, so this is not thread safe;
+`  all programs using it are single threaded
+*/
+unsigned long curBytesAryUL_memTag[def_numTags_memTag];
+unsigned long peakBytesAryUL_memTag[def_numTags_memTag];
+unsigned long allocsAryUL_memTag[def_numTags_memTag];
+unsigned long curAllUL_memTag = 0;  /*all tags now*/
+unsigned long peakAllUL_memTag = 0; /*all tags peak*/
+
+signed char *tagStrAry_memTag[def_numTags_memTag] =
+{
+   (signed char *) "seqST",
+   (signed char *) "refST_kmerFind",
+   (signed char *) "tblST_kmerFind",
+   (signed char *) "rows_memwaterScan",
+   (signed char *) "hits_memwaterScan",
+   (signed char *) "seedScan"
+};
+
+#ifdef MEMTAG
+
+/*-------------------------------------------------------\
+| ST01: head_memTag
+|   - header put before each block to hold its size
+|   - the union keeps the returned memory aligned for
+|     any type (same as malloc)
+\-------------------------------------------------------*/
+typedef union head_memTag
+{
+   struct
+   {
+      unsigned long sizeUL; /*bytes user asked for*/
+      unsigned char tagUC;  /*tag bytes counted to*/
+   }infoST;
+
+   long double alignLDbl;   /*only for alignment*/
+   void *alignPtr;          /*only for alignment*/
+}head_memTag;
+
+/*-------------------------------------------------------\
+| Fun01: add_memTag
+|   - adds (or removes) bytes from a tags count
+| Input:
+|   - sizeUL:
+|     o number of bytes to add or remove
+|   - tagUC:
+|     o tag to add bytes to
+|   - addBl:
+|     o 1: add bytes (new allocation)
+|     o 0: remove bytes (freed)
+| Output:
+|   - Modifies:
+|     o curBytesAryUL_memTag[tagUC] and curAllUL_memTag
+|     o peakBytesAryUL_memTag[tagUC] and peakAllUL_memTag
+|       if the current bytes are a new peak
+\-------------------------------------------------------*/
+void
+add_memTag(
+   unsigned long sizeUL,
+   unsigned char tagUC,
+   signed char addBl
+){
+   if(tagUC >= def_numTags_memTag)
+      return; /*unknown tag; should never happen*/
+
+   if(! addBl)
+   { /*If: removing bytes*/
+      curBytesAryUL_memTag[tagUC] -= sizeUL;
+      curAllUL_memTag -= sizeUL;
+      return;
+   } /*If: removing bytes*/
+
+   curBytesAryUL_memTag[tagUC] += sizeUL;
+   curAllUL_memTag += sizeUL;
+   ++allocsAryUL_memTag[tagUC];
+
+   if(
+        curBytesAryUL_memTag[tagUC]
+      > peakBytesAryUL_memTag[tagUC]
+   ) peakBytesAryUL_memTag[tagUC] =
+        curBytesAryUL_memTag[tagUC];
+
+   if(curAllUL_memTag > peakAllUL_memTag)
+      peakAllUL_memTag = curAllUL_memTag;
+} /*add_memTag*/
+
+/*-------------------------------------------------------\
+| Fun02: malloc_memTag
+|   - allocates memory and counts it to a tag
+| Input:
+|   - sizeUL:
+|     o number of bytes to allocate
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the allocated memory; only free this
+|       with free_memTag or resize with realloc_memTag
+|     o 0 for memory errors
+\-------------------------------------------------------*/
+void *
+malloc_memTag(
+   unsigned long sizeUL,
+   unsigned char tagUC
+){
+   union head_memTag *headST =
+      malloc(sizeof(union head_memTag) + sizeUL);
+
+   if(! headST)
+      return 0;
+
+   headST->infoST.sizeUL = sizeUL;
+   headST->infoST.tagUC = tagUC;
+   add_memTag(sizeUL, tagUC, 1);
+
+   return headST + 1;
+} /*malloc_memTag*/
+
+/*-------------------------------------------------------\
+| Fun03: calloc_memTag
+|   - allocates zeroed memory and counts it to a tag
+| Input:
+|   - numUL:
+|     o number of items to allocate
+|   - sizeUL:
+|     o size of one item in bytes
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the zeroed memory; only free this
+|       with free_memTag or resize with realloc_memTag
+|     o 0 for memory errors
+\-------------------------------------------------------*/
+void *
+calloc_memTag(
+   unsigned long numUL,
+   unsigned long sizeUL,
+   unsigned char tagUC
+){
+   union head_memTag *headST =
+      calloc(
+         1,
+         sizeof(union head_memTag) + (numUL * sizeUL)
+      );
+
+   if(! headST)
+      return 0;
+
+   headST->infoST.sizeUL = numUL * sizeUL;
+   headST->infoST.tagUC = tagUC;
+   add_memTag(numUL * sizeUL, tagUC, 1);
+
+   return headST + 1;
+} /*calloc_memTag*/
+
+/*-------------------------------------------------------\
+| Fun04: realloc_memTag
+|   - resizes memory from a memTag function
+| Input:
+|   - memPtr:
+|     o pointer from malloc_memTag, calloc_memTag, or
+|       realloc_memTag to resize
+|     o 0 to allocate new memory (as malloc_memTag)
+|   - sizeUL:
+|     o new size in bytes
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the resized memory
+|     o 0 for memory errors (memPtr is not freed)
+\-------------------------------------------------------*/
+void *
+realloc_memTag(
+   void *memPtr,
+   unsigned long sizeUL,
+   unsigned char tagUC
+){
+   union head_memTag *headST = 0;
+   unsigned long oldSizeUL = 0;
+   unsigned char oldTagUC = 0;
+
+   if(! memPtr)
+      return malloc_memTag(sizeUL, tagUC);
+
+   headST = ((union head_memTag *) memPtr) - 1;
+   oldSizeUL = headST->infoST.sizeUL;
+   oldTagUC = headST->infoST.tagUC;
+
+   headST =
+      realloc(headST, sizeof(union head_memTag) + sizeUL);
+
+   if(! headST)
+      return 0; /*old memory is still counted*/
+
+   add_memTag(oldSizeUL, oldTagUC, 0);
+   add_memTag(sizeUL, tagUC, 1);
+   headST->infoST.sizeUL = sizeUL;
+   headST->infoST.tagUC = tagUC;
+
+   return headST + 1;
+} /*realloc_memTag*/
+
+/*-------------------------------------------------------\
+| Fun05: free_memTag
+|   - frees memory from a memTag function
+| Input:
+|   - memPtr:
+|     o pointer from malloc_memTag, calloc_memTag, or
+|       realloc_memTag to free (0 is ignored)
+| Output:
+|   - Frees:
+|     o memPtr and removes its bytes from its tag
+\-------------------------------------------------------*/
+void
+free_memTag(
+   void *memPtr
+){
+   union head_memTag *headST = 0;
+
+   if(! memPtr)
+      return;
+
+   headST = ((union head_memTag *) memPtr) - 1;
+
+   add_memTag(
+      headST->infoST.sizeUL,
+      headST->infoST.tagUC,
+      0
+   );
+
+   free(headST);
+} /*free_memTag*/
+
+/*-------------------------------------------------------\
+| Fun06: resize_memTag
+|   - counts a buffer changing size (no allocation)
+| Input:
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+|   - oldUL:
+|     o bytes the buffer had (0 if it was not allocated)
+|   - newUL:
+|     o bytes the buffer has now (0 if it was freed)
+| Output:
+|   - Modifies:
+|     o bytes counted to tagUC
+\-------------------------------------------------------*/
+void
+resize_memTag(
+   unsigned char tagUC,
+   unsigned long oldUL,
+   unsigned long newUL
+){
+   if(oldUL == newUL)
+      return; /*buffer was not resized*/
+
+   if(oldUL)
+      add_memTag(oldUL, tagUC, 0);
+
+   if(newUL)
+      add_memTag(newUL, tagUC, 1);
+} /*resize_memTag*/
+
+#endif /*MEMTAG*/
+
+/*-------------------------------------------------------\
+| Fun07: pReport_memTag
+|   - prints the peak bytes for each tag
+| Input:
+|   - progStr:
+|     o c-string with program name to print on each row
+|   - outFILE:
+|     o FILE pointer to print to (use stderr)
+| Output:
+|   - Prints:
+|     o tsv with program, tag, peak bytes, bytes still
+|       allocated, and number of allocations for each
+|       tag to outFILE; the "all" row is the peak of all
+|       tags at once
+|     o nothing if nothing was counted (not compiled
+|       with -DMEMTAG)
+\-------------------------------------------------------*/
+void
+pReport_memTag(
+   signed char *progStr,
+   void *outFILE
+){
+   unsigned char ucTag = 0;
+
+   if(! peakAllUL_memTag)
+      return; /*-DMEMTAG not used or no allocations*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "program\ttag\tpeak_bytes\tend_bytes\tallocs\n"
+   );
+
+   for(ucTag = 0; ucTag < def_numTags_memTag; ++ucTag)
+   { /*Loop: print each tag*/
+      fprintf(
+         (FILE *) outFILE,
+         "%s\t%s\t%lu\t%lu\t%lu\n",
+         (char *) progStr,
+         (char *) tagStrAry_memTag[ucTag],
+         peakBytesAryUL_memTag[ucTag],
+         curBytesAryUL_memTag[ucTag],
+         allocsAryUL_memTag[ucTag]
+      );
+   } /*Loop: print each tag*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "%s\tall\t%lu\t%lu\tNA\n",
+      (char *) progStr,
+      peakAllUL_memTag,
+      curAllUL_memTag
+   );
+} /*pReport_memTag*/
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -0,0 +1,267 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' memTag SOF: Start Of File
+'   - optional tagged malloc wrappers that count the bytes
+'     each subsystem (tag) has allocated
+'   - compile with -DMEMTAG to turn on; otherwise the
+'     wrappers are plain malloc, calloc, realloc, and free
+'   - use the wrappers for memory a module allocates and
+'     frees itself; use resize_memTag to count buffers
+'     other code also grows (getFullLine_fileFun grows
+'     seqST buffers with realloc)
+'   o header:
+'     - guards, tags, and the wrappers for -DMEMTAG off
+'   o .c fun01: add_memTag
+'     - adds (or removes) bytes from a tags count
+'   o fun02: malloc_memTag
+'     - allocates memory and counts it to a tag
+'   o fun03: calloc_memTag
+'     - allocates zeroed memory and counts it to a tag
+'   o fun04: realloc_memTag
+'     - resizes memory from a memTag function
+'   o fun05: free_memTag
+'     - frees memory from a memTag function
+'   o fun06: resize_memTag
+'     - counts a buffer changing size (no allocation)
+'   o fun07: pReport_memTag
+'     - prints the peak bytes for each tag
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards, tags, and the wrappers for -DMEMTAG off
+\-------------------------------------------------------*/
+
+#ifndef MEMORY_TAG_H
+#define MEMORY_TAG_H
+
+/*tags (subsystems) memory is counted to; names are in
+`  tagStrAry_memTag in memTag.c
+*/
+#define def_seqST_memTag 0      /*seqST id/seq/q buffers*/
+#define def_refKmerFind_memTag 1 /*refST_kmerFind arrays*/
+#define def_tblKmerFind_memTag 2 /*tblST_kmerFind tables*/
+#define def_rowMemwaterScan_memTag 3 /*memwaterScan rows*/
+#define def_hitMemwaterScan_memTag 4 /*memwaterScan hits*/
+#define def_seedScan_memTag 5   /*seedScan index/windows*/
+#define def_numTags_memTag 6
+
+#ifndef MEMTAG
+   /*no accounting; use the standard functions directly,
+   `  so the normal build has no overhead
+   */
+   #define malloc_memTag(sizeUL, tagUC) malloc(sizeUL)
+   #define calloc_memTag(numUL, sizeUL, tagUC) \
+      calloc((numUL), (sizeUL))
+   #define realloc_memTag(memPtr, sizeUL, tagUC) \
+      realloc((memPtr), (sizeUL))
+   #define free_memTag(memPtr) free(memPtr)
+
+   /*the casts keep size variables only used here from
+   `  being flagged as set but not used
+   */
+   #define resize_memTag(tagUC, oldUL, newUL) \
+      ((void) (oldUL), (void) (newUL))
+#else
+
+/*-------------------------------------------------------\
+| Fun02: malloc_memTag
+|   - allocates memory and counts it to a tag
+| Input:
+|   - sizeUL:
+|     o number of bytes to allocate
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the allocated memory; only free this
+|       with free_memTag or resize with realloc_memTag
+|     o 0 for memory errors
+\-------------------------------------------------------*/
+void *
+malloc_memTag(
+   unsigned long sizeUL,
+   unsigned char tagUC
+);
+
+/*-------------------------------------------------------\
+| Fun03: calloc_memTag
+|   - allocates zeroed memory and counts it to a tag
+| Input:
+|   - numUL:
+|     o number of items to allocate
+|   - sizeUL:
+|     o size of one item in bytes
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the zeroed memory; only free this
+|       with free_memTag or resize with realloc_memTag
+|     o 0 for memory errors
+\-------------------------------------------------------*/
+void *
+calloc_memTag(
+   unsigned long numUL,
+   unsigned long sizeUL,
+   unsigned char tagUC
+);
+
+/*-------------------------------------------------------\
+| Fun04: realloc_memTag
+|   - resizes memory from a memTag function
+| Input:
+|   - memPtr:
+|     o pointer from malloc_memTag, calloc_memTag, or
+|       realloc_memTag to resize
+|     o 0 to allocate new memory (as malloc_memTag)
+|   - sizeUL:
+|     o new size in bytes
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+| Output:
+|   - Returns:
+|     o pointer to the resized memory
+|     o 0 for memory errors (memPtr is not freed)
+\-------------------------------------------------------*/
+void *
+realloc_memTag(
+   void *memPtr,
+   unsigned long sizeUL,
+   unsigned char tagUC
+);
+
+/*-------------------------------------------------------\
+| Fun05: free_memTag
+|   - frees memory from a memTag function
+| Input:
+|   - memPtr:
+|     o pointer from malloc_memTag, calloc_memTag, or
+|       realloc_memTag to free (0 is ignored)
+| Output:
+|   - Frees:
+|     o memPtr and removes its bytes from its tag
+\-------------------------------------------------------*/
+void
+free_memTag(
+   void *memPtr
+);
+
+/*-------------------------------------------------------\
+| Fun06: resize_memTag
+|   - counts a buffer changing size (no allocation)
+| Input:
+|   - tagUC:
+|     o tag to count the bytes to (def_..._memTag)
+|   - oldUL:
+|     o bytes the buffer had (0 if it was not allocated)
+|   - newUL:
+|     o bytes the buffer has now (0 if it was freed)
+| Output:
+|   - Modifies:
+|     o bytes counted to tagUC
+\-------------------------------------------------------*/
+void
+resize_memTag(
+   unsigned char tagUC,
+   unsigned long oldUL,
+   unsigned long newUL
+);
+
+#endif /*MEMTAG*/
+
+/*-------------------------------------------------------\
+| Fun07: pReport_memTag
+|   - prints the peak bytes for each tag
+| Input:
+|   - progStr:
+|     o c-string with program name to print on each row
+|   - outFILE:
+|     o FILE pointer to print to (use stderr)
+| Output:
+|   - Prints:
+|     o tsv with program, tag, peak bytes, bytes still
+|       allocated, and number of allocations for each
+|       tag to outFILE; the "all" row is the peak of all
+|       tags at once
+|     o nothing if nothing was counted (not compiled
+|       with -DMEMTAG)
+\-------------------------------------------------------*/
+void
+pReport_memTag(
+   signed char *progStr,
+   void *outFILE
+);
+
+#endif
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
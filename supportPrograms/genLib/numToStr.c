@@ -11,6 +11,9 @@
 '     - converts a signed number to a c-string
 '   o fun04: double_numToStr
 '     - converts a double to a c-string
+'   o fun05: fixDbl_numToStr
+'     - converts a double to a c-string with a fixed
+'       number of decimals (same as printf("%0.2f"))
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -330,6 +333,113 @@ double_numToStr(
    return retUI;
 } /*double_numToStr*/
 
+/*-------------------------------------------------------\
+| Fun05: fixDbl_numToStr
+|   - converts a double to a c-string with a fixed
+|     number of decimals (same as printf("%0.2f"))
+| Input:
+|   - cstr:
+|     o c-string to hold the converted number
+|   - numDbl:
+|     o number to convert
+|   - decUC:
+|     o number decimal digits to print; trailing zeros
+|       are kept (max_fixDecimal_numToStr)
+| Output:
+|   - Modifies:
+|     o cstr to have the number (adds a '\0' at the end)
+|   - Returns:
+|     o number of characters copied to cstr
+\-------------------------------------------------------*/
+unsigned int
+fixDbl_numToStr(
+   signed char *cstr,
+   double numDbl,
+   unsigned char decUC
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun05 TOC:
+   '   - converts a double to a c-string with a fixed
+   '     number of decimals
+   '   o fun05 sec01:
+   '     - variable declarations
+   '   o fun05 sec02:
+   '     - split number into whole and rounded decimals
+   '   o fun05 sec03:
+   '     - add whole number and decimals to c-string
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun05 Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   unsigned int retUI = 0;
+   unsigned char ucDec = 0;
+   unsigned long wholeUL = 0; /*non-decimal part*/
+   unsigned long decUL = 0;   /*decimals as whole number*/
+   unsigned long scaleUL = 1; /*10^decUC*/
+   long double decLDbl = 0;   /*decimal fraction*/
+      /*long double keeps the scaled decimals exact on
+      `  most systems, so ties round like printf
+      */
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun05 Sec02:
+   ^   - split number into whole and rounded decimals
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(numDbl < 0)
+   { /*If: negative number*/
+      numDbl *= -1;
+      cstr[retUI++] = '-';
+   } /*If: negative number*/
+
+   if(decUC > max_fixDecimal_numToStr)
+      decUC = max_fixDecimal_numToStr;
+
+   for(ucDec = 0; ucDec < decUC; ++ucDec)
+      scaleUL *= 10;
+
+   wholeUL = (unsigned long) numDbl;
+   decLDbl = (long double) numDbl - wholeUL;
+   decLDbl *= scaleUL;
+   decUL = (unsigned long) decLDbl;
+   decLDbl -= decUL;
+
+   if(decLDbl > 0.5)
+      ++decUL;
+   else if(decLDbl == 0.5 && (decUL & 1))
+      ++decUL; /*printf rounds ties to even*/
+
+   if(decUL >= scaleUL)
+   { /*If: rounding carried into whole number*/
+      decUL -= scaleUL;
+      ++wholeUL;
+   } /*If: rounding carried into whole number*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun05 Sec03:
+   ^   - add whole number and decimals to c-string
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   retUI += numToStr(&cstr[retUI], wholeUL);
+
+   if(decUC)
+   { /*If: printing decimals*/
+      cstr[retUI++] = '.';
+      retUI += decUC;
+
+      for(ucDec = 1; ucDec <= decUC; ++ucDec)
+      { /*Loop: add decimals (backwards)*/
+         cstr[retUI - ucDec] = (decUL % 10) + 48;
+         decUL /= 10;
+      } /*Loop: add decimals (backwards)*/
+   } /*If: printing decimals*/
+
+   cstr[retUI] = '\0';
+   return retUI;
+} /*fixDbl_numToStr*/
+
 /*=======================================================\
 : License:
 : 
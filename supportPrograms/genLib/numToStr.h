@@ -11,6 +11,9 @@
 '     - converts a signed number to a c-string
 '   o fun04: double_numToStr
 '     - converts a double to a c-string
+'   o fun05: fixDbl_numToStr
+'     - converts a double to a c-string with a fixed
+'       number of decimals (same as printf("%0.2f"))
 '   o license:
 '     - licensing for this code (public domain / mit)
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
@@ -25,6 +28,10 @@
 
 #define max_dblDecimal_numToStr 17
    /*maximum percsion of double*/
+#define max_fixDecimal_numToStr 9
+   /*maximum decimals fixDbl_numToStr can print; keeps
+   `  10^decimals in an unsigned long (32 bit windows)
+   */
 
 /*-------------------------------------------------------\
 | Fun01: numToStr
@@ -111,6 +118,31 @@ double_numToStr(
    unsigned char decUC
 );
 
+/*-------------------------------------------------------\
+| Fun05: fixDbl_numToStr
+|   - converts a double to a c-string with a fixed
+|     number of decimals (same as printf("%0.2f"))
+| Input:
+|   - cstr:
+|     o c-string to hold the converted number
+|   - numDbl:
+|     o number to convert
+|   - decUC:
+|     o number decimal digits to print; trailing zeros
+|       are kept (max_fixDecimal_numToStr)
+| Output:
+|   - Modifies:
+|     o cstr to have the number (adds a '\0' at the end)
+|   - Returns:
+|     o number of characters copied to cstr
+\-------------------------------------------------------*/
+unsigned int
+fixDbl_numToStr(
+   signed char *cstr,
+   double numDbl,
+   unsigned char decUC
+);
+
 #endif
 
 /*=======================================================\
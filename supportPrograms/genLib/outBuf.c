@@ -0,0 +1,576 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' outBuf SOF: Start Of File
+'   - buffered output for tables and sequences; avoids
+'     the format string parsing done by fprintf
+'   o header:
+'     - included libraries
+'   o fun01: blank_outBuf
+'     - empties the buffer in an outBuf struct (no flush)
+'   o fun02: init_outBuf
+'     - initializes an outBuf struct
+'   o fun03: freeStack_outBuf
+'     - frees variables in an outBuf struct (no flush)
+'   o fun04: freeHeap_outBuf
+'     - frees an outBuf struct (no flush)
+'   o fun05: setup_outBuf
+'     - allocates the buffer and sets the output file
+'   o fun06: flush_outBuf
+'     - writes the contents of the buffer to the file
+'   o fun07: addStr_outBuf
+'     - adds a c-string to the buffer
+'   o fun08: addLenStr_outBuf
+'     - adds a c-string of known length to the buffer
+'   o fun09: addChar_outBuf
+'     - adds a character to the buffer
+'   o fun10: addUL_outBuf
+'     - adds an unsigned long as text to the buffer
+'   o fun11: addSL_outBuf
+'     - adds a signed long as text to the buffer
+'   o fun12: addPadUL_outBuf
+'     - adds an zero padded unsigned long to the buffer
+'   o fun13: addDbl_outBuf
+'     - adds a double with a fixed number of decimals
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "outBuf.h"
+#include "numToStr.h"
+
+/*-------------------------------------------------------\
+| Fun01: blank_outBuf
+|   - empties the buffer in an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL and errSC in outBufSTPtr to be 0
+\-------------------------------------------------------*/
+void
+blank_outBuf(
+   struct outBuf *outBufSTPtr
+){
+   outBufSTPtr->lenSL = 0;
+   outBufSTPtr->errSC = 0;
+} /*blank_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun02: init_outBuf
+|   - initializes an outBuf struct
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all values in outBufSTPtr to be 0/null
+\-------------------------------------------------------*/
+void
+init_outBuf(
+   struct outBuf *outBufSTPtr
+){
+   outBufSTPtr->bufStr = 0;
+   outBufSTPtr->sizeSL = 0;
+   outBufSTPtr->outFILE = 0;
+
+   blank_outBuf(outBufSTPtr);
+} /*init_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_outBuf
+|   - frees variables in an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer with variables to free
+| Output:
+|   - Frees:
+|     o bufStr in outBufSTPtr and initializes
+|   - Note:
+|     o does not close outFILE or flush the buffer; call
+|       flush_outBuf first
+\-------------------------------------------------------*/
+void
+freeStack_outBuf(
+   struct outBuf *outBufSTPtr
+){
+   if(! outBufSTPtr)
+      return;
+
+   if(outBufSTPtr->bufStr)
+      free(outBufSTPtr->bufStr);
+
+   init_outBuf(outBufSTPtr);
+} /*freeStack_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_outBuf
+|   - frees an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to free
+| Output:
+|   - Frees:
+|     o outBufSTPtr (you must set to null)
+\-------------------------------------------------------*/
+void
+freeHeap_outBuf(
+   struct outBuf *outBufSTPtr
+){
+   if(! outBufSTPtr)
+      return;
+
+   freeStack_outBuf(outBufSTPtr);
+   free(outBufSTPtr);
+} /*freeHeap_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun05: setup_outBuf
+|   - allocates the buffer and sets the output file
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to setup
+|   - sizeSL:
+|     o size of the buffer in bytes
+|     o 0 (or anything under def_numSpace_outBuf) uses
+|       def_bufSize_outBuf
+|   - outFILE:
+|     o FILE pointer to flush the buffer to
+| Output:
+|   - Modifies:
+|     o bufStr in outBufSTPtr to have sizeSL bytes
+|     o outFILE in outBufSTPtr to be outFILE
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_outBuf for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed long sizeSL,
+   void *outFILE
+){
+   if(sizeSL < def_numSpace_outBuf)
+      sizeSL = def_bufSize_outBuf;
+
+   if(outBufSTPtr->bufStr)
+      free(outBufSTPtr->bufStr);
+   outBufSTPtr->bufStr = 0;
+   outBufSTPtr->sizeSL = 0;
+
+   outBufSTPtr->bufStr =
+      malloc((sizeSL + 1) * sizeof(signed char));
+      /*+ 1 for null from numToStr functions*/
+
+   if(! outBufSTPtr->bufStr)
+      return def_memErr_outBuf;
+
+   outBufSTPtr->sizeSL = sizeSL;
+   outBufSTPtr->outFILE = outFILE;
+   blank_outBuf(outBufSTPtr);
+
+   return 0;
+} /*setup_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun06: flush_outBuf
+|   - writes the contents of the buffer to the file
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to flush
+| Output:
+|   - Prints:
+|     o bufStr in outBufSTPtr to outFILE
+|   - Modifies:
+|     o lenSL in outBufSTPtr to be 0
+|     o errSC in outBufSTPtr to be def_fileErr_outBuf if
+|       not all bytes were written
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf if had a write error (this or
+|       any previous call)
+\-------------------------------------------------------*/
+signed char
+flush_outBuf(
+   struct outBuf *outBufSTPtr
+){
+   if(outBufSTPtr->lenSL <= 0)
+      return outBufSTPtr->errSC;
+
+   if(
+        fwrite(
+           (char *) outBufSTPtr->bufStr,
+           sizeof(signed char),
+           outBufSTPtr->lenSL,
+           (FILE *) outBufSTPtr->outFILE
+        )
+     != (unsigned long) outBufSTPtr->lenSL
+   ) outBufSTPtr->errSC = def_fileErr_outBuf;
+
+   outBufSTPtr->lenSL = 0;
+   return outBufSTPtr->errSC;
+} /*flush_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun07: addStr_outBuf
+|   - adds a c-string to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - addStr:
+|     o c-string to add (must end with '\0')
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have addStr
+|     o flushes bufStr when it fills up
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addStr_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char *addStr
+){
+   signed char *bufStr = 0;
+   signed long lenSL = outBufSTPtr->lenSL;
+   signed long sizeSL = outBufSTPtr->sizeSL;
+
+   bufStr = outBufSTPtr->bufStr;
+
+   while(*addStr)
+   { /*Loop: copy string*/
+      if(lenSL >= sizeSL)
+      { /*If: need to empty the buffer*/
+         outBufSTPtr->lenSL = lenSL;
+         flush_outBuf(outBufSTPtr);
+         lenSL = 0;
+      } /*If: need to empty the buffer*/
+
+      bufStr[lenSL++] = *addStr++;
+   } /*Loop: copy string*/
+
+   outBufSTPtr->lenSL = lenSL;
+   return outBufSTPtr->errSC;
+} /*addStr_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun08: addLenStr_outBuf
+|   - adds a c-string of known length to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - addStr:
+|     o c-string to add
+|   - lenSL:
+|     o number of characters to add from addStr
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have addStr
+|     o strings longer than the buffer are written
+|       directly to outFILE (after a flush)
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addLenStr_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char *addStr,
+   signed long lenSL
+){
+   signed char *bufStr = 0;
+
+   if(lenSL <= 0)
+      return outBufSTPtr->errSC;
+
+   if(lenSL > outBufSTPtr->sizeSL - outBufSTPtr->lenSL)
+   { /*If: string will not fit in the buffer*/
+      flush_outBuf(outBufSTPtr);
+
+      if(lenSL > outBufSTPtr->sizeSL)
+      { /*If: string is larger than the buffer*/
+         if(
+              fwrite(
+                 (char *) addStr,
+                 sizeof(signed char),
+                 lenSL,
+                 (FILE *) outBufSTPtr->outFILE
+              )
+           != (unsigned long) lenSL
+         ) outBufSTPtr->errSC = def_fileErr_outBuf;
+
+         return outBufSTPtr->errSC;
+      } /*If: string is larger than the buffer*/
+   } /*If: string will not fit in the buffer*/
+
+   bufStr = outBufSTPtr->bufStr + outBufSTPtr->lenSL;
+   outBufSTPtr->lenSL += lenSL;
+
+   while(lenSL-- > 0)
+      *bufStr++ = *addStr++;
+
+   return outBufSTPtr->errSC;
+} /*addLenStr_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun09: addChar_outBuf
+|   - adds a character to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - charSC:
+|     o character to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have charSC
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addChar_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char charSC
+){
+   if(outBufSTPtr->lenSL >= outBufSTPtr->sizeSL)
+      flush_outBuf(outBufSTPtr);
+
+   outBufSTPtr->bufStr[outBufSTPtr->lenSL++] = charSC;
+   return outBufSTPtr->errSC;
+} /*addChar_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun10: addUL_outBuf
+|   - adds an unsigned long as text to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numUL:
+|     o number to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numUL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addUL_outBuf(
+   struct outBuf *outBufSTPtr,
+   unsigned long numUL
+){
+   if(
+        outBufSTPtr->lenSL + def_numSpace_outBuf
+      > outBufSTPtr->sizeSL
+   ) flush_outBuf(outBufSTPtr);
+
+   outBufSTPtr->lenSL +=
+      numToStr(
+         &outBufSTPtr->bufStr[outBufSTPtr->lenSL],
+         numUL
+      );
+
+   return outBufSTPtr->errSC;
+} /*addUL_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun11: addSL_outBuf
+|   - adds a signed long as text to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numSL:
+|     o number to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addSL_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed long numSL
+){
+   if(
+        outBufSTPtr->lenSL + def_numSpace_outBuf
+      > outBufSTPtr->sizeSL
+   ) flush_outBuf(outBufSTPtr);
+
+   outBufSTPtr->lenSL +=
+      signed_numToStr(
+         &outBufSTPtr->bufStr[outBufSTPtr->lenSL],
+         numSL
+      );
+
+   return outBufSTPtr->errSC;
+} /*addSL_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun12: addPadUL_outBuf
+|   - adds an zero padded unsigned long to the buffer
+|   - same as printf("%0<padUC>lu")
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numUL:
+|     o number to add
+|   - padUC:
+|     o minimum number of digits to print; 0's are added
+|       to the start of numUL to get padUC digits
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numUL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addPadUL_outBuf(
+   struct outBuf *outBufSTPtr,
+   unsigned long numUL,
+   unsigned char padUC
+){
+   unsigned char digitsUC = 1;
+   unsigned long tmpUL = numUL;
+
+   while(tmpUL >= 10)
+   { /*Loop: count digits*/
+      tmpUL /= 10;
+      ++digitsUC;
+   } /*Loop: count digits*/
+
+   while(digitsUC < padUC)
+   { /*Loop: add padding*/
+      addChar_outBuf(outBufSTPtr, '0');
+      ++digitsUC;
+   } /*Loop: add padding*/
+
+   return addUL_outBuf(outBufSTPtr, numUL);
+} /*addPadUL_outBuf*/
+
+/*-------------------------------------------------------\
+| Fun13: addDbl_outBuf
+|   - adds a double with a fixed number of decimals
+|   - same as printf("%0.<decUC>f")
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numDbl:
+|     o number to add
+|   - decUC:
+|     o number of decimals to print
+|       (max_fixDecimal_numToStr)
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numDbl
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addDbl_outBuf(
+   struct outBuf *outBufSTPtr,
+   double numDbl,
+   unsigned char decUC
+){
+   if(
+        outBufSTPtr->lenSL + def_numSpace_outBuf
+      > outBufSTPtr->sizeSL
+   ) flush_outBuf(outBufSTPtr);
+
+   outBufSTPtr->lenSL +=
+      fixDbl_numToStr(
+         &outBufSTPtr->bufStr[outBufSTPtr->lenSL],
+         numDbl,
+         decUC
+      );
+
+   return outBufSTPtr->errSC;
+} /*addDbl_outBuf*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -0,0 +1,415 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' outBuf SOF: Start Of File
+'   - buffered output for tables and sequences; avoids
+'     the format string parsing done by fprintf
+'   o header:
+'     - guards and defined variables
+'   o .h st01: outBuf
+'     - holds the output buffer and the file to flush to
+'   o fun01: blank_outBuf
+'     - empties the buffer in an outBuf struct (no flush)
+'   o fun02: init_outBuf
+'     - initializes an outBuf struct
+'   o fun03: freeStack_outBuf
+'     - frees variables in an outBuf struct (no flush)
+'   o fun04: freeHeap_outBuf
+'     - frees an outBuf struct (no flush)
+'   o fun05: setup_outBuf
+'     - allocates the buffer and sets the output file
+'   o fun06: flush_outBuf
+'     - writes the contents of the buffer to the file
+'   o fun07: addStr_outBuf
+'     - adds a c-string to the buffer
+'   o fun08: addLenStr_outBuf
+'     - adds a c-string of known length to the buffer
+'   o fun09: addChar_outBuf
+'     - adds a character to the buffer
+'   o fun10: addUL_outBuf
+'     - adds an unsigned long as text to the buffer
+'   o fun11: addSL_outBuf
+'     - adds a signed long as text to the buffer
+'   o fun12: addPadUL_outBuf
+'     - adds an zero padded unsigned long to the buffer
+'   o fun13: addDbl_outBuf
+'     - adds a double with a fixed number of decimals
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards and defined variables
+\-------------------------------------------------------*/
+
+#ifndef OUTPUT_BUFFER_H
+#define OUTPUT_BUFFER_H
+
+#define def_memErr_outBuf 1
+#define def_fileErr_outBuf 2
+
+#define def_bufSize_outBuf (1 << 16)
+   /*default buffer size (64kb)*/
+#define def_numSpace_outBuf 64
+   /*bytes to keep open for converting a number*/
+
+/*-------------------------------------------------------\
+| ST01: outBuf
+|   - holds the output buffer and the file to flush to
+\-------------------------------------------------------*/
+typedef struct outBuf
+{
+   signed char *bufStr;    /*buffer with unwritten output*/
+   signed long lenSL;      /*number bytes in bufStr*/
+   signed long sizeSL;     /*maximum bytes in bufStr*/
+
+   void *outFILE;          /*file to flush bufStr to*/
+   signed char errSC;      /*first write error; 0 if none*/
+}outBuf;
+
+/*-------------------------------------------------------\
+| Fun01: blank_outBuf
+|   - empties the buffer in an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to blank
+| Output:
+|   - Modifies:
+|     o lenSL and errSC in outBufSTPtr to be 0
+\-------------------------------------------------------*/
+void
+blank_outBuf(
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun02: init_outBuf
+|   - initializes an outBuf struct
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all values in outBufSTPtr to be 0/null
+\-------------------------------------------------------*/
+void
+init_outBuf(
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun03: freeStack_outBuf
+|   - frees variables in an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer with variables to free
+| Output:
+|   - Frees:
+|     o bufStr in outBufSTPtr and initializes
+|   - Note:
+|     o does not close outFILE or flush the buffer; call
+|       flush_outBuf first
+\-------------------------------------------------------*/
+void
+freeStack_outBuf(
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun04: freeHeap_outBuf
+|   - frees an outBuf struct (no flush)
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to free
+| Output:
+|   - Frees:
+|     o outBufSTPtr (you must set to null)
+\-------------------------------------------------------*/
+void
+freeHeap_outBuf(
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun05: setup_outBuf
+|   - allocates the buffer and sets the output file
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to setup
+|   - sizeSL:
+|     o size of the buffer in bytes
+|     o 0 (or anything under def_numSpace_outBuf) uses
+|       def_bufSize_outBuf
+|   - outFILE:
+|     o FILE pointer to flush the buffer to
+| Output:
+|   - Modifies:
+|     o bufStr in outBufSTPtr to have sizeSL bytes
+|     o outFILE in outBufSTPtr to be outFILE
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_outBuf for memory errors
+\-------------------------------------------------------*/
+signed char
+setup_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed long sizeSL,
+   void *outFILE
+);
+
+/*-------------------------------------------------------\
+| Fun06: flush_outBuf
+|   - writes the contents of the buffer to the file
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to flush
+| Output:
+|   - Prints:
+|     o bufStr in outBufSTPtr to outFILE
+|   - Modifies:
+|     o lenSL in outBufSTPtr to be 0
+|     o errSC in outBufSTPtr to be def_fileErr_outBuf if
+|       not all bytes were written
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf if had a write error (this or
+|       any previous call)
+\-------------------------------------------------------*/
+signed char
+flush_outBuf(
+   struct outBuf *outBufSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun07: addStr_outBuf
+|   - adds a c-string to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - addStr:
+|     o c-string to add (must end with '\0')
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have addStr
+|     o flushes bufStr when it fills up
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addStr_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char *addStr
+);
+
+/*-------------------------------------------------------\
+| Fun08: addLenStr_outBuf
+|   - adds a c-string of known length to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - addStr:
+|     o c-string to add
+|   - lenSL:
+|     o number of characters to add from addStr
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have addStr
+|     o strings longer than the buffer are written
+|       directly to outFILE (after a flush)
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addLenStr_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char *addStr,
+   signed long lenSL
+);
+
+/*-------------------------------------------------------\
+| Fun09: addChar_outBuf
+|   - adds a character to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - charSC:
+|     o character to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have charSC
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addChar_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed char charSC
+);
+
+/*-------------------------------------------------------\
+| Fun10: addUL_outBuf
+|   - adds an unsigned long as text to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numUL:
+|     o number to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numUL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addUL_outBuf(
+   struct outBuf *outBufSTPtr,
+   unsigned long numUL
+);
+
+/*-------------------------------------------------------\
+| Fun11: addSL_outBuf
+|   - adds a signed long as text to the buffer
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numSL:
+|     o number to add
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numSL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addSL_outBuf(
+   struct outBuf *outBufSTPtr,
+   signed long numSL
+);
+
+/*-------------------------------------------------------\
+| Fun12: addPadUL_outBuf
+|   - adds an zero padded unsigned long to the buffer
+|   - same as printf("%0<padUC>lu")
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numUL:
+|     o number to add
+|   - padUC:
+|     o minimum number of digits to print; 0's are added
+|       to the start of numUL to get padUC digits
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numUL
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addPadUL_outBuf(
+   struct outBuf *outBufSTPtr,
+   unsigned long numUL,
+   unsigned char padUC
+);
+
+/*-------------------------------------------------------\
+| Fun13: addDbl_outBuf
+|   - adds a double with a fixed number of decimals
+|   - same as printf("%0.<decUC>f")
+| Input:
+|   - outBufSTPtr:
+|     o outBuf struct pointer to add to
+|   - numDbl:
+|     o number to add
+|   - decUC:
+|     o number of decimals to print
+|       (max_fixDecimal_numToStr)
+| Output:
+|   - Modifies:
+|     o bufStr and lenSL in outBufSTPtr to have numDbl
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_outBuf for write errors
+\-------------------------------------------------------*/
+signed char
+addDbl_outBuf(
+   struct outBuf *outBufSTPtr,
+   double numDbl,
+   unsigned char decUC
+);
+
+#endif
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
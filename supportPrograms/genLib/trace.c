@@ -0,0 +1,475 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' trace SOF: Start Of File
+'   - records begin/end times of program stages as
+'     chrome (perfetto) trace events
+'   o header:
+'     - included libraries
+'   o fun01: init_trace
+'     - initializes a trace struct
+'   o fun02: freeStack_trace
+'     - flushes and closes the trace file in a trace
+'   o fun03: freeHeap_trace
+'     - flushes, closes, and frees a trace struct
+'   o .c fun04: addJsonStr_trace
+'     - adds an escaped c-string to the trace buffer
+'   o fun05: setup_trace
+'     - opens (appends to) a trace file
+'   o fun06: time_trace
+'     - gets the current time in microseconds
+'   o .c fun07: event_trace
+'     - adds an event to the trace file
+'   o fun08: begin_trace
+'     - marks the start of a stage
+'   o fun09: end_trace
+'     - marks the end of a stage
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #define _POSIX_C_SOURCE 199309L /*for clock_gettime*/
+   #include <stdlib.h>
+   #include <time.h>
+#endif
+
+#include <stdio.h>
+
+#include "trace.h"
+#include "outBuf.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden libraries:
+!   - .c  #include "numToStr.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*-------------------------------------------------------\
+| Fun01: init_trace
+|   - initializes a trace struct
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all values in traceSTPtr to be 0/null
+\-------------------------------------------------------*/
+void
+init_trace(
+   struct trace *traceSTPtr
+){
+   traceSTPtr->bufSTPtr = 0;
+   traceSTPtr->pidSL = 0;
+   traceSTPtr->tidSL = 0;
+} /*init_trace*/
+
+/*-------------------------------------------------------\
+| Fun02: freeStack_trace
+|   - flushes and closes the trace file in a trace
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer with file to close
+| Output:
+|   - Prints:
+|     o any buffered events to the trace file
+|   - Frees:
+|     o the buffer in traceSTPtr and closes the file;
+|       then initializes traceSTPtr
+\-------------------------------------------------------*/
+void
+freeStack_trace(
+   struct trace *traceSTPtr
+){
+   if(! traceSTPtr)
+      return;
+
+   if(traceSTPtr->bufSTPtr)
+   { /*If: have a trace file*/
+      if(traceSTPtr->bufSTPtr->outFILE)
+      { /*If: need to close the file*/
+         flush_outBuf(traceSTPtr->bufSTPtr);
+         fclose((FILE *) traceSTPtr->bufSTPtr->outFILE);
+      } /*If: need to close the file*/
+
+      freeHeap_outBuf(traceSTPtr->bufSTPtr);
+   } /*If: have a trace file*/
+
+   init_trace(traceSTPtr);
+} /*freeStack_trace*/
+
+/*-------------------------------------------------------\
+| Fun03: freeHeap_trace
+|   - flushes, closes, and frees a trace struct
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to free
+| Output:
+|   - Frees:
+|     o traceSTPtr (you must set to null)
+\-------------------------------------------------------*/
+void
+freeHeap_trace(
+   struct trace *traceSTPtr
+){
+   if(! traceSTPtr)
+      return;
+
+   freeStack_trace(traceSTPtr);
+   free(traceSTPtr);
+} /*freeHeap_trace*/
+
+/*-------------------------------------------------------\
+| Fun04: addJsonStr_trace
+|   - adds an escaped c-string to the trace buffer
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer with buffer to add to
+|   - textStr:
+|     o c-string to add; '"', '\', and control
+|       characters are escaped
+| Output:
+|   - Modifies:
+|     o bufSTPtr in traceSTPtr to have textStr
+\-------------------------------------------------------*/
+void
+addJsonStr_trace(
+   struct trace *traceSTPtr,
+   signed char *textStr
+){
+   while(*textStr)
+   { /*Loop: copy and escape characters*/
+      if(*textStr == '"' || *textStr == '\\')
+      { /*If: need to escape*/
+         addChar_outBuf(traceSTPtr->bufSTPtr, '\\');
+         addChar_outBuf(traceSTPtr->bufSTPtr, *textStr);
+      } /*If: need to escape*/
+
+      else if(*textStr > 0 && *textStr < 32)
+         addChar_outBuf(traceSTPtr->bufSTPtr, ' ');
+         /*control characters (tabs) are not worth
+         `  escaping for a stage name
+         */
+
+      else
+         addChar_outBuf(traceSTPtr->bufSTPtr, *textStr);
+
+      ++textStr;
+   } /*Loop: copy and escape characters*/
+} /*addJsonStr_trace*/
+
+/*-------------------------------------------------------\
+| Fun05: setup_trace
+|   - opens (appends to) a trace file
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to setup
+|   - fileStr:
+|     o c-string with path to the trace file; events are
+|       appended if the file exists
+|   - pidSL:
+|     o process id to print in the events
+|   - nameStr:
+|     o c-string with name to give process pidSL in the
+|       trace viewer
+| Output:
+|   - Modifies:
+|     o bufSTPtr in traceSTPtr to have a buffer and the
+|       opened file
+|     o pidSL in traceSTPtr to be pidSL and tidSL to be 1
+|   - Prints:
+|     o '[' to fileStr if fileStr is empty
+|     o a process_name metadata event to fileStr
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_trace for memory errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+setup_trace(
+   struct trace *traceSTPtr,
+   signed char *fileStr,
+   signed long pidSL,
+   signed char *nameStr
+){
+   FILE *outFILE = 0;
+
+   freeStack_trace(traceSTPtr);
+
+   traceSTPtr->bufSTPtr = malloc(sizeof(struct outBuf));
+   if(! traceSTPtr->bufSTPtr)
+      goto memErr_fun05;
+   init_outBuf(traceSTPtr->bufSTPtr);
+
+   outFILE = fopen((char *) fileStr, "a");
+   if(! outFILE)
+      goto fileErr_fun05;
+
+   if(
+      setup_outBuf(
+         traceSTPtr->bufSTPtr,
+         def_bufSize_trace,
+         outFILE
+      )
+   ) goto memErr_fun05;
+   outFILE = 0; /*so not closed twice on errors*/
+
+   traceSTPtr->pidSL = pidSL;
+   traceSTPtr->tidSL = 1;
+
+   fseek((FILE *) traceSTPtr->bufSTPtr->outFILE, 0, SEEK_END);
+
+   if(! ftell((FILE *) traceSTPtr->bufSTPtr->outFILE))
+      addChar_outBuf(traceSTPtr->bufSTPtr, '[');
+      /*new file, so start the event array*/
+   else
+      addChar_outBuf(traceSTPtr->bufSTPtr, ',');
+      /*appending to another programs events*/
+
+   addStr_outBuf(
+      traceSTPtr->bufSTPtr,
+      (signed char *)
+         "\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+   );
+   addSL_outBuf(traceSTPtr->bufSTPtr, pidSL);
+   addStr_outBuf(
+      traceSTPtr->bufSTPtr,
+      (signed char *) ",\"tid\":0,\"args\":{\"name\":\""
+   );
+   addJsonStr_trace(traceSTPtr, nameStr);
+   addStr_outBuf(traceSTPtr->bufSTPtr,(signed char *) "\"}}");
+
+   if(flush_outBuf(traceSTPtr->bufSTPtr))
+      goto fileErr_fun05;
+
+   return 0;
+
+   memErr_fun05:;
+      if(outFILE)
+         fclose(outFILE);
+      freeStack_trace(traceSTPtr);
+      return def_memErr_trace;
+
+   fileErr_fun05:;
+      freeStack_trace(traceSTPtr);
+      return def_fileErr_trace;
+} /*setup_trace*/
+
+/*-------------------------------------------------------\
+| Fun06: time_trace
+|   - gets the current time in microseconds
+| Input:
+| Output:
+|   - Returns:
+|     o microseconds since an arbitrary point that is
+|       shared by all programs on the system
+\-------------------------------------------------------*/
+double
+time_trace(
+   void
+){
+   #ifdef PLAN9
+      return (double) nsec() / 1000.0;
+   #else
+   #ifdef _WIN32
+      /*windows clock() is wall time, but it starts at
+      `  program launch, so events from different
+      `  programs will not line up
+      */
+      return
+           (double) clock() * 1000000.0
+         / (double) CLOCKS_PER_SEC;
+   #else
+      struct timespec timeST;
+      clock_gettime(CLOCK_MONOTONIC, &timeST);
+
+      return
+           (double) timeST.tv_sec * 1000000.0
+         + (double) timeST.tv_nsec / 1000.0;
+   #endif
+   #endif
+} /*time_trace*/
+
+/*-------------------------------------------------------\
+| Fun07: event_trace
+|   - adds an event to the trace file
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to add event to
+|   - nameStr:
+|     o c-string with name of the event
+|   - catStr:
+|     o c-string with category of the event
+|   - phaseSC:
+|     o event type; 'B' for begin or 'E' for end
+| Output:
+|   - Prints:
+|     o event to the trace file (buffered)
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+event_trace(
+   struct trace *traceSTPtr,
+   signed char *nameStr,
+   signed char *catStr,
+   signed char phaseSC
+){
+   double timeDbl = time_trace();
+   struct outBuf *bufSTPtr = traceSTPtr->bufSTPtr;
+
+   addStr_outBuf(bufSTPtr, (signed char *) ",\n{\"name\":\"");
+   addJsonStr_trace(traceSTPtr, nameStr);
+   addStr_outBuf(bufSTPtr, (signed char *) "\",\"cat\":\"");
+   addJsonStr_trace(traceSTPtr, catStr);
+   addStr_outBuf(bufSTPtr, (signed char *) "\",\"ph\":\"");
+   addChar_outBuf(bufSTPtr, phaseSC);
+   addStr_outBuf(bufSTPtr, (signed char *) "\",\"ts\":");
+   addDbl_outBuf(bufSTPtr, timeDbl, 3);
+   addStr_outBuf(bufSTPtr, (signed char *) ",\"pid\":");
+   addSL_outBuf(bufSTPtr, traceSTPtr->pidSL);
+   addStr_outBuf(bufSTPtr, (signed char *) ",\"tid\":");
+   addSL_outBuf(bufSTPtr, traceSTPtr->tidSL);
+
+   if(addChar_outBuf(bufSTPtr, '}'))
+      return def_fileErr_trace;
+
+   return 0;
+} /*event_trace*/
+
+/*-------------------------------------------------------\
+| Fun08: begin_trace
+|   - marks the start of a stage
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to add the event to
+|     o 0 (null) to not trace (does nothing)
+|   - nameStr:
+|     o c-string with name of the stage
+|   - catStr:
+|     o c-string with category of the stage
+| Output:
+|   - Prints:
+|     o a "B" (begin) event to the trace file
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+begin_trace(
+   struct trace *traceSTPtr,
+   signed char *nameStr,
+   signed char *catStr
+){
+   if(! traceSTPtr || ! traceSTPtr->bufSTPtr)
+      return 0;
+
+   return event_trace(traceSTPtr, nameStr, catStr, 'B');
+} /*begin_trace*/
+
+/*-------------------------------------------------------\
+| Fun09: end_trace
+|   - marks the end of a stage
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to add the event to
+|     o 0 (null) to not trace (does nothing)
+|   - nameStr:
+|     o c-string with name of the stage
+|   - catStr:
+|     o c-string with category of the stage
+| Output:
+|   - Prints:
+|     o an "E" (end) event to the trace file
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+end_trace(
+   struct trace *traceSTPtr,
+   signed char *nameStr,
+   signed char *catStr
+){
+   if(! traceSTPtr || ! traceSTPtr->bufSTPtr)
+      return 0;
+
+   return event_trace(traceSTPtr, nameStr, catStr, 'E');
+} /*end_trace*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -0,0 +1,287 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' trace SOF: Start Of File
+'   - records begin/end times of program stages as
+'     chrome (perfetto) trace events
+'   o header:
+'     - guards and defined variables
+'   o .h st01: trace
+'     - holds the trace file and the event ids
+'   o fun01: init_trace
+'     - initializes a trace struct
+'   o fun02: freeStack_trace
+'     - flushes and closes the trace file in a trace
+'   o fun03: freeHeap_trace
+'     - flushes, closes, and frees a trace struct
+'   o .c fun04: addJsonStr_trace
+'     - adds an escaped c-string to the trace buffer
+'   o fun05: setup_trace
+'     - opens (appends to) a trace file
+'   o fun06: time_trace
+'     - gets the current time in microseconds
+'   o .c fun07: event_trace
+'     - adds an event to the trace file
+'   o fun08: begin_trace
+'     - marks the start of a stage
+'   o fun09: end_trace
+'     - marks the end of a stage
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - guards and defined variables
+\-------------------------------------------------------*/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+struct outBuf;
+
+#define def_memErr_trace 1
+#define def_fileErr_trace 2
+
+#define def_bufSize_trace (1 << 12)
+   /*trace events are small, so no need for a big
+   `  buffer
+   */
+
+/*-------------------------------------------------------\
+| ST01: trace
+|   - holds the trace file and the event ids
+\-------------------------------------------------------*/
+typedef struct trace
+{
+   struct outBuf *bufSTPtr; /*buffers events for file*/
+   signed long pidSL;       /*process id for events*/
+   signed long tidSL;       /*thread id for events*/
+}trace;
+
+/*-------------------------------------------------------\
+| Fun01: init_trace
+|   - initializes a trace struct
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to initialize
+| Output:
+|   - Modifies:
+|     o all values in traceSTPtr to be 0/null
+\-------------------------------------------------------*/
+void
+init_trace(
+   struct trace *traceSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun02: freeStack_trace
+|   - flushes and closes the trace file in a trace
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer with file to close
+| Output:
+|   - Prints:
+|     o any buffered events to the trace file
+|   - Frees:
+|     o the buffer in traceSTPtr and closes the file;
+|       then initializes traceSTPtr
+|   - Note:
+|     o the file is left open ended (no ']'), so that
+|       other programs can append their events; see
+|       using_trace.md
+\-------------------------------------------------------*/
+void
+freeStack_trace(
+   struct trace *traceSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun03: freeHeap_trace
+|   - flushes, closes, and frees a trace struct
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to free
+| Output:
+|   - Frees:
+|     o traceSTPtr (you must set to null)
+\-------------------------------------------------------*/
+void
+freeHeap_trace(
+   struct trace *traceSTPtr
+);
+
+/*-------------------------------------------------------\
+| Fun05: setup_trace
+|   - opens (appends to) a trace file
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to setup
+|   - fileStr:
+|     o c-string with path to the trace file; events are
+|       appended if the file exists
+|   - pidSL:
+|     o process id to print in the events; use a
+|       different number for each program in a pipeline
+|   - nameStr:
+|     o c-string with name to give process pidSL in the
+|       trace viewer
+| Output:
+|   - Modifies:
+|     o bufSTPtr in traceSTPtr to have a buffer and the
+|       opened file
+|     o pidSL in traceSTPtr to be pidSL and tidSL to be 1
+|   - Prints:
+|     o '[' to fileStr if fileStr is empty
+|     o a process_name metadata event to fileStr
+|   - Returns:
+|     o 0 for no errors
+|     o def_memErr_trace for memory errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+setup_trace(
+   struct trace *traceSTPtr,
+   signed char *fileStr,
+   signed long pidSL,
+   signed char *nameStr
+);
+
+/*-------------------------------------------------------\
+| Fun06: time_trace
+|   - gets the current time in microseconds
+| Input:
+| Output:
+|   - Returns:
+|     o microseconds since an arbitrary point that is
+|       shared by all programs on the system
+\-------------------------------------------------------*/
+double
+time_trace(
+   void
+);
+
+/*-------------------------------------------------------\
+| Fun08: begin_trace
+|   - marks the start of a stage
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to add the event to
+|     o 0 (null) to not trace (does nothing)
+|   - nameStr:
+|     o c-string with name of the stage
+|   - catStr:
+|     o c-string with category of the stage
+| Output:
+|   - Prints:
+|     o a "B" (begin) event to the trace file
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_trace for file errors
+\-------------------------------------------------------*/
+signed char
+begin_trace(
+   struct trace *traceSTPtr,
+   signed char *nameStr,
+   signed char *catStr
+);
+
+/*-------------------------------------------------------\
+| Fun09: end_trace
+|   - marks the end of a stage
+| Input:
+|   - traceSTPtr:
+|     o trace struct pointer to add the event to
+|     o 0 (null) to not trace (does nothing)
+|   - nameStr:
+|     o c-string with name of the stage; should be the
+|       same name used with begin_trace
+|   - catStr:
+|     o c-string with category of the stage
+| Output:
+|   - Prints:
+|     o an "E" (end) event to the trace file
+|   - Returns:
+|     o 0 for no errors
+|     o def_fileErr_trace for file errors
+| Note:
+|   - stages must be ended in the reverse order they
+|     were started (nested)
+\-------------------------------------------------------*/
+signed char
+end_trace(
+   struct trace *traceSTPtr,
+   signed char *nameStr,
+   signed char *catStr
+);
+
+#endif
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -0,0 +1,2320 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' mainMapRead SOF: Start Of File
+'   - maps reads to a reference with mapRead and builds a
+'     consensus from the mapped reads with tbCon
+'   o header:
+'     - included libraries
+'   o .c st01: thread_mainMapRead
+'     - holds the memory one thread uses to map reads
+'   o fun01: pversion_mainMapRead
+'     - prints version number for mainMapRead
+'   o fun02: phelp_mainMapRead
+'     - prints help message for mainMapRead
+'   o fun03: input_mainMapRead
+'     - gets user input
+'   o fun04: mapBatch_mainMapRead
+'     - maps one threads share of a batch of reads
+'   o fun05: conBatch_mainMapRead
+'     - adds the bases of a batch of reads that are in one
+'       threads reference blocks to the consensus
+'   o main:
+'     - driver function to map reads and build consensus
+'   o license:
+'     - Licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#ifdef THREADS
+   #include <pthread.h>
+#endif
+
+#include "../genLib/ulCp.h"
+#include "../genLib/base10str.h"
+#include "../genLib/memTag.h"
+
+#include "../genBio/seqST.h"
+#include "../genBio/samEntry.h"
+#include "../genBio/tbCon.h"
+
+#include "../genAln/alnSet.h"
+#include "../genAln/mapRead.h"
+
+/*.h files only*/
+#include "../genLib/endLine.h"
+#include "../genBio/tbConDefs.h"
+#include "../genAln/defsMapRead.h"
+#include "../bioTools.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden files
+!   o .c  #include "../genLib/fileFun.h"
+!   o .c  #include "../genLib/numToStr.h"
+!   o .c  #include "../genLib/charCp.h"
+!   o .c  #include "../genLib/shellSort.h"
+!   o .c  #include "../genBio/kmerFun.h"
+!   o .c  #include "../genAln/indexToCoord.h"
+!   o .c  #include "../genAln/dirMatrix.h"
+!   o .c  #include "../genAln/needle.h"
+!   o .c  #include "../genAln/water.h"
+!   o .h  #include "../genLib/genMath.h" (only .h macros)
+!   o .h  #include "../genBio/kmerBit.h"
+!   o .h  #include "../genBio/ntTo5Bit.h"
+!   o .h  #include "../genAln/alnDefs.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+#define def_fqFile_mainMapRead 0
+#define def_faFile_mainMapRead 1
+#define def_idxFile_mainMapRead 2 /*mapRead index*/
+
+#define def_threads_mainMapRead 1
+#define def_maxThreads_mainMapRead 64
+#define def_batch_mainMapRead 4096 /*reads mapped at once*/
+
+#define def_minMapq_mainMapRead 0
+   /*mapRead does not find mapping qualities (always 0),
+   `  so tbCon's mapq filter is off by default
+   */
+
+/*-------------------------------------------------------\
+| ST01: thread_mainMapRead
+|   - holds the memory one thread uses to map reads
+|   - the reference kmers are shared, but each thread has
+|     its own ref_mapRead and seqST copy, because the
+|     mapping steps change the reference offsets
+|   - for the consensus, each thread adds the reads bases
+|     in its own blocks (def_blockLen_tbCon bases) of each
+|     reference, so the pileups are shared without locks
+\-------------------------------------------------------*/
+typedef struct thread_mainMapRead
+{
+   signed int startSI;         /*first read to map*/
+   signed int stepSI;          /*number threads mapping*/
+   signed int lenSI;           /*number reads in batch*/
+   struct seqST *qryAryST;     /*batch of reads (shared)*/
+   struct samEntry *samAryST;  /*gets mappings (shared)*/
+
+   struct ref_mapRead refST;   /*copy of the reference*/
+   struct seqST refSeqST;      /*copy; own offset/id*/
+   struct aln_mapRead alnST;   /*memory for mapping*/
+   struct samEntry revSamST;   /*reverse mappings*/
+   struct set_mapRead *setSTPtr; /*settings (shared)*/
+
+   /*consensus (all shared; thread owns the blocks where
+   `  block % stepSI is startSI)
+   */
+   signed int *refArySI;       /*reference of each read*/
+      /*-1 if the read is not added to the consensus*/
+   struct pile_tbCon *pileAryST; /*consensus pileups*/
+   struct set_tbCon *conSetSTPtr; /*consensus settings*/
+
+   signed char errSC;          /*def_memErr_mapRead*/
+}thread_mainMapRead;
+
+/*-------------------------------------------------------\
+| Fun01: pversion_mainMapRead
+|   - prints version number for mainMapRead
+| Input:
+|   - outFILE:
+|     o file to print version number to
+| Output:
+|   - Prints:
+|     o version number to outFILE
+\-------------------------------------------------------*/
+void
+pversion_mainMapRead(
+   void *outFILE
+){
+   fprintf(
+     (FILE *) outFILE,
+     "mapRead from bioTools version: %i-%02i-%02i%s",
+     def_year_bioTools,
+     def_month_bioTools,
+     def_day_bioTools,
+     str_endLine
+   );
+} /*pversion_mainMapRead*/
+
+/*-------------------------------------------------------\
+| Fun02: phelp_mainMapRead
+|   - prints help message for mainMapRead
+| Input:
+|   - outFILE:
+|     o file to print help message to
+| Output:
+|   - Prints:
+|     o help message to outFILE
+\-------------------------------------------------------*/
+void
+phelp_mainMapRead(
+   void *outFILE
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun02 TOC:
+   '   - prints help message for mainMapRead
+   '   o fun02 sec01:
+   '     - print usage block
+   '   o fun02 sec02:
+   '     - print input block
+   '   o fun02 sec03:
+   '     - print output block
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec01:
+   ^   - print usage block
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf(
+     (FILE *) outFILE,
+     "mapRead -ref ref.fa -fq reads.fq -con con.fa"
+   );
+   fprintf((FILE *) outFILE, "%s", str_endLine);
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - maps reads to a reference and builds a%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    consensus from the mapped reads%s",
+      str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec02:
+   ^   - print input block
+   ^   o fun02 sec02 sub01:
+   ^     - input block header
+   ^   o fun02 sec02 sub02:
+   ^     - reference and read options
+   ^   o fun02 sec02 sub03:
+   ^     - output files
+   ^   o fun02 sec02 sub04:
+   ^     - mapping and consensus settings
+   ^   o fun02 sec02 sub05:
+   ^     - help/version number
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub01:
+   *   - input block header
+   \*****************************************************/
+
+   fprintf((FILE *) outFILE, "Input:%s", str_endLine);
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub02:
+   *   - reference and read options
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -ref ref.fasta: [Required]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o reference to map reads to (first sequence)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use `-ref-fq ref.fastq` for a fastq file%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use `-ref-idx ref.idx` for an index from%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      -write-idx (memory mapped, so is shared%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      by mapRead runs on the same reference)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -panel: [Optional; No]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use every sequence in -ref (or -ref-fq) as a%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      reference panel (ex: one per genotype)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o reads are mapped once to the best reference%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      and a consensus is built for each reference%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o -write-idx saves the panel; -ref-idx loads it%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -fq reads.fastq: [Required; or -fa]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o fastq file with reads to map%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use `-fa reads.fasta` for a fasta file%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub03:
+   *   - output files
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -sam out.sam: [Optional; stdout if no -con]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o sam file to save mapped reads to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use `-sam -` for stdout%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -con con.fasta: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o fasta file to save the consensus to; low%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      depth positions are masked with '%c'%s",
+      def_mask_tbConDefs,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o use `-con -` for stdout%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -write-idx ref.idx: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o save the reference index for -ref-idx%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o -fq/-fa are optional; if no reads, mapRead%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      only builds the index%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub04:
+   *   - mapping and consensus settings
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -threads %i: [Optional]%s",
+      def_threads_mainMapRead,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o number of threads to map reads and build the%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      consensus pileup with (max %i)%s",
+      def_maxThreads_mainMapRead,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o output is the same for any number of threads%s",
+      str_endLine
+   );
+
+   #ifndef THREADS
+      fprintf(
+         (FILE *) outFILE,
+         "    o this build has no thread support (only 1)%s",
+         str_endLine
+      );
+   #endif
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -min-score %0.2f: [Optional]%s",
+      def_minScore_defsMapRead,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o minimum percent score to keep a mapping%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -min-depth %i: [Optional]%s",
+      def_minDepth_tbConDefs,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o minimum read depth to keep a consensus base%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -min-q %i: [Optional]%s",
+      def_minNtQ_tbConDefs,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o minimum q-score to add a base to consensus%s",
+      str_endLine
+   );
+
+   /*****************************************************\
+   * Fun02 Sec02 Sub05:
+   *   - help/version number
+   \*****************************************************/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -h: print this help message and exit%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -v: print version number and exit%s",
+      str_endLine
+   );
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun02 Sec03:
+   ^   - print output block
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   fprintf((FILE *) outFILE, "Output:%s", str_endLine);
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - sam file with the mapped reads (-sam)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o unmapped reads are not printed%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  - fasta file with the consensus (-con)%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o for -panel, one consensus per reference%s",
+      str_endLine
+   );
+} /*phelp_mainMapRead*/
+
+/*-------------------------------------------------------\
+| Fun03: input_mainMapRead
+|   - gets user input
+| Input:
+|   - numArgsSI:
+|     o number of arguments the user input
+|   - argAryStr:
+|     o array of c-strings with user input
+|   - refFileStrPtr:
+|     o c-string pionter to point to reference file name
+|   - refTypeSCPtr:
+|     o pointer to signed char to hold if reference was
+|       a fasta, fastq, or index file
+|   - qryFileStrPtr:
+|     o c-string pionter to point to the reads file name
+|   - qryTypeSCPtr:
+|     o pointer to signed char to hold if the reads were
+|       a fasta or fastq file
+|   - samFileStrPtr:
+|     o c-string pionter to point to the sam file name
+|   - conFileStrPtr:
+|     o c-string pionter to point to consensus file name
+|   - idxFileStrPtr:
+|     o c-string pionter to point to the index file name
+|       to write (-write-idx)
+|   - panelBlPtr:
+|     o signed char pointer set to 1 if every reference
+|       sequence is used as a panel (-panel)
+|   - threadsSIPtr:
+|     o signed int pointer to get the number of threads
+|   - mapSetSTPtr:
+|     o set_mapRead struct pointer with mapping settings
+|   - conSetSTPtr:
+|     o set_tbCon struct pointer with consensus settings
+| Output:
+|   - Modifies:
+|     o all input variables to hold/point to user input
+|   - Returns:
+|     o 0 for no errors
+|     o 1 for help message/version number
+|     o 2 for unkown input
+\-------------------------------------------------------*/
+signed char
+input_mainMapRead(
+   int numArgsSI,
+   char *argAryStr[],
+   signed char **refFileStrPtr,
+   signed char *refTypeSCPtr,
+   signed char **qryFileStrPtr,
+   signed char *qryTypeSCPtr,
+   signed char **samFileStrPtr,
+   signed char **conFileStrPtr,
+   signed char **idxFileStrPtr,
+   signed char *panelBlPtr,
+   signed int *threadsSIPtr,
+   struct set_mapRead *mapSetSTPtr,
+   struct set_tbCon *conSetSTPtr
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun03 TOC:
+   '   - gets user input
+   '   o fun03 sec01:
+   '     - variable declerations
+   '   o fun03 sec02:
+   '     - check if user input something
+   '   o fun03 sec03:
+   '     - get user input
+   '   o fun03 sec04:
+   '     - return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec01:
+   ^   - variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char errSC = 0;
+   signed char *errStr = 0;
+   signed int siArg = 1;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec02:
+   ^   - check if user input something
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(numArgsSI == 1)
+   { /*If: nothing input*/
+      phelp_mainMapRead(stdout);
+      goto phelp_fun03_sec04;
+   } /*If: nothing input*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec03:
+   ^   - get user input
+   ^   o fun03 sec03 sub01:
+   ^     - start loop and check file input
+   ^   o fun03 sec03 sub02:
+   ^     - check mapping and consensus settings
+   ^   o fun03 sec03 sub03:
+   ^     - check if help message requested
+   ^   o fun03 sec03 sub04:
+   ^     - check if version number print
+   ^   o fun03 sec03 sub05:
+   ^     - invalid entry
+   ^   o fun03 sec03 sub06:
+   ^     - move to next entry
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Fun03 Sec03 Sub01:
+   *   - start loop and check file input
+   \*****************************************************/
+
+   while(siArg < numArgsSI)
+   { /*Loop: get user input*/
+      if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*If: reference fasta file*/
+         ++siArg;
+         *refFileStrPtr = (signed char *) argAryStr[siArg];
+         *refTypeSCPtr = def_faFile_mainMapRead;
+      }  /*If: reference fasta file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref-fq",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: reference fastq file*/
+         ++siArg;
+         *refFileStrPtr = (signed char *) argAryStr[siArg];
+         *refTypeSCPtr = def_fqFile_mainMapRead;
+      }  /*Else If: reference fastq file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-ref-idx",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: reference index file*/
+         ++siArg;
+         *refFileStrPtr = (signed char *) argAryStr[siArg];
+         *refTypeSCPtr = def_idxFile_mainMapRead;
+      }  /*Else If: reference index file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-fq",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: reads fastq file*/
+         ++siArg;
+         *qryFileStrPtr = (signed char *) argAryStr[siArg];
+         *qryTypeSCPtr = def_fqFile_mainMapRead;
+      }  /*Else If: reads fastq file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-fa",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: reads fasta file*/
+         ++siArg;
+         *qryFileStrPtr = (signed char *) argAryStr[siArg];
+         *qryTypeSCPtr = def_faFile_mainMapRead;
+      }  /*Else If: reads fasta file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-sam",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: sam file*/
+         ++siArg;
+         *samFileStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: sam file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-con",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: consensus file*/
+         ++siArg;
+         *conFileStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: consensus file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-write-idx",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: saving reference index*/
+         ++siArg;
+         *idxFileStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: saving reference index*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-panel",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *panelBlPtr = 1;
+
+      /**************************************************\
+      * Fun03 Sec03 Sub02:
+      *   - check mapping and consensus settings
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-threads",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: number of threads*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr += strToSI_base10str(errStr, threadsSIPtr);
+
+         if(*errStr > 32)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-threads %s is non-numeric%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*If: invalid input*/
+
+         else if(
+               *threadsSIPtr < 1
+            || *threadsSIPtr > def_maxThreads_mainMapRead
+         ){ /*Else If: out of range*/
+            fprintf(
+               stderr,
+               "-threads %s must be 1 to %i%s",
+               argAryStr[siArg],
+               def_maxThreads_mainMapRead,
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*Else If: out of range*/
+      }  /*Else If: number of threads*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-min-score",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: minimum percent score*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr +=
+            strToF_base10str(errStr, &mapSetSTPtr->minScoreF);
+
+         if(*errStr > 32)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-min-score %s is non-numeric%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*If: invalid input*/
+
+         else if(
+               mapSetSTPtr->minScoreF < 0
+            || mapSetSTPtr->minScoreF > 1
+         ){ /*Else If: out of range*/
+            fprintf(
+               stderr,
+               "-min-score %s must be 0 to 1%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*Else If: out of range*/
+      }  /*Else If: minimum percent score*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-min-depth",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: minimum read depth*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr +=
+            strToSI_base10str(
+               errStr,
+               &conSetSTPtr->minDepthSI
+            );
+
+         if(*errStr > 32 || conSetSTPtr->minDepthSI < 0)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-min-depth %s is not a positive number%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*If: invalid input*/
+      }  /*Else If: minimum read depth*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-min-q",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: minimum q-score*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr +=
+            strToSI_base10str(errStr, &conSetSTPtr->minQSI);
+
+         if(*errStr > 32 || conSetSTPtr->minQSI < 0)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-min-q %s is not a positive number%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;
+         } /*If: invalid input*/
+      }  /*Else If: minimum q-score*/
+
+      /**************************************************\
+      * Fun03 Sec03 Sub03:
+      *   - check if help message requested
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-h",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: help message*/
+         phelp_mainMapRead(stdout);
+         goto phelp_fun03_sec04;
+      }  /*Else If: help message*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--h",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: help message*/
+         phelp_mainMapRead(stdout);
+         goto phelp_fun03_sec04;
+      }  /*Else If: help message*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "help",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: help message*/
+         phelp_mainMapRead(stdout);
+         goto phelp_fun03_sec04;
+      }  /*Else If: help message*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-help",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: help message*/
+         phelp_mainMapRead(stdout);
+         goto phelp_fun03_sec04;
+      }  /*Else If: help message*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--help",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: help message*/
+         phelp_mainMapRead(stdout);
+         goto phelp_fun03_sec04;
+      }  /*Else If: help message*/
+
+      /**************************************************\
+      * Fun03 Sec03 Sub04:
+      *   - check if version number print
+      \**************************************************/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-v",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: version number*/
+         pversion_mainMapRead(stdout);
+         goto pversion_fun03_sec04;
+      }  /*Else If: version number*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--v",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: version number*/
+         pversion_mainMapRead(stdout);
+         goto pversion_fun03_sec04;
+      }  /*Else If: version number*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "version",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: version number*/
+         pversion_mainMapRead(stdout);
+         goto pversion_fun03_sec04;
+      }  /*Else If: version number*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-version",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: version number*/
+         pversion_mainMapRead(stdout);
+         goto pversion_fun03_sec04;
+      }  /*Else If: version number*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--version",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: version number*/
+         pversion_mainMapRead(stdout);
+         goto pversion_fun03_sec04;
+      }  /*Else If: version number*/
+
+      /**************************************************\
+      * Fun03 Sec03 Sub05:
+      *   - invalid entry
+      \**************************************************/
+
+      else
+      { /*Else: invalid input*/
+         fprintf(
+            stderr,
+            "%s is not recognized%s",
+            argAryStr[siArg],
+            str_endLine
+         );
+
+         goto err_fun03_sec04;
+      } /*Else: invalid input*/
+
+      /**************************************************\
+      * Fun03 Sec03 Sub06:
+      *   - move to next entry
+      \**************************************************/
+
+      ++siArg;
+   } /*Loop: get user input*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Fun03 Sec04:
+   ^   - return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*no errors*/
+   errSC = 0;
+   goto ret_fun03_sec04;
+
+   phelp_fun03_sec04:;
+   errSC = 1;
+   goto ret_fun03_sec04;
+
+   pversion_fun03_sec04:;
+   errSC = 1;
+   goto ret_fun03_sec04;
+
+   err_fun03_sec04:;
+   errSC = 2;
+   goto ret_fun03_sec04;
+
+   ret_fun03_sec04:;
+   return errSC;
+} /*input_mainMapRead*/
+
+/*-------------------------------------------------------\
+| Fun04: mapBatch_mainMapRead
+|   - maps one threads share of a batch of reads
+| Input:
+|   - threadPtr:
+|     o thread_mainMapRead struct pointer (as void *)
+|       with the reads and memory to map with
+|       * maps reads startSI, startSI + stepSI, ...
+| Output:
+|   - Modifies:
+|     o samAryST in threadPtr to have the best mapping
+|       (forward or reverse complement) for each read
+|       * flagUS is 4 for unmapped reads
+|     o seqStr in each mapped qryAryST to be lookup
+|       index's (from seqToIndex_alnSet)
+|     o errSC in threadPtr to be def_memErr_mapRead for
+|       memory errors (0 for no errors)
+|   - Returns:
+|     o 0 (for pthread_create)
+\-------------------------------------------------------*/
+void *
+mapBatch_mainMapRead(
+   void *threadPtr
+){
+   struct thread_mainMapRead *thSTPtr =
+      (struct thread_mainMapRead *) threadPtr;
+
+   signed int siRead = 0;
+   signed int mapIndexSI = 0;  /*best chain (not used)*/
+   signed long scoreSL = 0;
+   signed long revScoreSL = 0;
+   signed char errSC = 0;
+   signed char revErrSC = 0;
+
+   struct seqST *qrySTPtr = 0;
+   struct samEntry *samSTPtr = 0;
+
+   thSTPtr->errSC = 0;
+
+   for(
+      siRead = thSTPtr->startSI;
+      siRead < thSTPtr->lenSI;
+      siRead += thSTPtr->stepSI
+   ){ /*Loop: map reads*/
+      qrySTPtr = &thSTPtr->qryAryST[siRead];
+      samSTPtr = &thSTPtr->samAryST[siRead];
+
+      scoreSL =
+         align_mapRead(
+            qrySTPtr,
+            &thSTPtr->refST,
+            &mapIndexSI,
+            samSTPtr,
+            &thSTPtr->alnST,
+            thSTPtr->setSTPtr,
+            &errSC
+         );
+
+      if(errSC == def_memErr_mapRead)
+         goto memErr_fun04;
+
+      /*mapRead only maps the forward direction*/
+      revCmpIndex_alnSet(
+         qrySTPtr->seqStr,
+         qrySTPtr->qLenSL ? qrySTPtr->qStr : 0,
+         qrySTPtr->seqLenSL
+      );
+
+      revScoreSL =
+         align_mapRead(
+            qrySTPtr,
+            &thSTPtr->refST,
+            &mapIndexSI,
+            &thSTPtr->revSamST,
+            &thSTPtr->alnST,
+            thSTPtr->setSTPtr,
+            &revErrSC
+         );
+
+      if(revErrSC == def_memErr_mapRead)
+         goto memErr_fun04;
+
+      if(revErrSC)
+         ; /*reverse complement did not map*/
+
+      else if(errSC || revScoreSL > scoreSL)
+      { /*Else If: reverse complement mapped better*/
+         swap_samEntry(samSTPtr, &thSTPtr->revSamST);
+         samSTPtr->flagUS |= 16;
+         errSC = 0;
+      } /*Else If: reverse complement mapped better*/
+
+      if(errSC)
+         samSTPtr->flagUS = 4; /*unmapped*/
+   } /*Loop: map reads*/
+
+   return 0;
+
+   memErr_fun04:;
+      thSTPtr->errSC = def_memErr_mapRead;
+      return 0;
+} /*mapBatch_mainMapRead*/
+
+/*-------------------------------------------------------\
+| Fun05: conBatch_mainMapRead
+|   - adds the bases of a batch of reads that are in one
+|     threads reference blocks to the consensus
+| Input:
+|   - threadPtr:
+|     o thread_mainMapRead struct pointer (as void *)
+|       with the mapped reads and consensus pileups
+|       * thread owns every block (def_blockLen_tbCon
+|         bases) where block % stepSI is startSI
+|       * pileups must already cover the reads
+|         (realloc_pile_tbCon) and have stepSI insertion
+|         arenas (setup_pile_tbCon)
+| Output:
+|   - Modifies:
+|     o pileAryST in threadPtr to have the bases,
+|       deletions, and insertions of every read
+|       (refArySI >= 0) that are in this threads blocks
+|       * reads are added in input order, so the consensus
+|         is the same for any number of threads
+|     o errSC in threadPtr to be def_memErr_mapRead for
+|       memory errors (0 for no errors)
+|   - Returns:
+|     o 0 (for pthread_create)
+\-------------------------------------------------------*/
+void *
+conBatch_mainMapRead(
+   void *threadPtr
+){
+   struct thread_mainMapRead *thSTPtr =
+      (struct thread_mainMapRead *) threadPtr;
+   struct samEntry *samSTPtr = 0;
+   struct pile_tbCon *pileSTPtr = 0;
+
+   signed int siRead = 0;
+   signed int siRef = 0;
+   unsigned int blockUI = 0;  /*block on*/
+   unsigned int lastUI = 0;   /*last block read is in*/
+   unsigned int startUI = 0;  /*first base in block*/
+   unsigned int endUI = 0;    /*first base after block*/
+   unsigned int stepUI = (unsigned int) thSTPtr->stepSI;
+
+   thSTPtr->errSC = 0;
+
+   for(siRead = 0; siRead < thSTPtr->lenSI; ++siRead)
+   { /*Loop: add reads to consensus*/
+      siRef = thSTPtr->refArySI[siRead];
+
+      if(siRef < 0)
+         continue; /*read is not in the consensus*/
+
+      samSTPtr = &thSTPtr->samAryST[siRead];
+      pileSTPtr = &thSTPtr->pileAryST[siRef];
+
+      blockUI = samSTPtr->refStartUI / def_blockLen_tbCon;
+      lastUI =
+         (samSTPtr->refEndUI + 1) / def_blockLen_tbCon;
+         /*+ 1 for insertions at end of read*/
+
+      /*move to the first block this thread owns*/
+      blockUI +=
+           (
+                stepUI
+              + (unsigned int) thSTPtr->startSI
+              - blockUI % stepUI
+           )
+         % stepUI;
+
+      while(blockUI <= lastUI)
+      { /*Loop: add read to each block thread owns*/
+         startUI = blockUI * def_blockLen_tbCon;
+         endUI = startUI + def_blockLen_tbCon;
+
+         if(endUI > pileSTPtr->lenUI)
+            endUI = pileSTPtr->lenUI;
+
+         if(startUI >= endUI)
+            break; /*block is past end of pileup*/
+
+         if(
+               addReadWin_tbCon(
+                  samSTPtr,
+                  pileSTPtr,
+                  startUI,
+                  endUI,
+                  thSTPtr->conSetSTPtr
+               )
+            == def_memErr_tbConDefs
+         ) goto memErr_fun05;
+
+         blockUI += stepUI;
+      } /*Loop: add read to each block thread owns*/
+   } /*Loop: add reads to consensus*/
+
+   return 0;
+
+   memErr_fun05:;
+      thSTPtr->errSC = def_memErr_mapRead;
+      return 0;
+} /*conBatch_mainMapRead*/
+
+/*-------------------------------------------------------\
+| Main:
+|   - driver function to map reads and build consensus
+| Input:
+|   - numArgsSI:
+|     o number of arguments the user input
+|   - argAryStr:
+|     o array of c-strings with user input
+| Output:
+|   - prints mapped reads as a sam file and/or the
+|     consensus as a fasta file
+\-------------------------------------------------------*/
+int
+main(
+   int numArgsSI,
+   char *argAryStr[]
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Main TOC:
+   '   - driver function to map reads and build consensus
+   '   o main sec01:
+   '     - variable declerations
+   '   o main sec02:
+   '     - initialize structs, get input, and check input
+   '   o main sec03:
+   '     - set up threads and batch memory
+   '   o main sec04:
+   '     - map reads and add to consensus
+   '   o main sec05:
+   '     - collapse and print consensus
+   '   o main sec06:
+   '     - clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec01:
+   ^   - variable declerations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char errSC = 0;
+   signed char eofBl = 0;      /*1: read all reads*/
+
+   signed char *refFileStr = 0;
+   signed char refTypeSC = def_faFile_mainMapRead;
+   signed char *qryFileStr = 0;
+   signed char qryTypeSC = def_fqFile_mainMapRead;
+   signed char *samFileStr = 0;
+   signed char *conFileStr = 0;
+   signed char *idxFileStr = 0;
+   signed char panelBl = 0;    /*1: -ref is a panel*/
+   signed int threadsSI = def_threads_mainMapRead;
+
+   signed int siRead = 0;
+   signed int lenBatchSI = 0;  /*reads in this batch*/
+   signed int siThread = 0;
+   signed long numReadsSL = 0;
+   signed long numMapSL = 0;
+   signed char *tmpStr = 0;
+   signed int siRef = 0;       /*panel reference on*/
+   signed int numConSI = 0;    /*consensuses (references)*/
+
+   struct set_mapRead mapSetStackST;
+   struct ref_mapRead refStackST;
+
+   struct set_tbCon conSetStackST;
+   struct pile_tbCon *pileHeapAryST = 0;
+      /*one consensus pileup per (panel) reference*/
+   unsigned int maskUI = 0;    /*masked consensus bases*/
+   struct samEntry *conHeapST = 0;
+
+   /*batch and thread memory*/
+   struct seqST *qryHeapAryST = 0;
+   struct samEntry *samHeapAryST = 0;
+   signed int *refHeapArySI = 0; /*consensus of each read*/
+   signed int numBatchSI = 0;   /*initialized in batch*/
+   struct thread_mainMapRead *threadHeapAryST = 0;
+   signed int numThreadSI = 0; /*initialized threads*/
+
+   #ifdef THREADS
+      pthread_t *idHeapAryST = 0;
+      signed char *startHeapAryBl = 0;
+   #endif
+
+   FILE *refFILE = 0;
+   FILE *qryFILE = 0;
+   FILE *samFILE = 0;
+   FILE *conFILE = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec02:
+   ^   - initialize structures, get input, and check input
+   ^   o main sec02 sub01:
+   ^     - initialize structures
+   ^   o main sec02 sub02:
+   ^     - get input
+   ^   o main sec02 sub03:
+   ^     - get reference sequence
+   ^   o main sec02 sub04:
+   ^     - open reads and output files
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Main Sec02 Sub01:
+   *   - initialize structures
+   \*****************************************************/
+
+   init_set_mapRead(&mapSetStackST);
+   init_ref_mapRead(&refStackST);
+   init_set_tbCon(&conSetStackST);
+   conSetStackST.minMapqUC = def_minMapq_mainMapRead;
+
+   if(setup_set_mapRead(&mapSetStackST))
+   { /*If: memory error*/
+      fprintf(
+         stderr,
+         "MEMORY ERROR setting up mapping settings%s",
+         str_endLine
+      );
+
+      goto memErr_main_sec06;
+   } /*If: memory error*/
+
+   /*****************************************************\
+   * Main Sec02 Sub02:
+   *   - get input
+   \*****************************************************/
+
+   errSC =
+      input_mainMapRead(
+         numArgsSI,
+         argAryStr,
+         &refFileStr,
+         &refTypeSC,
+         &qryFileStr,
+         &qryTypeSC,
+         &samFileStr,
+         &conFileStr,
+         &idxFileStr,
+         &panelBl,
+         &threadsSI,
+         &mapSetStackST,
+         &conSetStackST
+      );
+
+   if(errSC)
+   { /*If: had input error*/
+      --errSC;
+      goto cleanUp_main_sec06;
+   } /*If: had input error*/
+
+   #ifndef THREADS
+      threadsSI = 1; /*build has no thread support*/
+   #endif
+
+   if(! samFileStr && ! conFileStr && qryFileStr)
+      samFileStr = (signed char *) "-";
+
+   /*****************************************************\
+   * Main Sec02 Sub03:
+   *   - get reference sequence
+   \*****************************************************/
+
+   if(! refFileStr)
+   { /*If: no reference file input*/
+      fprintf(
+         stderr,
+         "no reference file input with -ref%s",
+         str_endLine
+      );
+
+      goto fileErr_main_sec06;
+   } /*If: no reference file input*/
+
+   if(refTypeSC == def_idxFile_mainMapRead)
+   { /*If: reference is an index*/
+      errSC =
+         mmapRefBin_ref_mapRead(
+            &refStackST,
+            refFileStr,
+            0         /*only check header; no data read*/
+         );
+   } /*If: reference is an index*/
+
+   else
+   { /*Else: reference is a fasta/fastq file*/
+      refFILE = fopen((char *) refFileStr, "r");
+
+      if(! refFILE)
+      { /*If: could not open reference*/
+         fprintf(
+            stderr,
+            "could not open -ref %s%s",
+            refFileStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: could not open reference*/
+
+      if(panelBl)
+         errSC =
+            getPanel_ref_mapRead(
+               &refStackST,
+               &mapSetStackST,
+               refTypeSC == def_fqFile_mainMapRead,
+               0,              /*not gzipped*/
+               refFILE
+            );
+      else
+         errSC =
+            getRef_ref_mapRead(
+               &refStackST,
+               &mapSetStackST,
+               refTypeSC == def_fqFile_mainMapRead,
+               0,              /*not gzipped*/
+               refFILE
+            );
+
+      fclose(refFILE);
+      refFILE = 0;
+   } /*Else: reference is a fasta/fastq file*/
+
+   if(errSC && errSC != def_EOF_mapRead)
+   { /*If: had error*/
+      if(errSC == def_memErr_mapRead)
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "MEMORY ERROR reading -ref %s%s",
+            refFileStr,
+            str_endLine
+         );
+
+         goto memErr_main_sec06;
+      } /*If: memory error*/
+
+      if(refTypeSC == def_idxFile_mainMapRead)
+         fprintf(
+            stderr,
+            "-ref-idx %s is not a valid mapRead index%s",
+            refFileStr,
+            str_endLine
+         );
+      else
+         fprintf(
+            stderr,
+            "-ref %s is not a valid fasta/fastq file%s",
+            refFileStr,
+            str_endLine
+         );
+
+      goto fileErr_main_sec06;
+   } /*If: had error*/
+
+   /*remove white space from reference id; also keeps
+   `  the id the same for every thread
+   */
+   tmpStr = refStackST.seqSTPtr->idStr;
+   while(*tmpStr++ > 32) ;
+   --tmpStr;
+   *tmpStr = '\0';
+   refStackST.seqSTPtr->idLenSL =
+      tmpStr - refStackST.seqSTPtr->idStr;
+
+   if(idxFileStr)
+   { /*If: saving the reference index*/
+      refFILE = fopen((char *) idxFileStr, "wb");
+
+      if(! refFILE)
+      { /*If: could not open index file*/
+         fprintf(
+            stderr,
+            "could not open -write-idx %s%s",
+            idxFileStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: could not open index file*/
+
+      errSC = writeRefBin_ref_mapRead(&refStackST, refFILE);
+      fclose(refFILE);
+      refFILE = 0;
+
+      if(errSC)
+      { /*If: could not write index*/
+         fprintf(
+            stderr,
+            "could not write -write-idx %s%s",
+            idxFileStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: could not write index*/
+
+      if(! qryFileStr)
+         goto noErr_main_sec06; /*only building index*/
+   } /*If: saving the reference index*/
+
+   /*****************************************************\
+   * Main Sec02 Sub04:
+   *   - open reads and output files
+   \*****************************************************/
+
+   if(! qryFileStr)
+   { /*If: no reads input*/
+      fprintf(
+         stderr,
+         "no reads input with -fq or -fa%s",
+         str_endLine
+      );
+
+      goto fileErr_main_sec06;
+   } /*If: no reads input*/
+
+   if(*qryFileStr == '-' && qryFileStr[1] == '\0')
+      qryFILE = stdin;
+   else
+      qryFILE = fopen((char *) qryFileStr, "r");
+
+   if(! qryFILE)
+   { /*If: could not open reads*/
+      fprintf(
+         stderr,
+         "could not open reads file %s%s",
+         qryFileStr,
+         str_endLine
+      );
+
+      goto fileErr_main_sec06;
+   } /*If: could not open reads*/
+
+   if(! samFileStr)
+      ;
+   else if(*samFileStr == '-' && samFileStr[1] == '\0')
+      samFILE = stdout;
+   else
+   { /*Else: printing sam to a file*/
+      samFILE = fopen((char *) samFileStr, "w");
+
+      if(! samFILE)
+      { /*If: could not open sam file*/
+         fprintf(
+            stderr,
+            "could not open -sam %s%s",
+            samFileStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: could not open sam file*/
+   } /*Else: printing sam to a file*/
+
+   if(! conFileStr)
+      ;
+   else if(*conFileStr == '-' && conFileStr[1] == '\0')
+      conFILE = stdout;
+   else
+   { /*Else: printing consensus to a file*/
+      conFILE = fopen((char *) conFileStr, "w");
+
+      if(! conFILE)
+      { /*If: could not open consensus file*/
+         fprintf(
+            stderr,
+            "could not open -con %s%s",
+            conFileStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: could not open consensus file*/
+   } /*Else: printing consensus to a file*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec03:
+   ^   - set up threads and batch memory
+   ^   o main sec03 sub01:
+   ^     - allocate batch memory
+   ^   o main sec03 sub02:
+   ^     - set up thread memory
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Main Sec03 Sub01:
+   *   - allocate batch memory
+   \*****************************************************/
+
+   qryHeapAryST =
+      malloc(def_batch_mainMapRead * sizeof(struct seqST));
+   if(! qryHeapAryST)
+      goto batchMemErr_main_sec03_sub01;
+
+   samHeapAryST =
+      malloc(
+         def_batch_mainMapRead * sizeof(struct samEntry)
+      );
+   if(! samHeapAryST)
+      goto batchMemErr_main_sec03_sub01;
+
+   refHeapArySI =
+      malloc(def_batch_mainMapRead * sizeof(signed int));
+   if(! refHeapArySI)
+      goto batchMemErr_main_sec03_sub01;
+
+   for(
+      numBatchSI = 0;
+      numBatchSI < def_batch_mainMapRead;
+      ++numBatchSI
+   ){ /*Loop: initialize batch structures*/
+      init_seqST(&qryHeapAryST[numBatchSI]);
+      init_samEntry(&samHeapAryST[numBatchSI]);
+
+      if(setup_samEntry(&samHeapAryST[numBatchSI]))
+      { /*If: memory error*/
+         ++numBatchSI; /*so is freed*/
+         goto batchMemErr_main_sec03_sub01;
+      } /*If: memory error*/
+   } /*Loop: initialize batch structures*/
+
+   if(0)
+   { /*If: memory error (only reached by goto)*/
+      batchMemErr_main_sec03_sub01:;
+
+      fprintf(
+         stderr,
+         "MEMORY ERROR setting up read batch%s",
+         str_endLine
+      );
+
+      goto memErr_main_sec06;
+   } /*If: memory error (only reached by goto)*/
+
+   /*****************************************************\
+   * Main Sec03 Sub02:
+   *   - set up thread memory
+   \*****************************************************/
+
+   threadHeapAryST =
+      malloc(threadsSI * sizeof(struct thread_mainMapRead));
+   if(! threadHeapAryST)
+      goto threadMemErr_main_sec03_sub02;
+
+   #ifdef THREADS
+      idHeapAryST = malloc(threadsSI * sizeof(pthread_t));
+      if(! idHeapAryST)
+         goto threadMemErr_main_sec03_sub02;
+
+      startHeapAryBl = malloc(threadsSI * sizeof(signed char));
+      if(! startHeapAryBl)
+         goto threadMemErr_main_sec03_sub02;
+   #endif
+
+   for(
+      numThreadSI = 0;
+      numThreadSI < threadsSI;
+      ++numThreadSI
+   ){ /*Loop: set up each thread*/
+      threadHeapAryST[numThreadSI].startSI = numThreadSI;
+      threadHeapAryST[numThreadSI].stepSI = threadsSI;
+      threadHeapAryST[numThreadSI].lenSI = 0;
+      threadHeapAryST[numThreadSI].qryAryST = qryHeapAryST;
+      threadHeapAryST[numThreadSI].samAryST = samHeapAryST;
+      threadHeapAryST[numThreadSI].setSTPtr =
+         &mapSetStackST;
+      threadHeapAryST[numThreadSI].refArySI = refHeapArySI;
+      threadHeapAryST[numThreadSI].pileAryST = 0;
+      threadHeapAryST[numThreadSI].conSetSTPtr =
+         &conSetStackST;
+      threadHeapAryST[numThreadSI].errSC = 0;
+
+      /*shallow copies; kmer arrays and sequence are
+      `  shared, offsets and id are per thread
+      */
+      threadHeapAryST[numThreadSI].refSeqST =
+         *refStackST.seqSTPtr;
+      threadHeapAryST[numThreadSI].refST = refStackST;
+      threadHeapAryST[numThreadSI].refST.seqSTPtr =
+         &threadHeapAryST[numThreadSI].refSeqST;
+
+      init_aln_mapRead(&threadHeapAryST[numThreadSI].alnST);
+      init_samEntry(&threadHeapAryST[numThreadSI].revSamST);
+      threadHeapAryST[numThreadSI].refSeqST.idStr =
+         malloc(
+              (refStackST.seqSTPtr->idLenSL + 8)
+            * sizeof(signed char)
+         );
+
+      if(! threadHeapAryST[numThreadSI].refSeqST.idStr)
+      { /*If: memory error*/
+         ++numThreadSI; /*so is freed*/
+         goto threadMemErr_main_sec03_sub02;
+      } /*If: memory error*/
+
+      cpStr_ulCp(
+         threadHeapAryST[numThreadSI].refSeqST.idStr,
+         refStackST.seqSTPtr->idStr
+      );
+
+      if(
+            setup_aln_mapRead(
+               &threadHeapAryST[numThreadSI].alnST
+            )
+         || setup_samEntry(
+               &threadHeapAryST[numThreadSI].revSamST
+            )
+      ){ /*If: memory error*/
+         ++numThreadSI; /*so is freed*/
+         goto threadMemErr_main_sec03_sub02;
+      } /*If: memory error*/
+   } /*Loop: set up each thread*/
+
+   if(0)
+   { /*If: memory error (only reached by goto)*/
+      threadMemErr_main_sec03_sub02:;
+
+      fprintf(
+         stderr,
+         "MEMORY ERROR setting up threads%s",
+         str_endLine
+      );
+
+      goto memErr_main_sec06;
+   } /*If: memory error (only reached by goto)*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec04:
+   ^   - map reads and add to consensus
+   ^   o main sec04 sub01:
+   ^     - print sam header and set up consensus arrays
+   ^   o main sec04 sub02:
+   ^     - read in a batch of reads
+   ^   o main sec04 sub03:
+   ^     - map the batch (one share per thread)
+   ^   o main sec04 sub04:
+   ^     - print mappings (in order)
+   ^   o main sec04 sub05:
+   ^     - add batch to consensus (one window per thread)
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   /*****************************************************\
+   * Main Sec04 Sub01:
+   *   - print sam header and set up consensus arrays
+   \*****************************************************/
+
+   if(samFILE)
+   { /*If: printing sam file*/
+      fprintf(
+         samFILE,
+         "@HD\tVN:1.6\tSO:unsorted%s",
+         str_endLine
+      );
+
+      if(! refStackST.numRefSI)
+         fprintf(
+            samFILE,
+            "@SQ\tSN:%s\tLN:%li%s",
+            refStackST.seqSTPtr->idStr,
+            refStackST.seqSTPtr->seqLenSL,
+            str_endLine
+         );
+
+      for(siRef = 0; siRef < refStackST.numRefSI; ++siRef)
+         fprintf(
+            samFILE,
+            "@SQ\tSN:%s\tLN:%i%s",
+            refStackST.idAryStr
+               + siRef * def_lenPanelId_mapRead,
+            refStackST.lenRefArySI[siRef],
+            str_endLine
+         ); /*one entry per panel reference*/
+
+      fprintf(
+         samFILE,
+         "@PG\tID:mapRead\tPN:mapRead\tVN:%i-%02i-%02i",
+         def_year_bioTools,
+         def_month_bioTools,
+         def_day_bioTools
+      );
+
+      fprintf(
+         samFILE,
+         "\tCL:mapRead %s %s %s %s%s",
+         refTypeSC == def_idxFile_mainMapRead ?
+            "-ref-idx" : "-ref",
+         refFileStr,
+         qryTypeSC == def_fqFile_mainMapRead ? "-fq" : "-fa",
+         qryFileStr,
+         str_endLine
+      );
+   } /*If: printing sam file*/
+
+   numConSI = refStackST.numRefSI;
+   if(! numConSI)
+      numConSI = 1; /*not a panel*/
+
+   pileHeapAryST =
+      malloc(numConSI * sizeof(struct pile_tbCon));
+   if(! pileHeapAryST)
+      goto conMemErr_main_sec04_sub01;
+
+   for(siRef = 0; siRef < numConSI; ++siRef)
+      init_pile_tbCon(&pileHeapAryST[siRef]);
+
+   for(siRef = 0; siRef < numConSI; ++siRef)
+   { /*Loop: set up consensus pileups*/
+      if(setup_pile_tbCon(&pileHeapAryST[siRef], threadsSI))
+         goto conMemErr_main_sec04_sub01;
+         /*one insertion arena per thread*/
+
+      if(refStackST.numRefSI)
+         pileHeapAryST[siRef].lenUI =
+            (unsigned int) refStackST.lenRefArySI[siRef];
+      else
+         pileHeapAryST[siRef].lenUI =
+            (unsigned int) refStackST.seqSTPtr->seqLenSL;
+   } /*Loop: set up consensus pileups*/
+
+   if(0)
+   { /*If: memory error (only reached by goto)*/
+      conMemErr_main_sec04_sub01:;
+
+      fprintf(
+         stderr,
+         "MEMORY ERROR setting up consensus%s",
+         str_endLine
+      );
+
+      goto memErr_main_sec06;
+   } /*If: memory error (only reached by goto)*/
+
+   for(siThread = 0; siThread < threadsSI; ++siThread)
+      threadHeapAryST[siThread].pileAryST = pileHeapAryST;
+
+   while(! eofBl)
+   { /*Loop: map all reads*/
+
+      /**************************************************\
+      * Main Sec04 Sub02:
+      *   - read in a batch of reads
+      \**************************************************/
+
+      for(
+         lenBatchSI = 0;
+         lenBatchSI < def_batch_mainMapRead;
+         ++lenBatchSI
+      ){ /*Loop: read in batch*/
+         if(qryTypeSC == def_fqFile_mainMapRead)
+            errSC =
+               getFq_seqST(
+                  qryFILE,
+                  &qryHeapAryST[lenBatchSI]
+               );
+         else
+            errSC =
+               getFa_seqST(
+                  qryFILE,
+                  &qryHeapAryST[lenBatchSI]
+               );
+
+         if(! errSC)
+            continue;
+
+         else if(errSC == def_EOF_seqST)
+         { /*Else If: end of file*/
+            eofBl = 1;
+
+            /*fasta readers return EOF with the last read*/
+            if(
+                  qryTypeSC == def_faFile_mainMapRead
+               && qryHeapAryST[lenBatchSI].idLenSL
+               && qryHeapAryST[lenBatchSI].seqLenSL
+            ) ++lenBatchSI;
+
+            break;
+         } /*Else If: end of file*/
+
+         else if(errSC & def_memErr_seqST)
+         { /*Else If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR reading read %li%s",
+               numReadsSL + lenBatchSI + 1,
+               str_endLine
+            );
+
+            goto memErr_main_sec06;
+         } /*Else If: memory error*/
+
+         else
+         { /*Else: file error*/
+            fprintf(
+               stderr,
+               "read %li in %s is not a valid entry%s",
+               numReadsSL + lenBatchSI + 1,
+               qryFileStr,
+               str_endLine
+            );
+
+            goto fileErr_main_sec06;
+         } /*Else: file error*/
+      } /*Loop: read in batch*/
+
+      numReadsSL += lenBatchSI;
+
+      /**************************************************\
+      * Main Sec04 Sub03:
+      *   - map the batch (one share per thread)
+      \**************************************************/
+
+      for(siThread = 0; siThread < threadsSI; ++siThread)
+         threadHeapAryST[siThread].lenSI = lenBatchSI;
+
+      #ifdef THREADS
+         for(siThread = 1; siThread < threadsSI; ++siThread)
+         { /*Loop: start threads*/
+            startHeapAryBl[siThread] =
+               ! pthread_create(
+                  &idHeapAryST[siThread],
+                  0,
+                  mapBatch_mainMapRead,
+                  &threadHeapAryST[siThread]
+               );
+
+            if(! startHeapAryBl[siThread])
+               mapBatch_mainMapRead(
+                  &threadHeapAryST[siThread]
+               ); /*could not start thread; map here*/
+         } /*Loop: start threads*/
+      #endif
+
+      mapBatch_mainMapRead(&threadHeapAryST[0]);
+
+      #ifdef THREADS
+         for(siThread = 1; siThread < threadsSI; ++siThread)
+         { /*Loop: wait for threads*/
+            if(startHeapAryBl[siThread])
+               pthread_join(idHeapAryST[siThread], 0);
+         } /*Loop: wait for threads*/
+      #endif
+
+      for(siThread = 0; siThread < threadsSI; ++siThread)
+      { /*Loop: check for errors*/
+         if(threadHeapAryST[siThread].errSC)
+         { /*If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR mapping reads%s",
+               str_endLine
+            );
+
+            goto memErr_main_sec06;
+         } /*If: memory error*/
+      } /*Loop: check for errors*/
+
+      /**************************************************\
+      * Main Sec04 Sub04:
+      *   - print mappings (in order)
+      \**************************************************/
+
+      for(siRead = 0; siRead < lenBatchSI; ++siRead)
+      { /*Loop: print mapped reads*/
+         refHeapArySI[siRead] = -1;
+
+         if(samHeapAryST[siRead].flagUS & 4)
+            continue; /*unmapped read*/
+
+         siRef =
+            panelCoord_ref_mapRead(
+               &refStackST,
+               &samHeapAryST[siRead]
+            ); /*panel offsets and id; 0 if not a panel*/
+
+         if(siRef < 0)
+            continue; /*crosses two panel references*/
+
+         ++numMapSL;
+
+         if(samFILE)
+            p_samEntry(&samHeapAryST[siRead], 0, samFILE);
+
+         if(! conFILE)
+            continue;
+
+         if(chkRead_tbCon(&samHeapAryST[siRead], &conSetStackST))
+            continue; /*read can not be added to consensus*/
+
+         if(
+            realloc_pile_tbCon(
+               &pileHeapAryST[siRef],
+               samHeapAryST[siRead].refEndUI
+            )
+         ){ /*If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR adding read to consensus%s",
+               str_endLine
+            );
+
+            goto memErr_main_sec06;
+         } /*If: memory error*/
+
+         refHeapArySI[siRead] = siRef;
+      } /*Loop: print mapped reads*/
+
+      /**************************************************\
+      * Main Sec04 Sub05:
+      *   - add batch to consensus (one window per thread)
+      \**************************************************/
+
+      if(! conFILE)
+         continue;
+
+      #ifdef THREADS
+         for(siThread = 1; siThread < threadsSI; ++siThread)
+         { /*Loop: start threads*/
+            startHeapAryBl[siThread] =
+               ! pthread_create(
+                  &idHeapAryST[siThread],
+                  0,
+                  conBatch_mainMapRead,
+                  &threadHeapAryST[siThread]
+               );
+
+            if(! startHeapAryBl[siThread])
+               conBatch_mainMapRead(
+                  &threadHeapAryST[siThread]
+               ); /*could not start thread; add here*/
+         } /*Loop: start threads*/
+      #endif
+
+      conBatch_mainMapRead(&threadHeapAryST[0]);
+
+      #ifdef THREADS
+         for(siThread = 1; siThread < threadsSI; ++siThread)
+         { /*Loop: wait for threads*/
+            if(startHeapAryBl[siThread])
+               pthread_join(idHeapAryST[siThread], 0);
+         } /*Loop: wait for threads*/
+      #endif
+
+      for(siThread = 0; siThread < threadsSI; ++siThread)
+      { /*Loop: check for errors*/
+         if(threadHeapAryST[siThread].errSC)
+         { /*If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR adding read to consensus%s",
+               str_endLine
+            );
+
+            goto memErr_main_sec06;
+         } /*If: memory error*/
+      } /*Loop: check for errors*/
+   } /*Loop: map all reads*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec05:
+   ^   - collapse and print consensus
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(conFILE)
+   { /*If: building a consensus*/
+      for(siRef = 0; siRef < numConSI; ++siRef)
+      { /*Loop: find if any reads mapped*/
+         if(pileHeapAryST[siRef].numAArySI)
+            break;
+      } /*Loop: find if any reads mapped*/
+
+      if(siRef == numConSI)
+      { /*If: no reads mapped*/
+         fprintf(
+            stderr,
+            "no reads in %s mapped to %s; no consensus%s",
+            qryFileStr,
+            refStackST.seqSTPtr->idStr,
+            str_endLine
+         );
+
+         goto fileErr_main_sec06;
+      } /*If: no reads mapped*/
+
+      for(siRef = 0; siRef < numConSI; ++siRef)
+      { /*Loop: collapse each references consensus*/
+         if(! pileHeapAryST[siRef].numAArySI)
+            continue; /*no reads mapped to reference*/
+
+         if(refStackST.numRefSI)
+            tmpStr =
+                 refStackST.idAryStr
+               + siRef * def_lenPanelId_mapRead;
+         else
+            tmpStr = refStackST.seqSTPtr->idStr;
+
+         conHeapST =
+            noFragCollapse_tbCon(
+               &pileHeapAryST[siRef],
+               tmpStr,
+               &maskUI,
+               &conSetStackST,
+               &errSC
+            );
+
+         if(errSC == def_memErr_tbConDefs)
+         { /*If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR collapsing consensus%s",
+               str_endLine
+            );
+
+            goto memErr_main_sec06;
+         } /*If: memory error*/
+
+         else if(errSC || ! conHeapST)
+         { /*Else If: could not build consensus*/
+            if(refStackST.numRefSI)
+               continue; /*other references may have one*/
+
+            fprintf(
+               stderr,
+               "could not build a consensus from %s%s",
+               qryFileStr,
+               str_endLine
+            );
+
+            goto fileErr_main_sec06;
+         } /*Else If: could not build consensus*/
+
+         pfa_samEntry(conHeapST, conFILE);
+         freeHeap_samEntry(conHeapST);
+         conHeapST = 0;
+      } /*Loop: collapse each references consensus*/
+   } /*If: building a consensus*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec06:
+   ^   - clean up
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   noErr_main_sec06:;
+      errSC = 0;
+      goto cleanUp_main_sec06;
+
+   memErr_main_sec06:;
+      errSC = 1;
+      goto cleanUp_main_sec06;
+
+   fileErr_main_sec06:;
+      errSC = 2;
+      goto cleanUp_main_sec06;
+
+   cleanUp_main_sec06:;
+      if(threadHeapAryST)
+      { /*If: have thread memory to free*/
+         for(siThread = 0; siThread < numThreadSI; ++siThread)
+         { /*Loop: free thread memory*/
+            /*refST and refSeqST are shallow copies, so
+            `  only the id copy is freed
+            */
+            if(threadHeapAryST[siThread].refSeqST.idStr)
+               free(threadHeapAryST[siThread].refSeqST.idStr);
+            freeStack_aln_mapRead(
+               &threadHeapAryST[siThread].alnST
+            );
+            freeStack_samEntry(
+               &threadHeapAryST[siThread].revSamST
+            );
+         } /*Loop: free thread memory*/
+
+         free(threadHeapAryST);
+      } /*If: have thread memory to free*/
+      threadHeapAryST = 0;
+
+      #ifdef THREADS
+         if(idHeapAryST)
+            free(idHeapAryST);
+         idHeapAryST = 0;
+
+         if(startHeapAryBl)
+            free(startHeapAryBl);
+         startHeapAryBl = 0;
+      #endif
+
+      for(siRead = 0; siRead < numBatchSI; ++siRead)
+      { /*Loop: free batch memory*/
+         freeStack_seqST(&qryHeapAryST[siRead]);
+         freeStack_samEntry(&samHeapAryST[siRead]);
+      } /*Loop: free batch memory*/
+
+      if(qryHeapAryST)
+         free(qryHeapAryST);
+      qryHeapAryST = 0;
+
+      if(samHeapAryST)
+         free(samHeapAryST);
+      samHeapAryST = 0;
+
+      if(refHeapArySI)
+         free(refHeapArySI);
+      refHeapArySI = 0;
+
+      freeHeapAry_pile_tbCon(pileHeapAryST, numConSI);
+      pileHeapAryST = 0;
+
+      if(conHeapST)
+         freeHeap_samEntry(conHeapST);
+      conHeapST = 0;
+
+      freeStack_ref_mapRead(&refStackST);
+      freeStack_set_mapRead(&mapSetStackST);
+      freeStack_set_tbCon(&conSetStackST);
+
+      if(! qryFILE) ;
+      else if(qryFILE == stdin) ;
+      else fclose(qryFILE);
+      qryFILE = 0;
+
+      if(! samFILE) ;
+      else if(samFILE == stdout) ;
+      else fclose(samFILE);
+      samFILE = 0;
+
+      if(! conFILE) ;
+      else if(conFILE == stdout) ;
+      else fclose(conFILE);
+      conFILE = 0;
+
+      pReport_memTag(
+         (signed char *) "mapRead",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
+      return errSC;
+} /*main*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2024 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
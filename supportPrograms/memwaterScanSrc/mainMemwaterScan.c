@@ -32,12 +32,16 @@
 
 #include "../genLib/ulCp.h"
 #include "../genLib/base10str.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
 
 #include "../genBio/seqST.h"
 
 #include "../genAln/alnSet.h"
 #include "../genAln/indexToCoord.h"
 #include "../genAln/memwaterScan.h"
+#include "../genAln/hitTbl.h"
+#include "../genAln/seedScan.h"
 
 /*.h files only*/
 #include "../genLib/endLine.h"
@@ -47,8 +51,21 @@
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden files
 !   o .c  #include "../genLib/fileFun.h"
+!   o .c  #include "../genLib/numToStr.h"
+!   o .c  #include "../genLib/ptrAry.h"
 !   o .c  #include "../genAln/indexToCoord.h"
+!   o .c  #include "../genLib/charCp.h"
+!   o .c  #include "../genLib/shellSort.h"
+!   o .c  #include "../genBio/kmerFun.h"
+!   o .c  #include "../genBio/samEntry.h"
+!   o .c  #include "../genAln/dirMatrix.h"
+!   o .c  #include "../genAln/needle.h"
+!   o .c  #include "../genAln/water.h"
+!   o .c  #include "../genAln/mapRead.h"
 !   o .h  #include "../genLib/genMath.h" (only .h macros)
+!   o .h  #include "../genBio/kmerBit.h"
+!   o .h  #include "../genBio/ntTo5Bit.h"
+!   o .h  #include "../genAln/defsMapRead.h"
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 #define def_fqFile_mainMemwaterScan 0
@@ -61,6 +78,9 @@
 
 #define def_minPercScore_mainMemwaterScan 0.90f
 #define def_minScore_mainMemwaterScan 0
+#define def_topK_mainMemwaterScan 0 /*0: no top K mode*/
+#define def_seed_mainMemwaterScan 0 /*0: no seeding*/
+#define def_maxSeed_mainMemwaterScan 15 /*max kmer size*/
 
 /*-------------------------------------------------------\
 | Fun01: pversion_mainMemwaterScan
@@ -254,6 +274,50 @@ phelp_mainMemwaterScan(
       str_endLine
    );
 
+   fprintf(
+      (FILE *) outFILE,
+      "  -score-tbl: [No]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o print filtered scores.tsv rows (no header)%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      instead of every alignment%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o alignments starting inside a better%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      alignment are removed%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -high-tbl high.tsv: [Optional; not used]%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o append the highest scoring scores.tsv%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "      row(s) to high.tsv (turns on -score-tbl)%s",
+      str_endLine
+   );
+
    /*****************************************************\
    * Fun02 Sec02 Sub05:
    *   - alignment settings
@@ -263,6 +327,12 @@ phelp_mainMemwaterScan(
    *     - score and match matrixes
    *   o fun02 sec02 sub05 cat04:
    *     - minimum score
+   *   o fun02 sec02 sub05 cat05:
+   *     - filter alignments (and top K mode)
+   *   o fun02 sec02 sub05 cat06:
+   *     - alignment direction
+   *   o fun02 sec02 sub05 cat07:
+   *     - seed-and-chain mode
    \*****************************************************/
 
    /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
@@ -397,6 +467,38 @@ phelp_mainMemwaterScan(
       str_endLine
    );
 
+   fprintf(
+      (FILE *) outFILE,
+      "  -top-k %i: [Optional; %i is off]%s",
+      def_topK_mainMemwaterScan,
+      def_topK_mainMemwaterScan,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o only keep the top K best alignments that do%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      not overlap on the reference (filters while%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      aligning, so uses K instead of reference +%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      query length memory; -filter is not used)%s",
+      str_endLine
+   );
+
    /*++++++++++++++++++++++++++++++++++++++++++++++++++++\
    + Fun02 Sec02 Sub05 Cat06:
    +   - alignment direction
@@ -455,6 +557,75 @@ phelp_mainMemwaterScan(
      str_endLine
    );
 
+   /*++++++++++++++++++++++++++++++++++++++++++++++++++++   + Fun02 Sec02 Sub05 Cat07:
+   +   - seed-and-chain mode
+   \++++++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -seed %i: [Optional; %i is off]%s",
+      def_seed_mainMemwaterScan,
+      def_seed_mainMemwaterScan,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o kmer length (1 to %i) to seed alignments with%s",
+      def_maxSeed_mainMemwaterScan,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o only aligns the query to reference windows%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      that have chains of exact kmer matches%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o much faster, but can miss very divergent%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      alignments; -top-k is applied per window%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o %i is a good starting point%s",
+      def_kmerLen_seedScan,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -seed-pad %0.2f: [Optional; with -seed]%s",
+      def_padPerc_seedScan,
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "    o percent of query length to add to both%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "      ends of a window (for indels)%s",
+      str_endLine
+   );
+
    /*****************************************************\
    * Fun02 Sec02 Sub06:
    *   - help/version number
@@ -510,6 +681,11 @@ phelp_mainMemwaterScan(
 |       a fasta or fastq file
 |   - outFileStrPtr:
 |     o c-string pionter to point to output file name
+|   - scoreTblBlPtr:
+|     o signed char pointer to get if printing score
+|       table rows (1) or alignments (0)
+|   - highFileStrPtr:
+|     o c-string pionter to point to -high-tbl file name
 |   - minPercScoreFPtr:
 |     o float pointer to get the minimum percent score
 |   - minScoreSLPtr:
@@ -517,6 +693,15 @@ phelp_mainMemwaterScan(
 |   - filterBlPtr:
 |     o signed char pointer to get if filtering (1) or
 |       not (0)
+|   - topKSLPtr:
+|     o signed long pointer to get the number of top
+|       alignments to keep (-top-k; 0 for all)
+|   - seedUCPtr:
+|     o unsigned char pointer to get the seed kmer length
+|       (-seed; 0 for no seeding)
+|   - seedPadFPtr:
+|     o float pointer to get the percent of the query to
+|       pad seed windows with (-seed-pad)
 |   - dirSCPtr:
 |     o signed char pointer to get direction of the
 |       alignment
@@ -543,9 +728,14 @@ input_mainMemwaterScan(
    signed char **qryFileStrPtr,
    signed char *qryTypeSCPtr,
    signed char **outFileStrPtr,
+   signed char *scoreTblBlPtr,
+   signed char **highFileStrPtr,
    float *minPercScoreFPtr,
    signed long *minScoreSLPtr,
    signed char *filterBlPtr,
+   signed long *topKSLPtr,
+   unsigned char *seedUCPtr,
+   float *seedPadFPtr,
    signed char *dirSCPtr,
    struct alnSet *alnSetSTPtr
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
@@ -667,6 +857,25 @@ input_mainMemwaterScan(
             (signed char *) argAryStr[siArg];
       } /*If: is output file*/
 
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-score-tbl",
+            (signed char *) argAryStr[siArg]
+         )
+      ) *scoreTblBlPtr = 1;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-high-tbl",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: printing highest scoring rows*/
+         ++siArg;
+         *highFileStrPtr =
+            (signed char *) argAryStr[siArg];
+         *scoreTblBlPtr = 1;
+      } /*Else If: printing highest scoring rows*/
+
       /**************************************************\
       * Fun03 Sec03 Sub02:
       *   - check alignment settings
@@ -681,9 +890,11 @@ input_mainMemwaterScan(
       *   o fun03 sec03 sub02 cat05:
       *     - check minimum score
       *   o fun03 sec03 sub02 cat06:
-      *     - check if filtering
+      *     - check if filtering (and top K mode)
       *   o fun03 sec03 sub02 cat07:
       *     - check direction
+      *   o fun03 sec03 sub02 cat08:
+      *     - check seed-and-chain mode
       \**************************************************/
 
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
@@ -954,7 +1165,7 @@ input_mainMemwaterScan(
 
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
       + Fun03 Sec03 Sub02 Cat06:
-      +   - check if filtering
+      +   - check if filtering (and top K mode)
       \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
       else if(
@@ -971,6 +1182,41 @@ input_mainMemwaterScan(
          )
       ) *filterBlPtr = 0;
 
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-top-k",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: top K mode*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr += strToSL_base10str(errStr, topKSLPtr);
+
+         if(*errStr > 32)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-top-k %s is non-numeric%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*If: invalid input*/
+
+         else if(*topKSLPtr < 0)
+         { /*Else If: negative input*/
+            fprintf(
+               stderr,
+               "-top-k %s can not be negative%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*Else If: negative input*/
+      }  /*Else If: top K mode*/
+
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
       + Fun03 Sec03 Sub02 Cat07:
       +   - check direction
@@ -1004,6 +1250,82 @@ input_mainMemwaterScan(
          )
       ) *dirSCPtr &= ~def_alnRevDir_mainMemwaterScan;
 
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Fun03 Sec03 Sub02 Cat08:
+      +   - check seed-and-chain mode
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-seed",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: seed kmer length*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr += strToUC_base10str(errStr, seedUCPtr);
+
+         if(*errStr > 32)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-seed %s is non-numeric%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*If: invalid input*/
+
+         else if(*seedUCPtr > def_maxSeed_mainMemwaterScan)
+         { /*Else If: kmer to long*/
+            fprintf(
+               stderr,
+               "-seed %s can not be over %i%s",
+               argAryStr[siArg],
+               def_maxSeed_mainMemwaterScan,
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*Else If: kmer to long*/
+      }  /*Else If: seed kmer length*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-seed-pad",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: seed window padding*/
+         ++siArg;
+         errStr = (signed char *) argAryStr[siArg];
+         errStr += strToF_base10str(errStr, seedPadFPtr);
+
+         if(*errStr > 32)
+         { /*If: invalid input*/
+            fprintf(
+               stderr,
+               "-seed-pad %s is non-numeric%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*If: invalid input*/
+
+         else if(*seedPadFPtr < 0)
+         { /*Else If: negative input*/
+            fprintf(
+               stderr,
+               "-seed-pad %s can not be negative%s",
+               argAryStr[siArg],
+               str_endLine
+            );
+
+            goto err_fun03_sec04;     
+         } /*Else If: negative input*/
+      }  /*Else If: seed window padding*/
+
       /**************************************************\
       * Fun03 Sec03 Sub03:
       *   - check if help message requested
@@ -1212,6 +1534,9 @@ main(
    signed char dirFlagSC = def_alnDir_mainMemwaterScan;
    float minPercScoreF=def_minPercScore_mainMemwaterScan;
    signed long minScoreSL = def_minScore_mainMemwaterScan;
+   signed long topKSL = def_topK_mainMemwaterScan;
+   unsigned char seedUC = def_seed_mainMemwaterScan;
+   float seedPadF = def_padPerc_seedScan;
 
    signed char didRevBl = 0;
    signed char *qryFileStr = 0;
@@ -1220,6 +1545,9 @@ main(
    signed char *refFileStr = 0;
    signed char refTypeSC = def_fqFile_mainMemwaterScan;
 
+   signed char scoreTblBl = 0; /*1: print scores.tsv rows*/
+   signed char *highFileStr = 0;
+
 
    /*values for final return*/
    signed char dirCharSC = 0;
@@ -1244,8 +1572,16 @@ main(
    struct alnSet setStackST;
    struct aln_memwaterScan alnStackST;
 
+   struct seedScan seedStackST; /*for -seed windows*/
+   signed long winSL = 0;       /*window aligning to*/
+   signed long refEndSL = 0;    /*end of full reference*/
+
    FILE *seqFILE = 0;
    FILE *outFILE = 0;
+   FILE *highFILE = 0;
+   struct outBuf outStackST; /*buffers prints to outFILE*/
+   struct outBuf highStackST;/*buffers prints to highFILE*/
+   struct hitTbl hitStackST; /*hits for -score-tbl*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec02:
@@ -1271,6 +1607,10 @@ main(
    init_seqST(&refStackST);
    init_alnSet(&setStackST);
    init_aln_memwaterScan(&alnStackST);
+   init_outBuf(&outStackST);
+   init_outBuf(&highStackST);
+   init_hitTbl(&hitStackST);
+   init_seedScan(&seedStackST);
 
    /*****************************************************\
    * Main Sec02 Sub02:
@@ -1286,9 +1626,14 @@ main(
          &qryFileStr,
          &qryTypeSC,
          &outFileStr,
+         &scoreTblBl,
+         &highFileStr,
          &minPercScoreF,
          &minScoreSL,
          &filterBl,
+         &topKSL,
+         &seedUC,
+         &seedPadF,
          &dirFlagSC,
          &setStackST
       );
@@ -1525,6 +1870,17 @@ main(
          goto fileErr_main_sec04;
       } /*If: could not open output file*/
    } /*Else: output file input*/
+
+   if(setup_outBuf(&outStackST, 0, outFILE))
+   { /*If: memory error*/
+      fprintf(
+         stderr,
+         "MEMORY ERROR setting up output buffer%s",
+         str_endLine
+      );
+
+      goto memErr_main_sec04;
+   } /*If: memory error*/
   
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec03:
@@ -1544,24 +1900,47 @@ main(
    *   - setup/start loop and prepare for alignment
    \*****************************************************/
 
-   /*print out the header*/
-   fprintf(
-      outFILE,
-      "qry_id\tref_id\tdir\tscore\tperc_score\tmax_score"
-   );
+   if(! scoreTblBl)
+   { /*If: printing alignments; print out the header*/
+      addStr_outBuf(
+         &outStackST,
+         (signed char *)
+            "qry_id\tref_id\tdir\tscore\tperc_score\tmax_score"
+      );
 
-   fprintf(
-      outFILE,
-      "\tref_start\tref_end\tref_len\tqry_start\tqry_end"
-   );
+      addStr_outBuf(
+         &outStackST,
+         (signed char *)
+           "\tref_start\tref_end\tref_len\tqry_start\tqry_end"
+      );
 
-   fprintf(
-      outFILE,
-      "\tqry_len%s",
-      str_endLine
-   );
+      addStr_outBuf(
+         &outStackST,
+         (signed char *) "\tqry_len"
+      );
+      addStr_outBuf(&outStackST, str_endLine);
+   } /*If: printing alignments; print out the header*/
+   /*else score table rows have no header (appended)*/
 
    seqToIndex_alnSet(refStackST.seqStr);
+   refEndSL = refStackST.endAlnSL;
+
+   if(seedUC)
+   { /*If: seed-and-chain mode; index reference kmers*/
+      seedStackST.kmerLenUC = seedUC;
+      seedStackST.padPercF = seedPadF;
+
+      if(setRef_seedScan(&seedStackST, &refStackST))
+      { /*If: memory error*/
+         fprintf(
+            stderr,
+            "MEMORY ERROR indexing reference kmers%s",
+            str_endLine
+         );
+
+         goto memErr_main_sec04;
+      } /*If: memory error*/
+   } /*If: seed-and-chain mode; index reference kmers*/
 
    do
    { /*Loop: align all query sequences*/
@@ -1593,16 +1972,55 @@ main(
       * Main Sec03 Sub02:
       *   - align and print out alignment
       *   o main sec03 sub02 cat01:
-      *     - align input
+      *     - find seed windows (-seed) and align input
       *   o main sec03 sub02 cat02:
       *     - print the best score for each base
+      *   o main sec03 sub02 cat03:
+      *     - move to the next seed window (-seed)
       \**************************************************/
 
       /*+++++++++++++++++++++++++++++++++++++++++++++++++\
       + Main Sec03 Sub02 Cat01:
-      +   - align input
+      +   - find seed windows (-seed) and align input
       \+++++++++++++++++++++++++++++++++++++++++++++++++*/
 
+      winSL = 0;
+
+      if(seedUC)
+      { /*If: seed-and-chain mode; only align to windows*/
+         if(window_seedScan(&seedStackST, &qryStackST) < 0)
+         { /*If: memory error*/
+            errSC = def_memErr_seqST;
+            break;
+         } /*If: memory error*/
+
+         if(! seedStackST.lenWinSL)
+            goto revAln_main_sec03_sub03; /*no seeds*/
+      } /*If: seed-and-chain mode; only align to windows*/
+
+      nextWin_main_sec03_sub02:;
+
+      if(seedUC)
+      { /*If: seed-and-chain mode; set up window*/
+         refStackST.offsetSL = seedStackST.startArySL[winSL];
+         refStackST.endAlnSL = seedStackST.endArySL[winSL];
+
+         if(refStackST.endAlnSL >= refStackST.seqLenSL - 1)
+            refStackST.endAlnSL = refEndSL;
+            /*keep same reference end as full alignment*/
+
+         ++winSL;
+      } /*If: seed-and-chain mode; set up window*/
+
+      if(topKSL)
+      { /*If: top K mode; only need the top alignments*/
+         alnStackST.topKSL = topKSL;
+         alnStackST.topMinScoreSL =
+            maxScoreSL * minPercScoreF;
+         if(alnStackST.topMinScoreSL < minScoreSL)
+            alnStackST.topMinScoreSL = minScoreSL;
+      } /*If: top K mode; only need the top alignments*/
+
       scoreSL =
          memwaterScan(
             &qryStackST,
@@ -1617,7 +2035,7 @@ main(
          break;
       } /*If: memory error*/
 
-      if(filterBl)
+      if(filterBl && ! topKSL)
       { /*If: filtering alignments*/
          filter_memwaterScan(
             &alnStackST,
@@ -1660,29 +2078,86 @@ main(
             &qryEndUL
          );
 
-         fprintf(
-           outFILE,
-           "%s\t%s\t%c\t%0.2f\t%0.2f\t%li",
-           qryStackST.idStr,
-           refStackST.idStr,
-           dirCharSC,
-           scoreF,
-           percScoreF,
-           maxScoreSL
-         ); /*non-coodinates*/
-         fprintf(
-            outFILE,
-            "\t%lu\t%lu\t%li\t%lu\t%lu\t%li%s",
-            refStartUL + 1,
-            refEndUL + 1,
-            refStackST.seqLenSL,
-            qryStartUL + 1,
-            qryEndUL + 1,
-            qryStackST.seqLenSL,
-            str_endLine
-         );
+         /*windows (-seed) start at refOffsetSI, else 0*/
+         refStartUL += alnStackST.refOffsetSI;
+         refEndUL += alnStackST.refOffsetSI;
+
+         if(scoreTblBl)
+         { /*If: filtering to a score table*/
+            if(
+               add_hitTbl(
+                  &hitStackST,
+                  qryStackST.idStr,
+                  dirCharSC == 'R'
+                     ? def_reverse_hitTbl
+                     : def_forward_hitTbl,
+                     alnStackST.scoreArySL[siNt]
+                   / def_scoreAdj_alnDefs,
+                  maxScoreSL,
+                  (signed long) refStartUL + 1,
+                  (signed long) refEndUL + 1,
+                  (signed long) qryStartUL + 1,
+                  (signed long) qryEndUL + 1,
+                  qryStackST.seqLenSL,
+                  (signed long) (refEndUL - refStartUL) + 1
+               )
+            ){ /*If: memory error*/
+               fprintf(
+                  stderr,
+                  "MEMORY ERROR saving hit for %li%s",
+                  seqSL,
+                  str_endLine
+               );
+
+               goto memErr_main_sec04;
+            } /*If: memory error*/
+
+            continue;
+         } /*If: filtering to a score table*/
+
+         addStr_outBuf(&outStackST, qryStackST.idStr);
+         addChar_outBuf(&outStackST, '\t');
+         addStr_outBuf(&outStackST, refStackST.idStr);
+         addChar_outBuf(&outStackST, '\t');
+         addChar_outBuf(&outStackST, dirCharSC);
+         addChar_outBuf(&outStackST, '\t');
+         addDbl_outBuf(&outStackST, scoreF, 2);
+         addChar_outBuf(&outStackST, '\t');
+         addDbl_outBuf(&outStackST, percScoreF, 2);
+         addChar_outBuf(&outStackST, '\t');
+         addSL_outBuf(&outStackST, maxScoreSL);
+            /*non-coodinates*/
+
+         addChar_outBuf(&outStackST, '\t');
+         addUL_outBuf(&outStackST, refStartUL + 1);
+         addChar_outBuf(&outStackST, '\t');
+         addUL_outBuf(&outStackST, refEndUL + 1);
+         addChar_outBuf(&outStackST, '\t');
+         addSL_outBuf(&outStackST, refStackST.seqLenSL);
+
+         addChar_outBuf(&outStackST, '\t');
+         addUL_outBuf(&outStackST, qryStartUL + 1);
+         addChar_outBuf(&outStackST, '\t');
+         addUL_outBuf(&outStackST, qryEndUL + 1);
+         addChar_outBuf(&outStackST, '\t');
+         addSL_outBuf(&outStackST, qryStackST.seqLenSL);
+         addStr_outBuf(&outStackST, str_endLine);
       } /*Loop: print out best scores*/
 
+      /*+++++++++++++++++++++++++++++++++++++++++++++++++\
+      + Main Sec03 Sub02 Cat03:
+      +   - move to the next seed window (-seed)
+      \+++++++++++++++++++++++++++++++++++++++++++++++++*/
+
+      if(seedUC)
+      { /*If: seed-and-chain mode*/
+         if(winSL < seedStackST.lenWinSL)
+            goto nextWin_main_sec03_sub02;
+
+         refStackST.offsetSL = 0;
+         refStackST.endAlnSL = refEndSL;
+      } /*If: seed-and-chain mode*/
+
       /**************************************************\
       * Main Sec03 Sub03:
       *   - get next query sequence
@@ -1729,6 +2204,70 @@ main(
       goto memErr_main_sec04;
    } /*If: memory error*/
 
+   if(scoreTblBl)
+   { /*If: printing score table rows*/
+      /*same filter as sort -n -k 5,5 -k 3,3r | awk in
+      `  older mapGene.sh scripts
+      */
+      sort_hitTbl(&hitStackST, 0, def_refSort_hitTbl);
+      overlap_hitTbl(&hitStackST, 0);
+
+      for(seqSL = 0; seqSL < hitStackST.lenSL; ++seqSL)
+         pRow_hitTbl(&hitStackST, seqSL, &outStackST);
+
+      if(highFileStr)
+      { /*If: printing the highest scoring rows*/
+         highFILE = fopen((char *) highFileStr, "a");
+
+         if(! highFILE)
+         { /*If: could not open file*/
+            fprintf(
+               stderr,
+               "unable to open -high-tbl %s%s",
+               highFileStr,
+               str_endLine
+            );
+
+            goto fileErr_main_sec04;
+         } /*If: could not open file*/
+
+         if(setup_outBuf(&highStackST, 0, highFILE))
+         { /*If: memory error*/
+            fprintf(
+               stderr,
+               "MEMORY ERROR setting up -high-tbl buffer%s",
+               str_endLine
+            );
+
+            goto memErr_main_sec04;
+         } /*If: memory error*/
+
+         pHigh_hitTbl(&hitStackST, 0, &highStackST);
+
+         if(flush_outBuf(&highStackST))
+         { /*If: could not write output*/
+            fprintf(
+               stderr,
+               "error writing to -high-tbl%s",
+               str_endLine
+            );
+
+            goto fileErr_main_sec04;
+         } /*If: could not write output*/
+      } /*If: printing the highest scoring rows*/
+   } /*If: printing score table rows*/
+
+   if(flush_outBuf(&outStackST))
+   { /*If: could not write output*/
+      fprintf(
+         stderr,
+         "error writing alignments to -out%s",
+         str_endLine
+      );
+
+      goto fileErr_main_sec04;
+   } /*If: could not write output*/
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec04:
    ^   - clean up
@@ -1747,6 +2286,13 @@ main(
       goto cleanUp_main_sec04;
 
    cleanUp_main_sec04:;
+      if(outStackST.bufStr)
+         flush_outBuf(&outStackST);
+      freeStack_outBuf(&outStackST);
+      freeStack_outBuf(&highStackST);
+      freeStack_hitTbl(&hitStackST);
+      freeStack_seedScan(&seedStackST);
+
       freeStack_seqST(&qryStackST);
       freeStack_seqST(&refStackST);
       freeStack_alnSet(&setStackST);
@@ -1767,7 +2313,16 @@ main(
       else fclose(outFILE);
    
       outFILE = 0;
+
+      if(highFILE)
+         fclose(highFILE);
+      highFILE = 0;
    
+      pReport_memTag(
+         (signed char *) "memwaterScan",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
       return errSC;
 } /*main*/
 
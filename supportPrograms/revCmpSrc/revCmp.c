@@ -28,6 +28,8 @@
 #include <stdio.h>
 
 #include "../genLib/ulCp.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
 #include "../genBio/seqST.h"
 
 /*.h files only*/
@@ -38,6 +40,7 @@
 ! Hidden Libraries:
 !   - .c  #include "../genLib/fileFun.h"
 !   - .c  #include "../genLib/ulCp.h"
+!   - .c  #include "../genLib/numToStr.h"
 \%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
 
 /*--------------------------------------------------------\
@@ -183,6 +186,7 @@ int main(
    FILE *inFILE = 0;
    FILE *outFILE = stdout;
    struct seqST seqStackST;
+   struct outBuf outStackST;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec02:
@@ -190,6 +194,7 @@ int main(
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    init_seqST(&seqStackST);
+   init_outBuf(&outStackST);
 
    if(numArgsSI < 2)
    { /*If: printing help message*/
@@ -284,6 +289,9 @@ int main(
       goto clean_main_sec04;
    } /*Else If: version number requested*/
 
+   if(setup_outBuf(&outStackST, 0, outFILE))
+      goto memErr_main_sec04;
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec03:
    ^  - Get and reverse complement fasta entries
@@ -334,14 +342,15 @@ int main(
 
          revComp_seqST(&seqStackST);
 
-         fprintf(
-            outFILE,
-            ">%s%s%s%s",
-            seqStackST.idStr,
-            str_endLine,
+         addChar_outBuf(&outStackST, '>');
+         addStr_outBuf(&outStackST, seqStackST.idStr);
+         addStr_outBuf(&outStackST, str_endLine);
+         addLenStr_outBuf(
+            &outStackST,
             seqStackST.seqStr,
-            str_endLine
-         ); /*Print out the sequence*/
+            seqStackST.seqLenSL
+         );
+         addStr_outBuf(&outStackST, str_endLine);
 
          blank_seqST(&seqStackST);
          errSC = getFa_seqST(inFILE, &seqStackST);
@@ -362,6 +371,17 @@ int main(
    ^  - Clean up and exit
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+   if(flush_outBuf(&outStackST))
+   { /*If: could not write the output*/
+      fprintf(
+         stderr,
+         "failed to write output%s",
+         str_endLine
+      );
+      errSC = 2;
+      goto clean_main_sec04;
+   } /*If: could not write the output*/
+
    errSC = 0;
    goto clean_main_sec04;
 
@@ -416,6 +436,10 @@ int main(
       goto clean_main_sec04;
 
    clean_main_sec04:;
+      if(outStackST.bufStr)
+         flush_outBuf(&outStackST);
+      freeStack_outBuf(&outStackST);
+
       freeStack_seqST(&seqStackST);
 
       if(! inFILE) ;
@@ -432,6 +456,11 @@ int main(
       else fclose(outFILE);
       outFILE = 0;
 
+      pReport_memTag(
+         (signed char *) "revCmp",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
       return errSC;
 } /*main*/
 
@@ -0,0 +1,708 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' mainSamBin SOF: Start Of File
+'   - converts sam files to binary sam files and binary
+'     sam files back to sam files
+'   o header:
+'     - included libraries
+'   o fun01: pversion_mainSamBin
+'     - print version number for samBin
+'   o fun02: phelp_mainSamBin
+'     - print help message for samBin
+'   o fun03: input_mainSamBin
+'     - get user input from the aguments array
+'   o main:
+'     - driver function for samBin
+'   o license:
+'     - licensing for this code (public domain / mit)
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*-------------------------------------------------------\
+| Header:
+|   - included libraries
+\-------------------------------------------------------*/
+
+#ifdef PLAN9
+   #include <u.h>
+   #include <libc.h>
+#else
+   #include <stdlib.h>
+#endif
+
+#include <stdio.h>
+
+#include "../genLib/ulCp.h"
+#include "../genBio/samEntry.h"
+
+/*.h files only*/
+#include "../genLib/endLine.h"
+#include "../bioTools.h"
+
+/*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
+! Hidden Libraries:
+!   - .c  #include "../genLib/base10str.h"
+!   - .c  #include "../genLib/numToStr.h"
+!   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genBio/ntTo5Bit.h"
+\%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%*/
+
+/*-------------------------------------------------------\
+| Fun01: pversion_mainSamBin
+|   - print version number for samBin
+| Input:
+|   - outFILE:
+|     o FILE pointer to file to print version number to
+| Output:
+|   - Prints:
+|     o version number to outFILE
+\-------------------------------------------------------*/
+void
+pversion_mainSamBin(
+   void *outFILE
+){
+   fprintf(
+      (FILE *) outFILE,
+      "samBin from bioTools version: %i-%02i-%02i%s",
+      def_year_bioTools,
+      def_month_bioTools,
+      def_day_bioTools,
+      str_endLine
+   );
+} /*pversion_mainSamBin*/
+
+/*-------------------------------------------------------\
+| Fun02: phelp_mainSamBin
+|   - print help message for samBin
+| Input:
+|   - outFILE:
+|     o FILE pointer to file to print help message to
+| Output:
+|   - Prints:
+|     o help message to outFILE
+\-------------------------------------------------------*/
+void
+phelp_mainSamBin(
+   void *outFILE
+){
+   fprintf(
+      (FILE *) outFILE,
+      "samBin -sam reads.sam -out reads.samb%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "samBin -bin reads.samb -out reads.sam%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "  - converts sam files to and from binary sam%s",
+      str_endLine
+   );
+
+   fprintf((FILE *) outFILE, "Input:%s", str_endLine);
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -sam reads.sam: [Required; or -bin]%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o sam file to convert to binary sam%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o use \"-sam -\" for stdin input%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -bin reads.samb: [Required; or -sam]%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o binary sam file to convert to sam%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o use \"-bin -\" for stdin input%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -out file: [Optional; stdout]%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    o file to save the converted entries to%s",
+      str_endLine
+   );
+
+   fprintf(
+      (FILE *) outFILE,
+      "  -h: print this help message and exit%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "  -v: print version number and exit%s",
+      str_endLine
+   );
+
+   fprintf((FILE *) outFILE, "Output:%s", str_endLine);
+   fprintf(
+      (FILE *) outFILE,
+      "  - prints converted entries to -out%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "  - lower case bases and \"=\" bases are printed%s",
+      str_endLine
+   );
+   fprintf(
+      (FILE *) outFILE,
+      "    as upper case and N after a round trip%s",
+      str_endLine
+   );
+} /*phelp_mainSamBin*/
+
+/*-------------------------------------------------------\
+| Fun03: input_mainSamBin
+|   - get user input from the aguments array
+| Input:
+|   - argLenSI:
+|     o number of arguments the user input
+|   - argAryStr:
+|     o c-string array with user input
+|   - inFileStrPtr:
+|     o c-string pointer to point to the input file
+|   - toBinBlPtr:
+|     o signed char pointer to set to
+|       * 1 if converting sam to binary sam (-sam)
+|       * 0 if converting binary sam to sam (-bin)
+|   - outFileStrPtr:
+|     o c-string pointer to point to the output file
+| Output:
+|   - Modifies:
+|     o all input pointers to have the user input
+|   - Prints:
+|     o help message or version number to stdout
+|     o errors to stderr
+|   - Returns:
+|     o 0 for no errors
+|     o 1 if printed help message or version number
+|     o 2 if had input error
+\-------------------------------------------------------*/
+signed char
+input_mainSamBin(
+   signed int argLenSI,
+   char *argAryStr[],
+   signed char **inFileStrPtr,  /*file to convert*/
+   signed char *toBinBlPtr,     /*1: sam to binary*/
+   signed char **outFileStrPtr  /*file to save to*/
+){
+   signed int siArg = 1;
+
+   if(argLenSI < 2)
+      goto phelp_fun03;
+
+   while(siArg < argLenSI)
+   { /*Loop: get user input*/
+      if(
+         ! eqlNull_ulCp(
+            (signed char *) "-sam",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*If: sam file input*/
+         ++siArg;
+         if(siArg >= argLenSI)
+            goto noArg_fun03;
+
+         *inFileStrPtr = (signed char *) argAryStr[siArg];
+         *toBinBlPtr = 1;
+      }  /*If: sam file input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-bin",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: binary sam file input*/
+         ++siArg;
+         if(siArg >= argLenSI)
+            goto noArg_fun03;
+
+         *inFileStrPtr = (signed char *) argAryStr[siArg];
+         *toBinBlPtr = 0;
+      }  /*Else If: binary sam file input*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-out",
+            (signed char *) argAryStr[siArg]
+         )
+      ){ /*Else If: output file*/
+         ++siArg;
+         if(siArg >= argLenSI)
+            goto noArg_fun03;
+
+         *outFileStrPtr = (signed char *) argAryStr[siArg];
+      }  /*Else If: output file*/
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--h",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--help",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto phelp_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--v",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "-version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03;
+
+      else if(
+         ! eqlNull_ulCp(
+            (signed char *) "--version",
+            (signed char *) argAryStr[siArg]
+         )
+      ) goto pversion_fun03;
+
+      else
+      { /*Else: invalid input*/
+         fprintf(
+            stderr,
+            "%s is not recognized%s",
+            argAryStr[siArg],
+            str_endLine
+         );
+
+         goto err_fun03;
+      } /*Else: invalid input*/
+
+      ++siArg;
+   } /*Loop: get user input*/
+
+   if(! *inFileStrPtr)
+   { /*If: no input file*/
+      fprintf(
+         stderr,
+         "no -sam or -bin file input%s",
+         str_endLine
+      );
+
+      goto err_fun03;
+   } /*If: no input file*/
+
+   return 0;
+
+   phelp_fun03:;
+      phelp_mainSamBin(stdout);
+      return 1;
+   pversion_fun03:;
+      pversion_mainSamBin(stdout);
+      return 1;
+   noArg_fun03:;
+      fprintf(
+         stderr,
+         "%s is missing its file%s",
+         argAryStr[siArg - 1],
+         str_endLine
+      );
+      return 2;
+   err_fun03:;
+      return 2;
+} /*input_mainSamBin*/
+
+/*-------------------------------------------------------\
+| Main:
+|   - driver function for samBin
+| Input:
+|   - argLenSI:
+|     o number of arguments the user input
+|   - argAryStr:
+|     o c-string array with user input
+| Output:
+|   - Prints:
+|     o converted entries to the output file
+|     o errors to stderr
+|   - Returns:
+|     o 0 for no errors
+|     o 1 for an errors
+\-------------------------------------------------------*/
+int
+main(
+   int argLenSI,
+   char *argAryStr[]
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Main TOC:
+   '   - driver function for samBin
+   '   o main sec01:
+   '     - variable declarations
+   '   o main sec02:
+   '     - get user input and open files
+   '   o main sec03:
+   '     - convert entries
+   '   o main sec04:
+   '     - clean up and return
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec01:
+   ^   - variable declarations
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   signed char errSC = 0;
+   signed char *inFileStr = 0;
+   signed char *outFileStr = 0;
+   signed char toBinBl = 1;
+   unsigned long entryUL = 0;
+
+   signed char *buffHeapStr = 0; /*line buffer for view*/
+   signed long sizeBuffSL = 0;
+
+   struct samEntry samStackST;
+   struct view_samEntry viewStackST;
+
+   FILE *inFILE = 0;
+   FILE *outFILE = 0;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec02:
+   ^   - get user input and open files
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   init_samEntry(&samStackST);
+   init_view_samEntry(&viewStackST);
+
+   errSC =
+      input_mainSamBin(
+         argLenSI,
+         argAryStr,
+         &inFileStr,
+         &toBinBl,
+         &outFileStr
+      );
+
+   if(errSC)
+   { /*If: had error or printed help/version*/
+      --errSC; /*help message/version is no error*/
+      goto ret_main_sec04;
+   } /*If: had error or printed help/version*/
+
+   if(inFileStr[0] == '-' && inFileStr[1] == '\0')
+      inFILE = stdin;
+   else
+   { /*Else: input is a file*/
+      if(toBinBl)
+         inFILE = fopen((char *) inFileStr, "r");
+      else
+         inFILE = fopen((char *) inFileStr, "rb");
+
+      if(! inFILE)
+         goto inFileErr_main_sec04;
+   } /*Else: input is a file*/
+
+   if(! outFileStr)
+      outFILE = stdout;
+   else if(outFileStr[0] == '-' && outFileStr[1] == '\0')
+      outFILE = stdout;
+   else
+   { /*Else: output is a file*/
+      if(toBinBl)
+         outFILE = fopen((char *) outFileStr, "wb");
+      else
+         outFILE = fopen((char *) outFileStr, "w");
+
+      if(! outFILE)
+         goto outFileErr_main_sec04;
+   } /*Else: output is a file*/
+
+   if(setup_samEntry(&samStackST))
+      goto memErr_main_sec04;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec03:
+   ^   - convert entries
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   if(toBinBl)
+   { /*If: converting sam to binary sam*/
+      if(pbinHead_samEntry(outFILE))
+         goto writeErr_main_sec04;
+
+      errSC =
+         get_view_samEntry(
+            &viewStackST,
+            &buffHeapStr,
+            &sizeBuffSL,
+            inFILE
+         ); /*reads full lines, so no line is too long*/
+
+      while(! errSC)
+      { /*Loop: convert sam entries*/
+         errSC =
+            toSam_view_samEntry(&viewStackST, &samStackST);
+         if(errSC)
+            break;
+
+         ++entryUL;
+
+         if(pbin_samEntry(&samStackST, outFILE))
+            goto writeErr_main_sec04;
+
+         errSC =
+            get_view_samEntry(
+               &viewStackST,
+               &buffHeapStr,
+               &sizeBuffSL,
+               inFILE
+            );
+      } /*Loop: convert sam entries*/
+   } /*If: converting sam to binary sam*/
+
+   else
+   { /*Else: converting binary sam to sam*/
+      errSC = getBinHead_samEntry(inFILE);
+
+      if(errSC == def_EOF_samEntry)
+         goto noEntries_main_sec04;
+      else if(errSC)
+         goto fileErr_main_sec04;
+
+      errSC = getBin_samEntry(&samStackST, inFILE);
+
+      while(! errSC)
+      { /*Loop: convert binary sam entries*/
+         ++entryUL;
+         p_samEntry(&samStackST, 0, outFILE);
+         errSC = getBin_samEntry(&samStackST, inFILE);
+      } /*Loop: convert binary sam entries*/
+   } /*Else: converting binary sam to sam*/
+
+   if(errSC == def_memErr_samEntry)
+      goto memErr_main_sec04;
+   else if(errSC != def_EOF_samEntry)
+      goto fileErr_main_sec04;
+
+   if(! entryUL)
+      goto noEntries_main_sec04;
+
+   /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+   ^ Main Sec04:
+   ^   - clean up and return
+   \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+   errSC = 0;
+   goto ret_main_sec04;
+
+   memErr_main_sec04:;
+      fprintf(stderr, "memory error%s", str_endLine);
+      errSC = 1;
+      goto ret_main_sec04;
+
+   inFileErr_main_sec04:;
+      fprintf(
+         stderr,
+         "could not open %s%s",
+         inFileStr,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   outFileErr_main_sec04:;
+      fprintf(
+         stderr,
+         "could not open -out %s%s",
+         outFileStr,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   writeErr_main_sec04:;
+      fprintf(
+         stderr,
+         "could not write entry %lu to the output%s",
+         entryUL + 1,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   fileErr_main_sec04:;
+      fprintf(
+         stderr,
+         "entry %lu in %s is not a valid %s entry%s",
+         entryUL + 1,
+         inFileStr,
+         toBinBl ? "sam" : "binary sam",
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   noEntries_main_sec04:;
+      fprintf(
+         stderr,
+         "no entries in %s%s",
+         inFileStr,
+         str_endLine
+      );
+      errSC = 1;
+      goto ret_main_sec04;
+
+   ret_main_sec04:;
+      freeStack_samEntry(&samStackST);
+      freeStack_view_samEntry(&viewStackST);
+
+      if(buffHeapStr)
+         free(buffHeapStr);
+      buffHeapStr = 0;
+
+      if(! inFILE) ;
+      else if(inFILE == stdin) ;
+      else if(inFILE == stdout) ;
+      else if(inFILE == stderr) ;
+      else fclose(inFILE);
+      inFILE = 0;
+
+      if(! outFILE) ;
+      else if(outFILE == stdin) ;
+      else if(outFILE == stdout) ;
+      else if(outFILE == stderr) ;
+      else fclose(outFILE);
+      outFILE = 0;
+
+      return errSC;
+} /*main*/
+
+/*=======================================================\
+: License:
+: 
+: This code is under the unlicense (public domain).
+:   However, for cases were the public domain is not
+:   suitable, such as countries that do not respect the
+:   public domain or were working with the public domain
+:   is inconvient / not possible, this code is under the
+:   MIT license.
+: 
+: Public domain:
+: 
+: This is free and unencumbered software released into the
+:   public domain.
+: 
+: Anyone is free to copy, modify, publish, use, compile,
+:   sell, or distribute this software, either in source
+:   code form or as a compiled binary, for any purpose,
+:   commercial or non-commercial, and by any means.
+: 
+: In jurisdictions that recognize copyright laws, the
+:   author or authors of this software dedicate any and
+:   all copyright interest in the software to the public
+:   domain. We make this dedication for the benefit of the
+:   public at large and to the detriment of our heirs and
+:   successors. We intend this dedication to be an overt
+:   act of relinquishment in perpetuity of all present and
+:   future rights to this software under copyright law.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO
+:   EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM,
+:   DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF
+:   CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR
+:   IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+:   DEALINGS IN THE SOFTWARE.
+: 
+: For more information, please refer to
+:   <https://unlicense.org>
+: 
+: MIT License:
+: 
+: Copyright (c) 2025 jeremyButtler
+: 
+: Permission is hereby granted, free of charge, to any
+:   person obtaining a copy of this software and
+:   associated documentation files (the "Software"), to
+:   deal in the Software without restriction, including
+:   without limitation the rights to use, copy, modify,
+:   merge, publish, distribute, sublicense, and/or sell
+:   copies of the Software, and to permit persons to whom
+:   the Software is furnished to do so, subject to the
+:   following conditions:
+: 
+: The above copyright notice and this permission notice
+:   shall be included in all copies or substantial
+:   portions of the Software.
+: 
+: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF
+:   ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT
+:   LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+:   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO
+:   EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+:   FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN
+:   AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+:   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE
+:   USE OR OTHER DEALINGS IN THE SOFTWARE.
+\=======================================================*/
@@ -9,6 +9,9 @@
 '     - prints out tranSeq's help message
 '   o fun03: input_tranSeq
 '     - gets user input
+'   o fun04: pOrf_tranSeq
+'     - adds a translated reading frame (fasta entry) to
+'       the output buffer
 '   o main:
 '     - translate sequence(s) into amino acids
 '   o license:
@@ -31,6 +34,8 @@
 
 #include "../genLib/base10str.h"
 #include "../genLib/ulCp.h"
+#include "../genLib/outBuf.h"
+#include "../genLib/memTag.h"
 #include "../genBio/codonFun.h"
 #include "../genBio/seqST.h"
 
@@ -41,6 +46,7 @@
 /*%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%\
 ! Hidden Libraries:
 !   - .c  #include "../genLib/fileFun.h"
+!   - .c  #include "../genLib/numToStr.h"
 !   - .h  #include "../genBio/ntTo2Bit.h"
 !   - .h  #include "../genBio/revNtTo2Bit.h"
 !   - .h  #include "../genBio/codonTbl.h"
@@ -960,6 +966,79 @@ input_tranSeq(
       return errSC;
 } /*input_tranSeq*/
 
+/*--------------------------------------------------------\
+| Fun04: pOrf_tranSeq
+|  - adds a translated reading frame (fasta entry) to the
+|    output buffer
+| Input:
+|  - idStr:
+|    o c-string with sequence id (header)
+|  - orfSC:
+|    o reading frame translated (1 to 6)
+|  - startSL:
+|    o first base translated
+|  - endSL:
+|    o last base translated
+|  - forStartSL:
+|    o first base in the forward sequence (ORFs 4 to 6)
+|  - forEndSL:
+|    o last base in the forward sequence (ORFs 4 to 6)
+|  - aaStr:
+|    o c-string with amino acid sequence to print
+|  - outBufSTPtr:
+|    o outBuf struct pointer to print to
+| Output:
+|  - Prints:
+|    o header and amino acid sequence to outBufSTPtr
+\--------------------------------------------------------*/
+void
+pOrf_tranSeq(
+   signed char *idStr,
+   signed char orfSC,
+   signed long startSL,
+   signed long endSL,
+   signed long forStartSL,
+   signed long forEndSL,
+   signed char *aaStr,
+   struct outBuf *outBufSTPtr
+){
+   addChar_outBuf(outBufSTPtr, '>');
+   addStr_outBuf(outBufSTPtr, idStr);
+   addStr_outBuf(outBufSTPtr, (signed char *) "-ORF");
+   addSL_outBuf(outBufSTPtr, orfSC);
+
+   if(orfSC < 4)
+   { /*If: forward reading frame*/
+      addStr_outBuf(outBufSTPtr,(signed char *) "\tstart=");
+      addSL_outBuf(outBufSTPtr, startSL);
+      addStr_outBuf(outBufSTPtr, (signed char *) "\tend=");
+      addSL_outBuf(outBufSTPtr, endSL);
+   } /*If: forward reading frame*/
+
+   else
+   { /*Else: reverse complement reading frame*/
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\trev_start="
+      );
+      addSL_outBuf(outBufSTPtr, startSL);
+      addStr_outBuf(outBufSTPtr,(signed char *)"\trev_end=");
+      addSL_outBuf(outBufSTPtr, endSL);
+
+      addStr_outBuf(
+         outBufSTPtr,
+         (signed char *) "\tfor_start="
+      );
+      addSL_outBuf(outBufSTPtr, forStartSL);
+      addStr_outBuf(outBufSTPtr,(signed char *)"\tfor_end=");
+      addSL_outBuf(outBufSTPtr, forEndSL);
+   } /*Else: reverse complement reading frame*/
+
+   addStr_outBuf(outBufSTPtr, str_endLine);
+   addStr_outBuf(outBufSTPtr, aaStr);
+   addStr_outBuf(outBufSTPtr, str_endLine);
+} /*pOrf_tranSeq*/
+
 /*--------------------------------------------------------\
 | Main:
 |   - translates sequence(s) into amino acids
@@ -1013,14 +1092,16 @@ int main(
    signed char errSC = 0;
    signed long numSeqSL = 0;
 
-   signed char *aaHeapStr = 0;
-   signed long lenAaSL = 0;
-   signed long sizeAaSL = 0;
+   signed char *aaHeapStr = 0;   /*holds all six frames*/
+   signed char *aaAryStr[6];     /*frames in aaHeapStr*/
+   signed long lenArySL[6];      /*length of each frame*/
+   signed long sizeAaSL = 0;     /*size of one frame*/
 
    FILE *seqFILE = 0;
    FILE *outFILE = 0;
 
    struct seqST seqStackST;
+   struct outBuf outStackST;
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec02:
@@ -1043,6 +1124,7 @@ int main(
    \******************************************************/
 
    init_seqST(&seqStackST);
+   init_outBuf(&outStackST);
 
    /******************************************************\
    * Main Sec02 Sub02:
@@ -1124,7 +1206,7 @@ int main(
             "w"
          );
 
-      if(! seqFILE)
+      if(! outFILE)
       { /*If: could no open output file*/
          fprintf(
             stderr,
@@ -1137,6 +1219,9 @@ int main(
       } /*If: could not open output file*/
    } /*Else: user input output file*/
 
+   if(setup_outBuf(&outStackST, 0, outFILE))
+      goto memErr_main_sec0x;
+
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
    ^ Main Sec03:
    ^  - translate all sequences in the fasta file
@@ -1145,20 +1230,14 @@ int main(
    ^  o main sec03 sub02:
    ^    - start loop (memory allocation part of loop)
    ^  o main sec03 sub03:
-   ^    - translate reading frame 1
+   ^    - translate all requested frames (one pass)
    ^  o main sec03 sub04:
-   ^    - translate reading frame 2
+   ^    - print forward reading frames (1 to 3)
    ^  o main sec03 sub05:
-   ^    - translate reading frame 3
+   ^    - find reverse complement coordinates
    ^  o main sec03 sub06:
-   ^    - reverse complement the sequence for ORFs 4 to 6
+   ^    - print reverse reading frames (4 to 6)
    ^  o main sec03 sub07:
-   ^    - translate reading frame 4
-   ^  o main sec03 sub08:
-   ^    - translate reading frame 5
-   ^  o main sec03 sub09:
-   ^    - translate reading frame 6
-   ^  o main sec03 sub10:
    ^    - read in the next sequence to translate
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -1169,13 +1248,10 @@ int main(
 
    errSC = getFa_seqST(seqFILE, &seqStackST);
 
-   aaHeapStr =
-      malloc(
-         (seqStackST.seqLenSL + 9) * sizeof(signed char)
-      );
+   sizeAaSL = (seqStackST.seqLenSL / 3) + 2;
+   aaHeapStr = malloc(6 * sizeAaSL * sizeof(signed char));
    if(! aaHeapStr)
       goto memErr_main_sec0x;
-   sizeAaSL = seqStackST.seqLenSL;
 
    if(errSC == def_EOF_seqST)
    { /*If: read end of file*/
@@ -1207,23 +1283,20 @@ int main(
    { /*Loop: translate all sequences in fasta file*/
       ++numSeqSL;
 
-      if(sizeAaSL < (signed long) seqStackST.seqLenSL)
+      if(sizeAaSL < (seqStackST.seqLenSL / 3) + 2)
       { /*If: need more memory*/
          free(aaHeapStr);
          aaHeapStr = 0;
 
+         sizeAaSL = (seqStackST.seqLenSL / 3) + 2;
          aaHeapStr =
-            malloc(
-                 (seqStackST.seqLenSL + 9)
-               * sizeof(signed char)
-            );
+            malloc(6 * sizeAaSL * sizeof(signed char));
          if(! aaHeapStr)
             goto memErr_main_sec0x;
-         sizeAaSL = seqStackST.seqLenSL;
       } /*If: need more memory*/
 
       if(seqStackST.seqLenSL < startSL)
-         goto nextSeq_main_sec03_sub09;
+         goto nextSeq_main_sec03_sub07;
          /*can not translate*/
 
       tmpStartSL = startSL;
@@ -1236,251 +1309,145 @@ int main(
 
       /***************************************************\
       * Main Sec03 Sub03:
-      *  - translate reading frame 1
+      *  - translate all requested frames (one pass)
       \***************************************************/
 
-      if(orf1Bl)
-      { /*If: translating orf 1*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL,
-               tmpEndSL
-            ); /*Get the aa sequence for ORF 1*/
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
+      /*each frame gets its own part of aaHeapStr; frames
+      `  the user did not request are skipped (null)
+      */
+      aaAryStr[0] = orf1Bl ? aaHeapStr : 0;
+      aaAryStr[1] = orf2Bl ? aaHeapStr + sizeAaSL : 0;
+      aaAryStr[2] = orf3Bl ? aaHeapStr + 2 * sizeAaSL : 0;
+      aaAryStr[3] = orf4Bl ? aaHeapStr + 3 * sizeAaSL : 0;
+      aaAryStr[4] = orf5Bl ? aaHeapStr + 4 * sizeAaSL : 0;
+      aaAryStr[5] = orf6Bl ? aaHeapStr + 5 * sizeAaSL : 0;
+
+      sixFrame_codonFun(
+         seqStackST.seqStr,
+         tmpStartSL,
+         tmpEndSL,
+         aaAryStr,
+         lenArySL
+      );
 
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF1\tstart=%li\tend=%li%s%s%s",
+      /***************************************************\
+      * Main Sec03 Sub04:
+      *  - print forward reading frames (1 to 3)
+      \***************************************************/
+
+      if(orf1Bl)
+         pOrf_tranSeq(
             seqStackST.idStr,
+            1,
             tmpStartSL,
             tmpEndSL,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            0,
+            0,
+            aaAryStr[0],
+            &outStackST
          );
-      } /*If: translating orf 1*/
-
-      /***************************************************\
-      * Main Sec03 Sub04:
-      *  - Translate reading frame 2
-      \***************************************************/
 
       if(orf2Bl)
-      { /*If: I am working on reading frame 2*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL + 1,
-               tmpEndSL
-            );
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
-
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF2\tstart=%li\tend=%li%s%s%s",
+         pOrf_tranSeq(
             seqStackST.idStr,
+            2,
             tmpStartSL + 1,
             tmpEndSL,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            0,
+            0,
+            aaAryStr[1],
+            &outStackST
          );
-      } /*If: I am working on reading frame 2*/
-
-      /***************************************************\
-      * Main Sec03 Sub05:
-      *  - Translate reading frame 3
-      \***************************************************/
 
       if(orf3Bl)
-      { /*If: I am working on reading frame 3*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL + 2,
-               tmpEndSL
-            );
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
-
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF3\tstart=%li\tend=%li%s%s%s",
+         pOrf_tranSeq(
             seqStackST.idStr,
+            3,
             tmpStartSL + 2,
             tmpEndSL,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            0,
+            0,
+            aaAryStr[2],
+            &outStackST
          );
-      } /*If: I am working on reading frame 3*/
 
       /***************************************************\
-      * Main Sec03 Sub06:
-      *  - Reverse complement the sequence for ORFs 4 to 6
+      * Main Sec03 Sub05:
+      *  - find reverse complement coordinates
       \***************************************************/
 
-      /*Check if I am printing the reverse reading frames*/
-      if(orf4Bl || orf5Bl || orf6Bl)
-      { /*If: need to reverse complment the sequence*/
-         revComp_seqST(&seqStackST);
-
-         if(! startSL && ! endSL)
-            ; /*entire sequence no conversion needed*/
-
-         else if(startSL && endSL)
-         { /*Else If: adjust and swap coordinates*/
-            /*need to refind stat and end coordinates*/
-            tmpStartSL = seqStackST.seqLenSL - tmpEndSL;
-            revEndSL = seqStackST.seqLenSL - startSL;
-         } /*Else If: adjust and swap coordinates*/
-
-         else if(startSL)
-         { /*Else If: only using starting coordinate*/
-            revEndSL = seqStackST.seqLenSL - startSL;
-            tmpStartSL = 0;
-         } /*Else If: only using starting coordinate*/
-
-         else
-         { /*Else: only using ending coordinate*/
-            tmpStartSL = seqStackST.seqLenSL - tmpEndSL;
-            revEndSL = 0;
-         } /*Else: only using ending coordinate*/
-      }  /*If: need to reverse complment the sequence*/
+      if(! orf4Bl && ! orf5Bl && ! orf6Bl)
+         goto nextSeq_main_sec03_sub07;
+
+      if(! startSL && ! endSL)
+         ; /*entire sequence no conversion needed*/
+
+      else if(startSL && endSL)
+      { /*Else If: adjust and swap coordinates*/
+         /*need to refind stat and end coordinates*/
+         tmpStartSL = seqStackST.seqLenSL - tmpEndSL;
+         revEndSL = seqStackST.seqLenSL - startSL;
+      } /*Else If: adjust and swap coordinates*/
+
+      else if(startSL)
+      { /*Else If: only using starting coordinate*/
+         revEndSL = seqStackST.seqLenSL - startSL;
+         tmpStartSL = 0;
+      } /*Else If: only using starting coordinate*/
 
       else
-         goto nextSeq_main_sec03_sub09;
+      { /*Else: only using ending coordinate*/
+         tmpStartSL = seqStackST.seqLenSL - tmpEndSL;
+         revEndSL = 0;
+      } /*Else: only using ending coordinate*/
 
       /***************************************************\
-      * Main Sec03 Sub07:
-      *  - Translate reading frame 4
+      * Main Sec03 Sub06:
+      *  - print reverse reading frames (4 to 6)
       \***************************************************/
 
       if(orf4Bl)
-      { /*If: I am working on reading frame 4*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL,
-               revEndSL
-            );
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
-
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF4\trev_start=%li\trev_end=%li",
+         pOrf_tranSeq(
             seqStackST.idStr,
+            4,
             tmpStartSL,
-            revEndSL
-         );
-         fprintf(
-            (FILE *) outFILE,
-            "\tfor_start=%li\tfor_end=%li%s%s%s",
+            revEndSL,
             startSL,
             tmpEndSL,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            aaAryStr[3],
+            &outStackST
          );
-      } /*If: I am working on reading frame 4*/
-
-      /***************************************************\
-      * Main Sec03 Sub08:
-      *  - Translate reading frame 5
-      \***************************************************/
 
       if(orf5Bl)
-      { /*If: I am working on reading frame 5*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL + 1,
-               revEndSL
-            );
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
-
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF5\trev_start=%li\trev_end=%li",
+         pOrf_tranSeq(
             seqStackST.idStr,
+            5,
             tmpStartSL + 1,
-            revEndSL
-         );
-
-         fprintf(
-            (FILE *) outFILE,
-            "\tfor_start=%li\tfor_end=%li%s%s%s",
+            revEndSL,
             startSL,
             tmpEndSL - 1,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            aaAryStr[4],
+            &outStackST
          );
-      } /*If: I am working on reading frame 5*/
-
-      /***************************************************\
-      * Main Sec03 Sub09:
-      *  - Translate reading frame 6
-      \***************************************************/
 
       if(orf6Bl)
-      { /*If: I am working on reading frame 6*/
-         lenAaSL =
-            seqToAA_codonFun(
-               seqStackST.seqStr,
-               aaHeapStr,
-               tmpStartSL + 2,
-               revEndSL
-            );
-      
-         if(lenAaSL == def_unkownNt_codonFun)
-            goto invalidNt_main_sec0x;
-         /*else no error or spare bases at end*/
-
-         fprintf(
-            (FILE *) outFILE,
-            ">%s-ORF6\trev_start=%li\trev_end=%li",
+         pOrf_tranSeq(
             seqStackST.idStr,
+            6,
             tmpStartSL + 2,
-            revEndSL
-         );
-         fprintf(
-            (FILE *) outFILE,
-            "\tfor_start=%li\tfor_end=%li%s%s%s",
+            revEndSL,
             startSL,
             tmpEndSL - 2,
-            str_endLine,
-            aaHeapStr,
-            str_endLine
+            aaAryStr[5],
+            &outStackST
          );
-      } /*If: I am working on reading frame 5*/
 
       /***************************************************\
-      * Main Sec03 Sub10:
+      * Main Sec03 Sub07:
       *  - Read in the next sequence to translate
       \***************************************************/
 
-      nextSeq_main_sec03_sub09:;
+      nextSeq_main_sec03_sub07:;
          blank_seqST(&seqStackST);
          errSC = getFa_seqST(seqFILE, &seqStackST);
    } /*Loop: translate all sequences in fasta file*/
@@ -1493,6 +1460,17 @@ int main(
    if(errSC != def_EOF_seqST)
       goto readErr_main_sec0x;
 
+   if(flush_outBuf(&outStackST))
+   { /*If: could not write to output file*/
+      fprintf(
+         stderr,
+         "could not write to -out%s",
+         str_endLine
+      );
+
+      goto err_main_sec0x;
+   } /*If: could not write to output file*/
+
    errSC = 0;
    goto ret_main_sec0x;
 
@@ -1518,22 +1496,15 @@ int main(
 
       goto err_main_sec0x;
 
-   invalidNt_main_sec0x:;
-      fprintf(
-         stdout,
-         "sequence %li in -fa %s has an unknown base%s",
-         numSeqSL,
-         faFileStr,
-         str_endLine
-      ); /*Print out the error*/
-
-      goto err_main_sec0x;
-
    err_main_sec0x:;
       errSC = 1;
       goto ret_main_sec0x;
 
    ret_main_sec0x:;
+      if(outStackST.bufStr)
+         flush_outBuf(&outStackST);
+      freeStack_outBuf(&outStackST);
+
       if(aaHeapStr)
          free(aaHeapStr);
       aaHeapStr = 0;
@@ -1556,5 +1527,10 @@ int main(
       ) fclose(outFILE);
       outFILE = 0;
 
+      pReport_memTag(
+         (signed char *) "tranSeq",
+         stderr
+      ); /*only prints if built with -DMEMTAG*/
+
       return errSC;
 } /*main*/